@@ -0,0 +1,310 @@
+// ============================================================================
+// Bridge API Micro-Benchmark Harness
+// ============================================================================
+// Measures ns/op for the exported mdb_* families — class/method/field
+// resolution, invocation (runtime, direct, vtable), field access and array
+// exports — with mean, standard deviation and a 95% confidence interval over
+// repeated batches. Cold numbers (first lookup, index build) are reported
+// once per process; warm numbers time the steady-state cached paths.
+//
+// Usage:
+//   MDB_Bench_Bridge.exe
+//
+// The harness loads GameAssembly.dll from its own directory; the build drops
+// the mock from mock_game_assembly.cpp there, so the full bridge export
+// surface runs in-process against constant-time callees — the measured time
+// is bridge overhead, which is the part a bridge change can regress. Running
+// the exe from a real game's folder instead picks up the game's
+// GameAssembly.dll for representative absolute numbers.
+//
+// The bridge's named init-guard event is claimed before MDB_Bridge.dll is
+// loaded, so its background initialization thread (CLR host and all) stays
+// out of the timings; the harness drives mdb_init itself.
+
+#include <Windows.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// ====================================
+// Statistics
+// ====================================
+
+struct BenchResult {
+    double mean_ns;
+    double stddev_ns;
+    double ci95_ns;
+};
+
+/// Time `reps` batches of `inner` calls each; statistics are computed over
+/// the per-batch means, so the CI reflects run-to-run scheduling noise.
+template <class F>
+BenchResult MeasureNs(F&& op, int inner = 1000, int reps = 30) {
+    // Warm-up batch: first-touch caches, page-in, branch predictors
+    for (int i = 0; i < inner; i++) op();
+
+    std::vector<double> samples;
+    samples.reserve(reps);
+    for (int r = 0; r < reps; r++) {
+        auto start = Clock::now();
+        for (int i = 0; i < inner; i++) op();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(ns / inner);
+    }
+
+    double mean = 0.0;
+    for (double s : samples) mean += s;
+    mean /= samples.size();
+
+    double var = 0.0;
+    for (double s : samples) var += (s - mean) * (s - mean);
+    var /= (samples.size() > 1 ? samples.size() - 1 : 1);
+    double stddev = std::sqrt(var);
+
+    return { mean, stddev, 1.96 * stddev / std::sqrt(static_cast<double>(samples.size())) };
+}
+
+void Report(const char* label, const BenchResult& r) {
+    printf("  %-36s %10.1f ns/op  ±%7.1f ns (95%% CI)\n", label, r.mean_ns, r.ci95_ns);
+}
+
+void ReportOnce(const char* label, double ms) {
+    printf("  %-36s %10.2f ms (single-shot, cold)\n", label, ms);
+}
+
+// ====================================
+// Bridge export table (resolved from MDB_Bridge.dll at runtime; signatures
+// match bridge_exports.h)
+// ====================================
+
+struct MdbInvokeCommand {
+    void* method;
+    void* instance;
+    void** args;
+    void* result;
+    void* exception;
+};
+
+struct MdbFieldRecord {
+    void* field;
+    const char* name;
+    void* type;
+    int offset;
+    int flags;
+    int is_static;
+};
+
+struct MdbMethodRecord {
+    void* method;
+    const char* name;
+    void* return_type;
+    unsigned long long rva;
+    int param_count;
+    int flags;
+};
+
+struct Bridge {
+    HMODULE module = nullptr;
+
+    int (*init)() = nullptr;
+    void* (*find_class)(const char*, const char*, const char*) = nullptr;
+    void* (*get_method)(void*, const char*, int) = nullptr;
+    void* (*get_field)(void*, const char*) = nullptr;
+    void* (*invoke_method)(void*, void*, void**, void**) = nullptr;
+    void* (*invoke_method_direct)(void*, void*, void**, int) = nullptr;
+    int (*invoke_batch)(MdbInvokeCommand*, int) = nullptr;
+    int (*method_get_vtable_slot)(void*) = nullptr;
+    void* (*invoke_virtual_direct)(void*, int, void**, int) = nullptr;
+    void (*field_get_value)(void*, void*, void*) = nullptr;
+    bool (*field_get_value_direct)(void*, void*, void*, int) = nullptr;
+    int (*array_length)(void*) = nullptr;
+    void* (*array_get_element)(void*, int) = nullptr;
+    int (*array_copy)(void*, int, int, void*) = nullptr;
+    int (*class_enum_fields)(void*, MdbFieldRecord*, int) = nullptr;
+    int (*class_enum_methods)(void*, MdbMethodRecord*, int) = nullptr;
+    const char* (*get_last_error)() = nullptr;
+
+    bool Resolve() {
+        module = LoadLibraryW(L"MDB_Bridge.dll");
+        if (!module) {
+            fprintf(stderr, "Failed to load MDB_Bridge.dll (GetLastError=%lu)\n", GetLastError());
+            return false;
+        }
+        bool ok = true;
+        auto bind = [&](auto& slot, const char* name) {
+            slot = reinterpret_cast<std::remove_reference_t<decltype(slot)>>(GetProcAddress(module, name));
+            if (!slot) {
+                fprintf(stderr, "Missing bridge export: %s\n", name);
+                ok = false;
+            }
+        };
+        bind(init, "mdb_init");
+        bind(find_class, "mdb_find_class");
+        bind(get_method, "mdb_get_method");
+        bind(get_field, "mdb_get_field");
+        bind(invoke_method, "mdb_invoke_method");
+        bind(invoke_method_direct, "mdb_invoke_method_direct");
+        bind(invoke_batch, "mdb_invoke_batch");
+        bind(method_get_vtable_slot, "mdb_method_get_vtable_slot");
+        bind(invoke_virtual_direct, "mdb_invoke_virtual_direct");
+        bind(field_get_value, "mdb_field_get_value");
+        bind(field_get_value_direct, "mdb_field_get_value_direct");
+        bind(array_length, "mdb_array_length");
+        bind(array_get_element, "mdb_array_get_element");
+        bind(array_copy, "mdb_array_copy");
+        bind(class_enum_fields, "mdb_class_enum_fields");
+        bind(class_enum_methods, "mdb_class_enum_methods");
+        bind(get_last_error, "mdb_get_last_error");
+        return ok;
+    }
+};
+
+// Sink that keeps the optimizer from deleting the measured calls
+volatile uintptr_t g_sink;
+
+} // anonymous namespace
+
+int main() {
+    // Claim the bridge's process-wide init guard first, so loading the DLL
+    // does not spawn its background initialization thread (see dllmain.cpp)
+    HANDLE initGuard = CreateEventW(nullptr, TRUE, FALSE, L"Local\\MDB_Bridge_InitGuard");
+    (void)initGuard;
+
+    HMODULE gameAssembly = LoadLibraryW(L"GameAssembly.dll");
+    if (!gameAssembly) {
+        fprintf(stderr, "GameAssembly.dll not found next to the benchmark.\n");
+        fprintf(stderr, "Build drops the mock there; or run from a game folder.\n");
+        return 1;
+    }
+
+    Bridge bridge;
+    if (!bridge.Resolve()) return 1;
+
+    // Mock-only fixture helpers; absent when running against a real game
+    auto* createPlayer = reinterpret_cast<void* (*)()>(GetProcAddress(gameAssembly, "mock_create_player"));
+    auto* createArray = reinterpret_cast<void* (*)(int)>(GetProcAddress(gameAssembly, "mock_create_int32_array"));
+    const bool mockMode = createPlayer != nullptr;
+    printf("Mode: %s GameAssembly\n\n", mockMode ? "mock" : "real");
+
+    // --- Initialization (cold, includes scanner init + export binding) ---
+    printf("[Initialization]\n");
+    auto start = Clock::now();
+    int initResult = bridge.init();
+    double initMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (initResult != 0) {
+        fprintf(stderr, "mdb_init failed: %s\n", bridge.get_last_error());
+        return 1;
+    }
+    ReportOnce("mdb_init", initMs);
+
+    const char* assembly = mockMode ? "MockAssembly" : "mscorlib";
+    const char* ns = mockMode ? "Mock" : "System";
+    const char* className = mockMode ? "Player" : "String";
+
+    // --- Class resolution: cold (index build) vs warm (cache hit) ---
+    printf("\n[Class resolution]\n");
+    start = Clock::now();
+    void* klass = bridge.find_class(assembly, ns, className);
+    ReportOnce("mdb_find_class (cold, builds index)",
+               std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    if (!klass) {
+        fprintf(stderr, "find_class failed: %s\n", bridge.get_last_error());
+        return 1;
+    }
+    Report("mdb_find_class (warm)", MeasureNs([&] {
+        g_sink = reinterpret_cast<uintptr_t>(bridge.find_class(assembly, ns, className));
+    }));
+
+    // --- Member resolution ---
+    const char* methodName = mockMode ? "GetHealth" : "GetHashCode";
+    const char* virtualName = "ToString";
+    const char* fieldName = mockMode ? "health" : "_stringLength";
+    printf("\n[Member resolution]\n");
+    Report("mdb_get_method (warm)", MeasureNs([&] {
+        g_sink = reinterpret_cast<uintptr_t>(bridge.get_method(klass, methodName, 0));
+    }));
+    Report("mdb_get_field (warm)", MeasureNs([&] {
+        g_sink = reinterpret_cast<uintptr_t>(bridge.get_field(klass, fieldName));
+    }));
+    Report("mdb_class_enum_fields", MeasureNs([&] {
+        MdbFieldRecord records[16];
+        g_sink = static_cast<uintptr_t>(bridge.class_enum_fields(klass, records, 16));
+    }));
+    Report("mdb_class_enum_methods", MeasureNs([&] {
+        MdbMethodRecord records[16];
+        g_sink = static_cast<uintptr_t>(bridge.class_enum_methods(klass, records, 16));
+    }));
+
+    void* method = bridge.get_method(klass, methodName, 0);
+    void* virtualMethod = bridge.get_method(klass, virtualName, 0);
+    void* field = bridge.get_field(klass, fieldName);
+
+    // --- Invocation: runtime invoke vs direct vs vtable dispatch ---
+    void* instance = nullptr;
+    if (mockMode && createPlayer) instance = createPlayer();
+
+    if (instance && method) {
+        printf("\n[Invocation]\n");
+        Report("mdb_invoke_method (runtime invoke)", MeasureNs([&] {
+            void* exc = nullptr;
+            g_sink = reinterpret_cast<uintptr_t>(bridge.invoke_method(method, instance, nullptr, &exc));
+        }));
+        Report("mdb_invoke_method_direct", MeasureNs([&] {
+            g_sink = reinterpret_cast<uintptr_t>(bridge.invoke_method_direct(method, instance, nullptr, 0));
+        }));
+        MdbInvokeCommand commands[8];
+        Report("mdb_invoke_batch (batch of 8)", MeasureNs([&] {
+            for (auto& cmd : commands) cmd = { method, instance, nullptr, nullptr, nullptr };
+            g_sink = static_cast<uintptr_t>(bridge.invoke_batch(commands, 8));
+        }, 125));
+        int slot = virtualMethod ? bridge.method_get_vtable_slot(virtualMethod) : -1;
+        if (slot >= 0) {
+            Report("mdb_invoke_virtual_direct (vtable)", MeasureNs([&] {
+                g_sink = reinterpret_cast<uintptr_t>(bridge.invoke_virtual_direct(instance, slot, nullptr, 0));
+            }));
+        }
+    }
+
+    // --- Field access ---
+    if (instance && field) {
+        printf("\n[Field access]\n");
+        Report("mdb_field_get_value", MeasureNs([&] {
+            int value = 0;
+            bridge.field_get_value(instance, field, &value);
+            g_sink = static_cast<uintptr_t>(value);
+        }));
+        Report("mdb_field_get_value_direct", MeasureNs([&] {
+            int value = 0;
+            bridge.field_get_value_direct(instance, field, &value, sizeof(value));
+            g_sink = static_cast<uintptr_t>(value);
+        }));
+    }
+
+    // --- Array exports ---
+    if (mockMode && createArray) {
+        printf("\n[Array exports]\n");
+        constexpr int kArrayLength = 1024;
+        void* array = createArray(kArrayLength);
+        int32_t buffer[kArrayLength];
+        Report("mdb_array_length", MeasureNs([&] {
+            g_sink = static_cast<uintptr_t>(bridge.array_length(array));
+        }));
+        Report("mdb_array_get_element", MeasureNs([&] {
+            g_sink = reinterpret_cast<uintptr_t>(bridge.array_get_element(array, 512));
+        }));
+        Report("mdb_array_copy (1024 x int32)", MeasureNs([&] {
+            g_sink = static_cast<uintptr_t>(bridge.array_copy(array, 0, kArrayLength, buffer));
+        }, 250));
+    }
+
+    printf("\nDone.\n");
+    return 0;
+}
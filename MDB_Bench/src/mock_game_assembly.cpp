@@ -0,0 +1,459 @@
+// ============================================================================
+// Mock GameAssembly.dll for Bridge API Benchmarks
+// ============================================================================
+// A tiny DLL named GameAssembly.dll that exports the IL2CPP API subset the
+// bridge binds (the required set from Il2CppTableDefine.hpp plus the handful
+// resolved ad hoc via GetProcAddress) over a fixed in-memory metadata model.
+// Dropping it next to MDB_Bench.exe lets the bridge initialize and run its
+// full export surface in-process, so mdb_find_class / mdb_get_method /
+// mdb_invoke_* / field and array exports can be timed without injecting into
+// a real game. What it measures is bridge overhead — cache lookups, argument
+// marshalling, dispatch — on top of constant-time mock callees, which is
+// exactly the part the bridge controls.
+//
+// Class/method/field layouts mirror the unity_structs definitions in
+// il2cpp_resolver.hpp (Unity 2021+, x64); those offsets are pinned there by
+// static_asserts, so a mirror change shows up as a build break in the bridge
+// before it can silently skew these structures.
+
+#include <Windows.h>
+
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+
+#define MOCK_API extern "C" __declspec(dllexport)
+
+// ====================================
+// Layout-compatible metadata structures
+// ====================================
+// Kept at namespace scope: the extern "C" exports below name these types in
+// their signatures.
+
+struct MockImage {
+    const char* name;       // e.g. "MockAssembly.dll"
+    const char* nameNoExt;  // e.g. "MockAssembly"
+};
+
+struct MockAssemblyName {
+    const char* name;
+    const char* culture;
+    const char* hash;
+    const char* publicKey;
+    uint32_t hashAlg;
+    int32_t hashLength;
+    uint32_t flags;
+    int32_t major, minor, build, revision;
+    uint8_t publicKeyToken[8];
+};
+
+struct MockAssembly {
+    MockImage* image;
+    uint32_t token;
+    int32_t referencedAssemblyStart;
+    int32_t referencedAssemblyCount;
+    MockAssemblyName aname;
+};
+
+struct MockMethodInfo {
+    void* methodPointer;
+    void* invokerMethod;
+    const char* name;
+    void* klass;
+    void* returnType;
+    void* parameters;
+    void* methodDefinition;
+    void* virtualCallMethodPointer;
+    void* genericContainer;
+    uint32_t token;
+    uint16_t flags;
+    uint16_t flags2;
+    uint16_t slot;
+    uint8_t argsCount;
+    uint8_t bits;
+};
+
+struct MockFieldInfo {
+    const char* name;
+    void* type;
+    void* parentClass;
+    int32_t offset;
+    int32_t attributeIndex;
+    uint32_t token;
+};
+
+struct MockVirtualInvokeData {
+    void* methodPtr;
+    const MockMethodInfo* method;
+};
+
+// Offsets into the class blob, matching Il2CppClass_1 + static_fields +
+// rgctx_data + Il2CppClass_2 + vtable as mirrored by the resolver.
+constexpr size_t kClassNameOffset = 0x10;
+constexpr size_t kClassNamespaceOffset = 0x18;
+constexpr size_t kClassParentOffset = 0x58;
+constexpr size_t kClassInstanceSizeOffset = 0xF8;
+constexpr size_t kClassVTableCountOffset = 0x126;
+constexpr size_t kClassVTableOffset = 0x138;
+constexpr size_t kMaxVTableSlots = 8;
+
+struct MockClass {
+    alignas(8) uint8_t raw[kClassVTableOffset + kMaxVTableSlots * sizeof(MockVirtualInvokeData)] = {};
+
+    MockImage* image = nullptr;
+    MockMethodInfo* methods = nullptr;
+    int methodCount = 0;
+    MockFieldInfo* fields = nullptr;
+    int fieldCount = 0;
+    int* fieldSizes = nullptr;   // parallel to fields; bytes copied per access
+    bool isValueType = false;
+    MockClass* elementClass = nullptr;
+
+    const char* Name() const { return *reinterpret_cast<const char* const*>(raw + kClassNameOffset); }
+    const char* Namespace() const { return *reinterpret_cast<const char* const*>(raw + kClassNamespaceOffset); }
+    uint32_t InstanceSize() const { return *reinterpret_cast<const uint32_t*>(raw + kClassInstanceSizeOffset); }
+
+    void Init(const char* ns, const char* name, uint32_t instanceSize) {
+        *reinterpret_cast<const char**>(raw + kClassNameOffset) = name;
+        *reinterpret_cast<const char**>(raw + kClassNamespaceOffset) = ns;
+        *reinterpret_cast<void**>(raw + kClassParentOffset) = nullptr;
+        *reinterpret_cast<uint32_t*>(raw + kClassInstanceSizeOffset) = instanceSize;
+    }
+
+    MockVirtualInvokeData* VTable() {
+        return reinterpret_cast<MockVirtualInvokeData*>(raw + kClassVTableOffset);
+    }
+    void SetVTableCount(uint16_t count) {
+        *reinterpret_cast<uint16_t*>(raw + kClassVTableCountOffset) = count;
+    }
+};
+
+namespace {
+
+// ====================================
+// Mock model: Mock.Player in MockAssembly, Int32/Boolean in mscorlib
+// ====================================
+
+struct PlayerInstance {
+    MockClass* klass;
+    void* monitor;
+    int32_t health;    // offset 0x10
+    float speed;       // offset 0x14
+    int32_t score;     // offset 0x18
+};
+
+void* Player_GetHealth(PlayerInstance* self) {
+    return reinterpret_cast<void*>(static_cast<intptr_t>(self->health));
+}
+
+void* Player_SetHealth(PlayerInstance* self, void* value) {
+    self->health = static_cast<int32_t>(reinterpret_cast<intptr_t>(value));
+    return nullptr;
+}
+
+// Virtual: codegen convention (this, ..., const MethodInfo*)
+void* Player_ToString(PlayerInstance* self, const MockMethodInfo* /*mi*/) {
+    return self;
+}
+
+int g_domain = 0;
+
+MockImage g_mockImage{ "MockAssembly.dll", "MockAssembly" };
+MockImage g_corlibImage{ "mscorlib.dll", "mscorlib" };
+
+MockClass g_playerClass;
+MockClass g_int32Class;
+MockClass g_booleanClass;
+MockClass g_stringClass;
+
+MockMethodInfo g_playerMethods[3];
+MockFieldInfo g_playerFields[3];
+int g_playerFieldSizes[3] = { 4, 4, 4 };
+
+MockAssembly g_mockAssembly;
+MockAssembly g_corlibAssembly;
+MockAssembly* g_assemblyList[2] = { &g_mockAssembly, &g_corlibAssembly };
+
+MockClass* g_classes[4] = { &g_playerClass, &g_int32Class, &g_booleanClass, &g_stringClass };
+
+void InitModel() {
+    g_playerClass.Init("Mock", "Player", sizeof(PlayerInstance));
+    g_playerClass.image = &g_mockImage;
+
+    g_playerMethods[0] = {};
+    g_playerMethods[0].methodPointer = reinterpret_cast<void*>(&Player_GetHealth);
+    g_playerMethods[0].name = "GetHealth";
+    g_playerMethods[0].klass = &g_playerClass;
+    g_playerMethods[0].flags = 0x0006;              // public
+    g_playerMethods[0].slot = 0xFFFF;
+    g_playerMethods[0].argsCount = 0;
+
+    g_playerMethods[1] = {};
+    g_playerMethods[1].methodPointer = reinterpret_cast<void*>(&Player_SetHealth);
+    g_playerMethods[1].name = "SetHealth";
+    g_playerMethods[1].klass = &g_playerClass;
+    g_playerMethods[1].flags = 0x0006;
+    g_playerMethods[1].slot = 0xFFFF;
+    g_playerMethods[1].argsCount = 1;
+
+    g_playerMethods[2] = {};
+    g_playerMethods[2].methodPointer = reinterpret_cast<void*>(&Player_ToString);
+    g_playerMethods[2].name = "ToString";
+    g_playerMethods[2].klass = &g_playerClass;
+    g_playerMethods[2].flags = 0x0006 | 0x0040;     // public virtual
+    g_playerMethods[2].slot = 3;
+    g_playerMethods[2].argsCount = 0;
+
+    g_playerClass.methods = g_playerMethods;
+    g_playerClass.methodCount = 3;
+
+    g_playerFields[0] = { "health", nullptr, &g_playerClass, 0x10, -1, 1 };
+    g_playerFields[1] = { "speed",  nullptr, &g_playerClass, 0x14, -1, 2 };
+    g_playerFields[2] = { "score",  nullptr, &g_playerClass, 0x18, -1, 3 };
+    g_playerClass.fields = g_playerFields;
+    g_playerClass.fieldCount = 3;
+    g_playerClass.fieldSizes = g_playerFieldSizes;
+
+    g_playerClass.SetVTableCount(4);
+    g_playerClass.VTable()[3] = { g_playerMethods[2].methodPointer, &g_playerMethods[2] };
+
+    // Boxed sizes the bridge's layout probe checks (Int32 0x14, Boolean 0x11)
+    g_int32Class.Init("System", "Int32", 0x14);
+    g_int32Class.image = &g_corlibImage;
+    g_int32Class.isValueType = true;
+    g_booleanClass.Init("System", "Boolean", 0x11);
+    g_booleanClass.image = &g_corlibImage;
+    g_booleanClass.isValueType = true;
+    g_stringClass.Init("System", "String", 0x18);
+    g_stringClass.image = &g_corlibImage;
+
+    g_mockAssembly = {};
+    g_mockAssembly.image = &g_mockImage;
+    g_mockAssembly.aname.name = "MockAssembly";
+    g_corlibAssembly = {};
+    g_corlibAssembly.image = &g_corlibImage;
+    g_corlibAssembly.aname.name = "mscorlib";
+}
+
+} // anonymous namespace
+
+// ====================================
+// Exported IL2CPP API subset
+// ====================================
+
+MOCK_API void* il2cpp_domain_get() {
+    return &g_domain;
+}
+
+MOCK_API void* il2cpp_thread_attach(void* domain) {
+    return domain;
+}
+
+MOCK_API void* il2cpp_thread_detach(void* /*thread*/) {
+    return nullptr;
+}
+
+MOCK_API MockAssembly** il2cpp_domain_get_assemblies(void* /*domain*/, size_t* size) {
+    if (size) *size = 2;
+    return g_assemblyList;
+}
+
+MOCK_API MockClass* il2cpp_class_from_name(MockImage* image, const char* ns, const char* name) {
+    if (!image || !name) return nullptr;
+    for (MockClass* klass : g_classes) {
+        if (klass->image != image) continue;
+        if (strcmp(klass->Name(), name) != 0) continue;
+        const char* kns = klass->Namespace();
+        if (strcmp(kns ? kns : "", ns ? ns : "") != 0) continue;
+        return klass;
+    }
+    return nullptr;
+}
+
+MOCK_API MockMethodInfo* il2cpp_class_get_method_from_name(MockClass* klass, const char* name, int argc) {
+    if (!klass || !name) return nullptr;
+    for (int i = 0; i < klass->methodCount; i++) {
+        MockMethodInfo& m = klass->methods[i];
+        if (strcmp(m.name, name) != 0) continue;
+        if (argc >= 0 && argc != m.argsCount) continue;
+        return &m;
+    }
+    return nullptr;
+}
+
+MOCK_API MockFieldInfo* il2cpp_class_get_field_from_name(MockClass* klass, const char* name) {
+    if (!klass || !name) return nullptr;
+    for (int i = 0; i < klass->fieldCount; i++) {
+        if (strcmp(klass->fields[i].name, name) == 0) return &klass->fields[i];
+    }
+    return nullptr;
+}
+
+static int MockFieldSize(const MockFieldInfo* field) {
+    auto* klass = static_cast<MockClass*>(field->parentClass);
+    if (!klass || !klass->fieldSizes) return static_cast<int>(sizeof(void*));
+    return klass->fieldSizes[field - klass->fields];
+}
+
+MOCK_API void il2cpp_field_get_value(void* obj, MockFieldInfo* field, void* out) {
+    if (!obj || !field || !out || field->offset < 0) return;
+    memcpy(out, reinterpret_cast<uint8_t*>(obj) + field->offset, MockFieldSize(field));
+}
+
+MOCK_API void il2cpp_field_set_value(void* obj, MockFieldInfo* field, void* value) {
+    if (!obj || !field || !value || field->offset < 0) return;
+    memcpy(reinterpret_cast<uint8_t*>(obj) + field->offset, value, MockFieldSize(field));
+}
+
+MOCK_API void il2cpp_field_static_get_value(MockFieldInfo* field, void* out) {
+    if (!field || !out) return;
+    memset(out, 0, MockFieldSize(field));
+}
+
+MOCK_API void il2cpp_field_static_set_value(MockFieldInfo* /*field*/, void* /*value*/) {
+}
+
+MOCK_API void* il2cpp_object_new(MockClass* klass) {
+    if (!klass) return nullptr;
+    uint32_t size = klass->InstanceSize();
+    if (size < sizeof(void*) * 2) size = sizeof(void*) * 2;
+    void* obj = calloc(1, size);
+    if (obj) *reinterpret_cast<MockClass**>(obj) = klass;
+    return obj;
+}
+
+MOCK_API void* il2cpp_string_new(const char* str) {
+    if (!str) return nullptr;
+    size_t len = strlen(str);
+    // Il2CppString layout: klass, monitor, int32 length, utf-16 chars
+    auto* s = static_cast<uint8_t*>(calloc(1, 2 * sizeof(void*) + 4 + (len + 1) * 2));
+    if (!s) return nullptr;
+    *reinterpret_cast<MockClass**>(s) = &g_stringClass;
+    *reinterpret_cast<int32_t*>(s + 2 * sizeof(void*)) = static_cast<int32_t>(len);
+    auto* chars = reinterpret_cast<uint16_t*>(s + 2 * sizeof(void*) + 4);
+    for (size_t i = 0; i < len; i++) chars[i] = static_cast<uint8_t>(str[i]);
+    return s;
+}
+
+MOCK_API void* il2cpp_runtime_invoke(MockMethodInfo* method, void* obj, void** args, void** exc) {
+    if (exc) *exc = nullptr;
+    if (!method || !method->methodPointer) return nullptr;
+    switch (method->argsCount) {
+    case 0:
+        if (method->flags & 0x0040) {  // virtual: trailing MethodInfo
+            return reinterpret_cast<void* (*)(void*, const MockMethodInfo*)>(method->methodPointer)(obj, method);
+        }
+        return reinterpret_cast<void* (*)(void*)>(method->methodPointer)(obj);
+    case 1:
+        return reinterpret_cast<void* (*)(void*, void*)>(method->methodPointer)(obj, args ? args[0] : nullptr);
+    case 2:
+        return reinterpret_cast<void* (*)(void*, void*, void*)>(method->methodPointer)(
+            obj, args ? args[0] : nullptr, args ? args[1] : nullptr);
+    default:
+        return nullptr;
+    }
+}
+
+// -- Iterator-style enumeration (void** iter carries the 1-based index) --
+
+MOCK_API MockFieldInfo* il2cpp_class_get_fields(MockClass* klass, void** iter) {
+    if (!klass || !iter) return nullptr;
+    size_t index = reinterpret_cast<size_t>(*iter);
+    if (static_cast<int>(index) >= klass->fieldCount) return nullptr;
+    *iter = reinterpret_cast<void*>(index + 1);
+    return &klass->fields[index];
+}
+
+MOCK_API MockMethodInfo* il2cpp_class_get_methods(MockClass* klass, void** iter) {
+    if (!klass || !iter) return nullptr;
+    size_t index = reinterpret_cast<size_t>(*iter);
+    if (static_cast<int>(index) >= klass->methodCount) return nullptr;
+    *iter = reinterpret_cast<void*>(index + 1);
+    return &klass->methods[index];
+}
+
+// -- Accessors resolved ad hoc by the bridge --
+
+MOCK_API int il2cpp_field_get_flags(MockFieldInfo* field) {
+    return field ? 0x0006 : 0;   // public instance
+}
+
+MOCK_API const char* il2cpp_method_get_name(MockMethodInfo* method) {
+    return method ? method->name : nullptr;
+}
+
+MOCK_API uint32_t il2cpp_method_get_param_count(MockMethodInfo* method) {
+    return method ? method->argsCount : 0;
+}
+
+MOCK_API uint32_t il2cpp_method_get_flags(MockMethodInfo* method, uint32_t* iflags) {
+    if (iflags) *iflags = 0;
+    return method ? method->flags : 0;
+}
+
+MOCK_API const char* il2cpp_class_get_name(MockClass* klass) {
+    return klass ? klass->Name() : nullptr;
+}
+
+MOCK_API const char* il2cpp_class_get_namespace(MockClass* klass) {
+    return klass ? klass->Namespace() : nullptr;
+}
+
+MOCK_API bool il2cpp_class_is_valuetype(MockClass* klass) {
+    return klass && klass->isValueType;
+}
+
+MOCK_API MockClass* il2cpp_class_get_element_class(MockClass* klass) {
+    if (!klass) return nullptr;
+    return klass->elementClass ? klass->elementClass : klass;
+}
+
+MOCK_API int il2cpp_class_array_element_size(MockClass* klass) {
+    if (!klass) return 0;
+    if (klass == &g_int32Class) return 4;
+    if (klass == &g_booleanClass) return 1;
+    return static_cast<int>(sizeof(void*));
+}
+
+// ====================================
+// Benchmark-only helpers (not part of the IL2CPP surface)
+// ====================================
+
+// Hand the bench a ready Player instance and an Int32[] built with the
+// model's classes, so array exports can run against realistic layouts.
+MOCK_API void* mock_create_player() {
+    auto* player = static_cast<PlayerInstance*>(il2cpp_object_new(&g_playerClass));
+    if (player) {
+        player->health = 100;
+        player->speed = 5.5f;
+        player->score = 42;
+    }
+    return player;
+}
+
+MOCK_API void* mock_create_int32_array(int length) {
+    if (length < 0) length = 0;
+    // Il2CppArray layout: klass, monitor, bounds, max_length, inline elements
+    auto* arr = static_cast<uint8_t*>(calloc(1, 4 * sizeof(void*) + static_cast<size_t>(length) * 4));
+    if (!arr) return nullptr;
+    // Array class: element class Int32, reported through the exports above
+    static MockClass arrayClass = [] {
+        MockClass c;
+        c.Init("System", "Int32[]", 4 * sizeof(void*));
+        c.image = &g_corlibImage;
+        c.elementClass = &g_int32Class;
+        return c;
+    }();
+    *reinterpret_cast<MockClass**>(arr) = &arrayClass;
+    *reinterpret_cast<size_t*>(arr + 3 * sizeof(void*)) = static_cast<size_t>(length);
+    auto* data = reinterpret_cast<int32_t*>(arr + 4 * sizeof(void*));
+    for (int i = 0; i < length; i++) data[i] = i;
+    return arr;
+}
+
+BOOL APIENTRY DllMain(HMODULE /*hModule*/, DWORD reason, LPVOID /*lpReserved*/) {
+    if (reason == DLL_PROCESS_ATTACH) {
+        InitModel();
+    }
+    return TRUE;
+}
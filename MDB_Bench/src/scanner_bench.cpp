@@ -0,0 +1,216 @@
+// ============================================================================
+// SignatureScanner Micro-Benchmark Harness
+// ============================================================================
+// Measures scan throughput for the resolution strategies listed in
+// SignatureScanner.hpp: pattern scanning, string lookup, string-reference
+// scanning, and obfuscated export resolution.
+//
+// Usage:
+//   MDB_Bench.exe [path\to\GameAssembly.dll]
+//
+// With a path, the captured image is mapped (no DllMain) and scanned.
+// Without one, the benchmark scans its own module — smaller, but enough to
+// regression-test relative changes between scanner strategies.
+
+#include <SignatureScanner.hpp>
+
+#include <Windows.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// Throughput in GB/s for `bytes` swept in `ms` milliseconds.
+double ThroughputGBs(size_t bytes, double ms) {
+    if (ms <= 0.0) return 0.0;
+    return (static_cast<double>(bytes) / (1024.0 * 1024.0 * 1024.0)) / (ms / 1000.0);
+}
+
+/// Generate a pattern that is absent from the module with near certainty,
+/// forcing a full-section sweep (worst case, stable across runs of the
+/// same seed).
+void MakeMissPattern(std::mt19937_64& rng, size_t length,
+                     std::vector<char>& pattern, std::string& mask) {
+    pattern.resize(length);
+    mask.assign(length, 'x');
+    for (size_t i = 0; i < length; i++) {
+        pattern[i] = static_cast<char>(rng() & 0xFF);
+    }
+    // A couple of wildcards keeps the masked path honest
+    if (length >= 8) {
+        mask[3] = '?';
+        mask[length / 2] = '?';
+    }
+}
+
+void BenchPatternScan(size_t textSize, int iterations) {
+    std::mt19937_64 rng(0x5ca11ab1e);
+
+    // --- strlen/mask-interpreting scan (SIMD anchor path) ---
+    {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            std::vector<char> pattern;
+            std::string mask;
+            MakeMissPattern(rng, 32, pattern, mask);
+            SignatureScanner::FindPattern(pattern.data(), mask.c_str());
+        }
+        double ms = ElapsedMs(start);
+        printf("  FindPattern (32B, miss)          %8.2f ms/scan  %6.2f GB/s\n",
+               ms / iterations, ThroughputGBs(textSize, ms / iterations));
+    }
+
+    // --- precompiled BMH scan ---
+    {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            std::vector<char> pattern;
+            std::string mask;
+            MakeMissPattern(rng, 32, pattern, mask);
+            auto compiled = SignatureScanner::CompilePattern(pattern.data(), mask.c_str());
+            SignatureScanner::FindPattern(compiled);
+        }
+        double ms = ElapsedMs(start);
+        printf("  FindPattern (compiled BMH)       %8.2f ms/scan  %6.2f GB/s\n",
+               ms / iterations, ThroughputGBs(textSize, ms / iterations));
+    }
+
+    // --- parallel chunked scan ---
+    {
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            std::vector<char> pattern;
+            std::string mask;
+            MakeMissPattern(rng, 32, pattern, mask);
+            SignatureScanner::FindPatternParallel(pattern.data(), mask.c_str());
+        }
+        double ms = ElapsedMs(start);
+        printf("  FindPatternParallel              %8.2f ms/scan  %6.2f GB/s\n",
+               ms / iterations, ThroughputGBs(textSize, ms / iterations));
+    }
+
+    // --- batched multi-pattern scan (one sweep for N signatures) ---
+    {
+        constexpr size_t BATCH = 16;
+        std::vector<std::vector<char>> patterns(BATCH);
+        std::vector<std::string> masks(BATCH);
+        std::vector<SignatureScanner::PatternSpec> specs(BATCH);
+        for (size_t s = 0; s < BATCH; s++) {
+            MakeMissPattern(rng, 32, patterns[s], masks[s]);
+            specs[s] = { patterns[s].data(), masks[s].c_str(), 0 };
+        }
+
+        auto start = Clock::now();
+        SignatureScanner::FindPatterns(specs.data(), specs.size());
+        double ms = ElapsedMs(start);
+        printf("  FindPatterns (%zu patterns)      %8.2f ms total  %6.2f GB/s effective\n",
+               BATCH, ms, ThroughputGBs(textSize * BATCH, ms));
+    }
+}
+
+void BenchStringScan(size_t rdataSize, int iterations) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        // Unique per iteration so the persistent cache can't short-circuit
+        char needle[64];
+        snprintf(needle, sizeof(needle), "mdb_bench_missing_string_%d", i);
+        SignatureScanner::FindString(needle);
+    }
+    double ms = ElapsedMs(start);
+    printf("  FindString (miss)                %8.2f ms/scan  %6.2f GB/s\n",
+           ms / iterations, ThroughputGBs(rdataSize, ms / iterations));
+
+    start = Clock::now();
+    SignatureScanner::FindStringReference("mdb_bench_reference_probe");
+    printf("  FindStringReference (cold index) %8.2f ms\n", ElapsedMs(start));
+
+    start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        char needle[64];
+        snprintf(needle, sizeof(needle), "mdb_bench_ref_%d", i);
+        SignatureScanner::FindStringReference(needle);
+    }
+    printf("  FindStringReference (warm index) %8.4f ms/lookup\n",
+           ElapsedMs(start) / iterations);
+}
+
+void BenchExportResolution(int iterations) {
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        SignatureScanner::FindObfuscatedExport("il2cpp_domain_get_assemblies");
+    }
+    printf("  FindObfuscatedExport             %8.4f ms/lookup\n",
+           ElapsedMs(start) / iterations);
+
+    start = Clock::now();
+    SignatureScanner::ResolveAllExportThunks();
+    printf("  ResolveAllExportThunks (%5zu)    %8.2f ms\n",
+           SignatureScanner::GetExports().size(), ElapsedMs(start));
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    HMODULE hModule = nullptr;
+
+    if (argc > 1) {
+        // Map the captured image without running DllMain or resolving imports
+        hModule = LoadLibraryExA(argv[1], nullptr, DONT_RESOLVE_DLL_REFERENCES);
+        if (!hModule) {
+            fprintf(stderr, "Failed to load '%s' (GetLastError=%lu)\n", argv[1], GetLastError());
+            return 1;
+        }
+        printf("Benchmarking against: %s\n", argv[1]);
+    } else {
+        hModule = GetModuleHandleW(nullptr);
+        printf("No module path given — benchmarking against own image.\n");
+        printf("Pass a captured GameAssembly.dll path for representative numbers.\n");
+    }
+
+    // Remove any persisted scan cache so every run measures cold scans
+    {
+        char exePath[MAX_PATH];
+        GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+        auto cachePath = std::filesystem::path(exePath).parent_path() / "MDB" / "scanner_cache.txt";
+        std::error_code ec;
+        std::filesystem::remove(cachePath, ec);
+    }
+
+    auto initStart = Clock::now();
+    if (!SignatureScanner::Initialize(hModule)) {
+        fprintf(stderr, "SignatureScanner::Initialize failed\n");
+        return 1;
+    }
+    double initMs = ElapsedMs(initStart);
+
+    const auto& mod = SignatureScanner::GetModuleInfo();
+    printf("\nModule: base=0x%p size=%zu MB (.text %zu MB, .rdata %zu MB)\n",
+           reinterpret_cast<void*>(mod.base), mod.size >> 20,
+           mod.textSize >> 20, mod.rdataSize >> 20);
+    printf("Initialize (incl. prefetch + export map): %.2f ms\n\n", initMs);
+
+    const int iterations = (mod.textSize > (256u << 20)) ? 3 : 10;
+
+    printf("[Pattern scanning]\n");
+    BenchPatternScan(mod.textSize, iterations);
+
+    printf("\n[String scanning]\n");
+    BenchStringScan(mod.rdataSize, iterations);
+
+    printf("\n[Export resolution]\n");
+    BenchExportResolution(iterations);
+
+    printf("\nDone.\n");
+    return 0;
+}
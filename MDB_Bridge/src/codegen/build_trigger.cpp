@@ -1,7 +1,15 @@
 #include "build_trigger.hpp"
+#include "core/startup_fs.hpp"
+#include "core/startup_trace.hpp"
 #include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
 #include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 namespace MDB {
@@ -11,22 +19,24 @@ static std::string ReadPipeToString(HANDLE hReadPipe) {
     std::string result;
     char buffer[4096];
     DWORD bytesRead;
-    
+
     while (ReadFile(hReadPipe, buffer, sizeof(buffer) - 1, &bytesRead, NULL) && bytesRead > 0) {
         buffer[bytesRead] = '\0';
         result += buffer;
     }
-    
+
     return result;
 }
 
 std::string FindMSBuild() {
+    Trace::ScopedSpan span("build.find_msbuild");
+
     // Try vswhere first — most reliable method, works for any VS version/edition
     std::string vswhere_path = "C:\\Program Files (x86)\\Microsoft Visual Studio\\Installer\\vswhere.exe";
     if (std::filesystem::exists(vswhere_path)) {
         // Note: vswhere_path is hardcoded and trusted, command is properly quoted
         std::string command = "\"" + vswhere_path + "\" -latest -requires Microsoft.Component.MSBuild -find MSBuild\\**\\Bin\\MSBuild.exe";
-        
+
         SECURITY_ATTRIBUTES sa = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
         HANDLE hReadPipe, hWritePipe;
         if (CreatePipe(&hReadPipe, &hWritePipe, &sa, 0)) {
@@ -35,23 +45,23 @@ std::string FindMSBuild() {
             si.hStdOutput = hWritePipe;
             si.hStdError = hWritePipe;
             si.wShowWindow = SW_HIDE;
-            
+
             PROCESS_INFORMATION pi = { 0 };
-            
+
             if (CreateProcessA(NULL, const_cast<char*>(command.c_str()), NULL, NULL, TRUE, 0, NULL, NULL, &si, &pi)) {
                 CloseHandle(hWritePipe);
-                
+
                 std::string output = ReadPipeToString(hReadPipe);
                 CloseHandle(hReadPipe);
-                
+
                 WaitForSingleObject(pi.hProcess, INFINITE);
                 CloseHandle(pi.hProcess);
                 CloseHandle(pi.hThread);
-                
+
                 // Trim output and check if file exists
                 output.erase(0, output.find_first_not_of(" \t\n\r"));
                 output.erase(output.find_last_not_of(" \t\n\r") + 1);
-                
+
                 if (!output.empty() && std::filesystem::exists(output)) {
                     return output;
                 }
@@ -61,7 +71,7 @@ std::string FindMSBuild() {
             }
         }
     }
-    
+
     // Fallback: check hardcoded paths for modern VS installations
     // NOTE: Do NOT include old .NET Framework MSBuild (v4.0.30319) — it cannot
     // build SDK-style projects and will fail with MSB4041.
@@ -71,39 +81,496 @@ std::string FindMSBuild() {
         "C:\\Program Files\\Microsoft Visual Studio\\2022\\Professional\\MSBuild\\Current\\Bin\\MSBuild.exe",
         "C:\\Program Files\\Microsoft Visual Studio\\2022\\Community\\MSBuild\\Current\\Bin\\MSBuild.exe",
         "C:\\Program Files (x86)\\Microsoft Visual Studio\\2022\\BuildTools\\MSBuild\\Current\\Bin\\MSBuild.exe",
-        
+
         // Visual Studio 2019
         "C:\\Program Files (x86)\\Microsoft Visual Studio\\2019\\Enterprise\\MSBuild\\Current\\Bin\\MSBuild.exe",
         "C:\\Program Files (x86)\\Microsoft Visual Studio\\2019\\Professional\\MSBuild\\Current\\Bin\\MSBuild.exe",
         "C:\\Program Files (x86)\\Microsoft Visual Studio\\2019\\Community\\MSBuild\\Current\\Bin\\MSBuild.exe",
         "C:\\Program Files (x86)\\Microsoft Visual Studio\\2019\\BuildTools\\MSBuild\\Current\\Bin\\MSBuild.exe",
     };
-    
+
     for (const auto& path : search_paths) {
         if (std::filesystem::exists(path)) {
             return path;
         }
     }
-    
+
     return "";
 }
 
-BuildResult TriggerBuild(const std::string& project_path) {
+// ============================================================================
+// MSBuild Discovery Cache & Build-Skip Manifest
+// ============================================================================
+// Both persist in MDB\ next to the game. The vswhere spawn in FindMSBuild()
+// alone costs ~400ms, and a no-op MSBuild invocation still takes seconds —
+// so the discovered MSBuild path is cached and revalidated with a single
+// exists() check, and a hash over the generated sources recorded after each
+// successful build lets the trigger prove "nothing to compile" without
+// spawning MSBuild at all.
+
+// Derive the MDB directory from the project path:
+//   <game>\MDB_Core\MDB_Core.csproj  ->  <game>\MDB
+static std::filesystem::path MdbDirForProject(const std::string& project_path) {
+    return std::filesystem::path(project_path).parent_path().parent_path() / "MDB";
+}
+
+// Incremental FNV-1a 64 over a file's contents (same hash the dumper uses
+// for its wrapper manifest). Returns the seed unchanged if the file cannot
+// be opened, so a transient read failure reads as "changed", not "same".
+static uint64_t Fnv1aFile(const std::filesystem::path& path, uint64_t hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return hash;
+    }
+
+    char buffer[8192];
+    while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+        std::streamsize count = file.gcount();
+        for (std::streamsize i = 0; i < count; ++i) {
+            hash ^= static_cast<uint8_t>(buffer[i]);
+            hash *= 1099511628211ull;
+        }
+    }
+
+    return hash;
+}
+
+// Combined hash over the project file and every generated .cs source.
+// Filenames are folded in and the list is sorted so renames and directory
+// iteration order both affect/never affect the result respectively.
+static uint64_t ComputeSourceHash(const std::string& project_path) {
+    uint64_t hash = 1469598103934665603ull;
+
+    std::vector<std::filesystem::path> sources;
+    auto generated_dir = std::filesystem::path(project_path).parent_path() / "Generated";
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(generated_dir, ec)) {
+        if (entry.path().extension() == L".cs") {
+            sources.push_back(entry.path());
+        }
+    }
+    std::sort(sources.begin(), sources.end());
+
+    hash = Fnv1aFile(project_path, hash);
+    for (const auto& source : sources) {
+        std::string name = source.filename().string();
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        hash = Fnv1aFile(source, hash);
+    }
+
+    return hash;
+}
+
+// Look up MSBuild through the persisted path cache, falling back to full
+// discovery (and refreshing the cache) when the cached path is gone.
+static std::string FindMSBuildCached(const std::string& project_path) {
+    std::filesystem::path cache_file = MdbDirForProject(project_path) / "msbuild_path.cache";
+
+    std::ifstream in(cache_file);
+    if (in.is_open()) {
+        std::string cached;
+        std::getline(in, cached);
+        in.close();
+        if (!cached.empty() && StartupFs::Exists(cached)) {
+            return cached;
+        }
+    }
+
+    std::string discovered = FindMSBuild();
+    if (!discovered.empty()) {
+        std::ofstream out(cache_file, std::ios::trunc);
+        if (out.is_open()) {
+            out << discovered << "\n";
+        }
+    }
+
+    return discovered;
+}
+
+bool IsBuildCurrent(const std::string& project_path) {
+    std::filesystem::path manifest_file = MdbDirForProject(project_path) / "build_hash.manifest";
+
+    std::ifstream in(manifest_file);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    uint64_t recorded = 0;
+    in >> std::hex >> recorded;
+    if (in.fail() || recorded == 0) {
+        return false;
+    }
+
+    return ComputeSourceHash(project_path) == recorded;
+}
+
+// Record the source hash after a successful build so the next launch can
+// skip MSBuild when nothing changed.
+static void RecordBuildSuccess(const std::filesystem::path& manifest_file, uint64_t source_hash) {
+    std::ofstream out(manifest_file, std::ios::trunc);
+    if (out.is_open()) {
+        out << std::hex << source_hash << "\n";
+    }
+}
+
+// ============================================================================
+// Native Image Warm-up (NGEN)
+// ============================================================================
+// The CLR JIT-compiles the freshly built SDK from scratch on every launch —
+// thousands of wrapper methods on first touch, paid as early-gameplay
+// stutter. After a successful build the assembly is handed to the NGEN
+// service (/queue), which generates a native image in the background at
+// idle priority; later launches bind to the precompiled image and skip the
+// wrapper JIT entirely. An ngen_hash.manifest mirrors build_hash.manifest
+// so each distinct build is only queued once. Everything here is
+// best-effort: no NGEN (no admin rights, missing runtime) just means the
+// JIT keeps doing the work it does today.
+
+static void StartNativeImageWarmup(const std::filesystem::path& mdb_dir, uint64_t source_hash) {
+    std::filesystem::path assembly = mdb_dir / "Managed" / "GameSDK.ModHost.dll";
+    if (!StartupFs::Exists(assembly.wstring())) {
+        return;
+    }
+
+    // One queue request per build — re-submitting every launch would spin
+    // the NGEN service for nothing
+    std::filesystem::path manifest = mdb_dir / "ngen_hash.manifest";
+    {
+        std::ifstream in(manifest);
+        uint64_t recorded = 0;
+        if (in.is_open()) {
+            in >> std::hex >> recorded;
+            if (!in.fail() && recorded == source_hash) {
+                return;
+            }
+        }
+    }
+
+    char windir[MAX_PATH];
+    DWORD len = GetEnvironmentVariableA("WINDIR", windir, MAX_PATH);
+    if (len == 0 || len >= MAX_PATH) {
+        return;
+    }
+    std::filesystem::path ngen_path = std::filesystem::path(windir)
+        / "Microsoft.NET" / "Framework64" / "v4.0.30319" / "ngen.exe";
+    if (!StartupFs::Exists(ngen_path.wstring())) {
+        return;
+    }
+
+    // /queue returns immediately and leaves compilation to the NGEN
+    // service; the CLR prefers the native image automatically once it
+    // lands in the image cache
+    std::string command = "\"" + ngen_path.string() + "\" install \""
+        + assembly.string() + "\" /queue:1 /nologo /silent";
+
+    STARTUPINFOA si = { sizeof(STARTUPINFOA) };
+    si.dwFlags = STARTF_USESHOWWINDOW;
+    si.wShowWindow = SW_HIDE;
+    PROCESS_INFORMATION pi = { 0 };
+    if (CreateProcessA(NULL, const_cast<char*>(command.c_str()), NULL, NULL, FALSE,
+                       CREATE_NO_WINDOW | BELOW_NORMAL_PRIORITY_CLASS, NULL, NULL, &si, &pi)) {
+        CloseHandle(pi.hProcess);
+        CloseHandle(pi.hThread);
+
+        std::ofstream out(manifest, std::ios::trunc);
+        if (out.is_open()) {
+            out << std::hex << source_hash << "\n";
+        }
+    }
+}
+
+// ============================================================================
+// Overlapped Pipe Plumbing
+// ============================================================================
+// Anonymous pipes from CreatePipe() do not support overlapped I/O, so the
+// child's stdout/stderr go through a uniquely named pipe instead: the read
+// end is opened with FILE_FLAG_OVERLAPPED for the reader, the write end is
+// a plain inheritable handle for MSBuild.
+
+static bool CreateOverlappedPipe(HANDLE* read_pipe, HANDLE* write_pipe) {
+    static LONG s_serial = 0;
+    char name[MAX_PATH];
+    snprintf(name, sizeof(name), "\\\\.\\pipe\\MDB_Build_%lu_%ld",
+             GetCurrentProcessId(), InterlockedIncrement(&s_serial));
+
+    HANDLE hRead = CreateNamedPipeA(name,
+                                    PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED,
+                                    PIPE_TYPE_BYTE | PIPE_WAIT,
+                                    1, 64 * 1024, 64 * 1024, 0, NULL);
+    if (hRead == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    SECURITY_ATTRIBUTES sa = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
+    HANDLE hWrite = CreateFileA(name, GENERIC_WRITE, 0, &sa, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hWrite == INVALID_HANDLE_VALUE) {
+        CloseHandle(hRead);
+        return false;
+    }
+
+    *read_pipe = hRead;
+    *write_pipe = hWrite;
+    return true;
+}
+
+// ============================================================================
+// Async Build State
+// ============================================================================
+// One build in flight at a time — the bridge only ever compiles MDB_Core.
+
+namespace {
+    struct AsyncBuildState {
+        std::thread reader;             // pumps the pipe, then reaps MSBuild
+        std::atomic<bool> running{ false };
+        bool started = false;           // a build was launched at some point
+        BuildResult result{ false, "", "", -1 };
+        std::filesystem::path manifest_file;    // build-skip manifest to write
+        uint64_t source_hash = 0;               // ... and the hash to record
+        Trace::SpanToken span{ nullptr, 0 };    // covers launch → exit code
+    };
+}
+
+static AsyncBuildState g_build;
+
+// ============================================================================
+// In-Process Compile Server
+// ============================================================================
+// When GameSDK.CompileServer.dll exists in MDB\Managed (it is built next
+// to ModHost by the first MSBuild pass), the generated sources are handed
+// straight to it through the hosted CLR — no vswhere, no MSBuild startup,
+// no project evaluation. The server returns 0 on success; any other
+// outcome (CLR never registered, host call failed, compile errors the
+// in-box compiler may be wrong about) drops to the MSBuild path.
+
+static std::atomic<ManagedExecuteFn> g_managed_executor{ nullptr };
+
+void SetManagedExecutor(ManagedExecuteFn fn) {
+    g_managed_executor.store(fn, std::memory_order_release);
+}
+
+static std::filesystem::path ManagedDirForProject(const std::string& project_path) {
+    return MdbDirForProject(project_path) / "Managed";
+}
+
+static bool InProcessCompileAvailable(const std::string& project_path) {
+    return std::filesystem::exists(ManagedDirForProject(project_path) / "GameSDK.CompileServer.dll");
+}
+
+static void AppendCsSources(const std::filesystem::path& dir,
+                            std::vector<std::filesystem::path>& sources) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.path().extension() == L".cs") {
+            sources.push_back(entry.path());
+        }
+    }
+}
+
+// The source set the server compiles. Mirrors the <Compile> item group in
+// MDB_Core.csproj — keep the two in sync when adding source directories.
+static std::vector<std::filesystem::path> CollectProjectSources(const std::filesystem::path& project_dir) {
+    std::vector<std::filesystem::path> sources;
+    AppendCsSources(project_dir / "Core" / "Bridge", sources);
+    AppendCsSources(project_dir / "Core" / "Runtime", sources);
+    AppendCsSources(project_dir / "Core" / "Types", sources);
+    AppendCsSources(project_dir / "Core" / "ImGui", sources);
+    AppendCsSources(project_dir / "Core" / "Unity", sources);
+    AppendCsSources(project_dir / "Core" / "Injection", sources);
+    sources.push_back(project_dir / "Deobfuscation" / "MappingDatabase.cs");
+    sources.push_back(project_dir / "Deobfuscation" / "SignatureGenerator.cs");
+    AppendCsSources(project_dir / "ModHost", sources);
+    AppendCsSources(project_dir / "ModHost" / "Patching", sources);
+    AppendCsSources(project_dir / "ModHost" / "Examples", sources);
+    AppendCsSources(project_dir / "Generated", sources);
+    std::sort(sources.begin(), sources.end());
+    return sources;
+}
+
+// Run the compile server. Returns true with a successful BuildResult, or
+// false when the MSBuild fallback should take over.
+static bool RunInProcessCompile(const std::string& project_path,
+                                const BuildOutputCallback& on_output,
+                                BuildResult* out_result) {
+    // CLR warmup overlaps the build on purpose — wait for dllmain to
+    // register the executor rather than racing it
+    ManagedExecuteFn execute = nullptr;
+    for (int i = 0; i < 300; ++i) {
+        execute = g_managed_executor.load(std::memory_order_acquire);
+        if (execute) {
+            break;
+        }
+        Sleep(100);
+    }
+    if (!execute) {
+        return false;
+    }
+
+    auto project_dir = std::filesystem::path(project_path).parent_path();
+    auto mdb_dir = MdbDirForProject(project_path);
+    auto output_dll = mdb_dir / "Managed" / "GameSDK.ModHost.dll";
+    auto rsp_path = mdb_dir / "compile_server.rsp";
+    auto log_path = mdb_dir / "Logs" / "compile_server.log";
+
+    auto sources = CollectProjectSources(project_dir);
+    if (sources.empty()) {
+        return false;
+    }
+
+    {
+        std::ofstream rsp(rsp_path, std::ios::trunc);
+        if (!rsp.is_open()) {
+            return false;
+        }
+        rsp << "out=" << output_dll.string() << "\n";
+        rsp << "log=" << log_path.string() << "\n";
+        for (const auto& source : sources) {
+            rsp << "src=" << source.string() << "\n";
+        }
+    }
+
+    std::wstring server_dll = (mdb_dir / "Managed" / "GameSDK.CompileServer.dll").wstring();
+    std::wstring argument = rsp_path.wstring();
+    int rc = execute(server_dll.c_str(), L"GameSDK.CompileServer.Server",
+                     L"Compile", argument.c_str());
+
+    // Stream the server's diagnostics log through the same callback the
+    // MSBuild path uses, success or not
+    std::string log_text;
+    {
+        std::ifstream log(log_path);
+        std::stringstream buffer;
+        buffer << log.rdbuf();
+        log_text = buffer.str();
+    }
+    if (on_output && !log_text.empty()) {
+        std::stringstream lines(log_text);
+        std::string line;
+        while (std::getline(lines, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!line.empty()) {
+                on_output(line);
+            }
+        }
+    }
+
+    if (rc != 0) {
+        return false;
+    }
+
+    *out_result = { true, "", std::move(log_text), 0 };
+    return true;
+}
+
+// Reader thread: pumps overlapped reads on the output pipe, emitting each
+// complete line to the callback as it arrives, then reaps the MSBuild
+// process and records the BuildResult.
+static void BuildReaderThread(HANDLE hReadPipe, HANDLE hProcess, HANDLE hThread,
+                              BuildOutputCallback on_output) {
+    OVERLAPPED ov = { 0 };
+    ov.hEvent = CreateEventA(NULL, TRUE, FALSE, NULL);
+
+    std::string output;     // full transcript for BuildResult
+    std::string pending;    // partial line carried across reads
+    char buffer[4096];
+
+    for (;;) {
+        DWORD bytesRead = 0;
+        BOOL ok = ReadFile(hReadPipe, buffer, sizeof(buffer), &bytesRead, &ov);
+        if (!ok) {
+            if (GetLastError() == ERROR_IO_PENDING) {
+                ok = GetOverlappedResult(hReadPipe, &ov, &bytesRead, TRUE);
+            }
+            if (!ok) {
+                break;  // ERROR_BROKEN_PIPE — MSBuild closed its end
+            }
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        ResetEvent(ov.hEvent);
+
+        output.append(buffer, bytesRead);
+        pending.append(buffer, bytesRead);
+
+        size_t pos;
+        while ((pos = pending.find('\n')) != std::string::npos) {
+            std::string line = pending.substr(0, pos);
+            pending.erase(0, pos + 1);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (on_output && !line.empty()) {
+                on_output(line);
+            }
+        }
+    }
+
+    // Flush a trailing line without a newline
+    if (on_output && !pending.empty()) {
+        on_output(pending);
+    }
+
+    if (ov.hEvent) {
+        CloseHandle(ov.hEvent);
+    }
+    CloseHandle(hReadPipe);
+
+    // Output is drained, so this wait is just the process teardown
+    WaitForSingleObject(hProcess, INFINITE);
+
     BuildResult result = { false, "", "", -1 };
-    
-    // Check if project file exists
-    if (!std::filesystem::exists(project_path)) {
-        result.error_message = "Project file not found: " + project_path;
-        return result;
+    result.build_output = std::move(output);
+
+    DWORD exitCode;
+    if (GetExitCodeProcess(hProcess, &exitCode)) {
+        result.exit_code = static_cast<int>(exitCode);
+        result.success = (exitCode == 0);
+
+        if (!result.success) {
+            result.error_message = "MSBuild failed with exit code " + std::to_string(exitCode);
+        }
+    } else {
+        result.error_message = "Failed to get MSBuild exit code";
+    }
+
+    CloseHandle(hProcess);
+    CloseHandle(hThread);
+
+    Trace::EndSpan(g_build.span);
+
+    if (result.success) {
+        RecordBuildSuccess(g_build.manifest_file, g_build.source_hash);
+        StartNativeImageWarmup(g_build.manifest_file.parent_path(), g_build.source_hash);
     }
-    
-    // Find MSBuild
-    std::string msbuild_path = FindMSBuild();
+
+    g_build.result = std::move(result);
+    g_build.running.store(false, std::memory_order_release);
+}
+
+// Discover MSBuild, set up the output pipe and spawn the process. On
+// success the caller owns *read_pipe and the handles in *pi.
+static bool LaunchMSBuildProcess(const std::string& project_path,
+                                 HANDLE* read_pipe, PROCESS_INFORMATION* pi,
+                                 std::string* error_message) {
+    auto fail = [&](const char* message) {
+        if (error_message) {
+            *error_message = message;
+        }
+        return false;
+    };
+
+    // Find MSBuild (persisted-path cache, full discovery on a miss)
+    std::string msbuild_path = FindMSBuildCached(project_path);
     if (msbuild_path.empty()) {
-        result.error_message = "MSBuild.exe not found. Please install Visual Studio or Build Tools.";
-        return result;
+        return fail("MSBuild.exe not found. Please install Visual Studio or Build Tools.");
     }
-    
+
     // Prepare command line
     // Note: Both msbuild_path and project_path are properly quoted to handle spaces
     // and special characters. These paths come from trusted sources (filesystem/registry),
@@ -115,62 +582,158 @@ BuildResult TriggerBuild(const std::string& project_path) {
         << "/p:Platform=AnyCPU "
         << "/v:minimal "
         << "/nologo";
-    
+
     std::string command = cmd.str();
-    
-    // Create pipe for reading output
-    SECURITY_ATTRIBUTES sa = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
+
+    // Create overlapped pipe for streaming output
     HANDLE hReadPipe, hWritePipe;
-    
-    if (!CreatePipe(&hReadPipe, &hWritePipe, &sa, 0)) {
-        result.error_message = "Failed to create pipe for MSBuild output";
-        return result;
+    if (!CreateOverlappedPipe(&hReadPipe, &hWritePipe)) {
+        return fail("Failed to create pipe for MSBuild output");
     }
-    
+
     // Set up process startup info
     STARTUPINFOA si = { sizeof(STARTUPINFOA) };
     si.dwFlags = STARTF_USESTDHANDLES | STARTF_USESHOWWINDOW;
     si.hStdOutput = hWritePipe;
     si.hStdError = hWritePipe;
     si.wShowWindow = SW_HIDE;
-    
-    PROCESS_INFORMATION pi = { 0 };
-    
+
+    *pi = { 0 };
+
     // Start MSBuild process
-    if (!CreateProcessA(NULL, const_cast<char*>(command.c_str()), NULL, NULL, TRUE, 0, NULL, NULL, &si, &pi)) {
-        result.error_message = "Failed to start MSBuild process";
+    if (!CreateProcessA(NULL, const_cast<char*>(command.c_str()), NULL, NULL, TRUE, 0, NULL, NULL, &si, pi)) {
         CloseHandle(hReadPipe);
         CloseHandle(hWritePipe);
-        return result;
+        return fail("Failed to start MSBuild process");
     }
-    
+
     // Close write end of pipe (we're only reading)
     CloseHandle(hWritePipe);
-    
-    // Read build output
-    result.build_output = ReadPipeToString(hReadPipe);
-    CloseHandle(hReadPipe);
-    
-    // Wait for process to complete
-    WaitForSingleObject(pi.hProcess, INFINITE);
-    
-    // Get exit code
-    DWORD exitCode;
-    if (GetExitCodeProcess(pi.hProcess, &exitCode)) {
-        result.exit_code = static_cast<int>(exitCode);
-        result.success = (exitCode == 0);
-        
-        if (!result.success) {
-            result.error_message = "MSBuild failed with exit code " + std::to_string(exitCode);
+    *read_pipe = hReadPipe;
+    return true;
+}
+
+// Worker for the in-process path: try the compile server, fall back to a
+// full MSBuild run (launched from this thread, pumped inline) if it can't
+// deliver. Finalizes g_build either way.
+static void InProcessBuildThread(std::string project_path, BuildOutputCallback on_output) {
+    BuildResult result{ false, "", "", -1 };
+    if (RunInProcessCompile(project_path, on_output, &result)) {
+        Trace::EndSpan(g_build.span);
+        RecordBuildSuccess(g_build.manifest_file, g_build.source_hash);
+        StartNativeImageWarmup(g_build.manifest_file.parent_path(), g_build.source_hash);
+        g_build.result = std::move(result);
+        g_build.running.store(false, std::memory_order_release);
+        return;
+    }
+
+    if (on_output) {
+        on_output("[compile-server] unavailable or failed; falling back to MSBuild");
+    }
+
+    HANDLE read_pipe = NULL;
+    PROCESS_INFORMATION pi = { 0 };
+    std::string error;
+    if (!LaunchMSBuildProcess(project_path, &read_pipe, &pi, &error)) {
+        Trace::EndSpan(g_build.span);
+        g_build.result = { false, std::move(error), "", -1 };
+        g_build.running.store(false, std::memory_order_release);
+        return;
+    }
+
+    // BuildReaderThread is a plain function — run it inline on this
+    // thread; it reaps MSBuild and finalizes g_build
+    BuildReaderThread(read_pipe, pi.hProcess, pi.hThread, std::move(on_output));
+}
+
+bool StartBuildAsync(const std::string& project_path,
+                     BuildOutputCallback on_output,
+                     std::string* error_message) {
+    auto fail = [&](const char* message) {
+        if (error_message) {
+            *error_message = message;
         }
-    } else {
-        result.error_message = "Failed to get MSBuild exit code";
+        return false;
+    };
+
+    if (g_build.running.load(std::memory_order_acquire)) {
+        return fail("A build is already in progress");
     }
-    
-    CloseHandle(pi.hProcess);
-    CloseHandle(pi.hThread);
-    
-    return result;
+    if (g_build.reader.joinable()) {
+        g_build.reader.join();  // reap a previously completed build
+    }
+
+    // Check if project file exists
+    if (!StartupFs::Exists(project_path)) {
+        if (error_message) {
+            *error_message = "Project file not found: " + project_path;
+        }
+        return false;
+    }
+
+    // In-process path when the compile server from a previous MSBuild
+    // pass is present — skips vswhere and MSBuild startup entirely
+    if (InProcessCompileAvailable(project_path)) {
+        g_build.result = { false, "", "", -1 };
+        g_build.manifest_file = MdbDirForProject(project_path) / "build_hash.manifest";
+        g_build.source_hash = ComputeSourceHash(project_path);
+        g_build.span = Trace::BeginSpan("build.compile_server");
+        g_build.started = true;
+        g_build.running.store(true, std::memory_order_release);
+        g_build.reader = std::thread(InProcessBuildThread, project_path, std::move(on_output));
+        return true;
+    }
+
+    HANDLE read_pipe = NULL;
+    PROCESS_INFORMATION pi = { 0 };
+    std::string launch_error;
+    if (!LaunchMSBuildProcess(project_path, &read_pipe, &pi, &launch_error)) {
+        if (error_message) {
+            *error_message = std::move(launch_error);
+        }
+        return false;
+    }
+
+    g_build.result = { false, "", "", -1 };
+    g_build.manifest_file = MdbDirForProject(project_path) / "build_hash.manifest";
+    g_build.source_hash = ComputeSourceHash(project_path);
+    g_build.span = Trace::BeginSpan("build.msbuild");
+    g_build.started = true;
+    g_build.running.store(true, std::memory_order_release);
+    g_build.reader = std::thread(BuildReaderThread, read_pipe, pi.hProcess, pi.hThread,
+                                 std::move(on_output));
+    return true;
+}
+
+void EnsureNativeImage(const std::string& project_path) {
+    StartNativeImageWarmup(MdbDirForProject(project_path), ComputeSourceHash(project_path));
+}
+
+bool IsBuildRunning() {
+    return g_build.running.load(std::memory_order_acquire);
+}
+
+BuildResult WaitForBuild() {
+    if (!g_build.started) {
+        BuildResult result = { false, "No build was started", "", -1 };
+        return result;
+    }
+
+    if (g_build.reader.joinable()) {
+        g_build.reader.join();
+    }
+
+    return g_build.result;
+}
+
+BuildResult TriggerBuild(const std::string& project_path) {
+    std::string error;
+    if (!StartBuildAsync(project_path, BuildOutputCallback{}, &error)) {
+        BuildResult result = { false, error, "", -1 };
+        return result;
+    }
+
+    return WaitForBuild();
 }
 
 } // namespace Build
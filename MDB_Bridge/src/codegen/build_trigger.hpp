@@ -1,10 +1,26 @@
 #pragma once
+#include <functional>
 #include <string>
 
 // ============================================================================
 // MSBuild Trigger for MDB Bridge
 // ============================================================================
-// This module invokes MSBuild to compile the generated wrapper classes
+// This module compiles the generated wrapper classes. Two paths:
+//
+//   In-process — when GameSDK.CompileServer.dll (built alongside ModHost
+//   by the first MSBuild pass) exists, the sources are fed straight to a
+//   managed compile server in the hosted CLR. No vswhere, no MSBuild
+//   process startup, no project evaluation — just the raw compile.
+//
+//   MSBuild — the first launch, or any in-process failure, falls back to
+//   spawning MSBuild as before.
+//
+// Builds run asynchronously: StartBuildAsync() returns immediately while a
+// worker compiles (or pumps overlapped pipe I/O from MSBuild), streaming
+// output lines to a callback as they arrive. WaitForBuild() joins the
+// build and returns its result — mod loading gates on that, not on start,
+// so the bridge keeps initializing (CLR warmup, hooks) during the compile.
+// TriggerBuild() remains as a synchronous convenience wrapper.
 
 namespace MDB {
 namespace Build {
@@ -16,11 +32,48 @@ struct BuildResult {
     int exit_code;
 };
 
-// Trigger MSBuild to compile the MDB_Core project
+// Invoked once per complete line of MSBuild output, from the reader thread.
+using BuildOutputCallback = std::function<void(const std::string& line)>;
+
+// Launch MSBuild for the given project and return immediately.
+// Returns false (with the reason in *error_message) if the process could not
+// be started. Only one build can be in flight at a time.
+bool StartBuildAsync(const std::string& project_path,
+                     BuildOutputCallback on_output,
+                     std::string* error_message = nullptr);
+
+// Whether a build started by StartBuildAsync() is still running.
+bool IsBuildRunning();
+
+// Block until the in-flight build completes and return its result.
+// Returns a failed BuildResult if no build was ever started.
+BuildResult WaitForBuild();
+
+// Returns true when the generated sources match the hash manifest recorded
+// after the last successful build — the compile can be skipped entirely
+// without spawning MSBuild (or even vswhere).
+bool IsBuildCurrent(const std::string& project_path);
+
+// Queue background native-image (NGEN) generation for the built SDK if the
+// current build hasn't been queued yet. Called automatically after every
+// successful build; exposed so the build-skip path can cover installs whose
+// last build predates the warm-up. Best-effort and returns immediately.
+void EnsureNativeImage(const std::string& project_path);
+
+// Trigger MSBuild to compile the MDB_Core project (synchronous wrapper)
 BuildResult TriggerBuild(const std::string& project_path);
 
 // Find MSBuild.exe in standard locations
 std::string FindMSBuild();
 
+// Host-provided hook for the in-process compile path: runs a static
+// managed method (assembly, type, method, string argument) in the hosted
+// CLR's default AppDomain and returns its int result. Registered by
+// dllmain once the CLR is up; the build worker waits for it, and falls
+// back to MSBuild if it never arrives.
+using ManagedExecuteFn = int(*)(const wchar_t* assembly, const wchar_t* type,
+                                const wchar_t* method, const wchar_t* argument);
+void SetManagedExecutor(ManagedExecuteFn fn);
+
 } // namespace Build
 } // namespace MDB
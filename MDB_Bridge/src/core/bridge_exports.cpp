@@ -4,46 +4,57 @@
 // Implements all P/Invoke exported functions using il2cpp_resolver.hpp
 
 #include "bridge_exports.h"
+#include "etw_provider.hpp"
+#include "log_backend.hpp"
+#include "mem_stats.hpp"
+#include "event_ring.hpp"
+#include "thread_pool.hpp"
 #include "il2cpp/il2cpp_resolver.hpp"
+#include "il2cpp/metadata_cache.hpp"
+#include "il2cpp/dump_snapshot.hpp"
 
 #include <string>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
 #include <cstdio>
+#include <array>
+#include <utility>
+#include <intrin.h>
 
 // MinHook for function hooking
 #include <MinHook.h>
 #define MDB_HAS_MINHOOK 1
 
-// Debug logging - writes to both debugger output and a log file
-static FILE* g_log_file = nullptr;
-static std::mutex g_log_mutex;
-
+// Debug logging — formats locally and hands the record to the shared
+// async backend (the drain thread forwards to the debugger when one is
+// attached). No mutex, no OutputDebugStringA on the caller's thread.
 static void mdb_debug_log(const char* fmt, ...) {
-    std::lock_guard<std::mutex> lock(g_log_mutex);
-    
     char buffer[1024];
     va_list args;
     va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    int n = vsnprintf(buffer, sizeof(buffer), fmt, args);
     va_end(args);
-    
-    // Output to debugger
-    OutputDebugStringA("[MDB_Bridge] ");
-    OutputDebugStringA(buffer);
-    OutputDebugStringA("\n");
-    
-    // // Also write to log file
-    // if (!g_log_file) {
-    //     g_log_file = fopen("mdb_bridge_debug.log", "w");
-    // }
-    // if (g_log_file) {
-    //     fprintf(g_log_file, "[MDB_Bridge] %s\n", buffer);
-    //     fflush(g_log_file);
-    // }
+
+    if (n < 0) {
+        return;
+    }
+    size_t len = static_cast<size_t>(n) < sizeof(buffer) ? static_cast<size_t>(n)
+                                                         : sizeof(buffer) - 1;
+    MDB::Log::Enqueue(buffer, len);
 }
 
-// Thread-local error storage
-static thread_local std::string g_last_error;
+// Thread-local error storage. Every message passed to set_error is a static
+// string literal (to_string also returns literals), so the error path just
+// stores a code plus a pointer — no allocation or string churn on the
+// millions of clear_error/set_error calls the exports make.
+static thread_local const char* g_last_error = nullptr;
 static thread_local MdbErrorCode g_last_error_code = MdbErrorCode::Success;
 
 static void set_error(MdbErrorCode code, const char* msg) {
@@ -58,13 +69,102 @@ static void set_error(MdbErrorCode code, Il2CppStatus status) {
 
 static void clear_error() {
     g_last_error_code = MdbErrorCode::Success;
-    g_last_error.clear();
+    g_last_error = nullptr;
+}
+
+// ==============================
+// Export Call Instrumentation
+// ==============================
+
+// Opt-in per-export call counting and cycle-timer latency. Each instrumented
+// export registers one slot lazily via a function-local static, so the table
+// only holds exports that actually ran. Disabled, the cost is one relaxed
+// atomic load per call.
+static std::atomic<bool> g_export_stats_enabled{ false };
+
+struct ExportStat {
+    const char* name = nullptr;
+    std::atomic<uint64_t> calls{ 0 };
+    std::atomic<uint64_t> cycles{ 0 };
+};
+
+static constexpr int MDB_MAX_EXPORT_STATS = 128;
+static ExportStat g_export_stat_table[MDB_MAX_EXPORT_STATS];
+static std::atomic<int> g_export_stat_count{ 0 };
+
+static ExportStat* register_export_stat(const char* name) {
+    int index = g_export_stat_count.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MDB_MAX_EXPORT_STATS) return nullptr;
+    g_export_stat_table[index].name = name;
+    return &g_export_stat_table[index];
+}
+
+// RAII cycle timer; only usable in exports without __try (C2712)
+struct ExportTimer {
+    ExportStat* stat;
+    uint64_t start;
+
+    explicit ExportTimer(ExportStat* s) : stat(nullptr), start(0) {
+        if (s && g_export_stats_enabled.load(std::memory_order_relaxed)) {
+            stat = s;
+            start = __rdtsc();
+        }
+    }
+
+    ~ExportTimer() {
+        if (stat) {
+            stat->calls.fetch_add(1, std::memory_order_relaxed);
+            stat->cycles.fetch_add(__rdtsc() - start, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Drop at the top of an export to include it in the stats table
+#define MDB_PROFILE_EXPORT() \
+    static ExportStat* _mdb_profile_stat = register_export_stat(__FUNCTION__); \
+    ExportTimer _mdb_profile_timer(_mdb_profile_stat)
+
+MDB_API void mdb_export_stats_set_enabled(bool enabled) {
+    g_export_stats_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+MDB_API bool mdb_export_stats_is_enabled() {
+    return g_export_stats_enabled.load(std::memory_order_relaxed);
+}
+
+MDB_API void mdb_export_stats_reset() {
+    int count = g_export_stat_count.load(std::memory_order_relaxed);
+    if (count > MDB_MAX_EXPORT_STATS) count = MDB_MAX_EXPORT_STATS;
+    for (int i = 0; i < count; i++) {
+        g_export_stat_table[i].calls.store(0, std::memory_order_relaxed);
+        g_export_stat_table[i].cycles.store(0, std::memory_order_relaxed);
+    }
+}
+
+MDB_API int mdb_get_export_stats(MdbExportStat* out_stats, int cap) {
+    if (!out_stats || cap <= 0) return 0;
+
+    int count = g_export_stat_count.load(std::memory_order_relaxed);
+    if (count > MDB_MAX_EXPORT_STATS) count = MDB_MAX_EXPORT_STATS;
+
+    int written = 0;
+    for (int i = 0; i < count && written < cap; i++) {
+        const ExportStat& stat = g_export_stat_table[i];
+        if (!stat.name) continue;
+        out_stats[written].name = stat.name;
+        out_stats[written].calls = stat.calls.load(std::memory_order_relaxed);
+        out_stats[written].cycles = stat.cycles.load(std::memory_order_relaxed);
+        written++;
+    }
+    return written;
 }
 
 // ==============================
 // Initialization
 // ==============================
 
+static bool ensure_minhook_initialized();  // defined with the hooking system below
+
 MDB_API int mdb_init() {
     clear_error();
     auto result = il2cpp::init();
@@ -72,6 +172,21 @@ MDB_API int mdb_init() {
         set_error(MdbErrorCode::InitFailed, result);
         return static_cast<int>(MdbErrorCode::InitFailed);
     }
+
+#if MDB_HAS_MINHOOK
+    // Reserve executable trampoline memory near GameAssembly up front, so a
+    // hook installed mid-game (the usual lazy pattern for content-gated
+    // methods) is served from the pool instead of stalling on VirtualAlloc
+    // and page-permission flips.
+    if (ensure_minhook_initialized() && il2cpp::_internal::p_game_assembly) {
+        MH_PrewarmTrampolinePool(reinterpret_cast<void*>(il2cpp::_internal::p_game_assembly), 2);
+    }
+#endif
+
+    // Warm the shared worker pool so thread creation happens here, not in
+    // the middle of the first parallel dump/analysis phase.
+    MDB::Pool::Initialize();
+
     return 0;
 }
 
@@ -91,6 +206,101 @@ MDB_API void* mdb_domain_get() {
     return il2cpp::_internal::il2cpp_domain_get();
 }
 
+// ==============================
+// IL2CPP Runtime Readiness Signal
+// ==============================
+// The startup pipeline used to discover runtime readiness by polling
+// il2cpp_domain_get on a 10 ms timer — fixed sleeps either waste time or
+// fire too early and force retries. Arming the signal installs a one-shot
+// hook on il2cpp_init that flips a manual-reset event the moment the game
+// finishes initializing the runtime, so the gate wakes within microseconds
+// of the runtime being usable. If the runtime is already up when arming,
+// the event is set immediately; if the hook cannot be installed, waiting
+// falls back to the old poll cadence.
+
+static HANDLE g_runtime_ready_event = nullptr;    // manual-reset, process lifetime
+static std::atomic<bool> g_runtime_ready_armed{ false };
+static bool g_runtime_ready_hooked = false;
+
+#if MDB_HAS_MINHOOK
+static int (*g_il2cpp_init_original)(const char*) = nullptr;
+
+static int hooked_il2cpp_init(const char* domain_name) {
+    int result = g_il2cpp_init_original(domain_name);
+    if (g_runtime_ready_event) {
+        SetEvent(g_runtime_ready_event);
+    }
+    return result;
+}
+#endif
+
+static bool runtime_domain_up() {
+    if (il2cpp::_internal::ensure_exports() != Il2CppStatus::OK) return false;
+    return il2cpp::_internal::il2cpp_domain_get &&
+           il2cpp::_internal::il2cpp_domain_get() != nullptr;
+}
+
+MDB_API bool mdb_arm_runtime_ready_signal() {
+    clear_error();
+    if (g_runtime_ready_armed.exchange(true)) {
+        return g_runtime_ready_event != nullptr;
+    }
+
+    g_runtime_ready_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!g_runtime_ready_event) {
+        set_error(MdbErrorCode::InitFailed, "Failed to create runtime readiness event");
+        return false;
+    }
+
+    // Injection raced past il2cpp_init — nothing left to wait for
+    if (runtime_domain_up()) {
+        SetEvent(g_runtime_ready_event);
+        return true;
+    }
+
+#if MDB_HAS_MINHOOK
+    HMODULE hGA = GetModuleHandleW(L"GameAssembly.dll");
+    void* target = hGA ? reinterpret_cast<void*>(GetProcAddress(hGA, "il2cpp_init")) : nullptr;
+    if (target && ensure_minhook_initialized()) {
+        if (MH_CreateHook(target, reinterpret_cast<void*>(&hooked_il2cpp_init),
+                          reinterpret_cast<void**>(&g_il2cpp_init_original)) == MH_OK &&
+            MH_EnableHook(target) == MH_OK) {
+            g_runtime_ready_hooked = true;
+            // Close the arming race: il2cpp_init may have completed between
+            // the probe above and the hook going live
+            if (runtime_domain_up()) {
+                SetEvent(g_runtime_ready_event);
+            }
+            return true;
+        }
+    }
+#endif
+
+    // No hook — mdb_wait_runtime_ready falls back to polling
+    return true;
+}
+
+MDB_API bool mdb_wait_runtime_ready(int timeout_ms) {
+    clear_error();
+    if (runtime_domain_up()) return true;
+    if (timeout_ms < 0) timeout_ms = 0;
+
+    if (g_runtime_ready_hooked && g_runtime_ready_event) {
+        if (WaitForSingleObject(g_runtime_ready_event,
+                                static_cast<DWORD>(timeout_ms)) == WAIT_OBJECT_0) {
+            return runtime_domain_up();
+        }
+        return false;
+    }
+
+    // Poll fallback, same 10 ms cadence the startup gate used
+    for (int waited = 0; waited < timeout_ms; waited += 10) {
+        Sleep(10);
+        if (runtime_domain_up()) return true;
+    }
+    return false;
+}
+
 MDB_API void* mdb_thread_attach(void* domain) {
     clear_error();
     auto status = il2cpp::_internal::ensure_exports();
@@ -112,6 +322,7 @@ MDB_API void* mdb_thread_attach(void* domain) {
 // ==============================
 
 MDB_API void* mdb_find_class(const char* assembly, const char* ns, const char* name) {
+    MDB_PROFILE_EXPORT();
     clear_error();
     if (!assembly || !ns || !name) {
         set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: assembly, ns, and name are required");
@@ -150,23 +361,47 @@ MDB_API int mdb_get_class_size(void* klass) {
 // Method Resolution & Invocation
 // ==============================
 
+// Method resolution cache: (klass, name, param_count) -> il2cppMethodInfo*.
+// Generated SDK wrappers re-resolve the same methods on every scene load;
+// the cache turns repeat lookups (including the 0-16 arity probe loop when
+// param_count < 0) into a single hash probe. MethodInfo pointers are stable
+// runtime metadata, so entries never need invalidation.
+static std::unordered_map<std::string, void*> g_method_cache;
+static std::shared_mutex g_method_cache_mutex;
+
+static std::string make_method_cache_key(void* klass, const char* name, int param_count) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%p|%d|", klass, param_count);
+    return std::string(buffer) + name;
+}
+
 MDB_API void* mdb_get_method(void* klass, const char* name, int param_count) {
+    MDB_PROFILE_EXPORT();
     clear_error();
     if (!klass || !name) {
         set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: klass and name are required");
         return nullptr;
     }
-    
+
+    std::string cache_key = make_method_cache_key(klass, name, param_count);
+    {
+        std::shared_lock<std::shared_mutex> lock(g_method_cache_mutex);
+        auto it = g_method_cache.find(cache_key);
+        if (it != g_method_cache.end()) {
+            return it->second;
+        }
+    }
+
     auto status = il2cpp::_internal::ensure_exports();
     if (status != Il2CppStatus::OK) {
         set_error(MdbErrorCode::NotInitialized, status);
         return nullptr;
     }
-    
+
     auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    
+
     il2cpp::_internal::unity_structs::il2cppMethodInfo* method = nullptr;
-    
+
     if (param_count >= 0) {
         method = il2cpp::_internal::il2cpp_class_get_method_from_name(il2cpp_klass, name, param_count);
     } else {
@@ -175,12 +410,17 @@ MDB_API void* mdb_get_method(void* klass, const char* name, int param_count) {
             method = il2cpp::_internal::il2cpp_class_get_method_from_name(il2cpp_klass, name, i);
         }
     }
-    
+
     if (!method) {
         set_error(MdbErrorCode::MethodNotFound, "Method not found");
         return nullptr;
     }
-    
+
+    {
+        std::unique_lock<std::shared_mutex> lock(g_method_cache_mutex);
+        g_method_cache.emplace(std::move(cache_key), method);
+    }
+
     return method;
 }
 
@@ -196,6 +436,8 @@ MDB_API void* mdb_get_method_pointer(void* method) {
 }
 
 MDB_API void* mdb_invoke_method(void* method, void* instance, void** args, void** exception) {
+    MDB_PROFILE_EXPORT();
+    MDB::Events::Count(MDB::Events::Kind::Invoke);
     clear_error();
     if (!method) {
         set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
@@ -233,829 +475,1766 @@ MDB_API void* mdb_invoke_method(void* method, void* instance, void** args, void*
             *exception = exc;
         }
     }
-    
+
     return result;
 }
 
 // ==============================
-// Generic Method Inflation
+// Typed Invoke Variants
 // ==============================
-
-MDB_API void* mdb_inflate_generic_method(void* method, void** type_classes, int type_count) {
-    clear_error();
-    if (!method || !type_classes || type_count <= 0) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for generic inflation");
-        return nullptr;
-    }
-
-    auto status = il2cpp::ensure_thread_attached();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::ThreadNotAttached, status);
+// mdb_invoke_method returns a boxed object even for primitive-returning
+// methods, forcing managed callers to unbox every sampled int/float/bool.
+// These variants unbox natively and return the primitive by value, so
+// getter-heavy callers allocate no boxed object per call. Width conversions
+// follow the method's return type (mdb_method_get_return_type), so e.g. a
+// byte-returning method read through the i4 variant extends correctly.
+
+static void* unbox_invoke_result(void* boxed) {
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+    if (!il2cpp_object_unbox_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_object_unbox not available");
         return nullptr;
     }
+    return il2cpp_object_unbox_fn(boxed);
+}
 
-    using namespace il2cpp::_internal;
-    namespace us = il2cpp::_internal::unity_structs;
+static int invoke_result_type_enum(void* method) {
+    void* returnType = mdb_method_get_return_type(method);
+    return returnType ? mdb_type_get_type_enum(returnType) : 0;
+}
 
-    // Verify we have all the required exports
-    if (!il2cpp_method_get_object || !il2cpp_method_get_from_reflection ||
-        !il2cpp_type_get_object || !il2cpp_class_get_type || !il2cpp_object_get_class ||
-        !il2cpp_array_new || !il2cpp_runtime_invoke || !il2cpp_class_from_name ||
-        !il2cpp_class_get_method_from_name) {
-        set_error(MdbErrorCode::ExportNotFound, "Missing IL2CPP exports for generic inflation");
-        return nullptr;
+MDB_API int32_t mdb_invoke_method_i4(void* method, void* instance, void** args, void** exception) {
+    void* boxed = mdb_invoke_method(method, instance, args, exception);
+    if (!boxed) return 0;
+    int typeEnum = invoke_result_type_enum(method);
+    void* payload = unbox_invoke_result(boxed);
+    if (!payload) return 0;
+    switch (typeEnum) {
+        case 0x02: return *static_cast<uint8_t*>(payload) ? 1 : 0;  // IL2CPP_TYPE_BOOLEAN
+        case 0x04: return *static_cast<int8_t*>(payload);           // IL2CPP_TYPE_I1
+        case 0x05: return *static_cast<uint8_t*>(payload);          // IL2CPP_TYPE_U1
+        case 0x06: return *static_cast<int16_t*>(payload);          // IL2CPP_TYPE_I2
+        case 0x03:                                                  // IL2CPP_TYPE_CHAR
+        case 0x07: return *static_cast<uint16_t*>(payload);         // IL2CPP_TYPE_U2
+        default:   return *static_cast<int32_t*>(payload);          // I4/U4/enum
     }
+}
 
-    auto* mi = reinterpret_cast<us::il2cppMethodInfo*>(method);
+MDB_API int64_t mdb_invoke_method_i8(void* method, void* instance, void** args, void** exception) {
+    void* boxed = mdb_invoke_method(method, instance, args, exception);
+    if (!boxed) return 0;
+    int typeEnum = invoke_result_type_enum(method);
+    void* payload = unbox_invoke_result(boxed);
+    if (!payload) return 0;
+    switch (typeEnum) {
+        case 0x02: return *static_cast<uint8_t*>(payload) ? 1 : 0;  // IL2CPP_TYPE_BOOLEAN
+        case 0x04: return *static_cast<int8_t*>(payload);           // IL2CPP_TYPE_I1
+        case 0x05: return *static_cast<uint8_t*>(payload);          // IL2CPP_TYPE_U1
+        case 0x06: return *static_cast<int16_t*>(payload);          // IL2CPP_TYPE_I2
+        case 0x03:                                                  // IL2CPP_TYPE_CHAR
+        case 0x07: return *static_cast<uint16_t*>(payload);         // IL2CPP_TYPE_U2
+        case 0x08: return *static_cast<int32_t*>(payload);          // IL2CPP_TYPE_I4
+        case 0x09: return *static_cast<uint32_t*>(payload);         // IL2CPP_TYPE_U4
+        default:   return *static_cast<int64_t*>(payload);          // I8/U8
+    }
+}
 
-    // 1. Get the MethodInfo as an IL2CPP reflection object (System.Reflection.MethodInfo)
-    auto* reflMethod = il2cpp_method_get_object(mi, mi->m_pClass);
-    if (!reflMethod) {
-        set_error(MdbErrorCode::NullPointer, "il2cpp_method_get_object returned null");
-        return nullptr;
+MDB_API float mdb_invoke_method_r4(void* method, void* instance, void** args, void** exception) {
+    void* boxed = mdb_invoke_method(method, instance, args, exception);
+    if (!boxed) return 0.0f;
+    int typeEnum = invoke_result_type_enum(method);
+    void* payload = unbox_invoke_result(boxed);
+    if (!payload) return 0.0f;
+    if (typeEnum == 0x0d) {  // IL2CPP_TYPE_R8
+        return static_cast<float>(*static_cast<double*>(payload));
     }
+    return *static_cast<float*>(payload);
+}
 
-    // 2. Build a System.Type[] array with the type arguments
-    //    First, find the System.Type Il2CppClass so we can create an array of that type
-    auto* reflMethodClass = reinterpret_cast<us::il2cppClass*>(il2cpp_object_get_class(reflMethod));
-    if (!reflMethodClass) {
-        set_error(MdbErrorCode::NullPointer, "Could not get class of reflection method");
-        return nullptr;
+MDB_API double mdb_invoke_method_r8(void* method, void* instance, void** args, void** exception) {
+    void* boxed = mdb_invoke_method(method, instance, args, exception);
+    if (!boxed) return 0.0;
+    int typeEnum = invoke_result_type_enum(method);
+    void* payload = unbox_invoke_result(boxed);
+    if (!payload) return 0.0;
+    if (typeEnum == 0x0c) {  // IL2CPP_TYPE_R4
+        return static_cast<double>(*static_cast<float*>(payload));
     }
+    return *static_cast<double*>(payload);
+}
 
-    // Find System.Type class via the mscorlib/corlib image
-    us::il2cppClass* systemTypeClass = nullptr;
-    {
-        auto domain = il2cpp_domain_get ? il2cpp_domain_get() : nullptr;
-        if (!domain) {
-            set_error(MdbErrorCode::NotInitialized, "Domain unavailable");
-            return nullptr;
-        }
-        size_t asmCount = 0;
-        auto assemblies = il2cpp_domain_get_assemblies(domain, &asmCount);
-        for (size_t i = 0; i < asmCount && !systemTypeClass; ++i) {
-            auto img = il2cpp_assembly_get_image(assemblies[i]);
-            if (!img) continue;
-            systemTypeClass = il2cpp_class_from_name(img, "System", "Type");
+MDB_API void* mdb_invoke_method_ptr(void* method, void* instance, void** args, void** exception) {
+    void* boxed = mdb_invoke_method(method, instance, args, exception);
+    if (!boxed) return nullptr;
+    switch (invoke_result_type_enum(method)) {
+        case 0x0f:            // IL2CPP_TYPE_PTR
+        case 0x18:            // IL2CPP_TYPE_I (IntPtr)
+        case 0x19:            // IL2CPP_TYPE_U (UIntPtr)
+        case 0x1b: {          // IL2CPP_TYPE_FNPTR
+            void* payload = unbox_invoke_result(boxed);
+            return payload ? *static_cast<void**>(payload) : nullptr;
         }
+        default:
+            // Reference-type results are already the object pointer
+            return boxed;
     }
-    if (!systemTypeClass) {
-        set_error(MdbErrorCode::ClassNotFound, "Could not find System.Type class");
-        return nullptr;
-    }
+}
 
-    // Create a System.Type[] array
-    auto* typeArray = il2cpp_array_new(systemTypeClass, type_count);
-    if (!typeArray) {
-        set_error(MdbErrorCode::NullPointer, "Failed to create Type[] array");
-        return nullptr;
+// ==============================
+// Exception Details
+// ==============================
+// mdb_invoke_method keeps its throw path allocation-free: it hands back the
+// raw exception pointer and nothing else. Callers that wanted to know what
+// happened then performed several more managed invokes (get_Message,
+// get_StackTrace) — 4+ transitions per failure, which adds up in try-invoke
+// loops during API discovery. mdb_exception_get_info extracts type name,
+// message, and stack trace natively in one call, and only for callers that
+// ask; passing a null buffer skips that field entirely.
+
+// il2cpp_class_get_method_from_name does not search parents, and the
+// Message/StackTrace getters live on System.Exception, not the thrown
+// subclass — walk the class chain.
+static void* find_method_in_hierarchy(void* klass, const char* name) {
+    static auto il2cpp_class_get_parent_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_parent")
+    );
+    while (klass) {
+        auto* method = il2cpp::_internal::il2cpp_class_get_method_from_name(
+            reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass), name, 0);
+        if (method) return method;
+        if (!il2cpp_class_get_parent_fn) return nullptr;
+        klass = il2cpp_class_get_parent_fn(klass);
     }
+    return nullptr;
+}
 
-    // IL2CPP array layout: 4 pointers header (klass, monitor, bounds, max_length) then elements
-    // For reference type arrays, elements are void* (pointers to objects)
-    void** elements = reinterpret_cast<void**>(reinterpret_cast<char*>(typeArray) + sizeof(void*) * 4);
+// Invoke a zero-argument string getter on the exception object and convert
+// the result in place. A failed or throwing getter leaves an empty string —
+// detail extraction must never raise a second error.
+static void fill_exception_string(void* exception_obj, void* getter,
+                                  char* buffer, int buffer_size) {
+    if (!buffer || buffer_size <= 0) return;
+    buffer[0] = '\0';
+    if (!getter) return;
 
-    for (int i = 0; i < type_count; ++i) {
-        auto* argClass = reinterpret_cast<us::il2cppClass*>(type_classes[i]);
-        if (!argClass) {
-            set_error(MdbErrorCode::NullPointer, "Null type class argument");
-            return nullptr;
-        }
-        auto* argType = il2cpp_class_get_type(argClass);
-        if (!argType) {
-            set_error(MdbErrorCode::NullPointer, "il2cpp_class_get_type returned null");
-            return nullptr;
-        }
-        auto* argReflType = il2cpp_type_get_object(argType);
-        if (!argReflType) {
-            set_error(MdbErrorCode::NullPointer, "il2cpp_type_get_object returned null");
-            return nullptr;
-        }
-        elements[i] = argReflType;
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    if (!il2cpp_runtime_invoke_fn) return;
+
+    void* exc = nullptr;
+    void* str = il2cpp_runtime_invoke_fn(getter, exception_obj, nullptr, &exc);
+    if (exc || !str) return;
+    mdb_string_to_utf8(str, buffer, buffer_size);
+}
+
+MDB_API bool mdb_exception_get_info(void* exception,
+                                    char* type_buffer, int type_buffer_size,
+                                    char* message_buffer, int message_buffer_size,
+                                    char* stack_buffer, int stack_buffer_size) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!exception) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: exception is null");
+        return false;
     }
 
-    // 3. Find MakeGenericMethod on the reflection MethodInfo class
-    //    Walk up the class hierarchy to find it (may be on MethodInfo base class)
-    us::il2cppMethodInfo* makeGenericMethodDef = nullptr;
-    auto* searchClass = reflMethodClass;
-    while (searchClass && !makeGenericMethodDef) {
-        makeGenericMethodDef = il2cpp_class_get_method_from_name(searchClass, "MakeGenericMethod", 1);
-        if (!makeGenericMethodDef) {
-            searchClass = il2cpp_class_get_parent(searchClass);
-        }
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return false;
     }
 
-    if (!makeGenericMethodDef) {
-        set_error(MdbErrorCode::MethodNotFound, "Could not find MakeGenericMethod on MethodInfo");
-        return nullptr;
+    static auto il2cpp_object_get_class_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_get_class")
+    );
+    if (!il2cpp_object_get_class_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_object_get_class not available");
+        return false;
     }
 
-    // 4. Call MakeGenericMethod(Type[] typeArguments) on the reflection method
-    void* invokeArgs[] = { typeArray };
-    void* exc = nullptr;
-    auto* inflatedReflMethod = il2cpp_runtime_invoke(makeGenericMethodDef, reflMethod, invokeArgs, &exc);
-    if (exc || !inflatedReflMethod) {
-        set_error(MdbErrorCode::ExceptionThrown, "MakeGenericMethod threw an exception");
-        return nullptr;
+    void* klass = il2cpp_object_get_class_fn(exception);
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Exception object has no class");
+        return false;
     }
 
-    // 5. Get the underlying MethodInfo* from the inflated reflection method
-    auto* inflatedMethod = il2cpp_method_get_from_reflection(inflatedReflMethod);
-    if (!inflatedMethod) {
-        set_error(MdbErrorCode::NullPointer, "il2cpp_method_get_from_reflection returned null");
-        return nullptr;
+    if (type_buffer && type_buffer_size > 0) {
+        auto* k = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+        const char* ns = k->m_pNamespace;
+        const char* name = k->m_pName ? k->m_pName : "";
+        if (ns && ns[0]) {
+            snprintf(type_buffer, type_buffer_size, "%s.%s", ns, name);
+        } else {
+            snprintf(type_buffer, type_buffer_size, "%s", name);
+        }
     }
 
-    return const_cast<us::il2cppMethodInfo*>(inflatedMethod);
+    fill_exception_string(exception, find_method_in_hierarchy(klass, "get_Message"),
+                          message_buffer, message_buffer_size);
+    fill_exception_string(exception, find_method_in_hierarchy(klass, "get_StackTrace"),
+                          stack_buffer, stack_buffer_size);
+    return true;
 }
 
-MDB_API void* mdb_method_get_param_type(void* method, int index) {
+MDB_API int mdb_invoke_batch(MdbInvokeCommand* commands, int count) {
+    MDB_PROFILE_EXPORT();
     clear_error();
-    if (!method) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
-        return nullptr;
+    if (!commands || count < 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: commands is required and count must be >= 0");
+        return -1;
     }
-    
-    // Use the official IL2CPP API instead of direct struct access
-    // This handles struct layout differences between Unity versions
-    static auto il2cpp_method_get_param_fn = reinterpret_cast<const void*(*)(void*, uint32_t)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_param")
-    );
-    
-    if (!il2cpp_method_get_param_fn) {
-        // Fallback to direct struct access if API not available
-        auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
-        
-        if (index < 0 || index >= mi->m_uArgsCount) {
-            set_error(MdbErrorCode::InvalidArgument, "Parameter index out of range");
-            return nullptr;
-        }
-        
-        if (!mi->m_pParameters) {
-            set_error(MdbErrorCode::InvalidArgument, "Method has no parameter info");
-            return nullptr;
-        }
-        
-        return mi->m_pParameters[index].m_pParameterType;
-    }
-    
-    // Use the official API - returns Il2CppType* directly
-    return const_cast<void*>(il2cpp_method_get_param_fn(method, static_cast<uint32_t>(index)));
-}
 
-MDB_API void* mdb_method_get_return_type(void* method) {
-    clear_error();
-    if (!method) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
-        return nullptr;
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return -1;
     }
-    
-    // Use the official IL2CPP API instead of direct struct access
-    static auto il2cpp_method_get_return_type_fn = reinterpret_cast<const void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_return_type")
+
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
     );
-    
-    if (!il2cpp_method_get_return_type_fn) {
-        // Fallback to direct struct access
-        auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
-        return mi->m_pReturnType;
-    }
-    
-    return const_cast<void*>(il2cpp_method_get_return_type_fn(method));
-}
 
-MDB_API int mdb_type_get_type_enum(void* type) {
-    clear_error();
-    if (!type) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: type is null");
+    if (!il2cpp_runtime_invoke_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_runtime_invoke not available");
         return -1;
     }
-    
-    // Use the official IL2CPP API instead of direct struct access
-    static auto il2cpp_type_get_type_fn = reinterpret_cast<int(*)(const void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_type")
-    );
-    
-    if (!il2cpp_type_get_type_fn) {
-        // Fallback to direct struct access
-        auto* il2cpp_type = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppType*>(type);
-        return static_cast<int>(il2cpp_type->m_uType);
+
+    MDB::Events::Count(MDB::Events::Kind::Invoke, static_cast<uint64_t>(count));
+
+    // Duration measurement only when an ETW session is recording
+    const bool etw = MDB::Etw::Enabled();
+    LARGE_INTEGER batchStart{};
+    if (etw) QueryPerformanceCounter(&batchStart);
+
+    int succeeded = 0;
+    for (int i = 0; i < count; ++i) {
+        auto& cmd = commands[i];
+        cmd.result = nullptr;
+        cmd.exception = nullptr;
+
+        if (!cmd.method) {
+            continue;
+        }
+
+        void* exc = nullptr;
+        cmd.result = il2cpp_runtime_invoke_fn(cmd.method, cmd.instance, cmd.args, &exc);
+        if (exc) {
+            cmd.exception = exc;
+        } else {
+            ++succeeded;
+        }
     }
-    
-    return il2cpp_type_get_type_fn(type);
+
+    if (etw) {
+        LARGE_INTEGER batchEnd, freq;
+        QueryPerformanceCounter(&batchEnd);
+        QueryPerformanceFrequency(&freq);
+        MDB::Etw::InvokeBatch(count, succeeded,
+            (batchEnd.QuadPart - batchStart.QuadPart) * 1000.0 / freq.QuadPart);
+    }
+
+    return succeeded;
 }
 
 // ==============================
-// Field Access
+// Direct Invocation Fast Path
 // ==============================
+// il2cpp_runtime_invoke boxes every argument and dispatches generically,
+// costing roughly 10x a direct call. For non-virtual, non-generic methods
+// whose arity was checked via mdb_get_method_info, we call m_pMethodPointer
+// directly with native argument passing through a per-arity dispatcher.
+
+static void* invoke_direct_dispatch(void* fn, void** a, int n) {
+    using P = void*;
+    switch (n) {
+    case 0:  return reinterpret_cast<P(__fastcall*)()>(fn)();
+    case 1:  return reinterpret_cast<P(__fastcall*)(P)>(fn)(a[0]);
+    case 2:  return reinterpret_cast<P(__fastcall*)(P, P)>(fn)(a[0], a[1]);
+    case 3:  return reinterpret_cast<P(__fastcall*)(P, P, P)>(fn)(a[0], a[1], a[2]);
+    case 4:  return reinterpret_cast<P(__fastcall*)(P, P, P, P)>(fn)(a[0], a[1], a[2], a[3]);
+    case 5:  return reinterpret_cast<P(__fastcall*)(P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4]);
+    case 6:  return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5]);
+    case 7:  return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+    case 8:  return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+    case 9:  return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8]);
+    case 10: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9]);
+    case 11: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10]);
+    case 12: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11]);
+    case 13: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11], a[12]);
+    case 14: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11], a[12], a[13]);
+    case 15: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11], a[12], a[13], a[14]);
+    case 16: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11], a[12], a[13], a[14], a[15]);
+    case 17: return reinterpret_cast<P(__fastcall*)(P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P, P)>(fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9], a[10], a[11], a[12], a[13], a[14], a[15], a[16]);
+    }
+    return nullptr;
+}
 
-MDB_API void* mdb_get_field(void* klass, const char* name) {
+MDB_API void* mdb_invoke_method_direct(void* method, void* instance, void** args, int arg_count) {
+    MDB::Events::Count(MDB::Events::Kind::Invoke);
     clear_error();
-    if (!klass || !name) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: klass and name are required");
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
         return nullptr;
     }
-    
-    auto status = il2cpp::_internal::ensure_exports();
+    if (arg_count < 0 || arg_count > 16) {
+        set_error(MdbErrorCode::InvalidArgument, "arg_count must be between 0 and 16");
+        return nullptr;
+    }
+
+    auto status = il2cpp::ensure_thread_attached();
     if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
+        set_error(MdbErrorCode::ThreadNotAttached, status);
         return nullptr;
     }
-    
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    auto* field = il2cpp::_internal::il2cpp_class_get_field_from_name(il2cpp_klass, name);
-    
-    if (!field) {
-        set_error(MdbErrorCode::FieldNotFound, "Field not found");
+
+    auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
+    if (!mi->m_pMethodPointer) {
+        set_error(MdbErrorCode::InvalidMethod, "Method has no native function pointer");
         return nullptr;
     }
-    
-    return field;
-}
 
-MDB_API int mdb_get_field_offset(void* field) {
-    clear_error();
-    if (!field) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: field is null");
-        return -1;
+    // Virtual methods need vtable dispatch — route through runtime invoke
+    // METHOD_ATTRIBUTE_VIRTUAL = 0x0040, METHOD_ATTRIBUTE_STATIC = 0x0010
+    if (mi->m_uFlags & 0x0040) {
+        return mdb_invoke_method(method, instance, args, nullptr);
     }
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    return fi->m_iOffset;
-}
 
-MDB_API void mdb_field_get_value(void* instance, void* field, void* out_value) {
-    clear_error();
-    if (!instance || !field || !out_value) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
-        return;
+    const bool is_static = (mi->m_uFlags & 0x0010) != 0;
+
+    void* slots[17];
+    int n = 0;
+    if (!is_static) {
+        slots[n++] = instance;
     }
-    
-    auto status = il2cpp::_internal::ensure_exports();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
-        return;
+    for (int i = 0; i < arg_count; ++i) {
+        slots[n++] = args ? args[i] : nullptr;
     }
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    il2cpp::_internal::il2cpp_field_get_value(instance, fi, out_value);
-}
 
-MDB_API void mdb_field_set_value(void* instance, void* field, void* value) {
-    clear_error();
-    if (!instance || !field || !value) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
-        return;
+    void* result = nullptr;
+    __try {
+        result = invoke_direct_dispatch(mi->m_pMethodPointer, slots, n);
     }
-    
-    auto status = il2cpp::_internal::ensure_exports();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
-        return;
+    __except (EXCEPTION_EXECUTE_HANDLER) {
+        set_error(MdbErrorCode::InvocationFailed, "Access violation during direct invoke");
+        return nullptr;
     }
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    il2cpp::_internal::il2cpp_field_set_value(instance, fi, value);
+    return result;
 }
 
-MDB_API void mdb_field_static_get_value(void* field, void* out_value) {
+// ==============================
+// Vtable-Slot Virtual Dispatch
+// ==============================
+// IL2CPP codegen performs virtual calls by indexing the flat
+// VirtualInvokeData table at the tail of the class (mirrored in
+// unity_structs) — one load plus an indirect call. Routing mod-side
+// virtual calls through il2cpp_runtime_invoke instead pays boxing and
+// generic dispatch on every call. Resolve the slot once per call site via
+// mdb_method_get_vtable_slot, then dispatch with mdb_invoke_virtual_direct.
+
+static il2cpp::_internal::unity_structs::VirtualInvokeData* get_virtual_invoke_data(void* instance, int slot) {
+    namespace us = il2cpp::_internal::unity_structs;
+    if (!instance || slot < 0) return nullptr;
+
+    il2cpp::ensure_class_layout();
+
+    // The class pointer is the first word of every object header
+    auto* klass = *reinterpret_cast<uint8_t**>(instance);
+    if (!klass) return nullptr;
+
+    // Offsets derived from the compiled mirrors. If the runtime layout
+    // probe relocated instance_size, everything behind it (vtable_count and
+    // the vtable itself) shifted by the same amount, so apply that drift.
+    constexpr size_t kInstanceSizeCompiled = sizeof(us::Il2CppClass_1) + 2 * sizeof(void*) + offsetof(us::Il2CppClass_2, instance_size);
+    constexpr size_t kVTableCountCompiled  = sizeof(us::Il2CppClass_1) + 2 * sizeof(void*) + offsetof(us::Il2CppClass_2, vtable_count);
+    constexpr size_t kVTableCompiled       = sizeof(us::Il2CppClass_1) + 2 * sizeof(void*) + sizeof(us::Il2CppClass_2);
+    const ptrdiff_t drift = static_cast<ptrdiff_t>(il2cpp::_internal::g_class_layout.instance_size)
+                          - static_cast<ptrdiff_t>(kInstanceSizeCompiled);
+
+    uint16_t vtable_count = *reinterpret_cast<uint16_t*>(klass + kVTableCountCompiled + drift);
+    if (slot >= static_cast<int>(vtable_count)) return nullptr;
+
+    auto* vtable = reinterpret_cast<us::VirtualInvokeData*>(klass + kVTableCompiled + drift);
+    return &vtable[slot];
+}
+
+MDB_API int mdb_method_get_vtable_slot(void* method) {
     clear_error();
-    if (!field || !out_value) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
-        return;
-    }
-    
-    auto status = il2cpp::_internal::ensure_exports();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
-        return;
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
+        return -1;
     }
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    il2cpp::_internal::il2cpp_field_static_get_value(fi, out_value);
+
+    auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
+    // METHOD_ATTRIBUTE_VIRTUAL = 0x0040; 0xFFFF is kInvalidIl2CppMethodSlot
+    if (!(mi->m_uFlags & 0x0040)) return -1;
+    if (mi->m_uSlot == 0xFFFF) return -1;
+    return static_cast<int>(mi->m_uSlot);
 }
 
-MDB_API void mdb_field_static_set_value(void* field, void* value) {
+MDB_API void* mdb_object_resolve_virtual(void* instance, int slot) {
     clear_error();
-    if (!field || !value) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
-        return;
-    }
-    
-    auto status = il2cpp::_internal::ensure_exports();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
-        return;
+    auto* data = get_virtual_invoke_data(instance, slot);
+    if (!data) {
+        set_error(MdbErrorCode::InvalidArgument, "No vtable entry for slot");
+        return nullptr;
     }
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    il2cpp::_internal::il2cpp_field_static_set_value(fi, value);
+    return const_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(data->method);
 }
 
-// ==============================
-// Object Creation
-// ==============================
-
-MDB_API void* mdb_object_new(void* klass) {
+MDB_API void* mdb_invoke_virtual_direct(void* instance, int slot, void** args, int arg_count) {
+    MDB::Events::Count(MDB::Events::Kind::Invoke);
     clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+    if (!instance) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: instance is null");
         return nullptr;
     }
-    
-    auto status = il2cpp::_internal::ensure_exports();
-    if (status != Il2CppStatus::OK) {
-        set_error(MdbErrorCode::NotInitialized, status);
+    if (arg_count < 0 || arg_count > 15) {
+        set_error(MdbErrorCode::InvalidArgument, "arg_count must be between 0 and 15");
         return nullptr;
     }
-    
-    status = il2cpp::ensure_thread_attached();
+
+    auto status = il2cpp::ensure_thread_attached();
     if (status != Il2CppStatus::OK) {
         set_error(MdbErrorCode::ThreadNotAttached, status);
         return nullptr;
     }
-    
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    
-    if (!il2cpp::_internal::il2cpp_object_new) {
-        set_error(MdbErrorCode::ExportNotFound, "il2cpp_object_new not available");
+
+    auto* data = get_virtual_invoke_data(instance, slot);
+    if (!data || !data->methodPtr) {
+        set_error(MdbErrorCode::InvalidMethod, "No vtable entry for slot");
         return nullptr;
     }
-    
-    void* obj = il2cpp::_internal::il2cpp_object_new(il2cpp_klass);
-    if (!obj) {
-        set_error(MdbErrorCode::AllocationFailed, "Failed to allocate object");
-        return nullptr;
+
+    // Codegen convention: (this, args..., const MethodInfo*) — the concrete
+    // method from the invoke data rides as the hidden trailing argument.
+    void* slots[17];
+    int n = 0;
+    slots[n++] = instance;
+    for (int i = 0; i < arg_count; ++i) {
+        slots[n++] = args ? args[i] : nullptr;
     }
-    
-    return obj;
-}
+    slots[n++] = const_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(data->method);
 
-MDB_API void* mdb_string_new(const char* str) {
-    clear_error();
-    if (!str) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: str is null");
-        return nullptr;
+    void* result = nullptr;
+    __try {
+        result = invoke_direct_dispatch(reinterpret_cast<void*>(data->methodPtr), slots, n);
     }
-    
-    auto result = il2cpp::String::CreateNewString(str);
-    if (!result) {
-        set_error(MdbErrorCode::AllocationFailed, result.status);
+    __except (EXCEPTION_EXECUTE_HANDLER) {
+        set_error(MdbErrorCode::InvocationFailed, "Access violation during virtual invoke");
         return nullptr;
     }
-    
-    return result.value;
+    return result;
 }
 
-MDB_API int mdb_string_to_utf8(void* str, char* buffer, int buffer_size) {
+// ==============================
+// Generic Method Inflation
+// ==============================
+
+// Inflation cache: (generic method definition, type argument classes) ->
+// inflated MethodInfo*. Inflation goes through managed reflection
+// (MakeGenericMethod) and is expensive; wrappers re-instantiate the same
+// List<T>-style accessors per call site, so repeats become a hash lookup.
+static std::unordered_map<std::string, void*> g_inflation_cache;
+static std::shared_mutex g_inflation_cache_mutex;
+
+static std::string make_inflation_cache_key(void* method, void** type_classes, int type_count) {
+    std::string key;
+    key.reserve(static_cast<size_t>(type_count + 1) * 20);
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%p", method);
+    key = buffer;
+    for (int i = 0; i < type_count; ++i) {
+        snprintf(buffer, sizeof(buffer), "|%p", type_classes[i]);
+        key += buffer;
+    }
+    return key;
+}
+
+MDB_API void* mdb_inflate_generic_method(void* method, void** type_classes, int type_count) {
     clear_error();
-    if (!str || !buffer || buffer_size <= 0) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
-        return -1;
+    if (!method || !type_classes || type_count <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for generic inflation");
+        return nullptr;
     }
-    
-    std::string utf8 = il2cpp::String::convert_to_std_string(str);
-    if (utf8.empty()) {
-        buffer[0] = '\0';
-        return 0;
+
+    std::string cache_key = make_inflation_cache_key(method, type_classes, type_count);
+    {
+        std::shared_lock<std::shared_mutex> lock(g_inflation_cache_mutex);
+        auto it = g_inflation_cache.find(cache_key);
+        if (it != g_inflation_cache.end()) {
+            return it->second;
+        }
     }
-    
-    int copy_size = static_cast<int>(utf8.size());
-    if (copy_size >= buffer_size) {
-        set_error(MdbErrorCode::BufferTooSmall, "Buffer too small for string");
-        copy_size = buffer_size - 1;
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return nullptr;
     }
-    
-    memcpy(buffer, utf8.c_str(), copy_size);
-    buffer[copy_size] = '\0';
-    
-    return copy_size;
-}
 
-// ==============================
-// Utilities
-// ==============================
+    using namespace il2cpp::_internal;
+    namespace us = il2cpp::_internal::unity_structs;
 
-MDB_API void* mdb_object_get_class(void* instance) {
-    clear_error();
-    if (!instance) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: instance is null");
+    // Verify we have all the required exports
+    if (!il2cpp_method_get_object || !il2cpp_method_get_from_reflection ||
+        !il2cpp_type_get_object || !il2cpp_class_get_type || !il2cpp_object_get_class ||
+        !il2cpp_array_new || !il2cpp_runtime_invoke || !il2cpp_class_from_name ||
+        !il2cpp_class_get_method_from_name) {
+        set_error(MdbErrorCode::ExportNotFound, "Missing IL2CPP exports for generic inflation");
         return nullptr;
     }
-    
-    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(instance);
-    return obj->m_pClass;
-}
 
-MDB_API const char* mdb_class_get_name(void* klass) {
-    clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+    auto* mi = reinterpret_cast<us::il2cppMethodInfo*>(method);
+
+    // 1. Get the MethodInfo as an IL2CPP reflection object (System.Reflection.MethodInfo)
+    auto* reflMethod = il2cpp_method_get_object(mi, mi->m_pClass);
+    if (!reflMethod) {
+        set_error(MdbErrorCode::NullPointer, "il2cpp_method_get_object returned null");
         return nullptr;
     }
-    
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    return il2cpp_klass->m_pName;
-}
 
-MDB_API const char* mdb_class_get_namespace(void* klass) {
-    clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+    // 2. Build a System.Type[] array with the type arguments
+    //    First, find the System.Type Il2CppClass so we can create an array of that type
+    auto* reflMethodClass = reinterpret_cast<us::il2cppClass*>(il2cpp_object_get_class(reflMethod));
+    if (!reflMethodClass) {
+        set_error(MdbErrorCode::NullPointer, "Could not get class of reflection method");
         return nullptr;
     }
-    
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    return il2cpp_klass->m_pNamespace;
-}
 
-MDB_API void* mdb_class_get_type(void* klass) {
-    clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
-        return nullptr;
+    // Find System.Type class via the mscorlib/corlib image
+    us::il2cppClass* systemTypeClass = nullptr;
+    {
+        auto domain = il2cpp_domain_get ? il2cpp_domain_get() : nullptr;
+        if (!domain) {
+            set_error(MdbErrorCode::NotInitialized, "Domain unavailable");
+            return nullptr;
+        }
+        size_t asmCount = 0;
+        auto assemblies = il2cpp_domain_get_assemblies(domain, &asmCount);
+        for (size_t i = 0; i < asmCount && !systemTypeClass; ++i) {
+            auto img = il2cpp_assembly_get_image(assemblies[i]);
+            if (!img) continue;
+            systemTypeClass = il2cpp_class_from_name(img, "System", "Type");
+        }
     }
-    
-    // Use il2cpp_class_get_type API
-    static auto il2cpp_class_get_type_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_type")
-    );
-    
-    if (!il2cpp_class_get_type_fn) {
-        set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_get_type not available");
+    if (!systemTypeClass) {
+        set_error(MdbErrorCode::ClassNotFound, "Could not find System.Type class");
         return nullptr;
     }
-    
-    return il2cpp_class_get_type_fn(klass);
-}
 
-MDB_API void* mdb_type_get_object(void* il2cpp_type) {
-    clear_error();
-    if (!il2cpp_type) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: il2cpp_type is null");
+    // Create a System.Type[] array
+    auto* typeArray = il2cpp_array_new(systemTypeClass, type_count);
+    if (!typeArray) {
+        set_error(MdbErrorCode::NullPointer, "Failed to create Type[] array");
         return nullptr;
     }
-    
-    // il2cpp_type_get_object returns a System.Type (Il2CppReflectionType*)
-    // We need to find and call this IL2CPP API function
-    static auto il2cpp_type_get_object_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_object")
-    );
-    
-    if (!il2cpp_type_get_object_fn) {
-        set_error(MdbErrorCode::ExportNotFound, "il2cpp_type_get_object not available");
+
+    // IL2CPP array layout: 4 pointers header (klass, monitor, bounds, max_length) then elements
+    // For reference type arrays, elements are void* (pointers to objects)
+    void** elements = reinterpret_cast<void**>(reinterpret_cast<char*>(typeArray) + sizeof(void*) * 4);
+
+    for (int i = 0; i < type_count; ++i) {
+        auto* argClass = reinterpret_cast<us::il2cppClass*>(type_classes[i]);
+        if (!argClass) {
+            set_error(MdbErrorCode::NullPointer, "Null type class argument");
+            return nullptr;
+        }
+        auto* argType = il2cpp_class_get_type(argClass);
+        if (!argType) {
+            set_error(MdbErrorCode::NullPointer, "il2cpp_class_get_type returned null");
+            return nullptr;
+        }
+        auto* argReflType = il2cpp_type_get_object(argType);
+        if (!argReflType) {
+            set_error(MdbErrorCode::NullPointer, "il2cpp_type_get_object returned null");
+            return nullptr;
+        }
+        elements[i] = argReflType;
+    }
+
+    // 3. Find MakeGenericMethod on the reflection MethodInfo class
+    //    Walk up the class hierarchy to find it (may be on MethodInfo base class)
+    us::il2cppMethodInfo* makeGenericMethodDef = nullptr;
+    auto* searchClass = reflMethodClass;
+    while (searchClass && !makeGenericMethodDef) {
+        makeGenericMethodDef = il2cpp_class_get_method_from_name(searchClass, "MakeGenericMethod", 1);
+        if (!makeGenericMethodDef) {
+            searchClass = il2cpp_class_get_parent(searchClass);
+        }
+    }
+
+    if (!makeGenericMethodDef) {
+        set_error(MdbErrorCode::MethodNotFound, "Could not find MakeGenericMethod on MethodInfo");
         return nullptr;
     }
-    
-    return il2cpp_type_get_object_fn(il2cpp_type);
-}
 
-// ==============================
-// Array Helpers
-// ==============================
+    // 4. Call MakeGenericMethod(Type[] typeArguments) on the reflection method
+    void* invokeArgs[] = { typeArray };
+    void* exc = nullptr;
+    auto* inflatedReflMethod = il2cpp_runtime_invoke(makeGenericMethodDef, reflMethod, invokeArgs, &exc);
+    if (exc || !inflatedReflMethod) {
+        set_error(MdbErrorCode::ExceptionThrown, "MakeGenericMethod threw an exception");
+        return nullptr;
+    }
 
-// IL2CPP array structure (simplified)
-struct Il2CppArraySize {
-    void* klass;
-    void* monitor;
-    void* bounds;
-    size_t max_length;
-    void* vector[1];  // Flexible array member
-};
+    // 5. Get the underlying MethodInfo* from the inflated reflection method
+    auto* inflatedMethod = il2cpp_method_get_from_reflection(inflatedReflMethod);
+    if (!inflatedMethod) {
+        set_error(MdbErrorCode::NullPointer, "il2cpp_method_get_from_reflection returned null");
+        return nullptr;
+    }
 
-MDB_API int mdb_array_length(void* array) {
-    clear_error();
-    if (!array) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
-        return 0;
+    auto* result = const_cast<us::il2cppMethodInfo*>(inflatedMethod);
+    {
+        std::unique_lock<std::shared_mutex> lock(g_inflation_cache_mutex);
+        g_inflation_cache.emplace(std::move(cache_key), result);
     }
-    
-    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
-    return static_cast<int>(arr->max_length);
+    return result;
 }
 
-MDB_API void* mdb_array_get_element(void* array, int index) {
+MDB_API void* mdb_method_get_param_type(void* method, int index) {
     clear_error();
-    if (!array) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
         return nullptr;
     }
     
-    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
-    if (index < 0 || index >= static_cast<int>(arr->max_length)) {
-        set_error(MdbErrorCode::InvalidArgument, "Index out of bounds");
-        return nullptr;
-    }
+    // Use the official IL2CPP API instead of direct struct access
+    // This handles struct layout differences between Unity versions
+    static auto il2cpp_method_get_param_fn = reinterpret_cast<const void*(*)(void*, uint32_t)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_param")
+    );
     
-    // Determine if this is a value-type array to use correct element addressing
-    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
-    if (obj->m_pClass) {
-        // Resolve IL2CPP API functions
-        static auto il2cpp_class_get_element_class_fn = reinterpret_cast<void*(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_element_class")
-        );
-        static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
-        );
-        static auto il2cpp_class_array_element_size_fn = reinterpret_cast<int(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_array_element_size")
-        );
+    if (!il2cpp_method_get_param_fn) {
+        // Fallback to direct struct access if API not available
+        auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
         
-        void* elementClass = nullptr;
-        if (il2cpp_class_get_element_class_fn) {
-            elementClass = il2cpp_class_get_element_class_fn(obj->m_pClass);
-        } else {
-            elementClass = obj->m_pClass->m_pElementClass;
+        if (index < 0 || index >= mi->m_uArgsCount) {
+            set_error(MdbErrorCode::InvalidArgument, "Parameter index out of range");
+            return nullptr;
         }
         
-        if (elementClass && il2cpp_class_is_valuetype_fn && il2cpp_class_is_valuetype_fn(elementClass)) {
-            // Value-type array: elements are stored inline at their actual size,
-            // NOT as pointer-sized slots. Compute address as base + index * element_size.
-            int elemSize = 0;
-            if (il2cpp_class_array_element_size_fn) {
-                elemSize = il2cpp_class_array_element_size_fn(elementClass);
-            }
-            if (elemSize > 0) {
-                return reinterpret_cast<char*>(arr->vector) + static_cast<size_t>(index) * elemSize;
-            }
-            // Fallback: can't determine element size, log warning and use pointer indexing
+        if (!mi->m_pParameters) {
+            set_error(MdbErrorCode::InvalidArgument, "Method has no parameter info");
+            return nullptr;
         }
+        
+        return mi->m_pParameters[index].m_pParameterType;
     }
     
-    // Reference-type array (or fallback): each slot is a pointer
-    return arr->vector[index];
+    // Use the official API - returns Il2CppType* directly
+    return const_cast<void*>(il2cpp_method_get_param_fn(method, static_cast<uint32_t>(index)));
 }
 
-MDB_API int mdb_array_get_element_size(void* array) {
+MDB_API void* mdb_method_get_return_type(void* method) {
     clear_error();
-    if (!array) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
-        return -1;
-    }
-    
-    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
-    if (!obj->m_pClass) {
-        set_error(MdbErrorCode::InvalidClass, "Array has no class");
-        return -1;
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
+        return nullptr;
     }
     
-    // Get element class
-    static auto il2cpp_class_get_element_class_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_element_class")
+    // Use the official IL2CPP API instead of direct struct access
+    static auto il2cpp_method_get_return_type_fn = reinterpret_cast<const void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_return_type")
     );
     
-    void* elementClass = nullptr;
-    if (il2cpp_class_get_element_class_fn) {
-        elementClass = il2cpp_class_get_element_class_fn(obj->m_pClass);
-    } else {
-        elementClass = obj->m_pClass->m_pElementClass;
+    if (!il2cpp_method_get_return_type_fn) {
+        // Fallback to direct struct access
+        auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
+        return mi->m_pReturnType;
     }
     
-    if (!elementClass) {
-        set_error(MdbErrorCode::InvalidClass, "Could not determine element class");
+    return const_cast<void*>(il2cpp_method_get_return_type_fn(method));
+}
+
+MDB_API int mdb_type_get_type_enum(void* type) {
+    clear_error();
+    if (!type) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: type is null");
         return -1;
     }
     
-    // Get element size via IL2CPP API
-    static auto il2cpp_class_array_element_size_fn = reinterpret_cast<int(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_array_element_size")
+    // Use the official IL2CPP API instead of direct struct access
+    static auto il2cpp_type_get_type_fn = reinterpret_cast<int(*)(const void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_type")
     );
     
-    if (il2cpp_class_array_element_size_fn) {
-        return il2cpp_class_array_element_size_fn(elementClass);
+    if (!il2cpp_type_get_type_fn) {
+        // Fallback to direct struct access
+        auto* il2cpp_type = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppType*>(type);
+        return static_cast<int>(il2cpp_type->m_uType);
     }
     
-    set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_array_element_size API not found");
-    return -1;
+    return il2cpp_type_get_type_fn(type);
 }
 
-MDB_API void* mdb_array_get_element_class(void* array) {
+// ==============================
+// Field Access
+// ==============================
+
+MDB_API void* mdb_get_field(void* klass, const char* name) {
     clear_error();
-    if (!array) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+    if (!klass || !name) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: klass and name are required");
         return nullptr;
     }
     
-    // Get the class of the array object
-    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
-    if (!obj->m_pClass) {
-        set_error(MdbErrorCode::InvalidClass, "Array has no class");
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
         return nullptr;
     }
     
-    // Use the official IL2CPP API to get element class - struct offsets vary between versions
-    static auto il2cpp_class_get_element_class_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_element_class")
-    );
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    auto* field = il2cpp::_internal::il2cpp_class_get_field_from_name(il2cpp_klass, name);
     
-    if (il2cpp_class_get_element_class_fn) {
-        return il2cpp_class_get_element_class_fn(obj->m_pClass);
+    if (!field) {
+        set_error(MdbErrorCode::FieldNotFound, "Field not found");
+        return nullptr;
     }
     
-    // Fallback to struct access if API not available (may not work on all IL2CPP versions)
-    set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_get_element_class API not found");
-    return obj->m_pClass->m_pElementClass;
+    return field;
 }
 
-MDB_API int mdb_class_is_valuetype(void* klass) {
+MDB_API int mdb_get_field_offset(void* field) {
     clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+    if (!field) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: field is null");
         return -1;
     }
     
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    
-    // Check the valuetype flag - it's in the bitfield section
-    // We need to use the IL2CPP API for this
-    static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
-    );
-    
-    if (il2cpp_class_is_valuetype_fn) {
-        return il2cpp_class_is_valuetype_fn(klass) ? 1 : 0;
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+    return fi->m_iOffset;
+}
+
+MDB_API void mdb_field_get_value(void* instance, void* field, void* out_value) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!instance || !field || !out_value) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return;
     }
     
-    // Fallback: Check if parent is System.ValueType
-    if (il2cpp_klass->m_pParentClass) {
-        const char* parentName = il2cpp_klass->m_pParentClass->m_pName;
-        if (parentName && strcmp(parentName, "ValueType") == 0) {
-            return 1;
-        }
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return;
     }
     
-    return 0;
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+    il2cpp::_internal::il2cpp_field_get_value(instance, fi, out_value);
 }
 
-MDB_API void* mdb_class_get_element_class(void* klass) {
+MDB_API void mdb_field_set_value(void* instance, void* field, void* value) {
+    MDB_PROFILE_EXPORT();
     clear_error();
-    if (!klass) {
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
-        return nullptr;
+    if (!instance || !field || !value) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return;
     }
     
-    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
-    return il2cpp_klass->m_pElementClass;
-}
-
-// ==============================
-// RVA-based Method Access
-// ==============================
-
-MDB_API void* mdb_get_gameassembly_base() {
-    clear_error();
     auto status = il2cpp::_internal::ensure_exports();
     if (status != Il2CppStatus::OK) {
         set_error(MdbErrorCode::NotInitialized, status);
-        return nullptr;
+        return;
     }
     
-    return reinterpret_cast<void*>(il2cpp::_internal::p_game_assembly);
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+    il2cpp::_internal::il2cpp_field_set_value(instance, fi, value);
 }
 
-MDB_API void* mdb_get_method_pointer_from_rva(uint64_t rva) {
+MDB_API void mdb_field_static_get_value(void* field, void* out_value) {
     clear_error();
+    if (!field || !out_value) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return;
+    }
+    
     auto status = il2cpp::_internal::ensure_exports();
     if (status != Il2CppStatus::OK) {
         set_error(MdbErrorCode::NotInitialized, status);
-        return nullptr;
+        return;
     }
     
-    if (!il2cpp::_internal::p_game_assembly) {
-        set_error(MdbErrorCode::GameAssemblyNotFound, "GameAssembly.dll not loaded");
-        return nullptr;
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+    il2cpp::_internal::il2cpp_field_static_get_value(fi, out_value);
+}
+
+MDB_API void mdb_field_static_set_value(void* field, void* value) {
+    clear_error();
+    if (!field || !value) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return;
     }
     
-    // Calculate absolute address: base + RVA
-    auto base = reinterpret_cast<uintptr_t>(il2cpp::_internal::p_game_assembly);
-    auto method_ptr = reinterpret_cast<void*>(base + rva);
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return;
+    }
     
-    return method_ptr;
-}
-
-MDB_API const char* mdb_get_last_error() {
-    return g_last_error.c_str();
-}
-
-MDB_API int mdb_get_last_error_code() {
-    return static_cast<int>(g_last_error_code);
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+    il2cpp::_internal::il2cpp_field_static_set_value(fi, value);
 }
 
 // ==============================
-// GameObject Component Helpers
+// Object Creation
 // ==============================
 
-// Cached method info for GetComponents
-static void* g_cached_getComponents_method = nullptr;
-static void* g_cached_component_type_object = nullptr;
-static bool g_getComponents_init_attempted = false;
-
-MDB_API void* mdb_gameobject_get_components(void* gameObject) {
-    mdb_debug_log("=== mdb_gameobject_get_components called ===");
-    mdb_debug_log("gameObject ptr: %p", gameObject);
+MDB_API void* mdb_object_new(void* klass) {
     clear_error();
-    
-    if (!gameObject) {
-        mdb_debug_log("ERROR: gameObject is null");
-        set_error(MdbErrorCode::NullPointer, "Invalid argument: gameObject is null");
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
         return nullptr;
     }
     
-    // Validate the pointer looks reasonable (basic sanity check)
-    // IL2CPP objects typically have a valid vtable pointer as their first field
-    __try {
-        void* vtable = *reinterpret_cast<void**>(gameObject);
-        if (!vtable) {
-            mdb_debug_log("ERROR: gameObject has null vtable - likely destroyed");
-            set_error(MdbErrorCode::NullPointer, "GameObject appears to be destroyed (null vtable)");
-            return nullptr;
-        }
-    } __except(EXCEPTION_EXECUTE_HANDLER) {
-        mdb_debug_log("ERROR: Exception reading gameObject vtable - invalid pointer");
-        set_error(MdbErrorCode::NullPointer, "GameObject pointer is invalid");
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
         return nullptr;
     }
     
-    auto status = il2cpp::ensure_thread_attached();
+    status = il2cpp::ensure_thread_attached();
     if (status != Il2CppStatus::OK) {
-        mdb_debug_log("ERROR: Thread not attached, status=%d", (int)status);
         set_error(MdbErrorCode::ThreadNotAttached, status);
         return nullptr;
     }
-    mdb_debug_log("Thread attached OK");
     
-    // Get required il2cpp functions (cached as static)
-    static auto il2cpp_class_get_method_from_name_fn = reinterpret_cast<void*(*)(void*, const char*, int)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_method_from_name")
-    );
-    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
-    );
-    static auto il2cpp_class_get_type_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_type")
-    );
-    static auto il2cpp_type_get_object_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_object")
-    );
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
     
-    mdb_debug_log("il2cpp functions: get_method=%p, invoke=%p, get_type=%p, type_get_object=%p",
-        il2cpp_class_get_method_from_name_fn, il2cpp_runtime_invoke_fn, 
-        il2cpp_class_get_type_fn, il2cpp_type_get_object_fn);
+    if (!il2cpp::_internal::il2cpp_object_new) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_object_new not available");
+        return nullptr;
+    }
     
-    if (!il2cpp_class_get_method_from_name_fn || !il2cpp_runtime_invoke_fn || 
-        !il2cpp_class_get_type_fn || !il2cpp_type_get_object_fn) {
-        mdb_debug_log("ERROR: Required IL2CPP exports not found");
-        set_error(MdbErrorCode::ExportNotFound, "Required IL2CPP exports not found");
+    void* obj = il2cpp::_internal::il2cpp_object_new(il2cpp_klass);
+    if (!obj) {
+        set_error(MdbErrorCode::AllocationFailed, "Failed to allocate object");
         return nullptr;
     }
     
-    // Cache the Component type object and GetComponents method (only try once)
-    if (!g_getComponents_init_attempted) {
-        mdb_debug_log("First call - initializing cache...");
-        g_getComponents_init_attempted = true;
-        
-        // Use mdb_find_class which is already proven to work
-        mdb_debug_log("Looking for GameObject class...");
-        void* gameObjectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "GameObject");
-        mdb_debug_log("gameObjectClass = %p", gameObjectClass);
-        if (!gameObjectClass) {
-            mdb_debug_log("ERROR: GameObject class not found");
-            set_error(MdbErrorCode::ClassNotFound, "GameObject class not found via mdb_find_class");
-            return nullptr;
-        }
-        
-        mdb_debug_log("Looking for Component class...");
-        void* componentClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "Component");
-        mdb_debug_log("componentClass = %p", componentClass);
-        if (!componentClass) {
-            mdb_debug_log("ERROR: Component class not found");
-            set_error(MdbErrorCode::ClassNotFound, "Component class not found via mdb_find_class");
-            return nullptr;
-        }
-        
-        // Get GetComponentsInternal method - the non-generic internal method
-        // Signature: GetComponentsInternal(Type type, bool useSearchTypeAsArrayReturnType, 
-        //                                  bool recursive, bool includeInactive, bool reverse, object resultList)
-        mdb_debug_log("Looking for GetComponentsInternal method...");
-        
-        static auto il2cpp_class_get_methods_fn = reinterpret_cast<void*(*)(void*, void**)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_methods")
-        );
-        static auto il2cpp_method_get_name_fn = reinterpret_cast<const char*(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_name")
-        );
-        static auto il2cpp_method_get_param_count_fn = reinterpret_cast<uint32_t(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_param_count")
-        );
-        static auto il2cpp_method_is_generic_fn = reinterpret_cast<bool(*)(void*)>(
-            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_is_generic")
-        );
-        
-        // Find GetComponentsInternal (6 params, non-generic)
-        if (il2cpp_class_get_methods_fn && il2cpp_method_get_name_fn && il2cpp_method_get_param_count_fn) {
-            void* iter = nullptr;
-            void* method;
-            while ((method = il2cpp_class_get_methods_fn(gameObjectClass, &iter)) != nullptr) {
+    return obj;
+}
+
+// ==============================
+// GC-Safe Object Handles
+// ==============================
+
+// Wraps IL2CPP GC handles behind a native slot table so mods hold a stable
+// 64-bit handle (generation << 32 | index, like the hook table) instead of a
+// raw il2cppObject* that the GC can move or free. Resolution is one lock-free
+// table read plus il2cpp_gchandle_get_target — no find-class/find-object
+// re-walk per frame.
+static constexpr int MDB_MAX_GCHANDLES = 4096;
+
+struct GcHandleSlot {
+    uint32_t il2cpp_handle = 0;
+    std::atomic<bool> in_use{ false };
+    uint32_t generation = 0;
+};
+
+static GcHandleSlot g_gchandle_slots[MDB_MAX_GCHANDLES];
+static std::mutex g_gchandle_mutex;  // guards slot allocation/release only
+
+static GcHandleSlot* gchandle_slot_from_handle(int64_t handle) {
+    int index = static_cast<int>(handle & 0xFFFFFFFF);
+    uint32_t generation = static_cast<uint32_t>(handle >> 32);
+    if (index < 0 || index >= MDB_MAX_GCHANDLES || generation == 0) return nullptr;
+
+    GcHandleSlot& slot = g_gchandle_slots[index];
+    if (!slot.in_use.load(std::memory_order_acquire)) return nullptr;
+    if (slot.generation != generation) return nullptr;
+    return &slot;
+}
+
+MDB_API int64_t mdb_gchandle_new(void* instance, bool pinned) {
+    clear_error();
+    if (!instance) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: instance is null");
+        return -1;
+    }
+
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return -1;
+    }
+
+    static auto il2cpp_gchandle_new_fn = reinterpret_cast<uint32_t(*)(void*, bool)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_new")
+    );
+
+    if (!il2cpp_gchandle_new_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_gchandle_new not available");
+        return -1;
+    }
+
+    uint32_t gcHandle = il2cpp_gchandle_new_fn(instance, pinned);
+    if (gcHandle == 0) {
+        set_error(MdbErrorCode::AllocationFailed, "il2cpp_gchandle_new failed");
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(g_gchandle_mutex);
+    for (int i = 0; i < MDB_MAX_GCHANDLES; i++) {
+        GcHandleSlot& slot = g_gchandle_slots[i];
+        if (slot.in_use.load(std::memory_order_relaxed)) continue;
+        slot.generation++;
+        slot.il2cpp_handle = gcHandle;
+        slot.in_use.store(true, std::memory_order_release);
+        return (static_cast<int64_t>(slot.generation) << 32) | static_cast<uint32_t>(i);
+    }
+
+    // Table full — release the IL2CPP handle again
+    static auto il2cpp_gchandle_free_fn = reinterpret_cast<void(*)(uint32_t)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_free")
+    );
+    if (il2cpp_gchandle_free_fn) il2cpp_gchandle_free_fn(gcHandle);
+    set_error(MdbErrorCode::AllocationFailed, "GC handle table full");
+    return -1;
+}
+
+MDB_API void* mdb_gchandle_get(int64_t handle) {
+    clear_error();
+
+    GcHandleSlot* slot = gchandle_slot_from_handle(handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid or stale GC handle");
+        return nullptr;
+    }
+
+    static auto il2cpp_gchandle_get_target_fn = reinterpret_cast<void*(*)(uint32_t)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_get_target")
+    );
+
+    if (!il2cpp_gchandle_get_target_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_gchandle_get_target not available");
+        return nullptr;
+    }
+
+    // Null here means the object was collected (weak handles) — not an error
+    return il2cpp_gchandle_get_target_fn(slot->il2cpp_handle);
+}
+
+MDB_API int mdb_gchandle_free(int64_t handle) {
+    clear_error();
+
+    std::lock_guard<std::mutex> lock(g_gchandle_mutex);
+
+    GcHandleSlot* slot = gchandle_slot_from_handle(handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid or stale GC handle");
+        return -1;
+    }
+
+    static auto il2cpp_gchandle_free_fn = reinterpret_cast<void(*)(uint32_t)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_free")
+    );
+    if (il2cpp_gchandle_free_fn) {
+        il2cpp_gchandle_free_fn(slot->il2cpp_handle);
+    }
+
+    slot->il2cpp_handle = 0;
+    slot->in_use.store(false, std::memory_order_release);
+    return 0;
+}
+
+// ==============================
+// String Transcoding Fast Paths
+// ==============================
+// Chat-log and item-database mods push megabytes of string traffic per
+// minute through the string exports, and the overwhelming majority of that
+// content is plain ASCII. Both directions get an SSE2 ASCII fast path
+// (16 chars per iteration, always available on x64) that degrades to the
+// existing scalar/Win32 conversion at the first non-ASCII character.
+
+// Number of leading ASCII bytes in a UTF-8 buffer
+static size_t ascii_prefix_utf8(const char* src, size_t len) {
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(v) != 0) break;  // high bit set => non-ASCII
+    }
+    while (i < len && static_cast<unsigned char>(src[i]) < 0x80) ++i;
+    return i;
+}
+
+// ASCII-only string creation: widen bytes to UTF-16 code units with SSE2
+// and hand il2cpp_string_new_utf16 a ready buffer, skipping the runtime's
+// UTF-8 decode. Returns nullptr when the fast path does not apply.
+static void* string_new_ascii_fast(const char* str, size_t len) {
+    static auto il2cpp_string_new_utf16_fn = reinterpret_cast<void*(*)(const wchar_t*, int32_t)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_new_utf16")
+    );
+    if (!il2cpp_string_new_utf16_fn) return nullptr;
+    if (len == 0 || len > INT32_MAX) return nullptr;
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return nullptr;
+
+    wchar_t stack_buf[256];
+    std::vector<wchar_t> heap_buf;
+    wchar_t* dst = stack_buf;
+    if (len > 256) {
+        heap_buf.resize(len);
+        dst = heap_buf.data();
+    }
+
+    size_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+    for (; i < len; ++i) {
+        dst[i] = static_cast<wchar_t>(static_cast<unsigned char>(str[i]));
+    }
+
+    return il2cpp_string_new_utf16_fn(dst, static_cast<int32_t>(len));
+}
+
+MDB_API void* mdb_string_new(const char* str) {
+    clear_error();
+    if (!str) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: str is null");
+        return nullptr;
+    }
+
+    size_t len = strlen(str);
+    if (len > 0 && ascii_prefix_utf8(str, len) == len) {
+        if (void* fast = string_new_ascii_fast(str, len)) {
+            return fast;
+        }
+    }
+
+    auto result = il2cpp::String::CreateNewString(str);
+    if (!result) {
+        set_error(MdbErrorCode::AllocationFailed, result.status);
+        return nullptr;
+    }
+
+    return result.value;
+}
+
+// Interned string cache: mods pass the same literals repeatedly (method
+// names for SendMessage-style calls, UI strings, tag names), and each
+// mdb_string_new is a fresh allocation plus GC churn. Entries are rooted
+// with a pinned GC handle so the cached pointer stays valid across
+// collections; repeats become a hash lookup.
+static std::unordered_map<std::string, void*> g_interned_strings;
+static std::shared_mutex g_interned_strings_mutex;
+
+MDB_API void* mdb_string_new_interned(const char* str) {
+    clear_error();
+    if (!str) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: str is null");
+        return nullptr;
+    }
+
+    {
+        std::shared_lock<std::shared_mutex> lock(g_interned_strings_mutex);
+        auto it = g_interned_strings.find(str);
+        if (it != g_interned_strings.end()) {
+            return it->second;
+        }
+    }
+
+    auto result = il2cpp::String::CreateNewString(str);
+    if (!result) {
+        set_error(MdbErrorCode::AllocationFailed, result.status);
+        return nullptr;
+    }
+
+    static auto il2cpp_gchandle_new_fn = reinterpret_cast<uint32_t(*)(void*, bool)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_new")
+    );
+    if (!il2cpp_gchandle_new_fn) {
+        // Cannot root the string — return it uncached rather than hand out
+        // a pointer the GC is free to move or collect
+        return result.value;
+    }
+    il2cpp_gchandle_new_fn(result.value, true);
+
+    // Another thread may have interned the same content first; hand out
+    // whichever entry won (the extra handle just roots a duplicate string)
+    std::unique_lock<std::shared_mutex> lock(g_interned_strings_mutex);
+    return g_interned_strings.emplace(str, result.value).first->second;
+}
+
+MDB_API int mdb_string_to_utf8(void* str, char* buffer, int buffer_size) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!str || !buffer || buffer_size <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return -1;
+    }
+
+    static auto il2cpp_string_chars_fn = reinterpret_cast<wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+
+    if (il2cpp_string_chars_fn && il2cpp_string_length_fn) {
+        const wchar_t* src = il2cpp_string_chars_fn(str);
+        int len = il2cpp_string_length_fn(str);
+        if (!src || len <= 0) {
+            buffer[0] = '\0';
+            return 0;
+        }
+
+        // SSE2 ASCII fast path: pack 16 UTF-16 chars to 16 bytes per
+        // iteration straight into the caller's buffer; the Win32 transcoder
+        // only ever sees the non-ASCII remainder.
+        int ascii = 0;
+        const __m128i high_mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        while (ascii + 16 <= len && ascii + 16 < buffer_size) {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + ascii));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + ascii + 8));
+            __m128i nonAscii = _mm_or_si128(_mm_and_si128(lo, high_mask), _mm_and_si128(hi, high_mask));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + ascii), _mm_packus_epi16(lo, hi));
+            ascii += 16;
+        }
+        while (ascii < len && ascii < buffer_size - 1 && src[ascii] < 0x80) {
+            buffer[ascii] = static_cast<char>(src[ascii]);
+            ++ascii;
+        }
+
+        if (ascii == len) {
+            buffer[ascii] = '\0';
+            return ascii;
+        }
+        if (ascii >= buffer_size - 1) {
+            set_error(MdbErrorCode::BufferTooSmall, "Buffer too small for string");
+            buffer[buffer_size - 1] = '\0';
+            return buffer_size - 1;
+        }
+
+        int written = ::WideCharToMultiByte(CP_UTF8, 0,
+            reinterpret_cast<LPCWCH>(src + ascii), len - ascii,
+            buffer + ascii, buffer_size - 1 - ascii, nullptr, nullptr);
+        if (written > 0) {
+            buffer[ascii + written] = '\0';
+            return ascii + written;
+        }
+
+        // Remainder does not fit: transcode it off to the side and truncate,
+        // preserving the historical partial-copy behavior
+        int required = ::WideCharToMultiByte(CP_UTF8, 0,
+            reinterpret_cast<LPCWCH>(src + ascii), len - ascii,
+            nullptr, 0, nullptr, nullptr);
+        if (required <= 0) {
+            buffer[ascii] = '\0';
+            return ascii;
+        }
+        std::string tail(static_cast<size_t>(required), '\0');
+        ::WideCharToMultiByte(CP_UTF8, 0,
+            reinterpret_cast<LPCWCH>(src + ascii), len - ascii,
+            tail.data(), required, nullptr, nullptr);
+        set_error(MdbErrorCode::BufferTooSmall, "Buffer too small for string");
+        int copy_size = buffer_size - 1 - ascii;
+        memcpy(buffer + ascii, tail.data(), copy_size);
+        buffer[ascii + copy_size] = '\0';
+        return ascii + copy_size;
+    }
+
+    // Fallback when the string accessors are unavailable on this runtime
+    std::string utf8 = il2cpp::String::convert_to_std_string(str);
+    if (utf8.empty()) {
+        buffer[0] = '\0';
+        return 0;
+    }
+
+    int copy_size = static_cast<int>(utf8.size());
+    if (copy_size >= buffer_size) {
+        set_error(MdbErrorCode::BufferTooSmall, "Buffer too small for string");
+        copy_size = buffer_size - 1;
+    }
+
+    memcpy(buffer, utf8.c_str(), copy_size);
+    buffer[copy_size] = '\0';
+
+    return copy_size;
+}
+
+MDB_API bool mdb_string_get_chars(void* str, wchar_t** out_data, int* out_len) {
+    clear_error();
+    if (!str || !out_data || !out_len) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments");
+        return false;
+    }
+    *out_data = nullptr;
+    *out_len = 0;
+
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return false;
+    }
+
+    static auto il2cpp_string_chars_fn = reinterpret_cast<wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+
+    if (il2cpp_string_chars_fn && il2cpp_string_length_fn) {
+        *out_data = il2cpp_string_chars_fn(str);
+        *out_len = il2cpp_string_length_fn(str);
+        return *out_data != nullptr;
+    }
+
+    // Fallback: read the System_String_o layout directly (length field
+    // followed by the inline character data, as modeled in the resolver)
+    auto* sysStr = reinterpret_cast<il2cpp::_internal::unity_structs::System_String_o*>(str);
+    *out_data = reinterpret_cast<wchar_t*>(&sysStr->fields._firstChar);
+    *out_len = static_cast<int>(sysStr->fields._stringLength);
+    return true;
+}
+
+// ==============================
+// Utilities
+// ==============================
+
+MDB_API void* mdb_object_get_class(void* instance) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!instance) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: instance is null");
+        return nullptr;
+    }
+    
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(instance);
+    return obj->m_pClass;
+}
+
+MDB_API const char* mdb_class_get_name(void* klass) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+        return nullptr;
+    }
+    
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    return il2cpp_klass->m_pName;
+}
+
+MDB_API const char* mdb_class_get_namespace(void* klass) {
+    clear_error();
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+        return nullptr;
+    }
+    
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    return il2cpp_klass->m_pNamespace;
+}
+
+MDB_API void* mdb_class_get_type(void* klass) {
+    clear_error();
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+        return nullptr;
+    }
+    
+    // Use il2cpp_class_get_type API
+    static auto il2cpp_class_get_type_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_type")
+    );
+    
+    if (!il2cpp_class_get_type_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_get_type not available");
+        return nullptr;
+    }
+    
+    return il2cpp_class_get_type_fn(klass);
+}
+
+// Materialized System.Type objects per Il2CppType*, each rooted by a pinned
+// GC handle so the cached raw pointer stays valid. Reflection-driven mods
+// (the explorer's inspector in particular) request the same few hundred
+// Types every time a panel opens; a hit answers without crossing into
+// IL2CPP at all. Entries live for the process lifetime — Type objects are
+// effectively immortal anyway.
+static std::unordered_map<void*, void*> g_type_object_cache;
+static std::shared_mutex g_type_object_cache_mutex;
+
+MDB_API void* mdb_type_get_object(void* il2cpp_type) {
+    clear_error();
+    if (!il2cpp_type) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: il2cpp_type is null");
+        return nullptr;
+    }
+
+    {
+        std::shared_lock<std::shared_mutex> lock(g_type_object_cache_mutex);
+        auto it = g_type_object_cache.find(il2cpp_type);
+        if (it != g_type_object_cache.end()) {
+            return it->second;
+        }
+    }
+
+    // il2cpp_type_get_object returns a System.Type (Il2CppReflectionType*)
+    static auto il2cpp_type_get_object_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_object")
+    );
+    static auto il2cpp_gchandle_new_fn = reinterpret_cast<uint32_t(*)(void*, bool)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_gchandle_new")
+    );
+
+    if (!il2cpp_type_get_object_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_type_get_object not available");
+        return nullptr;
+    }
+
+    void* typeObject = il2cpp_type_get_object_fn(il2cpp_type);
+    if (!typeObject) {
+        return nullptr;
+    }
+
+    // Only cache a pointer we can root — without a GC handle the object
+    // could be collected out from under the cache
+    if (il2cpp_gchandle_new_fn) {
+        il2cpp_gchandle_new_fn(typeObject, true);
+        std::unique_lock<std::shared_mutex> lock(g_type_object_cache_mutex);
+        g_type_object_cache.emplace(il2cpp_type, typeObject);
+    }
+    return typeObject;
+}
+
+// ==============================
+// Array Helpers
+// ==============================
+
+// IL2CPP array structure (simplified)
+struct Il2CppArraySize {
+    void* klass;
+    void* monitor;
+    void* bounds;
+    size_t max_length;
+    void* vector[1];  // Flexible array member
+};
+
+MDB_API int mdb_array_length(void* array) {
+    clear_error();
+    if (!array) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+        return 0;
+    }
+    
+    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
+    return static_cast<int>(arr->max_length);
+}
+
+// Per-array-class element metadata. Element class, stride, and the
+// value-type flag are constant per array class but were re-derived through
+// IL2CPP calls on every query — array-processing loops interleave metadata
+// queries with element access, so the repeated work doubled their cost.
+// First query per array class populates the cache; everything after
+// (including every mdb_array_get_element call) answers from it.
+struct ArrayElementInfo {
+    void* element_class = nullptr;
+    int api_element_size = 0;        // il2cpp_class_array_element_size result
+    bool class_api_available = false;
+    bool size_api_available = false;
+    bool is_valuetype = false;
+};
+static std::unordered_map<void*, ArrayElementInfo> g_array_elem_cache;
+static std::shared_mutex g_array_elem_cache_mutex;
+
+static const ArrayElementInfo& array_element_info(void* arrayKlass) {
+    {
+        std::shared_lock<std::shared_mutex> lock(g_array_elem_cache_mutex);
+        auto it = g_array_elem_cache.find(arrayKlass);
+        if (it != g_array_elem_cache.end()) {
+            return it->second;
+        }
+    }
+
+    static auto il2cpp_class_get_element_class_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_element_class")
+    );
+    static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
+    );
+    static auto il2cpp_class_array_element_size_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_array_element_size")
+    );
+
+    ArrayElementInfo info;
+    info.class_api_available = il2cpp_class_get_element_class_fn != nullptr;
+    info.size_api_available = il2cpp_class_array_element_size_fn != nullptr;
+
+    if (il2cpp_class_get_element_class_fn) {
+        info.element_class = il2cpp_class_get_element_class_fn(arrayKlass);
+    } else {
+        // Struct access fallback — may not work on all IL2CPP versions
+        auto* klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(arrayKlass);
+        info.element_class = klass->m_pElementClass;
+    }
+
+    if (info.element_class) {
+        if (il2cpp_class_is_valuetype_fn) {
+            info.is_valuetype = il2cpp_class_is_valuetype_fn(info.element_class);
+        }
+        if (il2cpp_class_array_element_size_fn) {
+            info.api_element_size = il2cpp_class_array_element_size_fn(info.element_class);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(g_array_elem_cache_mutex);
+    return g_array_elem_cache.emplace(arrayKlass, info).first->second;
+}
+
+// Stride used for inline element addressing: value types are stored at
+// their actual size, reference types as pointer slots
+static int array_element_stride(const ArrayElementInfo& info) {
+    if (info.is_valuetype && info.api_element_size > 0) {
+        return info.api_element_size;
+    }
+    return static_cast<int>(sizeof(void*));
+}
+
+MDB_API void* mdb_array_get_element(void* array, int index) {
+    clear_error();
+    if (!array) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+        return nullptr;
+    }
+    
+    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
+    if (index < 0 || index >= static_cast<int>(arr->max_length)) {
+        set_error(MdbErrorCode::InvalidArgument, "Index out of bounds");
+        return nullptr;
+    }
+    
+    // Value-type arrays store elements inline at their actual size, NOT as
+    // pointer-sized slots — the cached metadata answers the distinction
+    // without any per-call IL2CPP work
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
+    if (obj->m_pClass) {
+        const ArrayElementInfo& info = array_element_info(obj->m_pClass);
+        if (info.is_valuetype && info.api_element_size > 0) {
+            return reinterpret_cast<char*>(arr->vector) + static_cast<size_t>(index) * info.api_element_size;
+        }
+    }
+
+    // Reference-type array (or fallback): each slot is a pointer
+    return arr->vector[index];
+}
+
+MDB_API int mdb_array_get_element_size(void* array) {
+    clear_error();
+    if (!array) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+        return -1;
+    }
+    
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
+    if (!obj->m_pClass) {
+        set_error(MdbErrorCode::InvalidClass, "Array has no class");
+        return -1;
+    }
+
+    const ArrayElementInfo& info = array_element_info(obj->m_pClass);
+    if (!info.element_class) {
+        set_error(MdbErrorCode::InvalidClass, "Could not determine element class");
+        return -1;
+    }
+    if (!info.size_api_available) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_array_element_size API not found");
+        return -1;
+    }
+    return info.api_element_size;
+}
+
+MDB_API void* mdb_array_get_element_class(void* array) {
+    clear_error();
+    if (!array) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: array is null");
+        return nullptr;
+    }
+    
+    // Get the class of the array object
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
+    if (!obj->m_pClass) {
+        set_error(MdbErrorCode::InvalidClass, "Array has no class");
+        return nullptr;
+    }
+
+    const ArrayElementInfo& info = array_element_info(obj->m_pClass);
+    if (!info.class_api_available) {
+        // Cached value came from struct access (may not work on all IL2CPP versions)
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_get_element_class API not found");
+    }
+    return info.element_class;
+}
+
+MDB_API int mdb_array_copy(void* array, int start, int count, void* out_buffer) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!array || !out_buffer) {
+        set_error(MdbErrorCode::NullPointer, "Invalid arguments: array and out_buffer are required");
+        return -1;
+    }
+
+    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
+    if (start < 0 || count < 0 || static_cast<size_t>(start) + static_cast<size_t>(count) > arr->max_length) {
+        set_error(MdbErrorCode::InvalidArgument, "Element range out of bounds");
+        return -1;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    // Element stride follows the same value-type/reference-type rules as
+    // mdb_array_get_element, answered from the per-array-class cache
+    int elemSize = static_cast<int>(sizeof(void*));
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
+    if (obj->m_pClass) {
+        elemSize = array_element_stride(array_element_info(obj->m_pClass));
+    }
+
+    size_t byteCount = static_cast<size_t>(count) * elemSize;
+    const char* src = reinterpret_cast<const char*>(arr->vector) + static_cast<size_t>(start) * elemSize;
+    memcpy(out_buffer, src, byteCount);
+    return static_cast<int>(byteCount);
+}
+
+MDB_API bool mdb_array_get_data(void* array, void** out_data, int* out_length, int* out_elem_size) {
+    clear_error();
+    if (out_data) *out_data = nullptr;
+    if (out_length) *out_length = 0;
+    if (out_elem_size) *out_elem_size = 0;
+    if (!array || !out_data) {
+        set_error(MdbErrorCode::NullPointer, "Invalid arguments: array and out_data are required");
+        return false;
+    }
+
+    auto* arr = reinterpret_cast<Il2CppArraySize*>(array);
+
+    // Element stride follows the same value-type/reference-type rules as
+    // mdb_array_get_element and mdb_array_copy, answered from the cache
+    int elemSize = static_cast<int>(sizeof(void*));
+    auto* obj = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppObject*>(array);
+    if (obj->m_pClass) {
+        elemSize = array_element_stride(array_element_info(obj->m_pClass));
+    }
+
+    *out_data = arr->vector;
+    if (out_length) *out_length = static_cast<int>(arr->max_length);
+    if (out_elem_size) *out_elem_size = elemSize;
+    return true;
+}
+
+MDB_API int mdb_class_is_valuetype(void* klass) {
+    clear_error();
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+        return -1;
+    }
+    
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    
+    // Check the valuetype flag - it's in the bitfield section
+    // We need to use the IL2CPP API for this
+    static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
+    );
+    
+    if (il2cpp_class_is_valuetype_fn) {
+        return il2cpp_class_is_valuetype_fn(klass) ? 1 : 0;
+    }
+    
+    // Fallback: Check if parent is System.ValueType
+    if (il2cpp_klass->m_pParentClass) {
+        const char* parentName = il2cpp_klass->m_pParentClass->m_pName;
+        if (parentName && strcmp(parentName, "ValueType") == 0) {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+MDB_API void* mdb_class_get_element_class(void* klass) {
+    clear_error();
+    if (!klass) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: klass is null");
+        return nullptr;
+    }
+    
+    auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    return il2cpp_klass->m_pElementClass;
+}
+
+// ==============================
+// RVA-based Method Access
+// ==============================
+
+MDB_API void* mdb_get_gameassembly_base() {
+    clear_error();
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return nullptr;
+    }
+    
+    return reinterpret_cast<void*>(il2cpp::_internal::p_game_assembly);
+}
+
+MDB_API void* mdb_get_method_pointer_from_rva(uint64_t rva) {
+    clear_error();
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return nullptr;
+    }
+    
+    if (!il2cpp::_internal::p_game_assembly) {
+        set_error(MdbErrorCode::GameAssemblyNotFound, "GameAssembly.dll not loaded");
+        return nullptr;
+    }
+    
+    // Calculate absolute address: base + RVA
+    auto base = reinterpret_cast<uintptr_t>(il2cpp::_internal::p_game_assembly);
+    auto method_ptr = reinterpret_cast<void*>(base + rva);
+    
+    return method_ptr;
+}
+
+MDB_API const char* mdb_get_last_error() {
+    return g_last_error ? g_last_error : "";
+}
+
+MDB_API int mdb_get_last_error_code() {
+    return static_cast<int>(g_last_error_code);
+}
+
+// ==============================
+// GameObject Component Helpers
+// ==============================
+
+// Cached method info for GetComponents
+static void* g_cached_getComponents_method = nullptr;
+static void* g_cached_component_type_object = nullptr;
+static bool g_getComponents_init_attempted = false;
+
+MDB_API void* mdb_gameobject_get_components(void* gameObject) {
+    mdb_debug_log("=== mdb_gameobject_get_components called ===");
+    mdb_debug_log("gameObject ptr: %p", gameObject);
+    clear_error();
+    
+    if (!gameObject) {
+        mdb_debug_log("ERROR: gameObject is null");
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: gameObject is null");
+        return nullptr;
+    }
+    
+    // Validate the pointer looks reasonable (basic sanity check)
+    // IL2CPP objects typically have a valid vtable pointer as their first field
+    __try {
+        void* vtable = *reinterpret_cast<void**>(gameObject);
+        if (!vtable) {
+            mdb_debug_log("ERROR: gameObject has null vtable - likely destroyed");
+            set_error(MdbErrorCode::NullPointer, "GameObject appears to be destroyed (null vtable)");
+            return nullptr;
+        }
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        mdb_debug_log("ERROR: Exception reading gameObject vtable - invalid pointer");
+        set_error(MdbErrorCode::NullPointer, "GameObject pointer is invalid");
+        return nullptr;
+    }
+    
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        mdb_debug_log("ERROR: Thread not attached, status=%d", (int)status);
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return nullptr;
+    }
+    mdb_debug_log("Thread attached OK");
+    
+    // Get required il2cpp functions (cached as static)
+    static auto il2cpp_class_get_method_from_name_fn = reinterpret_cast<void*(*)(void*, const char*, int)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_method_from_name")
+    );
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    static auto il2cpp_class_get_type_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_type")
+    );
+    static auto il2cpp_type_get_object_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_type_get_object")
+    );
+    
+    mdb_debug_log("il2cpp functions: get_method=%p, invoke=%p, get_type=%p, type_get_object=%p",
+        il2cpp_class_get_method_from_name_fn, il2cpp_runtime_invoke_fn, 
+        il2cpp_class_get_type_fn, il2cpp_type_get_object_fn);
+    
+    if (!il2cpp_class_get_method_from_name_fn || !il2cpp_runtime_invoke_fn || 
+        !il2cpp_class_get_type_fn || !il2cpp_type_get_object_fn) {
+        mdb_debug_log("ERROR: Required IL2CPP exports not found");
+        set_error(MdbErrorCode::ExportNotFound, "Required IL2CPP exports not found");
+        return nullptr;
+    }
+    
+    // Cache the Component type object and GetComponents method (only try once)
+    if (!g_getComponents_init_attempted) {
+        mdb_debug_log("First call - initializing cache...");
+        g_getComponents_init_attempted = true;
+        
+        // Use mdb_find_class which is already proven to work
+        mdb_debug_log("Looking for GameObject class...");
+        void* gameObjectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "GameObject");
+        mdb_debug_log("gameObjectClass = %p", gameObjectClass);
+        if (!gameObjectClass) {
+            mdb_debug_log("ERROR: GameObject class not found");
+            set_error(MdbErrorCode::ClassNotFound, "GameObject class not found via mdb_find_class");
+            return nullptr;
+        }
+        
+        mdb_debug_log("Looking for Component class...");
+        void* componentClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "Component");
+        mdb_debug_log("componentClass = %p", componentClass);
+        if (!componentClass) {
+            mdb_debug_log("ERROR: Component class not found");
+            set_error(MdbErrorCode::ClassNotFound, "Component class not found via mdb_find_class");
+            return nullptr;
+        }
+        
+        // Get GetComponentsInternal method - the non-generic internal method
+        // Signature: GetComponentsInternal(Type type, bool useSearchTypeAsArrayReturnType, 
+        //                                  bool recursive, bool includeInactive, bool reverse, object resultList)
+        mdb_debug_log("Looking for GetComponentsInternal method...");
+        
+        static auto il2cpp_class_get_methods_fn = reinterpret_cast<void*(*)(void*, void**)>(
+            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_methods")
+        );
+        static auto il2cpp_method_get_name_fn = reinterpret_cast<const char*(*)(void*)>(
+            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_name")
+        );
+        static auto il2cpp_method_get_param_count_fn = reinterpret_cast<uint32_t(*)(void*)>(
+            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_get_param_count")
+        );
+        static auto il2cpp_method_is_generic_fn = reinterpret_cast<bool(*)(void*)>(
+            GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_method_is_generic")
+        );
+        
+        // Find GetComponentsInternal (6 params, non-generic)
+        if (il2cpp_class_get_methods_fn && il2cpp_method_get_name_fn && il2cpp_method_get_param_count_fn) {
+            void* iter = nullptr;
+            void* method;
+            while ((method = il2cpp_class_get_methods_fn(gameObjectClass, &iter)) != nullptr) {
                 const char* methodName = il2cpp_method_get_name_fn(method);
                 if (methodName && strcmp(methodName, "GetComponentsInternal") == 0) {
                     uint32_t paramCount = il2cpp_method_get_param_count_fn(method);
@@ -1189,6 +2368,53 @@ MDB_API void* mdb_gameobject_get_components(void* gameObject) {
     return result;
 }
 
+MDB_API int mdb_gameobject_get_components_of_class(void* gameObject, void* klass, void** out, int cap) {
+    clear_error();
+    if (!gameObject || !klass || !out || cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for component query");
+        return -1;
+    }
+
+    // Reuses the GetComponentsInternal machinery (and its one-time cache)
+    void* componentsArray = mdb_gameobject_get_components(gameObject);
+    if (!componentsArray) {
+        return -1;  // error already set
+    }
+
+    static auto il2cpp_object_get_class_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_get_class")
+    );
+    static auto il2cpp_class_is_assignable_from_fn = reinterpret_cast<bool(*)(void*, void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_assignable_from")
+    );
+
+    if (!il2cpp_object_get_class_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_object_get_class not available");
+        return -1;
+    }
+
+    int len = mdb_array_length(componentsArray);
+    int matched = 0;
+    for (int i = 0; i < len && matched < cap; ++i) {
+        void* component = mdb_array_get_element(componentsArray, i);
+        if (!component) continue;
+
+        void* componentClass = il2cpp_object_get_class_fn(component);
+        if (!componentClass) continue;
+
+        // Subclass-aware match; exact-pointer compare if the assignability
+        // export is unavailable on this IL2CPP version
+        bool matches = il2cpp_class_is_assignable_from_fn
+            ? il2cpp_class_is_assignable_from_fn(klass, componentClass)
+            : (componentClass == klass);
+        if (matches) {
+            out[matched++] = component;
+        }
+    }
+
+    return matched;
+}
+
 MDB_API int mdb_components_array_length(void* componentsArray) {
     return mdb_array_length(componentsArray);
 }
@@ -1743,6 +2969,85 @@ MDB_API bool mdb_transform_set_local_scale(void* transform, float x, float y, fl
     return exc == nullptr;
 }
 
+// ==============================
+// Transform State Snapshot
+// ==============================
+// Position, rotation, and scale in one export (and a plural variant) so
+// per-frame overlays don't pay three thread-attach + invoke round trips
+// per transform.
+
+// Invokes one cached Vector3 getter; writes 3 floats. Zero-fills on failure.
+static bool transform_read_vec3(void* method, void* transform, float* out) {
+    out[0] = out[1] = out[2] = 0.0f;
+    if (!method) return false;
+
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+
+    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn) return false;
+
+    void* exc = nullptr;
+    void* result = nullptr;
+
+    __try {
+        result = il2cpp_runtime_invoke_fn(method, transform, nullptr, &exc);
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        return false;
+    }
+
+    if (exc || !result) return false;
+
+    UnityVector3* vec = (UnityVector3*)il2cpp_object_unbox_fn(result);
+    if (!vec) return false;
+
+    out[0] = vec->x;
+    out[1] = vec->y;
+    out[2] = vec->z;
+    return true;
+}
+
+MDB_API bool mdb_transform_get_trs(void* transform, float* out_trs) {
+    MDB_PROFILE_EXPORT();
+    if (!transform || !out_trs) return false;
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return false;
+
+    init_transform_property_helpers();
+
+    bool ok = transform_read_vec3(g_cached_get_localPosition_method, transform, out_trs);
+    ok &= transform_read_vec3(g_cached_get_localEulerAngles_method, transform, out_trs + 3);
+    ok &= transform_read_vec3(g_cached_get_localScale_method, transform, out_trs + 6);
+    return ok;
+}
+
+MDB_API int mdb_transform_get_trs_batch(void** transforms, int count, float* out_buffer) {
+    if (!transforms || !out_buffer || count < 0) return -1;
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return -1;
+
+    init_transform_property_helpers();
+
+    int succeeded = 0;
+    for (int i = 0; i < count; ++i) {
+        float* trs = out_buffer + static_cast<size_t>(i) * 9;
+        if (!transforms[i]) {
+            for (int j = 0; j < 9; ++j) trs[j] = 0.0f;
+            continue;
+        }
+        bool ok = transform_read_vec3(g_cached_get_localPosition_method, transforms[i], trs);
+        ok &= transform_read_vec3(g_cached_get_localEulerAngles_method, transforms[i], trs + 3);
+        ok &= transform_read_vec3(g_cached_get_localScale_method, transforms[i], trs + 6);
+        if (ok) ++succeeded;
+    }
+    return succeeded;
+}
+
 // ==============================
 // SceneManager Helper Functions
 // ==============================
@@ -1822,26 +3127,123 @@ MDB_API int mdb_scenemanager_get_scene_count() {
     int count = *unboxed;
     mdb_debug_log("Scene count: %d", count);
     
-    // Sanity check
-    if (count < 0 || count > 100) return 0;
+    // Sanity check
+    if (count < 0 || count > 100) return 0;
+    
+    return count;
+}
+
+// Scene struct layout in IL2CPP (Unity's Scene is a struct with just an int handle)
+struct UnityScene {
+    int handle;
+};
+
+MDB_API int mdb_scenemanager_get_scene_name(int sceneIndex, char* buffer, int bufferSize) {
+    if (!buffer || bufferSize <= 0) return 0;
+    buffer[0] = '\0';
+    
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return 0;
+    
+    init_scenemanager_helpers();
+    if (!g_cached_getSceneAt_method || !g_cached_scene_get_name_method) return 0;
+    
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+    static auto il2cpp_string_chars_fn = reinterpret_cast<const wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    
+    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn || !il2cpp_string_chars_fn) return 0;
+    
+    // Get scene at index
+    void* args[1] = { &sceneIndex };
+    void* exc = nullptr;
+    void* sceneBoxed = nullptr;
+    
+    __try {
+        sceneBoxed = il2cpp_runtime_invoke_fn(g_cached_getSceneAt_method, nullptr, args, &exc);
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        return 0;
+    }
+    
+    if (exc || !sceneBoxed) return 0;
+    
+    // Unbox to get Scene struct pointer
+    UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
+    if (!scene) return 0;
+    
+    // Call get_name on the scene (need to pass the unboxed struct)
+    // For instance methods on value types, we pass the unboxed struct pointer
+    void* nameResult = nullptr;
+    
+    __try {
+        nameResult = il2cpp_runtime_invoke_fn(g_cached_scene_get_name_method, scene, nullptr, &exc);
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        return 0;
+    }
+    
+    if (exc || !nameResult) return 0;
+    
+    // Convert IL2CPP string to char*
+    const wchar_t* wstr = il2cpp_string_chars_fn(nameResult);
+    if (!wstr) return 0;
+    
+    // Convert wchar_t to char
+    int written = 0;
+    for (int i = 0; i < bufferSize - 1 && wstr[i]; i++) {
+        buffer[i] = (char)wstr[i];
+        written++;
+    }
+    buffer[written] = '\0';
+    
+    return written;
+}
+
+MDB_API int mdb_scenemanager_get_scene_handle(int sceneIndex) {
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return -1;
+    
+    init_scenemanager_helpers();
+    if (!g_cached_getSceneAt_method) return -1;
+    
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+    
+    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn) return -1;
+    
+    void* args[1] = { &sceneIndex };
+    void* exc = nullptr;
+    void* sceneBoxed = nullptr;
+    
+    __try {
+        sceneBoxed = il2cpp_runtime_invoke_fn(g_cached_getSceneAt_method, nullptr, args, &exc);
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        return -1;
+    }
+    
+    if (exc || !sceneBoxed) return -1;
     
-    return count;
+    UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
+    if (!scene) return -1;
+    
+    return scene->handle;
 }
 
-// Scene struct layout in IL2CPP (Unity's Scene is a struct with just an int handle)
-struct UnityScene {
-    int handle;
-};
-
-MDB_API int mdb_scenemanager_get_scene_name(int sceneIndex, char* buffer, int bufferSize) {
-    if (!buffer || bufferSize <= 0) return 0;
-    buffer[0] = '\0';
-    
+MDB_API int mdb_scenemanager_get_scene_root_count(int sceneIndex) {
     auto status = il2cpp::ensure_thread_attached();
     if (status != Il2CppStatus::OK) return 0;
     
     init_scenemanager_helpers();
-    if (!g_cached_getSceneAt_method || !g_cached_scene_get_name_method) return 0;
+    if (!g_cached_getSceneAt_method || !g_cached_scene_get_rootCount_method) return 0;
     
     static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
         GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
@@ -1849,11 +3251,8 @@ MDB_API int mdb_scenemanager_get_scene_name(int sceneIndex, char* buffer, int bu
     static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
         GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
     );
-    static auto il2cpp_string_chars_fn = reinterpret_cast<const wchar_t*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
-    );
     
-    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn || !il2cpp_string_chars_fn) return 0;
+    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn) return 0;
     
     // Get scene at index
     void* args[1] = { &sceneIndex };
@@ -1868,150 +3267,1085 @@ MDB_API int mdb_scenemanager_get_scene_name(int sceneIndex, char* buffer, int bu
     
     if (exc || !sceneBoxed) return 0;
     
-    // Unbox to get Scene struct pointer
     UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
     if (!scene) return 0;
     
-    // Call get_name on the scene (need to pass the unboxed struct)
-    // For instance methods on value types, we pass the unboxed struct pointer
-    void* nameResult = nullptr;
+    // Call get_rootCount on the scene
+    void* rootCountResult = nullptr;
     
     __try {
-        nameResult = il2cpp_runtime_invoke_fn(g_cached_scene_get_name_method, scene, nullptr, &exc);
+        rootCountResult = il2cpp_runtime_invoke_fn(g_cached_scene_get_rootCount_method, scene, nullptr, &exc);
     } __except(EXCEPTION_EXECUTE_HANDLER) {
         return 0;
     }
     
-    if (exc || !nameResult) return 0;
+    if (exc || !rootCountResult) return 0;
     
-    // Convert IL2CPP string to char*
-    const wchar_t* wstr = il2cpp_string_chars_fn(nameResult);
-    if (!wstr) return 0;
+    int* unboxed = (int*)il2cpp_object_unbox_fn(rootCountResult);
+    if (!unboxed) return 0;
     
-    // Convert wchar_t to char
+    int count = *unboxed;
+    if (count < 0 || count > 100000) return 0;
+    
+    return count;
+}
+
+// Get DontDestroyOnLoad scene by finding a GameObject marked with DontDestroyOnLoad
+// Returns the scene handle, or -1 if not found
+// This works by getting a special scene that Unity uses for DontDestroyOnLoad objects
+MDB_API int mdb_get_dontdestroyonload_scene_handle() {
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) return -1;
+    
+    // The DontDestroyOnLoad scene has a specific name: "DontDestroyOnLoad"
+    // We can find it by checking all root objects and finding one in that scene
+    // However, a simpler approach: Unity's SceneManager.sceneCount doesn't include it
+    // The DDOL scene handle is typically a high number or specific value
+    
+    // Alternative: Use Scene.GetSceneByName which doesn't work for DDOL
+    // Best approach: Find any DDOL object and get its scene
+    
+    // For now, return -1 to indicate we'll handle this differently
+    // The C# code will detect DDOL objects by checking if their scene handle
+    // doesn't match any loaded scene
+    return -1;
+}
+
+// ==============================
+// GameObject Name Index
+// ==============================
+// Hash-of-name → object index populated by the snapshot walk and kept
+// current by the diff facility, so mdb_find_gameobject_by_name resolves
+// without marshaling the name of a single non-match. Keys are the same
+// FNV-1a over the UTF-16 name chars the diff uses for rename detection;
+// a 64-bit collision is treated as a match, exactly as the diff already
+// treats it as "not renamed".
+
+struct NameIndexEntry {
+    uint64_t name_hash;
+    void* gameObject;
+};
+static std::unordered_map<void*, NameIndexEntry> g_name_index_entries;  // transform → entry
+static std::unordered_multimap<uint64_t, void*> g_name_index;           // name hash → transform
+static std::mutex g_name_index_mutex;
+
+static uint64_t name_index_hash(const wchar_t* chars, int len) {
+    uint64_t h = 14695981039346656037ull;
+    for (int i = 0; i < len; ++i) {
+        h ^= static_cast<uint64_t>(chars[i]);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Insert or refresh one node. Caller holds g_name_index_mutex.
+static void name_index_put(void* transform, void* gameObject, uint64_t hash) {
+    auto it = g_name_index_entries.find(transform);
+    if (it != g_name_index_entries.end()) {
+        if (it->second.name_hash == hash) {
+            it->second.gameObject = gameObject;
+            return;
+        }
+        // Renamed: drop the stale hash bucket entry before re-keying
+        auto range = g_name_index.equal_range(it->second.name_hash);
+        for (auto b = range.first; b != range.second; ++b) {
+            if (b->second == transform) {
+                g_name_index.erase(b);
+                break;
+            }
+        }
+        it->second.name_hash = hash;
+        it->second.gameObject = gameObject;
+    } else {
+        g_name_index_entries.emplace(transform, NameIndexEntry{ hash, gameObject });
+    }
+    g_name_index.emplace(hash, transform);
+}
+
+// Drop one node. Caller holds g_name_index_mutex.
+static void name_index_remove(void* transform) {
+    auto it = g_name_index_entries.find(transform);
+    if (it == g_name_index_entries.end()) return;
+    auto range = g_name_index.equal_range(it->second.name_hash);
+    for (auto b = range.first; b != range.second; ++b) {
+        if (b->second == transform) {
+            g_name_index.erase(b);
+            break;
+        }
+    }
+    g_name_index_entries.erase(it);
+}
+
+MDB_API int mdb_find_gameobject_by_name(const char* name, void** out_objects, int object_cap) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!name || !out_objects || object_cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for name lookup");
+        return -1;
+    }
+
+    // The only string marshaled is the query itself, widened once to match
+    // the UTF-16 hashing the index uses
+    int wlen = ::MultiByteToWideChar(CP_UTF8, 0, name, -1, nullptr, 0);
+    if (wlen <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Query name is not valid UTF-8");
+        return -1;
+    }
+    std::vector<wchar_t> wname(static_cast<size_t>(wlen));
+    ::MultiByteToWideChar(CP_UTF8, 0, name, -1, wname.data(), wlen);
+    uint64_t hash = name_index_hash(wname.data(), wlen - 1);  // exclude the NUL
+
+    std::lock_guard<std::mutex> lock(g_name_index_mutex);
+    auto range = g_name_index.equal_range(hash);
+    int found = 0;
+    for (auto it = range.first; it != range.second && found < object_cap; ++it) {
+        auto entry = g_name_index_entries.find(it->second);
+        if (entry == g_name_index_entries.end()) continue;
+        out_objects[found++] = entry->second.gameObject;
+    }
+    return found;
+}
+
+// ==============================
+// Scene Hierarchy Snapshot
+// ==============================
+// Walks entire hierarchies natively and emits a flat record buffer, so
+// scene refreshes cost one P/Invoke instead of thousands of
+// child-count/get-child/get-name round trips.
+
+static void* g_cached_transform_get_gameObject_method = nullptr;
+static void* g_cached_object_get_name_method = nullptr;
+static void* g_cached_snapshot_activeSelf_method = nullptr;
+static bool g_snapshot_init_attempted = false;
+
+static void init_scene_snapshot_helpers() {
+    if (g_snapshot_init_attempted) return;
+    g_snapshot_init_attempted = true;
+
+    init_transform_helpers(); // childCount / GetChild
+    if (!g_cached_transform_class) return;
+
+    static auto il2cpp_class_get_method_from_name_fn = reinterpret_cast<void*(*)(void*, const char*, int)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_method_from_name")
+    );
+    if (!il2cpp_class_get_method_from_name_fn) return;
+
+    g_cached_transform_get_gameObject_method =
+        il2cpp_class_get_method_from_name_fn(g_cached_transform_class, "get_gameObject", 0);
+
+    void* objectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "Object");
+    if (objectClass) {
+        g_cached_object_get_name_method =
+            il2cpp_class_get_method_from_name_fn(objectClass, "get_name", 0);
+    }
+
+    void* gameObjectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "GameObject");
+    if (gameObjectClass) {
+        g_cached_snapshot_activeSelf_method =
+            il2cpp_class_get_method_from_name_fn(gameObjectClass, "get_activeSelf", 0);
+    }
+
+    mdb_debug_log("Scene snapshot helpers: getGO=%p, getName=%p, activeSelf=%p",
+        g_cached_transform_get_gameObject_method, g_cached_object_get_name_method,
+        g_cached_snapshot_activeSelf_method);
+}
+
+// SEH-guarded runtime invoke (POD locals only so __try is allowed)
+static void* snapshot_invoke(void* method, void* instance, void** args) {
+    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
+    );
+    if (!il2cpp_runtime_invoke_fn || !method) return nullptr;
+
+    void* exc = nullptr;
+    void* result = nullptr;
+    __try {
+        result = il2cpp_runtime_invoke_fn(method, instance, args, &exc);
+    } __except(EXCEPTION_EXECUTE_HANDLER) {
+        return nullptr;
+    }
+    return exc ? nullptr : result;
+}
+
+static int snapshot_invoke_int(void* method, void* instance, int fallback) {
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+    void* boxed = snapshot_invoke(method, instance, nullptr);
+    if (!boxed || !il2cpp_object_unbox_fn) return fallback;
+    int* unboxed = (int*)il2cpp_object_unbox_fn(boxed);
+    return unboxed ? *unboxed : fallback;
+}
+
+// Appends the object's name as NUL-terminated UTF-8; returns its offset or
+// -1. out_hash, when provided, receives the FNV-1a name hash for the name
+// index even when the buffer has no room left for the UTF-8 copy.
+static int snapshot_write_name(void* gameObject, char* name_buffer, int name_buffer_cap, int* name_used,
+                               uint64_t* out_hash = nullptr) {
+    static auto il2cpp_string_chars_fn = reinterpret_cast<const wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+
+    if (!name_buffer || !g_cached_object_get_name_method || !il2cpp_string_chars_fn) return -1;
+
+    void* nameStr = snapshot_invoke(g_cached_object_get_name_method, gameObject, nullptr);
+    if (!nameStr) return -1;
+
+    const wchar_t* wstr = il2cpp_string_chars_fn(nameStr);
+    if (!wstr) return -1;
+    int wlen = il2cpp_string_length_fn ? il2cpp_string_length_fn(nameStr) : static_cast<int>(wcslen(wstr));
+    if (wlen < 0) return -1;
+
+    if (out_hash) *out_hash = name_index_hash(wstr, wlen);
+
+    int remaining = name_buffer_cap - *name_used;
+    if (remaining <= 1) return -1;
+
+    int written = ::WideCharToMultiByte(CP_UTF8, 0, wstr, wlen,
+        name_buffer + *name_used, remaining - 1, nullptr, nullptr);
+    if (written < 0) return -1;
+
+    int offset = *name_used;
+    name_buffer[offset + written] = '\0';
+    *name_used += written + 1;
+    return offset;
+}
+
+MDB_API int mdb_scene_snapshot(void** root_transforms, int root_count,
+                               MdbSceneNode* out_nodes, int node_cap,
+                               char* name_buffer, int name_buffer_cap) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!root_transforms || root_count < 0 || !out_nodes || node_cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for scene snapshot");
+        return -1;
+    }
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return -1;
+    }
+
+    init_scene_snapshot_helpers();
+    if (!g_cached_get_childCount_method || !g_cached_getChild_method ||
+        !g_cached_transform_get_gameObject_method) {
+        set_error(MdbErrorCode::MethodNotFound, "Transform traversal methods unavailable");
+        return -1;
+    }
+
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+
+    // Iterative breadth-first walk: the work list doubles as the output
+    // order, so a node's parent index always precedes it.
+    std::vector<std::pair<void*, int>> work;  // (transform, parent index)
+    work.reserve(static_cast<size_t>(root_count) * 4);
+    for (int i = 0; i < root_count; ++i) {
+        if (root_transforms[i]) {
+            work.emplace_back(root_transforms[i], -1);
+        }
+    }
+
+    int name_used = 0;
     int written = 0;
-    for (int i = 0; i < bufferSize - 1 && wstr[i]; i++) {
-        buffer[i] = (char)wstr[i];
-        written++;
+
+    // The full walk doubles as a name index build; held across the loop
+    // like the diff holds its own mutex for its walk
+    std::lock_guard<std::mutex> nameLock(g_name_index_mutex);
+
+    for (size_t w = 0; w < work.size() && written < node_cap; ++w) {
+        void* transform = work[w].first;
+
+        MdbSceneNode& node = out_nodes[written];
+        node.transform = transform;
+        node.parent = work[w].second;
+        node.gameObject = snapshot_invoke(g_cached_transform_get_gameObject_method, transform, nullptr);
+        node.active = -1;
+        node.component_count = -1;
+        node.name_offset = -1;
+
+        if (node.gameObject) {
+            if (g_cached_snapshot_activeSelf_method && il2cpp_object_unbox_fn) {
+                void* boxed = snapshot_invoke(g_cached_snapshot_activeSelf_method, node.gameObject, nullptr);
+                if (boxed) {
+                    bool* unboxed = (bool*)il2cpp_object_unbox_fn(boxed);
+                    if (unboxed) node.active = *unboxed ? 1 : 0;
+                }
+            }
+            uint64_t nameHash = 0;
+            node.name_offset = snapshot_write_name(node.gameObject, name_buffer, name_buffer_cap, &name_used,
+                                                   &nameHash);
+            if (nameHash) name_index_put(transform, node.gameObject, nameHash);
+
+            // Component count uses the GetComponents machinery when it has
+            // been initialized by the component helpers; otherwise -1.
+            if (g_cached_getComponents_method && g_cached_component_type_object) {
+                void* args[1] = { g_cached_component_type_object };
+                void* arr = snapshot_invoke(g_cached_getComponents_method, node.gameObject, args);
+                if (arr) node.component_count = mdb_array_length(arr);
+            }
+        }
+
+        int myIndex = written;
+        ++written;
+
+        int childCount = snapshot_invoke_int(g_cached_get_childCount_method, transform, 0);
+        for (int c = 0; c < childCount; ++c) {
+            int index = c;
+            void* args[1] = { &index };
+            void* child = snapshot_invoke(g_cached_getChild_method, transform, args);
+            if (child) {
+                work.emplace_back(child, myIndex);
+            }
+        }
+    }
+
+    return written;
+}
+
+// Batch SceneManager enumeration. The scalar mdb_scenemanager_get_* calls
+// cost one P/Invoke per datum per scene, each re-invoking GetSceneAt; here
+// every loaded scene's handle, name, and root count come back in one call,
+// with a single GetSceneAt invoke per scene reused for all three. Lives in
+// this section to share the SEH-guarded invoke helpers; the MethodInfo
+// pointers are the ones cached by init_scenemanager_helpers().
+MDB_API int mdb_scenemanager_snapshot(MdbSceneInfo* out_scenes, int scene_cap,
+                                      char* name_buffer, int name_buffer_cap,
+                                      int* out_ddol_handle) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (out_ddol_handle) *out_ddol_handle = -1;
+    if (!out_scenes || scene_cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for scenemanager snapshot");
+        return -1;
+    }
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return -1;
+    }
+
+    init_scenemanager_helpers();
+    if (!g_cached_get_sceneCount_method || !g_cached_getSceneAt_method) {
+        set_error(MdbErrorCode::MethodNotFound, "SceneManager methods unavailable");
+        return -1;
+    }
+
+    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    );
+    static auto il2cpp_string_chars_fn = reinterpret_cast<const wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+    if (!il2cpp_object_unbox_fn) {
+        set_error(MdbErrorCode::MethodNotFound, "il2cpp_object_unbox unavailable");
+        return -1;
+    }
+
+    int count = snapshot_invoke_int(g_cached_get_sceneCount_method, nullptr, 0);
+    if (count < 0 || count > 100) count = 0;  // same sanity bound as the scalar export
+    if (count > scene_cap) count = scene_cap;
+
+    int name_used = 0;
+    int written = 0;
+    for (int i = 0; i < count; ++i) {
+        int index = i;
+        void* args[1] = { &index };
+        void* sceneBoxed = snapshot_invoke(g_cached_getSceneAt_method, nullptr, args);
+        if (!sceneBoxed) continue;
+        UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
+        if (!scene) continue;
+
+        MdbSceneInfo& rec = out_scenes[written];
+        rec.handle = scene->handle;
+        rec.root_count = -1;
+        rec.name_offset = -1;
+
+        if (g_cached_scene_get_rootCount_method) {
+            int rootCount = snapshot_invoke_int(g_cached_scene_get_rootCount_method, scene, -1);
+            if (rootCount >= 0 && rootCount <= 100000) rec.root_count = rootCount;
+        }
+
+        if (name_buffer && name_buffer_cap > 0 &&
+            g_cached_scene_get_name_method && il2cpp_string_chars_fn) {
+            void* nameStr = snapshot_invoke(g_cached_scene_get_name_method, scene, nullptr);
+            const wchar_t* wstr = nameStr ? il2cpp_string_chars_fn(nameStr) : nullptr;
+            if (wstr) {
+                int wlen = il2cpp_string_length_fn ? il2cpp_string_length_fn(nameStr)
+                                                   : static_cast<int>(wcslen(wstr));
+                int remaining = name_buffer_cap - name_used;
+                if (wlen >= 0 && remaining > 1) {
+                    int nameBytes = ::WideCharToMultiByte(CP_UTF8, 0, wstr, wlen,
+                        name_buffer + name_used, remaining - 1, nullptr, nullptr);
+                    if (nameBytes >= 0) {
+                        rec.name_offset = name_used;
+                        name_buffer[name_used + nameBytes] = '\0';
+                        name_used += nameBytes + 1;
+                    }
+                }
+            }
+        }
+
+        ++written;
+    }
+
+    if (out_ddol_handle) *out_ddol_handle = mdb_get_dontdestroyonload_scene_handle();
+    return written;
+}
+
+// ==============================
+// Scene Snapshot Diffing
+// ==============================
+// Retains the previous refresh's flat snapshot natively (transform pointer
+// → parent / sibling order / name hash) so steady-state refreshes emit only
+// what changed instead of re-marshalling every node. The traversal still
+// walks the full hierarchy — the savings are in the emitted records and the
+// managed-side rebuild, which dominate refresh cost on large scenes.
+
+struct SceneDiffNode {
+    void* parent;          // parent transform at the last refresh
+    int sibling_index;     // index among the parent's children
+    uint64_t name_hash;    // FNV-1a over the UTF-16 name chars
+    uint32_t generation;   // last refresh that saw this node
+};
+static std::unordered_map<void*, SceneDiffNode> g_scene_diff_prev;
+static uint32_t g_scene_diff_generation = 0;
+static std::mutex g_scene_diff_mutex;
+
+MDB_API int mdb_scene_snapshot_diff(void** root_transforms, int root_count,
+                                    MdbSceneDiffRecord* out_changes, int change_cap,
+                                    char* name_buffer, int name_buffer_cap) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!root_transforms || root_count < 0 || !out_changes || change_cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for scene snapshot diff");
+        return -1;
+    }
+
+    auto status = il2cpp::ensure_thread_attached();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return -1;
+    }
+
+    init_scene_snapshot_helpers();
+    if (!g_cached_get_childCount_method || !g_cached_getChild_method ||
+        !g_cached_transform_get_gameObject_method) {
+        set_error(MdbErrorCode::MethodNotFound, "Transform traversal methods unavailable");
+        return -1;
+    }
+
+    static auto il2cpp_string_chars_fn = reinterpret_cast<const wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+
+    std::lock_guard<std::mutex> lock(g_scene_diff_mutex);
+    std::lock_guard<std::mutex> nameLock(g_name_index_mutex);  // diff maintains the name index
+    uint32_t generation = ++g_scene_diff_generation;
+
+    int name_used = 0;
+    int total_changes = 0;
+    int written = 0;
+
+    // Counts every change; writes a record while the buffer has room. The
+    // caller compares the return value against change_cap to detect
+    // truncation (and should fall back to a full snapshot then).
+    auto emit = [&](void* transform, void* gameObject, void* parent, int sibling,
+                    int changes, const wchar_t* wname, int wlen) {
+        ++total_changes;
+        if (written >= change_cap) return;
+        MdbSceneDiffRecord& rec = out_changes[written];
+        rec.transform = transform;
+        rec.gameObject = gameObject;
+        rec.parent_transform = parent;
+        rec.sibling_index = sibling;
+        rec.changes = changes;
+        rec.name_offset = -1;
+        if (wname && wlen >= 0 && name_buffer && name_buffer_cap - name_used > 1) {
+            int nameBytes = ::WideCharToMultiByte(CP_UTF8, 0, wname, wlen,
+                name_buffer + name_used, name_buffer_cap - name_used - 1, nullptr, nullptr);
+            if (nameBytes >= 0) {
+                rec.name_offset = name_used;
+                name_buffer[name_used + nameBytes] = '\0';
+                name_used += nameBytes + 1;
+            }
+        }
+        ++written;
+    };
+
+    // Same breadth-first order as mdb_scene_snapshot
+    struct DiffWorkItem {
+        void* transform;
+        void* parent;
+        int sibling;
+    };
+    std::vector<DiffWorkItem> work;
+    work.reserve(static_cast<size_t>(root_count) * 4);
+    for (int i = 0; i < root_count; ++i) {
+        if (root_transforms[i]) {
+            work.push_back({ root_transforms[i], nullptr, i });
+        }
+    }
+
+    for (size_t w = 0; w < work.size(); ++w) {
+        void* transform = work[w].transform;
+        void* parent = work[w].parent;
+        int sibling = work[w].sibling;
+
+        void* gameObject = snapshot_invoke(g_cached_transform_get_gameObject_method, transform, nullptr);
+
+        // Hash the UTF-16 name chars directly — UTF-8 conversion happens
+        // only for nodes that turn out to need emitting
+        const wchar_t* wname = nullptr;
+        int wlen = -1;
+        uint64_t nameHash = 0;
+        if (gameObject && g_cached_object_get_name_method && il2cpp_string_chars_fn) {
+            void* nameStr = snapshot_invoke(g_cached_object_get_name_method, gameObject, nullptr);
+            if (nameStr) {
+                wname = il2cpp_string_chars_fn(nameStr);
+                if (wname) {
+                    wlen = il2cpp_string_length_fn ? il2cpp_string_length_fn(nameStr)
+                                                   : static_cast<int>(wcslen(wname));
+                    nameHash = name_index_hash(wname, wlen);
+                }
+            }
+        }
+
+        auto it = g_scene_diff_prev.find(transform);
+        if (it == g_scene_diff_prev.end()) {
+            g_scene_diff_prev.emplace(transform, SceneDiffNode{ parent, sibling, nameHash, generation });
+            if (nameHash) name_index_put(transform, gameObject, nameHash);
+            emit(transform, gameObject, parent, sibling, MDB_SCENE_DIFF_ADDED, wname, wlen);
+        } else {
+            SceneDiffNode& prev = it->second;
+            int changes = 0;
+            if (prev.parent != parent || prev.sibling_index != sibling) changes |= MDB_SCENE_DIFF_MOVED;
+            if (prev.name_hash != nameHash) changes |= MDB_SCENE_DIFF_RENAMED;
+            prev.parent = parent;
+            prev.sibling_index = sibling;
+            prev.name_hash = nameHash;
+            prev.generation = generation;
+            if (changes) {
+                if ((changes & MDB_SCENE_DIFF_RENAMED) && nameHash) {
+                    name_index_put(transform, gameObject, nameHash);
+                }
+                emit(transform, gameObject, parent, sibling, changes,
+                     (changes & MDB_SCENE_DIFF_RENAMED) ? wname : nullptr, wlen);
+            }
+        }
+
+        int childCount = snapshot_invoke_int(g_cached_get_childCount_method, transform, 0);
+        for (int c = 0; c < childCount; ++c) {
+            int index = c;
+            void* args[1] = { &index };
+            void* child = snapshot_invoke(g_cached_getChild_method, transform, args);
+            if (child) {
+                work.push_back({ child, transform, c });
+            }
+        }
     }
-    buffer[written] = '\0';
-    
-    return written;
+
+    // Anything this traversal did not touch is gone. The pointers in
+    // removed records are stale by definition — identity only.
+    for (auto it = g_scene_diff_prev.begin(); it != g_scene_diff_prev.end();) {
+        if (it->second.generation != generation) {
+            name_index_remove(it->first);
+            emit(it->first, nullptr, nullptr, -1, MDB_SCENE_DIFF_REMOVED, nullptr, -1);
+            it = g_scene_diff_prev.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    return total_changes;
 }
 
-MDB_API int mdb_scenemanager_get_scene_handle(int sceneIndex) {
-    auto status = il2cpp::ensure_thread_attached();
-    if (status != Il2CppStatus::OK) return -1;
-    
+MDB_API void mdb_scene_snapshot_diff_reset() {
+    std::lock_guard<std::mutex> lock(g_scene_diff_mutex);
+    g_scene_diff_prev.clear();
+    // The name index is maintained by the same traversals, so its pointers
+    // go stale at the same moments — drop it together with the diff state
+    std::lock_guard<std::mutex> nameLock(g_name_index_mutex);
+    g_name_index.clear();
+    g_name_index_entries.clear();
+}
+
+// ==============================
+// Native Instance Finder
+// ==============================
+// Finding live instances of a class used to mean hooking a constructor or
+// walking scenes through hundreds of P/Invokes. This walks every loaded
+// scene's hierarchy natively — the same traversal the snapshot exports use
+// — and matches GameObjects or their components against the requested class
+// in one call.
+
+static void* g_cached_scene_getRootGameObjects_method = nullptr;
+static void* g_cached_gameObject_get_transform_method = nullptr;
+static bool g_find_instances_init_attempted = false;
+
+static void init_find_instances_helpers() {
+    if (g_find_instances_init_attempted) return;
+    g_find_instances_init_attempted = true;
+
     init_scenemanager_helpers();
-    if (!g_cached_getSceneAt_method) return -1;
-    
-    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
-    );
-    static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
+    init_scene_snapshot_helpers();
+
+    static auto il2cpp_class_get_method_from_name_fn = reinterpret_cast<void*(*)(void*, const char*, int)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_method_from_name")
     );
-    
-    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn) return -1;
-    
-    void* args[1] = { &sceneIndex };
-    void* exc = nullptr;
-    void* sceneBoxed = nullptr;
-    
-    __try {
-        sceneBoxed = il2cpp_runtime_invoke_fn(g_cached_getSceneAt_method, nullptr, args, &exc);
-    } __except(EXCEPTION_EXECUTE_HANDLER) {
-        return -1;
+    if (!il2cpp_class_get_method_from_name_fn) return;
+
+    if (g_cached_scene_class) {
+        g_cached_scene_getRootGameObjects_method =
+            il2cpp_class_get_method_from_name_fn(g_cached_scene_class, "GetRootGameObjects", 0);
     }
-    
-    if (exc || !sceneBoxed) return -1;
-    
-    UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
-    if (!scene) return -1;
-    
-    return scene->handle;
+
+    void* gameObjectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "GameObject");
+    if (gameObjectClass) {
+        g_cached_gameObject_get_transform_method =
+            il2cpp_class_get_method_from_name_fn(gameObjectClass, "get_transform", 0);
+    }
+
+    mdb_debug_log("Instance finder helpers: getRootGOs=%p, getTransform=%p",
+        g_cached_scene_getRootGameObjects_method, g_cached_gameObject_get_transform_method);
 }
 
-MDB_API int mdb_scenemanager_get_scene_root_count(int sceneIndex) {
+MDB_API int mdb_find_instances(void* klass, void** out_instances, int instance_cap) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!klass || !out_instances || instance_cap <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments for instance scan");
+        return -1;
+    }
+
     auto status = il2cpp::ensure_thread_attached();
-    if (status != Il2CppStatus::OK) return 0;
-    
-    init_scenemanager_helpers();
-    if (!g_cached_getSceneAt_method || !g_cached_scene_get_rootCount_method) return 0;
-    
-    static auto il2cpp_runtime_invoke_fn = reinterpret_cast<void*(*)(void*, void*, void**, void**)>(
-        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_runtime_invoke")
-    );
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::ThreadNotAttached, status);
+        return -1;
+    }
+
+    init_find_instances_helpers();
+    if (!g_cached_get_sceneCount_method || !g_cached_getSceneAt_method ||
+        !g_cached_scene_getRootGameObjects_method || !g_cached_gameObject_get_transform_method ||
+        !g_cached_get_childCount_method || !g_cached_getChild_method ||
+        !g_cached_transform_get_gameObject_method) {
+        set_error(MdbErrorCode::MethodNotFound, "Scene traversal methods unavailable");
+        return -1;
+    }
+
     static auto il2cpp_object_unbox_fn = reinterpret_cast<void*(*)(void*)>(
         GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_unbox")
     );
-    
-    if (!il2cpp_runtime_invoke_fn || !il2cpp_object_unbox_fn) return 0;
-    
-    // Get scene at index
-    void* args[1] = { &sceneIndex };
-    void* exc = nullptr;
-    void* sceneBoxed = nullptr;
-    
-    __try {
-        sceneBoxed = il2cpp_runtime_invoke_fn(g_cached_getSceneAt_method, nullptr, args, &exc);
-    } __except(EXCEPTION_EXECUTE_HANDLER) {
-        return 0;
+    static auto il2cpp_object_get_class_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_object_get_class")
+    );
+    if (!il2cpp_object_unbox_fn || !il2cpp_object_get_class_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp object exports unavailable");
+        return -1;
     }
-    
-    if (exc || !sceneBoxed) return 0;
-    
-    UnityScene* scene = (UnityScene*)il2cpp_object_unbox_fn(sceneBoxed);
-    if (!scene) return 0;
-    
-    // Call get_rootCount on the scene
-    void* rootCountResult = nullptr;
-    
-    __try {
-        rootCountResult = il2cpp_runtime_invoke_fn(g_cached_scene_get_rootCount_method, scene, nullptr, &exc);
-    } __except(EXCEPTION_EXECUTE_HANDLER) {
-        return 0;
+
+    // Decide once whether the target is a GameObject type or a component
+    // type; a GameObject is never assignable to a Component class and vice
+    // versa, so only one of the two checks runs per node. Both memoized
+    // lookups go through mdb_class_is_assignable.
+    void* gameObjectClass = mdb_find_class("UnityEngine.CoreModule", "UnityEngine", "GameObject");
+    bool wantGameObjects = gameObjectClass && mdb_class_is_assignable(gameObjectClass, klass);
+
+    // The GetComponents cache initializes lazily inside
+    // mdb_gameobject_get_components; component matching needs it primed
+    // before the walk starts.
+    bool wantComponents = !wantGameObjects;
+
+    // Collect the roots of every loaded scene
+    std::vector<std::pair<void*, int>> work;  // (transform, unused)
+    int sceneCount = snapshot_invoke_int(g_cached_get_sceneCount_method, nullptr, 0);
+    if (sceneCount < 0 || sceneCount > 100) sceneCount = 0;
+
+    for (int i = 0; i < sceneCount; ++i) {
+        int index = i;
+        void* args[1] = { &index };
+        void* sceneBoxed = snapshot_invoke(g_cached_getSceneAt_method, nullptr, args);
+        if (!sceneBoxed) continue;
+        void* scene = il2cpp_object_unbox_fn(sceneBoxed);
+        if (!scene) continue;
+
+        void* rootsArray = snapshot_invoke(g_cached_scene_getRootGameObjects_method, scene, nullptr);
+        if (!rootsArray) continue;
+
+        int rootCount = mdb_array_length(rootsArray);
+        for (int r = 0; r < rootCount; ++r) {
+            void* rootGO = mdb_array_get_element(rootsArray, r);
+            if (!rootGO) continue;
+            void* transform = snapshot_invoke(g_cached_gameObject_get_transform_method, rootGO, nullptr);
+            if (transform) work.emplace_back(transform, 0);
+        }
     }
-    
-    if (exc || !rootCountResult) return 0;
-    
-    int* unboxed = (int*)il2cpp_object_unbox_fn(rootCountResult);
-    if (!unboxed) return 0;
-    
-    int count = *unboxed;
-    if (count < 0 || count > 100000) return 0;
-    
-    return count;
+
+    if (wantComponents && !g_cached_getComponents_method && !work.empty()) {
+        void* firstGO = snapshot_invoke(g_cached_transform_get_gameObject_method, work[0].first, nullptr);
+        if (firstGO) mdb_gameobject_get_components(firstGO);  // primes the cache
+    }
+
+    // Same breadth-first walk as mdb_scene_snapshot
+    int found = 0;
+    for (size_t w = 0; w < work.size() && found < instance_cap; ++w) {
+        void* transform = work[w].first;
+        void* gameObject = snapshot_invoke(g_cached_transform_get_gameObject_method, transform, nullptr);
+
+        if (gameObject) {
+            if (wantGameObjects) {
+                void* objClass = il2cpp_object_get_class_fn(gameObject);
+                if (objClass && mdb_class_is_assignable(objClass, klass)) {
+                    out_instances[found++] = gameObject;
+                }
+            } else if (wantComponents && g_cached_getComponents_method && g_cached_component_type_object) {
+                void* typeArgs[1] = { g_cached_component_type_object };
+                void* arr = snapshot_invoke(g_cached_getComponents_method, gameObject, typeArgs);
+                int len = arr ? mdb_array_length(arr) : 0;
+                for (int c = 0; c < len && found < instance_cap; ++c) {
+                    void* component = mdb_array_get_element(arr, c);
+                    if (!component) continue;
+                    void* componentClass = il2cpp_object_get_class_fn(component);
+                    if (componentClass && mdb_class_is_assignable(componentClass, klass)) {
+                        out_instances[found++] = component;
+                    }
+                }
+            }
+        }
+
+        int childCount = snapshot_invoke_int(g_cached_get_childCount_method, transform, 0);
+        for (int c = 0; c < childCount; ++c) {
+            int index = c;
+            void* args[1] = { &index };
+            void* child = snapshot_invoke(g_cached_getChild_method, transform, args);
+            if (child) work.emplace_back(child, 0);
+        }
+    }
+
+    return found;
 }
 
-// Get DontDestroyOnLoad scene by finding a GameObject marked with DontDestroyOnLoad
-// Returns the scene handle, or -1 if not found
-// This works by getting a special scene that Unity uses for DontDestroyOnLoad objects
-MDB_API int mdb_get_dontdestroyonload_scene_handle() {
+// ==============================
+// Per-Frame Command Buffer
+// ==============================
+
+static std::vector<MdbCommand> g_command_buffer;
+static std::mutex g_command_buffer_mutex;
+static constexpr size_t MDB_COMMAND_BUFFER_CAP = 4096;
+
+MDB_API int mdb_command_buffer_append(const MdbCommand* commands, int count) {
+    if (!commands || count <= 0) return 0;
+
+    std::lock_guard<std::mutex> lock(g_command_buffer_mutex);
+    int appended = 0;
+    for (int i = 0; i < count; i++) {
+        if (g_command_buffer.size() >= MDB_COMMAND_BUFFER_CAP) break;
+        g_command_buffer.push_back(commands[i]);
+        appended++;
+    }
+    return appended;
+}
+
+MDB_API int mdb_command_buffer_pending() {
+    std::lock_guard<std::mutex> lock(g_command_buffer_mutex);
+    return static_cast<int>(g_command_buffer.size());
+}
+
+MDB_API int mdb_command_buffer_flush() {
+    MDB_PROFILE_EXPORT();
     auto status = il2cpp::ensure_thread_attached();
     if (status != Il2CppStatus::OK) return -1;
-    
-    // The DontDestroyOnLoad scene has a specific name: "DontDestroyOnLoad"
-    // We can find it by checking all root objects and finding one in that scene
-    // However, a simpler approach: Unity's SceneManager.sceneCount doesn't include it
-    // The DDOL scene handle is typically a high number or specific value
-    
-    // Alternative: Use Scene.GetSceneByName which doesn't work for DDOL
-    // Best approach: Find any DDOL object and get its scene
-    
-    // For now, return -1 to indicate we'll handle this differently
-    // The C# code will detect DDOL objects by checking if their scene handle
-    // doesn't match any loaded scene
-    return -1;
+
+    // Swap the queue out under the lock, then apply without holding it so
+    // appends from mod threads never wait on IL2CPP invokes
+    std::vector<MdbCommand> batch;
+    {
+        std::lock_guard<std::mutex> lock(g_command_buffer_mutex);
+        if (g_command_buffer.empty()) return 0;
+        batch.swap(g_command_buffer);
+    }
+
+    int applied = 0;
+    for (const MdbCommand& cmd : batch) {
+        switch (cmd.type) {
+        case MDB_CMD_SET_LOCAL_POSITION:
+            if (mdb_transform_set_local_position(cmd.target, cmd.x, cmd.y, cmd.z)) applied++;
+            break;
+        case MDB_CMD_SET_LOCAL_EULER_ANGLES:
+            if (mdb_transform_set_local_euler_angles(cmd.target, cmd.x, cmd.y, cmd.z)) applied++;
+            break;
+        case MDB_CMD_SET_LOCAL_SCALE:
+            if (mdb_transform_set_local_scale(cmd.target, cmd.x, cmd.y, cmd.z)) applied++;
+            break;
+        case MDB_CMD_SET_FIELD_VALUE:
+            if (cmd.target && cmd.field) {
+                mdb_field_set_value(cmd.target, cmd.field,
+                                    const_cast<unsigned char*>(cmd.payload));
+                applied++;
+            }
+            break;
+        case MDB_CMD_SET_FIELD_REFERENCE:
+            if (cmd.target && cmd.field) {
+                // Payload holds the object pointer; pass it as the value itself
+                mdb_field_set_value(cmd.target, cmd.field,
+                                    *reinterpret_cast<void* const*>(cmd.payload));
+                applied++;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    return applied;
+}
+
+// ==============================
+// Frame-Budgeted Task Scheduler
+// ==============================
+
+// Work items drained from the Present hook under a per-frame time budget,
+// so heavy native work (scene scans, batch reads) amortizes across frames
+// instead of hitching one. A task returning nonzero goes back to the tail
+// of the queue and resumes on a later frame; anything the budget didn't
+// reach simply carries over. Tasks run on the render thread with the
+// IL2CPP attach already done by the command buffer flush above them.
+
+struct FrameTask {
+    MdbFrameTaskFn fn;
+    void* user_data;
+};
+
+static std::deque<FrameTask> g_frame_tasks;
+static std::mutex g_frame_tasks_mutex;
+static std::atomic<int> g_frame_task_budget_us{ 500 };
+static constexpr size_t MDB_FRAME_TASK_CAP = 1024;
+
+MDB_API int mdb_frame_task_queue(MdbFrameTaskFn task, void* user_data) {
+    clear_error();
+    if (!task) {
+        set_error(MdbErrorCode::NullPointer, "Task function is null");
+        return static_cast<int>(MdbErrorCode::NullPointer);
+    }
+
+    std::lock_guard<std::mutex> lock(g_frame_tasks_mutex);
+    if (g_frame_tasks.size() >= MDB_FRAME_TASK_CAP) {
+        set_error(MdbErrorCode::InvalidArgument, "Frame task queue is full");
+        return static_cast<int>(MdbErrorCode::InvalidArgument);
+    }
+    g_frame_tasks.push_back({ task, user_data });
+    return 0;
+}
+
+MDB_API void mdb_frame_tasks_set_budget(int microseconds) {
+    if (microseconds < 50) microseconds = 50;
+    if (microseconds > 10000) microseconds = 10000;
+    g_frame_task_budget_us.store(microseconds, std::memory_order_relaxed);
+}
+
+MDB_API int mdb_frame_tasks_pending() {
+    std::lock_guard<std::mutex> lock(g_frame_tasks_mutex);
+    return static_cast<int>(g_frame_tasks.size());
+}
+
+MDB_API int mdb_frame_tasks_drain() {
+    MDB_PROFILE_EXPORT();
+
+    LARGE_INTEGER freq, start;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&start);
+    const int64_t budgetTicks =
+        (static_cast<int64_t>(g_frame_task_budget_us.load(std::memory_order_relaxed)) *
+         freq.QuadPart) / 1000000;
+
+    // Bound the pass to the queue length at entry so a task that re-queues
+    // itself every call cannot spin the drain past the budget check count
+    size_t passLimit;
+    {
+        std::lock_guard<std::mutex> lock(g_frame_tasks_mutex);
+        passLimit = g_frame_tasks.size();
+    }
+    if (passLimit == 0) return 0;
+
+    int completed = 0;
+    for (size_t i = 0; i < passLimit; ++i) {
+        FrameTask task;
+        {
+            std::lock_guard<std::mutex> lock(g_frame_tasks_mutex);
+            if (g_frame_tasks.empty()) break;
+            task = g_frame_tasks.front();
+            g_frame_tasks.pop_front();
+        }
+
+        // Run outside the lock so queueing from mod threads never blocks
+        // on a task body
+        int again = task.fn(task.user_data);
+        if (again != 0) {
+            std::lock_guard<std::mutex> lock(g_frame_tasks_mutex);
+            if (g_frame_tasks.size() < MDB_FRAME_TASK_CAP) {
+                g_frame_tasks.push_back(task);
+            }
+        } else {
+            completed++;
+        }
+
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        if (now.QuadPart - start.QuadPart >= budgetTicks) break;
+    }
+
+    return completed;
+}
+
+// ==============================
+// Async Invocation Worker
+// ==============================
+
+// Queue drained by a dedicated thread that attaches to the IL2CPP domain
+// once and stays attached, so background mods stream invocations without
+// per-call attach overhead or manual attach management.
+struct AsyncInvokeJob {
+    void* method;
+    void* instance;
+    void* args[16];
+    int arg_count;
+    MdbInvokeCallbackFn callback;
+    void* user_data;
+};
+
+static std::deque<AsyncInvokeJob> g_async_queue;
+static std::mutex g_async_mutex;
+static std::condition_variable g_async_cv;
+static HANDLE g_async_thread = nullptr;
+static bool g_async_shutdown = false;
+
+static DWORD WINAPI async_invoke_worker(LPVOID) {
+    // Attach once; ensure_thread_attached is a thread-local stamp check on
+    // every later call, so re-checking per job is effectively free
+    il2cpp::ensure_thread_attached();
+
+    for (;;) {
+        AsyncInvokeJob job;
+        {
+            std::unique_lock<std::mutex> lock(g_async_mutex);
+            g_async_cv.wait(lock, [] { return g_async_shutdown || !g_async_queue.empty(); });
+            if (g_async_queue.empty()) {
+                if (g_async_shutdown) break;
+                continue;
+            }
+            job = g_async_queue.front();
+            g_async_queue.pop_front();
+        }
+
+        void* exception = nullptr;
+        void* result = mdb_invoke_method(job.method, job.instance,
+                                         job.arg_count > 0 ? job.args : nullptr, &exception);
+        if (job.callback) {
+            job.callback(result, exception, job.user_data);
+        }
+    }
+
+    return 0;
+}
+
+MDB_API bool mdb_invoke_async(void* method, void* instance, void** args, int arg_count,
+                              MdbInvokeCallbackFn callback, void* user_data) {
+    clear_error();
+    if (!method || arg_count < 0 || arg_count > 16 || (arg_count > 0 && !args)) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: method required, 0-16 args");
+        return false;
+    }
+
+    AsyncInvokeJob job{};
+    job.method = method;
+    job.instance = instance;
+    for (int i = 0; i < arg_count; i++) {
+        job.args[i] = args[i];
+    }
+    job.arg_count = arg_count;
+    job.callback = callback;
+    job.user_data = user_data;
+
+    {
+        std::lock_guard<std::mutex> lock(g_async_mutex);
+        if (g_async_shutdown) {
+            set_error(MdbErrorCode::NotInitialized, "Async worker is shut down");
+            return false;
+        }
+        if (!g_async_thread) {
+            g_async_thread = CreateThread(nullptr, 0, async_invoke_worker, nullptr, 0, nullptr);
+            if (!g_async_thread) {
+                set_error(MdbErrorCode::InitFailed, "Could not start async invoke worker");
+                return false;
+            }
+        }
+        g_async_queue.push_back(job);
+    }
+    g_async_cv.notify_one();
+    return true;
+}
+
+MDB_API int mdb_invoke_async_pending() {
+    std::lock_guard<std::mutex> lock(g_async_mutex);
+    return static_cast<int>(g_async_queue.size());
+}
+
+MDB_API void mdb_invoke_async_shutdown() {
+    HANDLE thread = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_async_mutex);
+        g_async_shutdown = true;
+        thread = g_async_thread;
+        g_async_thread = nullptr;
+    }
+    g_async_cv.notify_all();
+
+    if (thread) {
+        // Bounded wait: the worker may be stuck inside a managed call
+        WaitForSingleObject(thread, 2000);
+        CloseHandle(thread);
+    }
 }
 
 // ==============================
 // OnGUI Hook Support
 // ==============================
 
-// Global callback for OnGUI dispatch
-static OnGUICallbackFn g_ongui_callback = nullptr;
+// OnGUI callbacks are dispatched every frame from the BeginGUI/EndGUI hooks,
+// so the dispatch path reads one atomic pointer to an immutable snapshot and
+// loops a plain array — no lock and no vector growth where hitching shows.
+// Registration (rare) builds a new snapshot under a mutex and swaps it in;
+// retired snapshots are kept alive until process exit because a dispatching
+// thread may still be walking one.
+struct OnGuiSnapshot {
+    int count = 0;
+    OnGUICallbackFn callbacks[32] = {};
+};
+
+static std::atomic<const OnGuiSnapshot*> g_ongui_snapshot{ nullptr };
+static std::mutex g_ongui_reg_mutex;
+static std::vector<std::unique_ptr<OnGuiSnapshot>> g_ongui_snapshot_storage;
+
+static void dispatch_ongui_callbacks() {
+    const OnGuiSnapshot* snap = g_ongui_snapshot.load(std::memory_order_acquire);
+    if (!snap) return;
+    for (int i = 0; i < snap->count; i++) {
+        snap->callbacks[i]();
+    }
+}
+
 static bool g_minhook_initialized = false;
 static std::string g_hooked_method_name;  // Track which method was hooked
 
@@ -2032,22 +4366,18 @@ static void Hooked_GUIUtility_BeginGUI() {
         g_original_BeginGUI();
     }
     
-    // Now call our managed OnGUI callback
-    if (g_ongui_callback) {
-        g_ongui_callback();
-    }
+    // Now call our managed OnGUI callbacks
+    dispatch_ongui_callbacks();
 }
 
 // Alternative: Hook GUIUtility.EndGUI for drawing after Unity GUI
 typedef void (*GUIUtility_EndGUI_t)(int32_t layoutType);
 static GUIUtility_EndGUI_t g_original_EndGUI = nullptr;
 
-static void Hooked_GUIUtility_EndGUI(int32_t layoutType) {
-    // Call our managed OnGUI callback before ending
-    if (g_ongui_callback) {
-        g_ongui_callback();
-    }
-    
+static void Hooked_GUIUtility_EndGUI(int32_t layoutType) {
+    // Call our managed OnGUI callbacks before ending
+    dispatch_ongui_callbacks();
+
     // Then call original to finalize
     if (g_original_EndGUI) {
         g_original_EndGUI(layoutType);
@@ -2057,15 +4387,53 @@ static void Hooked_GUIUtility_EndGUI(int32_t layoutType) {
 #endif // MDB_HAS_MINHOOK
 
 MDB_API int mdb_register_ongui_callback(OnGUICallbackFn callback) {
-    g_ongui_callback = callback;
+    if (!callback) return -1;
+
+    std::lock_guard<std::mutex> lock(g_ongui_reg_mutex);
+
+    const OnGuiSnapshot* current = g_ongui_snapshot.load(std::memory_order_relaxed);
+    auto next = std::make_unique<OnGuiSnapshot>();
+    if (current) {
+        for (int i = 0; i < current->count; i++) {
+            if (current->callbacks[i] == callback) return 0;  // already registered
+            next->callbacks[next->count++] = current->callbacks[i];
+        }
+    }
+    if (next->count >= 32) return -2;
+    next->callbacks[next->count++] = callback;
+
+    g_ongui_snapshot.store(next.get(), std::memory_order_release);
+    g_ongui_snapshot_storage.push_back(std::move(next));
     return 0;
 }
 
-MDB_API void mdb_dispatch_ongui() {
-    // Manually trigger OnGUI callback (for testing)
-    if (g_ongui_callback) {
-        g_ongui_callback();
+MDB_API int mdb_unregister_ongui_callback(OnGUICallbackFn callback) {
+    if (!callback) return -1;
+
+    std::lock_guard<std::mutex> lock(g_ongui_reg_mutex);
+
+    const OnGuiSnapshot* current = g_ongui_snapshot.load(std::memory_order_relaxed);
+    if (!current) return -1;
+
+    auto next = std::make_unique<OnGuiSnapshot>();
+    bool found = false;
+    for (int i = 0; i < current->count; i++) {
+        if (current->callbacks[i] == callback) {
+            found = true;
+            continue;
+        }
+        next->callbacks[next->count++] = current->callbacks[i];
     }
+    if (!found) return -1;
+
+    g_ongui_snapshot.store(next.get(), std::memory_order_release);
+    g_ongui_snapshot_storage.push_back(std::move(next));
+    return 0;
+}
+
+MDB_API void mdb_dispatch_ongui() {
+    // Manually trigger OnGUI callbacks (for testing)
+    dispatch_ongui_callbacks();
 }
 
 // ==============================
@@ -2074,18 +4442,95 @@ MDB_API void mdb_dispatch_ongui() {
 
 #include <unordered_map>
 
-// Hook tracking structure
-struct HookInfo {
-    int64_t handle;
-    void* target;
-    void* detour;
-    void* original;
-    bool enabled;
+// Fixed-capacity hook slot table. A handle encodes (generation << 32) | index
+// so a stale handle to a removed-and-reused slot is rejected rather than
+// toggling someone else's hook. The enabled flag is atomic, so
+// mdb_set_hook_enabled runs without taking g_hooks_mutex (MinHook serializes
+// its own state internally) — the mutex only guards slot allocation and
+// release, keeping per-level hook toggles off the creation lock.
+static constexpr int MDB_MAX_HOOKS = 512;
+
+// Native argument filter (mdb_hook_add_filter). Each descriptor compares one
+// forwarded integer argument, truncated to the given width, against a
+// constant. All installed descriptors must pass (logical AND) for the detour
+// to run; a rejected hit calls the trampoline directly so the game function
+// still executes without paying the transition into the callback.
+static constexpr int MDB_MAX_HOOK_FILTERS = 4;
+
+struct HookFilter {
+    int arg_index = 0;   // position in the forwarded argument list (0-11)
+    int width = 8;       // bytes compared: 1, 2, 4 or 8
+    int op = 0;          // MDB_HOOK_FILTER_* compare op
+    uint64_t value = 0;  // comparison constant
+};
+
+struct HookSlot {
+    void* target = nullptr;
+    void* detour = nullptr;
+    void* original = nullptr;
+    std::atomic<bool> enabled{ false };
+    std::atomic<bool> in_use{ false };
+    uint32_t generation = 0;
+
+    // Instrumentation (mdb_create_hook*_instrumented). hits counts every
+    // stub invocation; the cycle fields accumulate TSC deltas sampled on
+    // every 16th hit. All relaxed — readers get an eventually-consistent
+    // snapshot, which is all mdb_get_hook_stats promises.
+    bool instrumented = false;
+    std::atomic<uint64_t> hits{ 0 };
+    std::atomic<uint64_t> sampled_cycles{ 0 };
+    std::atomic<uint64_t> sampled_count{ 0 };
+    std::atomic<uint64_t> min_cycles{ 0 };
+    std::atomic<uint64_t> max_cycles{ 0 };
+
+    // Argument filters (mdb_hook_add_filter). Only meaningful when the hook
+    // is stub-routed — plain hooks jump straight into the detour and never
+    // pass through the bridge. Descriptors are staged under g_hooks_mutex;
+    // the release store to filter_count publishes them, and the stub's
+    // acquire load orders the descriptor reads behind it.
+    bool stub_routed = false;
+    HookFilter filters[MDB_MAX_HOOK_FILTERS];
+    std::atomic<int> filter_count{ 0 };
+    std::atomic<uint64_t> filtered_hits{ 0 };
+
+    void reset_stats() {
+        hits.store(0, std::memory_order_relaxed);
+        sampled_cycles.store(0, std::memory_order_relaxed);
+        sampled_count.store(0, std::memory_order_relaxed);
+        min_cycles.store(UINT64_MAX, std::memory_order_relaxed);
+        max_cycles.store(0, std::memory_order_relaxed);
+    }
 };
 
-static std::unordered_map<int64_t, HookInfo> g_hooks;
-static int64_t g_next_hook_handle = 1;
-static std::mutex g_hooks_mutex;
+static HookSlot g_hook_slots[MDB_MAX_HOOKS];
+static std::mutex g_hooks_mutex;  // guards slot allocation/release only
+
+static int64_t make_hook_handle(int index, uint32_t generation) {
+    return (static_cast<int64_t>(generation) << 32) | static_cast<uint32_t>(index);
+}
+
+// Resolve a handle to its slot, or null if the handle is stale or invalid.
+static HookSlot* hook_slot_from_handle(int64_t handle) {
+    int index = static_cast<int>(handle & 0xFFFFFFFF);
+    uint32_t generation = static_cast<uint32_t>(handle >> 32);
+    if (index < 0 || index >= MDB_MAX_HOOKS || generation == 0) return nullptr;
+
+    HookSlot& slot = g_hook_slots[index];
+    if (!slot.in_use.load(std::memory_order_acquire)) return nullptr;
+    if (slot.generation != generation) return nullptr;
+    return &slot;
+}
+
+// Claim a free slot and stamp a fresh generation. Caller holds g_hooks_mutex.
+static int hook_slot_alloc() {
+    for (int i = 0; i < MDB_MAX_HOOKS; i++) {
+        if (!g_hook_slots[i].in_use.load(std::memory_order_relaxed)) {
+            g_hook_slots[i].generation++;
+            return i;
+        }
+    }
+    return -1;
+}
 
 static bool ensure_minhook_initialized() {
 #if MDB_HAS_MINHOOK
@@ -2094,6 +4539,8 @@ static bool ensure_minhook_initialized() {
             return false;
         }
         g_minhook_initialized = true;
+        // Fixed-capacity table, charged once when hooking first activates
+        MDB::Mem::Account(MDB::Mem::Tag::HookTable, sizeof(g_hook_slots));
     }
     return true;
 #else
@@ -2101,21 +4548,210 @@ static bool ensure_minhook_initialized() {
 #endif
 }
 
+// ------------------------------
+// Instrumented / filtered hook stubs
+// ------------------------------
+// MinHook jumps the patched target straight into the mod's detour, so the
+// bridge is normally not in the call path and cannot count or filter
+// anything. For instrumented and filtered hooks the bridge installs one of
+// these per-slot stubs as the MinHook detour instead, keeping the user
+// detour in slot.detour. The stub evaluates any installed argument filters
+// (short-circuiting to the trampoline on reject), bumps the hit counter on
+// every call and, for instrumented hooks, brackets every 16th detour call
+// with __rdtsc() — cheap enough to leave on for a method called 100k times
+// per frame, while still converging on a stable mean.
+//
+// Forwarding mirrors the fixed-arity casts in invoke_direct_dispatch: the
+// first 12 integer/pointer arguments and an integer/pointer return pass
+// through unchanged; float/double anywhere in the signature is unsupported
+// for instrumented hooks (XMM registers are not forwarded).
+static constexpr int MDB_HOOK_SAMPLE_MASK = 0xF;  // sample every 16th hit
+
+// Evaluate one filter descriptor against the forwarded argument array. Both
+// sides are truncated to the descriptor's width before comparing, so a
+// 4-byte filter on a register holding sign-extended garbage in the upper
+// half still matches. Comparisons are unsigned.
+static bool hook_filter_passes(const HookFilter& f, const uintptr_t* args) {
+    uint64_t arg = static_cast<uint64_t>(args[f.arg_index]);
+    uint64_t value = f.value;
+    switch (f.width) {
+        case 1: arg &= 0xFFull;       value &= 0xFFull;       break;
+        case 2: arg &= 0xFFFFull;     value &= 0xFFFFull;     break;
+        case 4: arg &= 0xFFFFFFFFull; value &= 0xFFFFFFFFull; break;
+        default: break;  // 8: full width
+    }
+    switch (f.op) {
+        case MDB_HOOK_FILTER_EQ:   return arg == value;
+        case MDB_HOOK_FILTER_NE:   return arg != value;
+        case MDB_HOOK_FILTER_LT:   return arg < value;
+        case MDB_HOOK_FILTER_LE:   return arg <= value;
+        case MDB_HOOK_FILTER_GT:   return arg > value;
+        case MDB_HOOK_FILTER_GE:   return arg >= value;
+        case MDB_HOOK_FILTER_MASK: return (arg & value) != 0;
+        default:                   return true;
+    }
+}
+
+static uintptr_t hook_stub_invoke(int index,
+                                  uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3,
+                                  uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7,
+                                  uintptr_t a8, uintptr_t a9, uintptr_t a10, uintptr_t a11) {
+    HookSlot& slot = g_hook_slots[index];
+    using DetourFn = uintptr_t(*)(uintptr_t, uintptr_t, uintptr_t, uintptr_t,
+                                  uintptr_t, uintptr_t, uintptr_t, uintptr_t,
+                                  uintptr_t, uintptr_t, uintptr_t, uintptr_t);
+
+    // Filters run before anything else: a rejected hit goes straight to the
+    // trampoline and never pays the hit accounting or the callback.
+    int filterCount = slot.filter_count.load(std::memory_order_acquire);
+    if (filterCount > 0) {
+        const uintptr_t fargs[12] = { a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11 };
+        for (int i = 0; i < filterCount; i++) {
+            if (!hook_filter_passes(slot.filters[i], fargs)) {
+                slot.filtered_hits.fetch_add(1, std::memory_order_relaxed);
+                return reinterpret_cast<DetourFn>(slot.original)(a0, a1, a2, a3, a4, a5,
+                                                                 a6, a7, a8, a9, a10, a11);
+            }
+        }
+    }
+
+    DetourFn detour = reinterpret_cast<DetourFn>(slot.detour);
+
+    uint64_t hit = slot.hits.fetch_add(1, std::memory_order_relaxed);
+    MDB::Events::Count(MDB::Events::Kind::HookHit);
+    if (!slot.instrumented || (hit & MDB_HOOK_SAMPLE_MASK) != 0) {
+        return detour(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+    }
+
+    uint64_t t0 = __rdtsc();
+    uintptr_t result = detour(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+    uint64_t delta = __rdtsc() - t0;
+
+    slot.sampled_cycles.fetch_add(delta, std::memory_order_relaxed);
+    slot.sampled_count.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t seen = slot.min_cycles.load(std::memory_order_relaxed);
+    while (delta < seen &&
+           !slot.min_cycles.compare_exchange_weak(seen, delta, std::memory_order_relaxed)) {
+    }
+    seen = slot.max_cycles.load(std::memory_order_relaxed);
+    while (delta > seen &&
+           !slot.max_cycles.compare_exchange_weak(seen, delta, std::memory_order_relaxed)) {
+    }
+    return result;
+}
+
+template <size_t I>
+static uintptr_t hook_stub(uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3,
+                           uintptr_t a4, uintptr_t a5, uintptr_t a6, uintptr_t a7,
+                           uintptr_t a8, uintptr_t a9, uintptr_t a10, uintptr_t a11) {
+    return hook_stub_invoke(static_cast<int>(I),
+                            a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11);
+}
+
+using HookStubFn = uintptr_t(*)(uintptr_t, uintptr_t, uintptr_t, uintptr_t,
+                                uintptr_t, uintptr_t, uintptr_t, uintptr_t,
+                                uintptr_t, uintptr_t, uintptr_t, uintptr_t);
+
+template <size_t... Is>
+static constexpr std::array<HookStubFn, sizeof...(Is)> make_hook_stub_table(std::index_sequence<Is...>) {
+    return { &hook_stub<Is>... };
+}
+
+static constexpr auto g_hook_stubs = make_hook_stub_table(std::make_index_sequence<MDB_MAX_HOOKS>{});
+
+// Shared body of mdb_create_hook_ptr and its instrumented/filtered
+// variants. Caller state (error slot) is already cleared. For stub-routed
+// hooks the slot's detour and counters must be live before MH_EnableHook
+// lands, since the stub can run the instant the target is patched.
+// filterable routes through the stub without rdtsc sampling, so filters
+// installed later via mdb_hook_add_filter have a place to run.
+static int64_t create_hook_ptr_impl(void* target, void* detour, void** out_original, bool instrumented, bool filterable) {
+#if MDB_HAS_MINHOOK
+    if (!target || !detour) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: target and detour are required");
+        return -1;
+    }
+
+    if (!ensure_minhook_initialized()) {
+        set_error(MdbErrorCode::InitFailed, "MinHook initialization failed");
+        return -2;
+    }
+
+    std::lock_guard<std::mutex> lock(g_hooks_mutex);
+
+    int index = hook_slot_alloc();
+    if (index < 0) {
+        set_error(MdbErrorCode::InvocationFailed, "Hook table full");
+        return -5;
+    }
+
+    // Stage the slot before the target is patched: the instrumented stub
+    // dereferences slot.detour as soon as the first hooked call arrives
+    HookSlot& slot = g_hook_slots[index];
+    slot.target = target;
+    slot.detour = detour;
+    slot.instrumented = instrumented;
+    slot.stub_routed = instrumented || filterable;
+    slot.filter_count.store(0, std::memory_order_relaxed);
+    slot.filtered_hits.store(0, std::memory_order_relaxed);
+    slot.reset_stats();
+
+    void* minhookDetour = slot.stub_routed ? reinterpret_cast<void*>(g_hook_stubs[index]) : detour;
+
+    void* original = nullptr;
+    MH_STATUS status = MH_CreateHook(target, minhookDetour, &original);
+    if (status != MH_OK) {
+        mdb_debug_log("MH_CreateHook failed: %d", status);
+        set_error(MdbErrorCode::InvocationFailed, "MH_CreateHook failed");
+        return -3;
+    }
+
+    slot.original = original;
+    status = MH_EnableHook(target);
+    if (status != MH_OK) {
+        MH_RemoveHook(target);
+        set_error(MdbErrorCode::InvocationFailed, "MH_EnableHook failed");
+        return -4;
+    }
+
+    // Publish the slot: fields first, in_use last with release ordering
+    slot.enabled.store(true, std::memory_order_relaxed);
+    slot.in_use.store(true, std::memory_order_release);
+    int64_t handle = make_hook_handle(index, slot.generation);
+
+    if (out_original) {
+        *out_original = original;
+    }
+
+    mdb_debug_log("Created %shook %lld: target=%p, detour=%p, original=%p",
+                  instrumented ? "instrumented " : "", handle, target, detour, original);
+    MDB::Etw::HookInstalled(nullptr, target);
+    MDB::Events::Record(MDB::Events::Kind::HookInstall, "hook.install");
+    return handle;
+
+#else
+    (void)target; (void)detour; (void)out_original; (void)instrumented; (void)filterable;
+    set_error(MdbErrorCode::NotInitialized, "MinHook not available");
+    return -100;
+#endif
+}
+
 MDB_API int64_t mdb_create_hook(void* method, HookCallbackFn callback, void** out_original) {
     clear_error();
-    
+
     if (!method) {
         set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
         return -1;
     }
-    
+
     // Get method pointer
     void* methodPtr = mdb_get_method_pointer(method);
     if (!methodPtr) {
         set_error(MdbErrorCode::InvalidMethod, "Method has no function pointer");
         return -2;
     }
-    
+
     return mdb_create_hook_ptr(methodPtr, (void*)callback, out_original);
 }
 
@@ -2133,121 +4769,350 @@ MDB_API int64_t mdb_create_hook_rva(uint64_t rva, HookCallbackFn callback, void*
 
 MDB_API int64_t mdb_create_hook_ptr(void* target, void* detour, void** out_original) {
     clear_error();
-    
+    return create_hook_ptr_impl(target, detour, out_original, /*instrumented=*/false, /*filterable=*/false);
+}
+
+MDB_API int64_t mdb_create_hook_instrumented(void* method, HookCallbackFn callback, void** out_original) {
+    clear_error();
+
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
+        return -1;
+    }
+
+    void* methodPtr = mdb_get_method_pointer(method);
+    if (!methodPtr) {
+        set_error(MdbErrorCode::InvalidMethod, "Method has no function pointer");
+        return -2;
+    }
+
+    return create_hook_ptr_impl(methodPtr, (void*)callback, out_original, /*instrumented=*/true, /*filterable=*/false);
+}
+
+MDB_API int64_t mdb_create_hook_ptr_instrumented(void* target, void* detour, void** out_original) {
+    clear_error();
+    return create_hook_ptr_impl(target, detour, out_original, /*instrumented=*/true, /*filterable=*/false);
+}
+
+MDB_API int64_t mdb_create_hook_filtered(void* method, HookCallbackFn callback, void** out_original) {
+    clear_error();
+
+    if (!method) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: method is null");
+        return -1;
+    }
+
+    void* methodPtr = mdb_get_method_pointer(method);
+    if (!methodPtr) {
+        set_error(MdbErrorCode::InvalidMethod, "Method has no function pointer");
+        return -2;
+    }
+
+    return create_hook_ptr_impl(methodPtr, (void*)callback, out_original, /*instrumented=*/false, /*filterable=*/true);
+}
+
+MDB_API int64_t mdb_create_hook_ptr_filtered(void* target, void* detour, void** out_original) {
+    clear_error();
+    return create_hook_ptr_impl(target, detour, out_original, /*instrumented=*/false, /*filterable=*/true);
+}
+
+MDB_API int mdb_create_hooks_batch(MdbHookRequest* requests, int count) {
+    clear_error();
+
 #if MDB_HAS_MINHOOK
-    if (!target || !detour) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: target and detour are required");
+    if (!requests || count <= 0) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid arguments: requests array is required");
         return -1;
     }
-    
+
     if (!ensure_minhook_initialized()) {
         set_error(MdbErrorCode::InitFailed, "MinHook initialization failed");
         return -2;
     }
-    
+
     std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    
-    void* original = nullptr;
-    MH_STATUS status = MH_CreateHook(target, detour, &original);
-    if (status != MH_OK) {
-        mdb_debug_log("MH_CreateHook failed: %d", status);
-        set_error(MdbErrorCode::InvocationFailed, "MH_CreateHook failed");
+
+    // Create all hooks first and queue their enables, then commit with one
+    // MH_ApplyQueued — MH_EnableHook suspends every thread per call, so a mod
+    // installing dozens of patches at startup pays one suspension cycle
+    // instead of one per hook.
+    int created = 0;
+    for (int i = 0; i < count; i++) {
+        MdbHookRequest& req = requests[i];
+        req.original = nullptr;
+        req.handle = 0;
+
+        void* target = req.target;
+        if (!target && req.rva != 0) {
+            target = mdb_get_method_pointer_from_rva(req.rva);
+        }
+        if (!target || !req.detour) {
+            req.handle = -1;
+            continue;
+        }
+
+        int index = hook_slot_alloc();
+        if (index < 0) {
+            req.handle = -5;
+            continue;
+        }
+
+        void* original = nullptr;
+        MH_STATUS status = MH_CreateHook(target, req.detour, &original);
+        if (status != MH_OK) {
+            mdb_debug_log("MH_CreateHook failed for batch entry %d: %d", i, status);
+            req.handle = -3;
+            continue;
+        }
+
+        status = MH_QueueEnableHook(target);
+        if (status != MH_OK) {
+            MH_RemoveHook(target);
+            req.handle = -4;
+            continue;
+        }
+
+        req.target = target;
+        req.original = original;
+        req.handle = make_hook_handle(index, g_hook_slots[index].generation);
+        created++;
+    }
+
+    if (created == 0) {
+        set_error(MdbErrorCode::InvocationFailed, "No hooks could be created");
         return -3;
     }
-    
-    status = MH_EnableHook(target);
+
+    MH_STATUS status = MH_ApplyQueued();
     if (status != MH_OK) {
-        MH_RemoveHook(target);
-        set_error(MdbErrorCode::InvocationFailed, "MH_EnableHook failed");
+        // Roll back: none of the queued hooks were committed
+        for (int i = 0; i < count; i++) {
+            if (requests[i].handle > 0) {
+                MH_RemoveHook(requests[i].target);
+                requests[i].handle = -5;
+                requests[i].original = nullptr;
+            }
+        }
+        set_error(MdbErrorCode::InvocationFailed, "MH_ApplyQueued failed");
         return -4;
     }
+
+    // Commit: publish the slots now that every queued enable has landed
+    for (int i = 0; i < count; i++) {
+        if (requests[i].handle > 0) {
+            int index = static_cast<int>(requests[i].handle & 0xFFFFFFFF);
+            HookSlot& slot = g_hook_slots[index];
+            slot.target = requests[i].target;
+            slot.detour = requests[i].detour;
+            slot.original = requests[i].original;
+            slot.instrumented = false;
+            slot.reset_stats();
+            slot.enabled.store(true, std::memory_order_relaxed);
+            slot.in_use.store(true, std::memory_order_release);
+        }
+    }
+
+    mdb_debug_log("Batch-created %d/%d hooks with one queued-enable commit", created, count);
+    return created;
+
+#else
+    set_error(MdbErrorCode::NotInitialized, "MinHook not available");
+    return -100;
+#endif
+}
+
+MDB_API int mdb_remove_hook(int64_t hook_handle) {
+    clear_error();
     
-    // Store hook info
-    int64_t handle = g_next_hook_handle++;
-    g_hooks[handle] = HookInfo{handle, target, detour, original, true};
-    
-    if (out_original) {
-        *out_original = original;
+#if MDB_HAS_MINHOOK
+    std::lock_guard<std::mutex> lock(g_hooks_mutex);
+
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+        return -1;
+    }
+
+    MH_STATUS status = MH_DisableHook(slot->target);
+    if (status != MH_OK && status != MH_ERROR_DISABLED) {
+        set_error(MdbErrorCode::InvocationFailed, "MH_DisableHook failed");
+        return -2;
+    }
+
+    status = MH_RemoveHook(slot->target);
+    if (status != MH_OK) {
+        set_error(MdbErrorCode::InvocationFailed, "MH_RemoveHook failed");
+        return -3;
     }
+
+    slot->enabled.store(false, std::memory_order_relaxed);
+    slot->in_use.store(false, std::memory_order_release);
+    mdb_debug_log("Removed hook %lld", hook_handle);
+    return 0;
     
-    mdb_debug_log("Created hook %lld: target=%p, detour=%p, original=%p", handle, target, detour, original);
-    return handle;
+#else
+    set_error(MdbErrorCode::NotInitialized, "MinHook not available");
+    return -100;
+#endif
+}
+
+MDB_API int mdb_set_hook_enabled(int64_t hook_handle, bool enabled) {
+    clear_error();
     
+#if MDB_HAS_MINHOOK
+    // No g_hooks_mutex here: the slot lookup is lock-free and MinHook
+    // serializes its own transaction state, so per-level hook toggles from
+    // mod threads never contend with hook creation.
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+        return -1;
+    }
+
+    MH_STATUS status;
+    if (enabled) {
+        status = MH_EnableHook(slot->target);
+    } else {
+        status = MH_DisableHook(slot->target);
+    }
+
+    if (status != MH_OK) {
+        set_error(MdbErrorCode::InvocationFailed, enabled ? "MH_EnableHook failed" : "MH_DisableHook failed");
+        return -2;
+    }
+
+    slot->enabled.store(enabled, std::memory_order_release);
+    return 0;
+
 #else
     set_error(MdbErrorCode::NotInitialized, "MinHook not available");
     return -100;
 #endif
 }
 
-MDB_API int mdb_remove_hook(int64_t hook_handle) {
+MDB_API int mdb_get_hook_stats(int64_t hook_handle, MdbHookStats* out_stats) {
+    clear_error();
+
+    if (!out_stats) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: out_stats is null");
+        return -1;
+    }
+
+    // Lock-free like mdb_set_hook_enabled: reading counters must not stall
+    // hook creation, and relaxed loads are fine for a monitoring snapshot
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+        return -2;
+    }
+
+    uint64_t sampled = slot->sampled_count.load(std::memory_order_relaxed);
+    uint64_t cycles = slot->sampled_cycles.load(std::memory_order_relaxed);
+    uint64_t minCycles = slot->min_cycles.load(std::memory_order_relaxed);
+
+    out_stats->hit_count = slot->hits.load(std::memory_order_relaxed);
+    out_stats->sampled_count = sampled;
+    out_stats->avg_cycles = sampled ? static_cast<double>(cycles) / static_cast<double>(sampled) : 0.0;
+    out_stats->min_cycles = (minCycles == UINT64_MAX) ? 0 : minCycles;
+    out_stats->max_cycles = slot->max_cycles.load(std::memory_order_relaxed);
+    out_stats->instrumented = slot->instrumented ? 1 : 0;
+    return 0;
+}
+
+MDB_API int mdb_reset_hook_stats(int64_t hook_handle) {
+    clear_error();
+
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+        return -1;
+    }
+
+    slot->reset_stats();
+    return 0;
+}
+
+MDB_API int mdb_hook_add_filter(int64_t hook_handle, int arg_index, int width, int compare_op, uint64_t value) {
     clear_error();
-    
-#if MDB_HAS_MINHOOK
-    std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    
-    auto it = g_hooks.find(hook_handle);
-    if (it == g_hooks.end()) {
-        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+
+    if (arg_index < 0 || arg_index >= 12) {
+        set_error(MdbErrorCode::InvalidArgument, "Filter argument index out of range");
         return -1;
     }
-    
-    HookInfo& info = it->second;
-    
-    MH_STATUS status = MH_DisableHook(info.target);
-    if (status != MH_OK && status != MH_ERROR_DISABLED) {
-        set_error(MdbErrorCode::InvocationFailed, "MH_DisableHook failed");
+    if (width != 1 && width != 2 && width != 4 && width != 8) {
+        set_error(MdbErrorCode::InvalidArgument, "Filter width must be 1, 2, 4 or 8");
         return -2;
     }
-    
-    status = MH_RemoveHook(info.target);
-    if (status != MH_OK) {
-        set_error(MdbErrorCode::InvocationFailed, "MH_RemoveHook failed");
+    if (compare_op < MDB_HOOK_FILTER_EQ || compare_op > MDB_HOOK_FILTER_MASK) {
+        set_error(MdbErrorCode::InvalidArgument, "Unknown filter compare op");
         return -3;
     }
-    
-    g_hooks.erase(it);
-    mdb_debug_log("Removed hook %lld", hook_handle);
+
+    // Staged under the creation lock so concurrent installs don't race on
+    // the same descriptor index
+    std::lock_guard<std::mutex> lock(g_hooks_mutex);
+
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
+        return -4;
+    }
+    if (!slot->stub_routed) {
+        set_error(MdbErrorCode::InvalidArgument, "Filters require a filtered or instrumented hook");
+        return -5;
+    }
+
+    int count = slot->filter_count.load(std::memory_order_relaxed);
+    if (count >= MDB_MAX_HOOK_FILTERS) {
+        set_error(MdbErrorCode::InvalidArgument, "Hook filter table full");
+        return -6;
+    }
+
+    HookFilter& filter = slot->filters[count];
+    filter.arg_index = arg_index;
+    filter.width = width;
+    filter.op = compare_op;
+    filter.value = value;
+
+    // Publish: the stub's acquire load of filter_count orders the
+    // descriptor fields written above
+    slot->filter_count.store(count + 1, std::memory_order_release);
     return 0;
-    
-#else
-    set_error(MdbErrorCode::NotInitialized, "MinHook not available");
-    return -100;
-#endif
 }
 
-MDB_API int mdb_set_hook_enabled(int64_t hook_handle, bool enabled) {
+MDB_API int mdb_hook_clear_filters(int64_t hook_handle) {
     clear_error();
-    
-#if MDB_HAS_MINHOOK
+
     std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    
-    auto it = g_hooks.find(hook_handle);
-    if (it == g_hooks.end()) {
+
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
         set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
         return -1;
     }
-    
-    HookInfo& info = it->second;
-    
-    MH_STATUS status;
-    if (enabled) {
-        status = MH_EnableHook(info.target);
-    } else {
-        status = MH_DisableHook(info.target);
+
+    slot->filter_count.store(0, std::memory_order_release);
+    return 0;
+}
+
+MDB_API int mdb_hook_get_filtered_hits(int64_t hook_handle, unsigned long long* out_count) {
+    clear_error();
+
+    if (!out_count) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: out_count is null");
+        return -1;
     }
-    
-    if (status != MH_OK) {
-        set_error(MdbErrorCode::InvocationFailed, enabled ? "MH_EnableHook failed" : "MH_DisableHook failed");
+
+    // Lock-free like mdb_get_hook_stats: a monitoring snapshot must not
+    // stall hook creation
+    HookSlot* slot = hook_slot_from_handle(hook_handle);
+    if (!slot) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid hook handle");
         return -2;
     }
-    
-    info.enabled = enabled;
+
+    *out_count = slot->filtered_hits.load(std::memory_order_relaxed);
     return 0;
-    
-#else
-    set_error(MdbErrorCode::NotInitialized, "MinHook not available");
-    return -100;
-#endif
 }
 
 MDB_API int mdb_get_method_info(void* method, int* out_param_count, bool* out_is_static, bool* out_has_return) {
@@ -2326,15 +5191,13 @@ MDB_API int mdb_install_ongui_hook() {
     clear_error();
     
 #if MDB_HAS_MINHOOK
-    // Initialize MinHook if not done
-    if (!g_minhook_initialized) {
-        if (MH_Initialize() != MH_OK) {
-            set_error(MdbErrorCode::InitFailed, "MinHook initialization failed");
-            return -1;
-        }
-        g_minhook_initialized = true;
+    // Normally a no-op: mdb_init() already initialized MinHook eagerly.
+    // Kept as a guard for callers that install the OnGUI hook standalone.
+    if (!ensure_minhook_initialized()) {
+        set_error(MdbErrorCode::InitFailed, "MinHook initialization failed");
+        return -1;
     }
-    
+
     // Ensure IL2CPP is initialized
     auto status = il2cpp::_internal::ensure_exports();
     if (status != Il2CppStatus::OK) {
@@ -2569,6 +5432,99 @@ MDB_API void* mdb_property_get_set_method(void* prop) {
     return pi->m_pSet;
 }
 
+// ==============================
+// Property Accessor Resolution
+// ==============================
+// Generated-wrapper property access otherwise resolves "get_X"/"set_X"
+// through name-based method probes on every cold path. These exports
+// resolve the property itself once (one pass over the property tables,
+// parent chain included) and answer the accessor pair — MethodInfo plus
+// direct function pointer — from a cache keyed by the property pointer.
+
+struct PropertyAccessors {
+    void* getter = nullptr;
+    void* setter = nullptr;
+    void* getter_ptr = nullptr;
+    void* setter_ptr = nullptr;
+};
+
+static std::unordered_map<void*, PropertyAccessors> g_property_accessor_cache;
+static std::shared_mutex g_property_accessor_cache_mutex;
+
+MDB_API void* mdb_class_get_property(void* klass, const char* name) {
+    clear_error();
+    if (!klass || !name) {
+        set_error(MdbErrorCode::NullPointer, "Invalid arguments: klass and name are required");
+        return nullptr;
+    }
+
+    static auto il2cpp_class_get_properties_fn = reinterpret_cast<void*(*)(void*, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_properties")
+    );
+    static auto il2cpp_class_get_parent_fn = reinterpret_cast<void*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_parent")
+    );
+
+    if (!il2cpp_class_get_properties_fn) {
+        set_error(MdbErrorCode::ExportNotFound, "il2cpp_class_get_properties not available");
+        return nullptr;
+    }
+
+    for (void* k = klass; k; k = il2cpp_class_get_parent_fn ? il2cpp_class_get_parent_fn(k) : nullptr) {
+        void* iter = nullptr;
+        while (void* prop = il2cpp_class_get_properties_fn(k, &iter)) {
+            auto* pi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppPropertyInfo*>(prop);
+            if (pi->m_pName && strcmp(pi->m_pName, name) == 0) {
+                return prop;
+            }
+        }
+    }
+
+    set_error(MdbErrorCode::MethodNotFound, "Property not found");
+    return nullptr;
+}
+
+MDB_API int mdb_property_get_accessors(void* prop, void** out_getter, void** out_setter,
+                                       void** out_getter_ptr, void** out_setter_ptr) {
+    clear_error();
+    if (out_getter) *out_getter = nullptr;
+    if (out_setter) *out_setter = nullptr;
+    if (out_getter_ptr) *out_getter_ptr = nullptr;
+    if (out_setter_ptr) *out_setter_ptr = nullptr;
+    if (!prop) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: prop is null");
+        return -1;
+    }
+
+    const PropertyAccessors* cached = nullptr;
+    {
+        std::shared_lock<std::shared_mutex> lock(g_property_accessor_cache_mutex);
+        auto it = g_property_accessor_cache.find(prop);
+        if (it != g_property_accessor_cache.end()) {
+            cached = &it->second;
+        }
+    }
+
+    if (!cached) {
+        auto* pi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppPropertyInfo*>(prop);
+        PropertyAccessors acc;
+        acc.getter = pi->m_pGet;
+        acc.setter = pi->m_pSet;
+        if (pi->m_pGet) acc.getter_ptr = pi->m_pGet->m_pMethodPointer;
+        if (pi->m_pSet) acc.setter_ptr = pi->m_pSet->m_pMethodPointer;
+
+        std::unique_lock<std::shared_mutex> lock(g_property_accessor_cache_mutex);
+        cached = &g_property_accessor_cache.emplace(prop, acc).first->second;
+    }
+
+    if (out_getter) *out_getter = cached->getter;
+    if (out_setter) *out_setter = cached->setter;
+    if (out_getter_ptr) *out_getter_ptr = cached->getter_ptr;
+    if (out_setter_ptr) *out_setter_ptr = cached->setter_ptr;
+
+    return (cached->getter ? 1 : 0) | (cached->setter ? 2 : 0);
+}
+
 // Get method count for a class
 MDB_API int mdb_class_get_method_count(void* klass) {
     if (!klass) return 0;
@@ -2721,6 +5677,74 @@ MDB_API void* mdb_class_get_parent(void* klass) {
     return il2cpp_class_get_parent_fn(klass);
 }
 
+// ==============================
+// Class Assignability Cache
+// ==============================
+// "is A assignable to B" drives component filtering, object scanning, and
+// patch target validation — millions of checks per scene load, previously
+// walked in managed code through repeated class/name round trips. The
+// answer is constant per class pair, so memoize it.
+
+struct ClassPairHash {
+    size_t operator()(const std::pair<void*, void*>& p) const {
+        size_t h = std::hash<void*>{}(p.first);
+        return h ^ (std::hash<void*>{}(p.second) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+    }
+};
+
+static std::unordered_map<std::pair<void*, void*>, bool, ClassPairHash> g_assignable_cache;
+static std::shared_mutex g_assignable_cache_mutex;
+
+static bool class_is_assignable_uncached(void* from, void* to) {
+    // Official API when the runtime exports it
+    static auto il2cpp_class_is_assignable_from_fn = reinterpret_cast<bool(*)(void*, void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_assignable_from")
+    );
+    if (il2cpp_class_is_assignable_from_fn) {
+        return il2cpp_class_is_assignable_from_fn(to, from);
+    }
+
+    // Struct-walk fallback: parent chain, plus each class's interface list
+    // (recursing so interface inheritance is honored)
+    namespace us = il2cpp::_internal::unity_structs;
+    for (auto* k = reinterpret_cast<us::il2cppClass*>(from); k; k = k->m_pParentClass) {
+        if (k == to) return true;
+        if (il2cpp::_internal::il2cpp_class_get_interfaces) {
+            void* iter = nullptr;
+            while (auto* itf = il2cpp::_internal::il2cpp_class_get_interfaces(k, &iter)) {
+                if (itf == to || class_is_assignable_uncached(itf, to)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+MDB_API bool mdb_class_is_assignable(void* from, void* to) {
+    clear_error();
+    if (!from || !to) {
+        set_error(MdbErrorCode::NullPointer, "Invalid arguments: from and to are required");
+        return false;
+    }
+    if (from == to) return true;
+
+    const std::pair<void*, void*> key(from, to);
+    {
+        std::shared_lock<std::shared_mutex> lock(g_assignable_cache_mutex);
+        auto it = g_assignable_cache.find(key);
+        if (it != g_assignable_cache.end()) {
+            return it->second;
+        }
+    }
+
+    bool result = class_is_assignable_uncached(from, to);
+
+    {
+        std::unique_lock<std::shared_mutex> lock(g_assignable_cache_mutex);
+        g_assignable_cache.emplace(key, result);
+    }
+    return result;
+}
+
 // Get value type data directly from field (for primitive types)
 MDB_API bool mdb_field_get_value_direct(void* instance, void* field, void* outBuffer, int bufferSize) {
     if (!instance || !field || !outBuffer || bufferSize <= 0) return false;
@@ -2736,24 +5760,336 @@ MDB_API bool mdb_field_get_value_direct(void* instance, void* field, void* outBu
         memcpy(outBuffer, ptr, bufferSize);
         return true;
     }
-    
-    return false;
+    
+    return false;
+}
+
+// Set value type data directly to field (for primitive types)
+MDB_API bool mdb_field_set_value_direct(void* instance, void* field, void* value, int valueSize) {
+    if (!instance || !field || !value || valueSize <= 0) return false;
+
+    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+
+    // For instance fields, offset is positive
+    if (fi->m_iOffset >= 0) {
+        char* ptr = reinterpret_cast<char*>(instance) + fi->m_iOffset;
+        memcpy(ptr, value, valueSize);
+        return true;
+    }
+
+    return false;
+}
+
+// Storage size of a field in the packed buffer: value types occupy their
+// unboxed size, everything else is a pointer slot. Falls back to pointer
+// size when the sizing exports are unavailable.
+static int field_storage_size(il2cpp::_internal::unity_structs::il2cppFieldInfo* fi, bool* out_is_valuetype) {
+    static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
+    );
+    static auto il2cpp_class_value_size_fn = reinterpret_cast<int(*)(void*, uint32_t*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_value_size")
+    );
+
+    if (out_is_valuetype) *out_is_valuetype = false;
+    if (il2cpp::_internal::il2cpp_field_get_type &&
+        il2cpp::_internal::il2cpp_class_from_type &&
+        il2cpp_class_is_valuetype_fn && il2cpp_class_value_size_fn) {
+        auto* type = il2cpp::_internal::il2cpp_field_get_type(fi);
+        auto* fieldClass = type ? il2cpp::_internal::il2cpp_class_from_type(type) : nullptr;
+        if (fieldClass && il2cpp_class_is_valuetype_fn(fieldClass)) {
+            uint32_t align = 0;
+            int size = il2cpp_class_value_size_fn(fieldClass, &align);
+            if (size > 0) {
+                if (out_is_valuetype) *out_is_valuetype = true;
+                return size;
+            }
+        }
+    }
+    return static_cast<int>(sizeof(void*));
+}
+
+MDB_API int mdb_field_get_values(void* instance, void** fields, int count, void* out_packed) {
+    MDB_PROFILE_EXPORT();
+    if (!instance || !fields || !out_packed || count <= 0) return -1;
+
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) return -1;
+
+    // One transition for the whole read set: values are packed back to back
+    // in field-array order, each at its storage size (the caller knows the
+    // field types, so it knows the layout).
+    char* cursor = reinterpret_cast<char*>(out_packed);
+    for (int i = 0; i < count; i++) {
+        auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(fields[i]);
+        if (!fi) return -1;
+        int size = field_storage_size(fi, nullptr);
+        il2cpp::_internal::il2cpp_field_get_value(instance, fi, cursor);
+        cursor += size;
+    }
+
+    return static_cast<int>(cursor - reinterpret_cast<char*>(out_packed));
+}
+
+MDB_API int mdb_field_set_values(void* instance, void** fields, int count, void* packed) {
+    MDB_PROFILE_EXPORT();
+    if (!instance || !fields || !packed || count <= 0) return -1;
+
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) return -1;
+
+    char* cursor = reinterpret_cast<char*>(packed);
+    for (int i = 0; i < count; i++) {
+        auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(fields[i]);
+        if (!fi) return -1;
+        bool isValueType = false;
+        int size = field_storage_size(fi, &isValueType);
+        // il2cpp_field_set_value takes value-type data by pointer but
+        // reference values directly, matching mdb_field_set_value's contract.
+        void* value = isValueType ? static_cast<void*>(cursor) : *reinterpret_cast<void**>(cursor);
+        il2cpp::_internal::il2cpp_field_set_value(instance, fi, value);
+        cursor += size;
+    }
+
+    return static_cast<int>(cursor - reinterpret_cast<char*>(packed));
+}
+
+// ==============================
+// Object Graph Dump
+// ==============================
+// Inspecting one object in the explorer used to issue a P/Invoke cascade:
+// class lookup, field enumeration, a value read per field, nested class
+// queries. mdb_object_dump serializes the whole graph to a self-describing
+// record stream in one transition — primitive payloads inline, string
+// contents inline (capped), reference fields as (object, class) pairs —
+// recursing to a bounded depth. Field layouts are resolved once per class
+// and cached; every read of game memory goes through an SEH guard so a
+// stale instance produces a truncated dump, not a crash.
+
+struct DumpFieldDesc {
+    void* field;
+    const char* name;
+    int32_t offset;
+    int32_t type_enum;
+    int32_t value_size;     // unboxed size for value types, pointer size otherwise
+    bool is_valuetype;
+};
+
+struct DumpClassLayout {
+    const char* name;
+    const char* name_space;
+    std::vector<DumpFieldDesc> fields;   // own fields first, then base chain
+};
+
+static std::unordered_map<void*, DumpClassLayout> g_dump_layout_cache;
+static std::shared_mutex g_dump_layout_cache_mutex;
+
+// SEH-guarded copy from game memory (POD locals only)
+static bool dump_read_guarded(void* dst, const void* src, int size) {
+    __try {
+        memcpy(dst, src, size);
+        return true;
+    } __except (EXCEPTION_EXECUTE_HANDLER) {
+        return false;
+    }
+}
+
+static const DumpClassLayout* dump_get_layout(void* klass) {
+    {
+        std::shared_lock<std::shared_mutex> lock(g_dump_layout_cache_mutex);
+        auto it = g_dump_layout_cache.find(klass);
+        if (it != g_dump_layout_cache.end()) return &it->second;
+    }
+
+    static auto il2cpp_class_get_fields_fn = reinterpret_cast<void*(*)(void*, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_fields")
+    );
+    static auto il2cpp_field_get_flags_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_field_get_flags")
+    );
+    if (!il2cpp_class_get_fields_fn) return nullptr;
+
+    DumpClassLayout layout{};
+    auto* k = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+    layout.name = k->m_pName ? k->m_pName : "";
+    layout.name_space = k->m_pNamespace ? k->m_pNamespace : "";
+
+    // Own fields first, then the base chain, matching inspector display order
+    for (auto* cur = k; cur; cur = cur->m_pParentClass) {
+        void* iter = nullptr;
+        void* field = nullptr;
+        while ((field = il2cpp_class_get_fields_fn(cur, &iter)) != nullptr) {
+            auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+            if (il2cpp_field_get_flags_fn) {
+                int flags = il2cpp_field_get_flags_fn(field);
+                if (flags & 0x0010) continue;   // FIELD_ATTRIBUTE_STATIC
+                if (flags & 0x0040) continue;   // FIELD_ATTRIBUTE_LITERAL
+            }
+            if (fi->m_iOffset <= 0) continue;
+
+            DumpFieldDesc desc{};
+            desc.field = field;
+            desc.name = fi->m_pName ? fi->m_pName : "";
+            desc.offset = fi->m_iOffset;
+            desc.type_enum = fi->m_pType ? mdb_type_get_type_enum(fi->m_pType) : 0;
+            desc.value_size = field_storage_size(fi, &desc.is_valuetype);
+            layout.fields.push_back(desc);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(g_dump_layout_cache_mutex);
+    return &g_dump_layout_cache.emplace(klass, std::move(layout)).first->second;
+}
+
+namespace {
+
+struct DumpWriter {
+    char* base;
+    int capacity;
+    int used = 0;
+    bool truncated = false;
+
+    bool Emit(uint8_t kind, uint8_t depth, const char* name, int32_t type_enum,
+              const void* value, int32_t value_size) {
+        uint16_t nameLen = name ? static_cast<uint16_t>(strlen(name)) : 0;
+        int total = static_cast<int>(sizeof(MdbDumpRecord)) + nameLen + value_size;
+        if (used + total > capacity) {
+            truncated = true;
+            return false;
+        }
+        MdbDumpRecord rec{};
+        rec.kind = kind;
+        rec.depth = depth;
+        rec.name_len = nameLen;
+        rec.type_enum = type_enum;
+        rec.value_size = value_size;
+        memcpy(base + used, &rec, sizeof(rec));
+        if (nameLen) memcpy(base + used + sizeof(rec), name, nameLen);
+        if (value_size) memcpy(base + used + sizeof(rec) + nameLen, value, value_size);
+        used += total;
+        return true;
+    }
+};
+
+} // anonymous namespace
+
+static void dump_object_recursive(DumpWriter& writer, void* instance, void* klass,
+                                  int depth, int max_depth,
+                                  std::unordered_set<void*>& visited) {
+    const DumpClassLayout* layout = dump_get_layout(klass);
+    if (!layout) return;
+
+    static auto il2cpp_string_chars_fn = reinterpret_cast<wchar_t*(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_chars")
+    );
+    static auto il2cpp_string_length_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_string_length")
+    );
+
+    char className[512];
+    if (layout->name_space[0]) {
+        snprintf(className, sizeof(className), "%s.%s", layout->name_space, layout->name);
+    } else {
+        snprintf(className, sizeof(className), "%s", layout->name);
+    }
+
+    void* objectHeader[2] = { instance, klass };
+    if (!writer.Emit(MDB_DUMP_OBJECT_BEGIN, static_cast<uint8_t>(depth), className, 0,
+                     objectHeader, sizeof(objectHeader))) {
+        return;
+    }
+
+    for (const DumpFieldDesc& desc : layout->fields) {
+        const char* fieldAddr = reinterpret_cast<const char*>(instance) + desc.offset;
+
+        if (desc.is_valuetype) {
+            // Inline struct/primitive payload, clamped so one oversized
+            // struct cannot eat the whole buffer
+            char value[MDB_DUMP_MAX_VALUE_BYTES];
+            int size = desc.value_size < MDB_DUMP_MAX_VALUE_BYTES ? desc.value_size
+                                                                  : MDB_DUMP_MAX_VALUE_BYTES;
+            if (!dump_read_guarded(value, fieldAddr, size)) continue;
+            if (!writer.Emit(MDB_DUMP_FIELD_VALUE, static_cast<uint8_t>(depth), desc.name,
+                             desc.type_enum, value, size)) return;
+            continue;
+        }
+
+        void* ref = nullptr;
+        if (!dump_read_guarded(&ref, fieldAddr, sizeof(ref))) continue;
+
+        if (!ref) {
+            if (!writer.Emit(MDB_DUMP_FIELD_NULL, static_cast<uint8_t>(depth), desc.name,
+                             desc.type_enum, nullptr, 0)) return;
+            continue;
+        }
+
+        // Inline string contents (UTF-8, capped) — the single most-read
+        // reference type in the inspector
+        if (desc.type_enum == 0x0e && il2cpp_string_chars_fn && il2cpp_string_length_fn) {
+            const wchar_t* chars = il2cpp_string_chars_fn(ref);
+            int len = il2cpp_string_length_fn(ref);
+            if (chars && len >= 0) {
+                char utf8[MDB_DUMP_MAX_VALUE_BYTES];
+                int written = ::WideCharToMultiByte(CP_UTF8, 0, chars, len,
+                                                    utf8, sizeof(utf8), nullptr, nullptr);
+                if (written >= 0) {
+                    if (!writer.Emit(MDB_DUMP_FIELD_STRING, static_cast<uint8_t>(depth),
+                                     desc.name, desc.type_enum, utf8, written)) return;
+                    continue;
+                }
+            }
+        }
+
+        // Runtime class is the object's first pointer-sized field
+        void* refClass = nullptr;
+        dump_read_guarded(&refClass, ref, sizeof(refClass));
+
+        void* refValue[2] = { ref, refClass };
+        if (!writer.Emit(MDB_DUMP_FIELD_REFERENCE, static_cast<uint8_t>(depth), desc.name,
+                         desc.type_enum, refValue, sizeof(refValue))) return;
+
+        if (refClass && depth < max_depth && visited.insert(ref).second) {
+            dump_object_recursive(writer, ref, refClass, depth + 1, max_depth, visited);
+        }
+    }
+
+    writer.Emit(MDB_DUMP_OBJECT_END, static_cast<uint8_t>(depth), nullptr, 0, nullptr, 0);
 }
 
-// Set value type data directly to field (for primitive types)
-MDB_API bool mdb_field_set_value_direct(void* instance, void* field, void* value, int valueSize) {
-    if (!instance || !field || !value || valueSize <= 0) return false;
-    
-    auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
-    
-    // For instance fields, offset is positive
-    if (fi->m_iOffset >= 0) {
-        char* ptr = reinterpret_cast<char*>(instance) + fi->m_iOffset;
-        memcpy(ptr, value, valueSize);
-        return true;
+MDB_API int mdb_object_dump(void* instance, int depth, void* out_buffer, int buffer_size) {
+    MDB_PROFILE_EXPORT();
+    clear_error();
+    if (!instance || !out_buffer) {
+        set_error(MdbErrorCode::NullPointer, "Invalid arguments: instance and out_buffer are required");
+        return -1;
     }
-    
-    return false;
+    if (buffer_size < static_cast<int>(sizeof(MdbDumpRecord))) {
+        set_error(MdbErrorCode::InvalidArgument, "Buffer too small for a dump record");
+        return -1;
+    }
+
+    auto status = il2cpp::_internal::ensure_exports();
+    if (status != Il2CppStatus::OK) {
+        set_error(MdbErrorCode::NotInitialized, status);
+        return -1;
+    }
+
+    // Runtime class from the object header, guarded — a destroyed object
+    // fails here rather than faulting mid-walk
+    void* klass = nullptr;
+    if (!dump_read_guarded(&klass, instance, sizeof(klass)) || !klass) {
+        set_error(MdbErrorCode::NullPointer, "Object pointer is invalid or destroyed");
+        return -1;
+    }
+
+    if (depth < 0) depth = 0;
+    if (depth > 8) depth = 8;
+
+    DumpWriter writer{ reinterpret_cast<char*>(out_buffer), buffer_size };
+    std::unordered_set<void*> visited;
+    visited.insert(instance);
+    dump_object_recursive(writer, instance, klass, 0, depth, visited);
+    return writer.used;
 }
 
 // ==============================
@@ -2822,6 +6158,24 @@ MDB_API void* mdb_image_get_class(void* image, int index) {
         reinterpret_cast<il2cpp::_internal::unity_structs::il2cppImage*>(image), static_cast<size_t>(index));
 }
 
+MDB_API int mdb_get_assembly_snapshot(MdbAssemblyInfo* out_infos, int cap) {
+    if (!ensure_assembly_cache()) return 0;
+
+    int total = static_cast<int>(g_cached_assembly_count);
+    if (!out_infos || cap <= 0) return total;   // size query
+
+    int count = total < cap ? total : cap;
+    for (int i = 0; i < count; i++) {
+        auto* asm_ptr = g_cached_assemblies[i];
+        MdbAssemblyInfo& info = out_infos[i];
+        info.assembly = asm_ptr;
+        info.image = mdb_assembly_get_image(asm_ptr);
+        info.image_name = mdb_image_get_name(info.image);
+        info.class_count = mdb_image_get_class_count(info.image);
+    }
+    return count;
+}
+
 MDB_API int mdb_class_get_flags(void* klass) {
     if (!klass) return 0;
 
@@ -2835,16 +6189,218 @@ MDB_API int mdb_class_get_flags(void* klass) {
     return 0;
 }
 
+MDB_API int mdb_class_get_info_batch(void** classes, int count, MdbClassInfo* out_infos) {
+    if (!classes || !out_infos || count <= 0) return 0;
+
+    // IL2CPP name/namespace pointers point into the metadata segment and are
+    // stable for the process lifetime, so returning them raw is safe and lets
+    // the caller marshal each string lazily (or not at all).
+    static auto il2cpp_class_is_valuetype_fn = reinterpret_cast<bool(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_is_valuetype")
+    );
+
+    int written = 0;
+    for (int i = 0; i < count; i++) {
+        void* klass = classes[i];
+        MdbClassInfo& info = out_infos[i];
+        if (!klass) {
+            info.name = nullptr;
+            info.name_space = nullptr;
+            info.flags = 0;
+            info.is_valuetype = 0;
+            info.parent = nullptr;
+            continue;
+        }
+
+        auto* il2cpp_klass = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppClass*>(klass);
+        info.name = il2cpp_klass->m_pName;
+        info.name_space = il2cpp_klass->m_pNamespace;
+        info.flags = mdb_class_get_flags(klass);
+        info.is_valuetype = il2cpp_class_is_valuetype_fn ? (il2cpp_class_is_valuetype_fn(klass) ? 1 : 0) : 0;
+        info.parent = mdb_class_get_parent(klass);
+        written++;
+    }
+
+    return written;
+}
+
+MDB_API int mdb_class_enum_fields(void* klass, MdbFieldRecord* out_records, int cap) {
+    if (!klass) return 0;
+
+    static auto il2cpp_class_get_fields_fn = reinterpret_cast<void*(*)(void*, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_fields")
+    );
+    static auto il2cpp_field_get_flags_fn = reinterpret_cast<int(*)(void*)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_field_get_flags")
+    );
+    if (!il2cpp_class_get_fields_fn) return 0;
+
+    int count = 0;
+    void* iter = nullptr;
+    void* field = nullptr;
+    while ((field = il2cpp_class_get_fields_fn(klass, &iter)) != nullptr) {
+        if (out_records && count < cap) {
+            auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
+            MdbFieldRecord& rec = out_records[count];
+            rec.field = field;
+            rec.name = fi->m_pName;
+            rec.type = fi->m_pType;
+            rec.offset = fi->m_iOffset;
+            rec.flags = il2cpp_field_get_flags_fn ? il2cpp_field_get_flags_fn(field) : 0;
+            // FIELD_ATTRIBUTE_STATIC = 0x0010; offset -1 fallback matches mdb_field_is_static
+            rec.is_static = il2cpp_field_get_flags_fn
+                ? ((rec.flags & 0x0010) != 0 ? 1 : 0)
+                : (fi->m_iOffset == -1 ? 1 : 0);
+        }
+        count++;
+    }
+
+    if (!out_records || cap <= 0) return count;   // size query
+    return count < cap ? count : cap;
+}
+
+MDB_API int mdb_class_enum_methods(void* klass, MdbMethodRecord* out_records, int cap) {
+    if (!klass) return 0;
+
+    static auto il2cpp_class_get_methods_fn = reinterpret_cast<void*(*)(void*, void**)>(
+        GetProcAddress(il2cpp::_internal::p_game_assembly, "il2cpp_class_get_methods")
+    );
+    if (!il2cpp_class_get_methods_fn) return 0;
+
+    uintptr_t module_base = reinterpret_cast<uintptr_t>(il2cpp::_internal::p_game_assembly);
+
+    int count = 0;
+    void* iter = nullptr;
+    void* method = nullptr;
+    while ((method = il2cpp_class_get_methods_fn(klass, &iter)) != nullptr) {
+        if (out_records && count < cap) {
+            MdbMethodRecord& rec = out_records[count];
+            rec.method = method;
+            // These exports carry their own API-with-struct-fallback logic, so
+            // layout drift on exotic Unity versions is handled in one place.
+            rec.name = mdb_method_get_name_str(method);
+            rec.return_type = mdb_method_get_return_type(method);
+            rec.param_count = mdb_method_get_param_count(method);
+            rec.flags = mdb_method_get_flags(method);
+
+            auto* mi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppMethodInfo*>(method);
+            uintptr_t mp = reinterpret_cast<uintptr_t>(mi->m_pMethodPointer);
+            rec.rva = (mp > module_base) ? static_cast<unsigned long long>(mp - module_base) : 0;
+        }
+        count++;
+    }
+
+    if (!out_records || cap <= 0) return count;   // size query
+    return count < cap ? count : cap;
+}
+
 MDB_API int mdb_field_get_offset(void* field) {
     if (!field) return -1;
     auto* fi = reinterpret_cast<il2cpp::_internal::unity_structs::il2cppFieldInfo*>(field);
     return fi->m_iOffset;
 }
 
+// ==============================
+// Validated Memory Region Registry
+// ==============================
+// mdb_read_memory pays a VirtualQuery syscall per call to vet arbitrary
+// addresses, which is overkill for the overwhelmingly common case of
+// pointer-chain sampling inside GameAssembly or heap regions that earlier
+// reads already proved readable. The registry remembers those ranges so
+// repeat reads skip the syscall. The SEH guard stays on the fast path — it
+// is table-driven and free unless it fires — so a region freed behind our
+// back degrades to one failed read that drops the stale entry, never a
+// crash.
+
+struct ValidatedRegion {
+    uintptr_t begin;
+    uintptr_t end;
+};
+static constexpr size_t MDB_MAX_VALIDATED_REGIONS = 256;
+static std::vector<ValidatedRegion> g_validated_regions;
+static std::shared_mutex g_validated_regions_mutex;
+static std::atomic<bool> g_validated_regions_seeded{ false };
+
+static bool validated_region_contains(uintptr_t begin, uintptr_t end) {
+    std::shared_lock<std::shared_mutex> lock(g_validated_regions_mutex);
+    for (const ValidatedRegion& r : g_validated_regions) {
+        if (begin >= r.begin && end <= r.end) return true;
+    }
+    return false;
+}
+
+static void validated_region_add(uintptr_t begin, uintptr_t end) {
+    if (begin >= end) return;
+    std::unique_lock<std::shared_mutex> lock(g_validated_regions_mutex);
+    for (ValidatedRegion& r : g_validated_regions) {
+        // Grow an overlapping or adjacent entry instead of stacking slivers
+        if (begin <= r.end && end >= r.begin) {
+            if (begin < r.begin) r.begin = begin;
+            if (end > r.end) r.end = end;
+            return;
+        }
+    }
+    if (g_validated_regions.size() < MDB_MAX_VALIDATED_REGIONS) {
+        g_validated_regions.push_back({ begin, end });
+    }
+}
+
+static void validated_region_invalidate(uintptr_t addr) {
+    std::unique_lock<std::shared_mutex> lock(g_validated_regions_mutex);
+    for (size_t i = 0; i < g_validated_regions.size(); ++i) {
+        if (addr >= g_validated_regions[i].begin && addr < g_validated_regions[i].end) {
+            g_validated_regions[i] = g_validated_regions.back();
+            g_validated_regions.pop_back();
+            return;
+        }
+    }
+}
+
+// Seed the registry with the GameAssembly image range (base + SizeOfImage
+// from its own PE header) — the single hottest target of pointer reads.
+static void validated_regions_seed() {
+    if (g_validated_regions_seeded.exchange(true, std::memory_order_relaxed)) return;
+
+    HMODULE mod = il2cpp::_internal::p_game_assembly;
+    if (!mod) return;
+    const uint8_t* base = reinterpret_cast<const uint8_t*>(mod);
+    const auto* dos = reinterpret_cast<const IMAGE_DOS_HEADER*>(base);
+    if (dos->e_magic != IMAGE_DOS_SIGNATURE) return;
+    const auto* nt = reinterpret_cast<const IMAGE_NT_HEADERS*>(base + dos->e_lfanew);
+    if (nt->Signature != IMAGE_NT_SIGNATURE) return;
+
+    validated_region_add(reinterpret_cast<uintptr_t>(base),
+                         reinterpret_cast<uintptr_t>(base) + nt->OptionalHeader.SizeOfImage);
+}
+
+// SEH-guarded copy kept in its own function: the callers hold locks via the
+// registry helpers, and __try cannot share a frame with objects that have
+// destructors. Returns bytes copied, or -1 on an access violation.
+static int read_memory_guarded(void* address, void* buffer, int size) {
+    __try {
+        memcpy(buffer, address, size);
+        return size;
+    } __except (EXCEPTION_EXECUTE_HANDLER) {
+        return -1;
+    }
+}
+
 MDB_API int mdb_read_memory(void* address, void* buffer, int size) {
     if (!address || !buffer || size <= 0 || size > 4096) return 0;
 
-    // Use VirtualQuery to verify the memory is readable
+    uintptr_t addr = reinterpret_cast<uintptr_t>(address);
+    validated_regions_seed();
+
+    // Fast path: the whole read falls inside a region validated earlier —
+    // no VirtualQuery, just the guarded copy
+    if (validated_region_contains(addr, addr + static_cast<uintptr_t>(size))) {
+        int copied = read_memory_guarded(address, buffer, size);
+        if (copied >= 0) return copied;
+        validated_region_invalidate(addr);
+        return 0;
+    }
+
+    // Slow path: use VirtualQuery to verify the memory is readable
     MEMORY_BASIC_INFORMATION mbi;
     if (VirtualQuery(address, &mbi, sizeof(mbi)) == 0) return 0;
 
@@ -2854,19 +6410,294 @@ MDB_API int mdb_read_memory(void* address, void* buffer, int size) {
 
     // Clamp read to the end of the committed region
     uintptr_t regionEnd = reinterpret_cast<uintptr_t>(mbi.BaseAddress) + mbi.RegionSize;
-    uintptr_t readEnd = reinterpret_cast<uintptr_t>(address) + size;
+    uintptr_t readEnd = addr + size;
     int safeSize = size;
     if (readEnd > regionEnd) {
-        safeSize = static_cast<int>(regionEnd - reinterpret_cast<uintptr_t>(address));
+        safeSize = static_cast<int>(regionEnd - addr);
         if (safeSize <= 0) return 0;
     }
 
+    int copied = read_memory_guarded(address, buffer, safeSize);
+    if (copied <= 0) return 0;
+
+    // The region just proved itself readable — remember it so the next
+    // read here takes the fast path
+    validated_region_add(reinterpret_cast<uintptr_t>(mbi.BaseAddress), regionEnd);
+    return copied;
+}
+
+MDB_API int mdb_read_memory_batch(MdbReadDescriptor* descriptors, int count, void* buffer, int buffer_size) {
+    if (!descriptors || !buffer || count <= 0 || buffer_size <= 0) return 0;
+
+    // One transition for hundreds of small reads (vtable slots, pointer
+    // chains). Failed descriptors zero-fill their slot so the layout stays
+    // predictable; SEH catches the access violation and the loop continues
+    // with the next descriptor instead of aborting the batch.
+    int succeeded = 0;
+    for (int i = 0; i < count; i++) {
+        const MdbReadDescriptor& d = descriptors[i];
+        if (!d.address || d.size <= 0 || d.size > 4096) continue;
+        if (d.dest_offset < 0 || d.dest_offset + d.size > buffer_size) continue;
+
+        char* dest = reinterpret_cast<char*>(buffer) + d.dest_offset;
+        __try {
+            memcpy(dest, d.address, d.size);
+            succeeded++;
+        } __except (EXCEPTION_EXECUTE_HANDLER) {
+            memset(dest, 0, d.size);
+        }
+    }
+
+    return succeeded;
+}
+
+// SEH-guarded write, isolated for the same frame-destructor reason as
+// read_memory_guarded. Returns bytes written, or -1 on an access violation.
+static int write_memory_guarded(void* address, const void* src, int size) {
     __try {
-        memcpy(buffer, address, safeSize);
-        return safeSize;
+        memcpy(address, src, size);
+        return size;
     } __except (EXCEPTION_EXECUTE_HANDLER) {
-        return 0;
+        return -1;
+    }
+}
+
+MDB_API int mdb_write_memory_batch(MdbWriteDescriptor* descriptors, int count, const void* data, int data_size) {
+    if (!descriptors || !data || count <= 0 || data_size <= 0) return 0;
+
+    static const uintptr_t pageSize = [] {
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        return static_cast<uintptr_t>(si.dwPageSize);
+    }();
+    const uintptr_t pageMask = ~(pageSize - 1);
+
+    // Pages flipped writable this batch, with their original protection.
+    // 200 patches usually land on a handful of pages, so the linear scan is
+    // the cache — each page pays its VirtualProtect pair once per batch,
+    // not once per write.
+    struct FlippedPage {
+        uintptr_t page;
+        DWORD old_protect;
+    };
+    std::vector<FlippedPage> flipped;
+
+    auto ensure_writable = [&](uintptr_t page) -> bool {
+        for (const FlippedPage& p : flipped) {
+            if (p.page == page) return true;
+        }
+        DWORD oldProtect = 0;
+        if (!VirtualProtect(reinterpret_cast<void*>(page), pageSize, PAGE_EXECUTE_READWRITE, &oldProtect)) {
+            return false;
+        }
+        flipped.push_back({ page, oldProtect });
+        return true;
+    };
+
+    int succeeded = 0;
+    for (int i = 0; i < count; i++) {
+        const MdbWriteDescriptor& d = descriptors[i];
+        if (!d.address || d.size <= 0 || d.size > 4096) continue;
+        if (d.data_offset < 0 || d.data_offset + d.size > data_size) continue;
+
+        uintptr_t addr = reinterpret_cast<uintptr_t>(d.address);
+        bool pagesReady = true;
+        for (uintptr_t page = addr & pageMask; page < addr + static_cast<uintptr_t>(d.size); page += pageSize) {
+            if (!ensure_writable(page)) {
+                pagesReady = false;
+                break;
+            }
+        }
+        if (!pagesReady) continue;
+
+        const char* src = reinterpret_cast<const char*>(data) + d.data_offset;
+        if (write_memory_guarded(d.address, src, d.size) >= 0) {
+            succeeded++;
+        }
+    }
+
+    // Restore original protections and flush once — most batches patch code
+    for (const FlippedPage& p : flipped) {
+        DWORD ignored = 0;
+        VirtualProtect(reinterpret_cast<void*>(p.page), pageSize, p.old_protect, &ignored);
+    }
+    if (!flipped.empty()) {
+        FlushInstructionCache(GetCurrentProcess(), nullptr, 0);
+    }
+
+    return succeeded;
+}
+
+// ==============================
+// Binary Metadata Cache Implementation
+// ==============================
+// Thin P/Invoke shims over MDB::MetaCache (src/il2cpp/metadata_cache.cpp).
+// The cache is written by the dumper at the end of a dump run and validated
+// against the loaded GameAssembly.dll on open, so these never serve stale
+// metadata.
+
+MDB_API bool mdb_metadata_cache_open(const char* path) {
+    clear_error();
+    if (!path || !*path) {
+        set_error(MdbErrorCode::InvalidArgument, "path is null or empty");
+        return false;
+    }
+    return MDB::MetaCache::Open(path);
+}
+
+MDB_API bool mdb_metadata_cache_is_open() {
+    return MDB::MetaCache::IsOpen();
+}
+
+MDB_API void mdb_metadata_cache_close() {
+    MDB::MetaCache::Close();
+}
+
+MDB_API int mdb_metadata_cache_get_class_count() {
+    return static_cast<int>(MDB::MetaCache::GetClassCount());
+}
+
+MDB_API int mdb_metadata_cache_find_class(const char* name_space, const char* name) {
+    return MDB::MetaCache::FindClass(name_space, name);
+}
+
+MDB_API bool mdb_metadata_cache_get_class(int index, MdbCachedClassInfo* out_info) {
+    if (!out_info || index < 0) return false;
+
+    MDB::MetaCache::ClassView view{};
+    if (!MDB::MetaCache::GetClass(static_cast<uint32_t>(index), &view)) return false;
+
+    out_info->name = view.name;
+    out_info->name_space = view.name_space;
+    out_info->image = view.image;
+    out_info->flags = view.flags;
+    out_info->method_count = view.method_count;
+    out_info->field_count = view.field_count;
+    out_info->instance_size = view.instance_size;
+    out_info->is_valuetype = view.is_valuetype ? 1 : 0;
+    return true;
+}
+
+MDB_API bool mdb_metadata_cache_get_method(int class_index, int method_ordinal,
+                                           const char** out_name, unsigned int* out_param_count,
+                                           unsigned int* out_flags, unsigned long long* out_rva) {
+    if (class_index < 0 || method_ordinal < 0) return false;
+    return MDB::MetaCache::GetMethod(static_cast<uint32_t>(class_index),
+                                     static_cast<uint32_t>(method_ordinal),
+                                     out_name, out_param_count, out_flags, out_rva);
+}
+
+MDB_API bool mdb_metadata_cache_get_field(int class_index, int field_ordinal,
+                                          const char** out_name, unsigned int* out_offset,
+                                          unsigned int* out_flags) {
+    if (class_index < 0 || field_ordinal < 0) return false;
+    return MDB::MetaCache::GetField(static_cast<uint32_t>(class_index),
+                                    static_cast<uint32_t>(field_ordinal),
+                                    out_name, out_offset, out_flags);
+}
+
+MDB_API bool mdb_resolve_rva_to_method(unsigned long long rva,
+                                       const char** out_namespace, const char** out_class_name,
+                                       const char** out_method_name, unsigned long long* out_method_rva) {
+    // Accept raw pointers as well: anything at or past the GameAssembly base
+    // cannot be a valid RVA, so rebase it. Hook logs and hitch reports hand
+    // us absolute addresses; dump artifacts hand us RVAs.
+    uintptr_t gaBase = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
+    if (gaBase && rva >= gaBase) rva -= gaBase;
+
+    MDB::MetaCache::MethodSymbol symbol{};
+    if (!MDB::MetaCache::ResolveRva(rva, &symbol)) return false;
+    if (out_namespace) *out_namespace = symbol.name_space;
+    if (out_class_name) *out_class_name = symbol.class_name;
+    if (out_method_name) *out_method_name = symbol.method_name;
+    if (out_method_rva) *out_method_rva = symbol.method_rva;
+    return true;
+}
+
+// ==============================
+// Dump Snapshot Capture & Replay Implementation
+// ==============================
+// Thin shims over MDB::DumpSnapshot (src/il2cpp/dump_snapshot.cpp). Capture
+// needs a live (or mock) IL2CPP runtime; replay swaps the resolver accessors
+// for snapshot-backed ones and runs the full dump pipeline offline.
+
+MDB_API bool mdb_dump_capture_snapshot(const char* path) {
+    clear_error();
+    if (!path || !*path) {
+        set_error(MdbErrorCode::InvalidArgument, "path is null or empty");
+        return false;
+    }
+    std::string error;
+    if (!MDB::DumpSnapshot::Capture(path, &error)) {
+        set_error(MdbErrorCode::Unknown, error.c_str());
+        return false;
+    }
+    return true;
+}
+
+MDB_API bool mdb_dump_replay_snapshot(const char* snapshot_path,
+                                      const char* output_directory,
+                                      MdbDumpReplayStats* out_stats) {
+    clear_error();
+    if (!snapshot_path || !*snapshot_path || !output_directory || !*output_directory) {
+        set_error(MdbErrorCode::InvalidArgument, "snapshot path or output directory is null or empty");
+        return false;
+    }
+
+    MDB::Dumper::DumpResult result{};
+    std::string error;
+    bool ok = MDB::DumpSnapshot::Replay(snapshot_path, output_directory, &result, &error);
+
+    if (out_stats) {
+        out_stats->ms_image_hashing = result.ms_image_hashing;
+        out_stats->ms_obfuscation_analysis = result.ms_obfuscation_analysis;
+        out_stats->ms_collection = result.ms_collection;
+        out_stats->ms_registry = result.ms_registry;
+        out_stats->ms_generation = result.ms_generation;
+        out_stats->ms_file_io = result.ms_file_io;
+        out_stats->ms_metadata_cache = result.ms_metadata_cache;
+        out_stats->ms_total = result.ms_total;
+        out_stats->total_assemblies = result.total_assemblies;
+        out_stats->total_classes = result.total_classes;
+        out_stats->total_wrappers = result.total_wrappers_generated;
+    }
+
+    if (!ok) {
+        set_error(MdbErrorCode::Unknown, error.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ==============================
+// Memory Accounting Implementation
+// ==============================
+
+MDB_API int mdb_get_memory_tag_count() {
+    return static_cast<int>(MDB::Mem::Tag::Count);
+}
+
+MDB_API const char* mdb_get_memory_tag_name(int tag) {
+    return MDB::Mem::TagName(static_cast<MDB::Mem::Tag>(tag));
+}
+
+MDB_API int mdb_get_memory_stats(int tag, MdbMemoryStats* out_stats) {
+    clear_error();
+
+    if (!out_stats) {
+        set_error(MdbErrorCode::NullPointer, "Invalid argument: out_stats is null");
+        return -1;
     }
+    if (tag < 0 || tag >= static_cast<int>(MDB::Mem::Tag::Count)) {
+        set_error(MdbErrorCode::InvalidArgument, "Invalid memory tag index");
+        return -2;
+    }
+
+    MDB::Mem::TagStats stats = MDB::Mem::Get(static_cast<MDB::Mem::Tag>(tag));
+    out_stats->live_bytes = stats.live_bytes;
+    out_stats->peak_bytes = stats.peak_bytes;
+    out_stats->alloc_count = stats.alloc_count;
+    return 0;
 }
 
 // ==============================
@@ -2887,80 +6718,87 @@ MDB_API bool mdb_hook_is_debug_enabled() {
 }
 
 MDB_API int mdb_hook_get_count() {
-    std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    return static_cast<int>(g_hooks.size());
+    int count = 0;
+    for (int i = 0; i < MDB_MAX_HOOKS; i++) {
+        if (g_hook_slots[i].in_use.load(std::memory_order_acquire)) count++;
+    }
+    return count;
 }
 
 MDB_API int mdb_hook_get_debug_info(int index, MdbHookDebugInfo* out_info) {
-    if (!out_info) return -1;
-    
-    std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    
-    if (index < 0 || index >= static_cast<int>(g_hooks.size())) {
-        return -2;
-    }
-    
-    auto it = g_hooks.begin();
-    std::advance(it, index);
-    
-    const HookInfo& info = it->second;
-    out_info->handle = info.handle;
-    out_info->target = info.target;
-    out_info->detour = info.detour;
-    out_info->trampoline = info.original;
-    out_info->enabled = info.enabled;
-    
-    // Get description if available
-    auto desc_it = g_hook_descriptions.find(info.handle);
-    if (desc_it != g_hook_descriptions.end()) {
-        strncpy_s(out_info->description, desc_it->second.c_str(), sizeof(out_info->description) - 1);
-    } else {
-        snprintf(out_info->description, sizeof(out_info->description), "Hook_%lld", info.handle);
+    if (!out_info || index < 0) return -1;
+
+    // Walk the slot table to the index'th live hook
+    int seen = 0;
+    for (int i = 0; i < MDB_MAX_HOOKS; i++) {
+        HookSlot& slot = g_hook_slots[i];
+        if (!slot.in_use.load(std::memory_order_acquire)) continue;
+        if (seen++ != index) continue;
+
+        int64_t handle = make_hook_handle(i, slot.generation);
+        out_info->handle = handle;
+        out_info->target = slot.target;
+        out_info->detour = slot.detour;
+        out_info->trampoline = slot.original;
+        out_info->enabled = slot.enabled.load(std::memory_order_relaxed);
+
+        // Get description if available
+        std::lock_guard<std::mutex> lock(g_hooks_mutex);
+        auto desc_it = g_hook_descriptions.find(handle);
+        if (desc_it != g_hook_descriptions.end()) {
+            strncpy_s(out_info->description, desc_it->second.c_str(), sizeof(out_info->description) - 1);
+        } else {
+            snprintf(out_info->description, sizeof(out_info->description), "Hook_%lld", handle);
+        }
+
+        return 0;
     }
-    
-    return 0;
+
+    return -2;
 }
 
 MDB_API void mdb_hook_dump_all() {
     std::lock_guard<std::mutex> lock(g_hooks_mutex);
-    
-    mdb_debug_log("=== HOOK DUMP: %zu active hooks ===", g_hooks.size());
-    
-    for (const auto& pair : g_hooks) {
-        const HookInfo& info = pair.second;
-        
+
+    mdb_debug_log("=== HOOK DUMP: %d active hooks ===", mdb_hook_get_count());
+
+    for (int i = 0; i < MDB_MAX_HOOKS; i++) {
+        HookSlot& slot = g_hook_slots[i];
+        if (!slot.in_use.load(std::memory_order_acquire)) continue;
+        int64_t handle = make_hook_handle(i, slot.generation);
+
         std::string desc = "Unknown";
-        auto desc_it = g_hook_descriptions.find(info.handle);
+        auto desc_it = g_hook_descriptions.find(handle);
         if (desc_it != g_hook_descriptions.end()) {
             desc = desc_it->second;
         }
-        
+
         std::string sig = "N/A";
-        auto sig_it = g_hook_signatures.find(info.handle);
+        auto sig_it = g_hook_signatures.find(handle);
         if (sig_it != g_hook_signatures.end()) {
             sig = sig_it->second;
         }
-        
-        mdb_debug_log("  Hook #%lld: %s", info.handle, desc.c_str());
-        mdb_debug_log("    Target:     %p", info.target);
-        mdb_debug_log("    Detour:     %p", info.detour);
-        mdb_debug_log("    Trampoline: %p", info.original);
+
+        mdb_debug_log("  Hook #%lld: %s", handle, desc.c_str());
+        mdb_debug_log("    Target:     %p", slot.target);
+        mdb_debug_log("    Detour:     %p", slot.detour);
+        mdb_debug_log("    Trampoline: %p", slot.original);
         mdb_debug_log("    Signature:  %s", sig.c_str());
-        mdb_debug_log("    Enabled:    %s", info.enabled ? "YES" : "NO");
-        
+        mdb_debug_log("    Enabled:    %s", slot.enabled.load(std::memory_order_relaxed) ? "YES" : "NO");
+
         // Dump first few bytes of target and trampoline for debugging
-        if (info.target) {
-            unsigned char* bytes = reinterpret_cast<unsigned char*>(info.target);
+        if (slot.target) {
+            unsigned char* bytes = reinterpret_cast<unsigned char*>(slot.target);
             mdb_debug_log("    Target bytes: %02X %02X %02X %02X %02X %02X %02X %02X",
                 bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6], bytes[7]);
         }
-        if (info.original) {
-            unsigned char* bytes = reinterpret_cast<unsigned char*>(info.original);
+        if (slot.original) {
+            unsigned char* bytes = reinterpret_cast<unsigned char*>(slot.original);
             mdb_debug_log("    Trampoline bytes: %02X %02X %02X %02X %02X %02X %02X %02X",
                 bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6], bytes[7]);
         }
     }
-    
+
     mdb_debug_log("=== END HOOK DUMP ===");
 }
 
@@ -71,7 +71,27 @@ extern "C" {
     /// </summary>
     /// <returns>Pointer to the IL2CPP domain, or nullptr on failure</returns>
     MDB_API void* mdb_domain_get();
-    
+
+    /// <summary>
+    /// Arm the runtime readiness signal: a one-shot hook on il2cpp_init
+    /// flips an event the moment the game finishes initializing the IL2CPP
+    /// runtime. If the runtime is already up, the event is set immediately.
+    /// Call as early as possible (right after GameAssembly.dll is loaded),
+    /// then gate on mdb_wait_runtime_ready. Idempotent.
+    /// </summary>
+    /// <returns>True if the signal is armed (hook or immediate); false only
+    /// if the event could not be created</returns>
+    MDB_API bool mdb_arm_runtime_ready_signal();
+
+    /// <summary>
+    /// Block until the IL2CPP runtime is ready for managed interop (the
+    /// domain exists). Wakes event-driven when the signal was armed and the
+    /// il2cpp_init hook is live; otherwise polls at 10 ms.
+    /// </summary>
+    /// <param name="timeout_ms">Maximum time to wait</param>
+    /// <returns>True once the runtime is usable, false on timeout</returns>
+    MDB_API bool mdb_wait_runtime_ready(int timeout_ms);
+
     /// <summary>
     /// Attach the current thread to the IL2CPP domain.
     /// Must be called from any thread that will make IL2CPP calls.
@@ -129,7 +149,164 @@ extern "C" {
     /// <param name="exception">Output: exception object if thrown (can be nullptr)</param>
     /// <returns>Return value pointer (nullptr for void methods)</returns>
     MDB_API void* mdb_invoke_method(void* method, void* instance, void** args, void** exception);
-    
+
+    /// <summary>
+    /// Typed variant of mdb_invoke_method for int-returning methods: invoke
+    /// through il2cpp_runtime_invoke, then unbox the result natively and
+    /// return it by value — no boxed object crosses back to the caller.
+    /// Narrower integer returns (bool/char/i1/u1/i2/u2) are widened
+    /// according to the method's return type.
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo</param>
+    /// <param name="instance">Pointer to object instance (nullptr for static methods)</param>
+    /// <param name="args">Array of argument pointers</param>
+    /// <param name="exception">Output: exception object if thrown (can be nullptr)</param>
+    /// <returns>The unboxed value, or 0 on error or thrown exception</returns>
+    MDB_API int32_t mdb_invoke_method_i4(void* method, void* instance, void** args, void** exception);
+
+    /// <summary>
+    /// 64-bit integer variant of mdb_invoke_method_i4. Narrower integer
+    /// returns are widened according to the method's return type.
+    /// </summary>
+    MDB_API int64_t mdb_invoke_method_i8(void* method, void* instance, void** args, void** exception);
+
+    /// <summary>
+    /// float variant of mdb_invoke_method_i4 (double returns are narrowed).
+    /// </summary>
+    MDB_API float mdb_invoke_method_r4(void* method, void* instance, void** args, void** exception);
+
+    /// <summary>
+    /// double variant of mdb_invoke_method_i4 (float returns are widened).
+    /// </summary>
+    MDB_API double mdb_invoke_method_r8(void* method, void* instance, void** args, void** exception);
+
+    /// <summary>
+    /// Pointer variant of mdb_invoke_method_i4: pointer-sized primitive
+    /// returns (IntPtr/UIntPtr/pointers) are unboxed; reference-type results
+    /// are returned as the object pointer unchanged.
+    /// </summary>
+    MDB_API void* mdb_invoke_method_ptr(void* method, void* instance, void** args, void** exception);
+
+    /// <summary>
+    /// Extract the details of a thrown exception in a single call: type name
+    /// (namespace-qualified), Message, and StackTrace, written UTF-8 into the
+    /// caller's buffers. Pass a null buffer (or zero size) to skip a field —
+    /// the corresponding getter is then never invoked. Replaces the separate
+    /// get_Message/get_StackTrace invokes managed code performed per failure;
+    /// the invoke throw path itself stays allocation-free.
+    /// </summary>
+    /// <param name="exception">Exception object from a failed invoke</param>
+    /// <returns>True if the exception was inspected; fields that could not be
+    /// read are left as empty strings</returns>
+    MDB_API bool mdb_exception_get_info(void* exception,
+                                        char* type_buffer, int type_buffer_size,
+                                        char* message_buffer, int message_buffer_size,
+                                        char* stack_buffer, int stack_buffer_size);
+
+    /// <summary>
+    /// Invoke a method directly through its native function pointer,
+    /// bypassing il2cpp_runtime_invoke. Arguments are passed natively: each
+    /// entry in args must already be the raw pointer-sized value the method
+    /// expects (object reference, widened primitive, or pointer to value-type
+    /// storage). Analyze the signature once via mdb_get_method_info before
+    /// using this path. Virtual methods are transparently routed back through
+    /// mdb_invoke_method; float/double returns are not supported here.
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo</param>
+    /// <param name="instance">Pointer to object instance (ignored for static methods)</param>
+    /// <param name="args">Array of raw argument values (can be nullptr if arg_count is 0)</param>
+    /// <param name="arg_count">Number of entries in args (0-16)</param>
+    /// <returns>Raw return value (undefined for void methods), nullptr on error</returns>
+    MDB_API void* mdb_invoke_method_direct(void* method, void* instance, void** args, int arg_count);
+
+    /// <summary>
+    /// Get the vtable slot of a virtual method. Resolve once per call site,
+    /// then dispatch with mdb_invoke_virtual_direct.
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo</param>
+    /// <returns>Slot index, or -1 for non-virtual methods / no slot</returns>
+    MDB_API int mdb_method_get_vtable_slot(void* method);
+
+    /// <summary>
+    /// Resolve the concrete MethodInfo an instance dispatches to for a
+    /// vtable slot (the override, not the declaration).
+    /// </summary>
+    /// <param name="instance">Object instance</param>
+    /// <param name="slot">Slot from mdb_method_get_vtable_slot</param>
+    /// <returns>Concrete MethodInfo, or nullptr on bad slot</returns>
+    MDB_API void* mdb_object_resolve_virtual(void* instance, int slot);
+
+    /// <summary>
+    /// Invoke a virtual method by indexing the instance's class vtable
+    /// directly — one load plus an indirect call, the same dispatch IL2CPP
+    /// codegen emits — instead of routing through il2cpp_runtime_invoke.
+    /// Arguments follow the mdb_invoke_method_direct native convention;
+    /// float/double returns are likewise not supported.
+    /// </summary>
+    /// <param name="instance">Object instance (never null for virtual calls)</param>
+    /// <param name="slot">Slot from mdb_method_get_vtable_slot</param>
+    /// <param name="args">Array of raw argument values (can be nullptr if arg_count is 0)</param>
+    /// <param name="arg_count">Number of entries in args (0-15)</param>
+    /// <returns>Raw return value (undefined for void methods), nullptr on error</returns>
+    MDB_API void* mdb_invoke_virtual_direct(void* instance, int slot, void** args, int arg_count);
+
+    /// <summary>
+    /// One entry of an mdb_invoke_batch call. results receives the return
+    /// value, exceptions the thrown exception object (or nullptr).
+    /// </summary>
+    struct MdbInvokeCommand {
+        void* method;     // Pointer to MethodInfo
+        void* instance;   // Object instance (nullptr for static)
+        void** args;      // Argument pointer array (runtime-invoke convention)
+        void* result;     // Out: return value pointer
+        void* exception;  // Out: exception object if thrown
+    };
+
+    /// <summary>
+    /// Execute a batch of method invocations in a single P/Invoke
+    /// transition. Each command runs through il2cpp_runtime_invoke exactly
+    /// like mdb_invoke_method; an exception in one command does not stop the
+    /// remaining commands. Amortizes the managed/native transition cost for
+    /// workloads issuing many small calls per frame.
+    /// </summary>
+    /// <param name="commands">Array of commands, results written in place</param>
+    /// <param name="count">Number of commands</param>
+    /// <returns>Number of commands that completed without an exception, or -1 on setup failure</returns>
+    MDB_API int mdb_invoke_batch(MdbInvokeCommand* commands, int count);
+
+    /// <summary>
+    /// Completion callback for mdb_invoke_async. Runs on the worker thread:
+    /// result is the boxed return value, exception the thrown exception
+    /// object (or nullptr), user_data the pointer passed at enqueue time.
+    /// </summary>
+    typedef void (*MdbInvokeCallbackFn)(void* result, void* exception, void* user_data);
+
+    /// <summary>
+    /// Queue an invocation for a dedicated worker thread that attaches to the
+    /// IL2CPP domain once and stays attached. Background mods can stream
+    /// invocations without per-call attach overhead or manual attach
+    /// management. Arguments (up to 16 pointers) are copied at enqueue time,
+    /// but the values they point to must stay valid until the callback runs.
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo</param>
+    /// <param name="instance">Object instance (nullptr for static)</param>
+    /// <param name="args">Argument pointer array (runtime-invoke convention)</param>
+    /// <param name="arg_count">Number of arguments (0-16)</param>
+    /// <param name="callback">Completion callback, or nullptr for fire-and-forget</param>
+    /// <param name="user_data">Opaque pointer handed back to the callback</param>
+    /// <returns>true if the job was queued</returns>
+    MDB_API bool mdb_invoke_async(void* method, void* instance, void** args, int arg_count,
+                                  MdbInvokeCallbackFn callback, void* user_data);
+
+    /// <summary>Number of async invocations still queued.</summary>
+    MDB_API int mdb_invoke_async_pending();
+
+    /// <summary>
+    /// Stop the async worker, dropping any unprocessed jobs. Called during
+    /// bridge shutdown; further mdb_invoke_async calls fail.
+    /// </summary>
+    MDB_API void mdb_invoke_async_shutdown();
+
     /// <summary>
     /// Inflate a generic method definition with concrete type arguments.
     /// Uses IL2CPP reflection APIs: MethodInfo.MakeGenericMethod(Type[]).
@@ -216,7 +393,31 @@ extern "C" {
     /// <param name="field">Pointer to FieldInfo</param>
     /// <param name="value">Pointer to the new value</param>
     MDB_API void mdb_field_set_value(void* instance, void* field, void* value);
-    
+
+    /// <summary>
+    /// Read several instance fields in one call. Values are packed back to
+    /// back in field-array order: value types at their unboxed size,
+    /// reference types as pointer slots. The caller knows the field types
+    /// and therefore the buffer layout.
+    /// </summary>
+    /// <param name="instance">Pointer to object instance</param>
+    /// <param name="fields">Array of FieldInfo pointers</param>
+    /// <param name="count">Number of fields</param>
+    /// <param name="out_packed">Output buffer for the packed values</param>
+    /// <returns>Total bytes written, or -1 on failure</returns>
+    MDB_API int mdb_field_get_values(void* instance, void** fields, int count, void* out_packed);
+
+    /// <summary>
+    /// Write several instance fields in one call from a packed buffer laid
+    /// out as described for mdb_field_get_values.
+    /// </summary>
+    /// <param name="instance">Pointer to object instance</param>
+    /// <param name="fields">Array of FieldInfo pointers</param>
+    /// <param name="count">Number of fields</param>
+    /// <param name="packed">Buffer holding the packed values</param>
+    /// <returns>Total bytes consumed, or -1 on failure</returns>
+    MDB_API int mdb_field_set_values(void* instance, void** fields, int count, void* packed);
+
     /// <summary>
     /// Get the value of a static field.
     /// </summary>
@@ -230,7 +431,56 @@ extern "C" {
     /// <param name="field">Pointer to FieldInfo</param>
     /// <param name="value">Pointer to the new value</param>
     MDB_API void mdb_field_static_set_value(void* field, void* value);
-    
+
+    // ==============================
+    // Object Graph Dump
+    // ==============================
+
+    /// <summary>
+    /// Record header in the mdb_object_dump stream. Each record is this
+    /// header followed by name_len bytes of UTF-8 field/class name and
+    /// value_size bytes of payload, packed back to back.
+    /// </summary>
+    #pragma pack(push, 1)
+    struct MdbDumpRecord {
+        unsigned char kind;        // MDB_DUMP_* record kind
+        unsigned char depth;       // nesting depth, 0 for the root object
+        unsigned short name_len;   // UTF-8 name bytes following this header
+        int type_enum;             // IL2CPP type enum of the field (0 for object records)
+        int value_size;            // payload bytes following the name
+    };
+    #pragma pack(pop)
+
+    // Record kinds. OBJECT_BEGIN carries the namespace-qualified class name
+    // and a { instance, class } pointer pair; FIELD_VALUE carries the raw
+    // unboxed bytes; FIELD_STRING carries the UTF-8 string contents;
+    // FIELD_REFERENCE carries an { object, runtime class } pointer pair.
+    #define MDB_DUMP_OBJECT_BEGIN    1
+    #define MDB_DUMP_OBJECT_END      2
+    #define MDB_DUMP_FIELD_VALUE     3
+    #define MDB_DUMP_FIELD_NULL      4
+    #define MDB_DUMP_FIELD_STRING    5
+    #define MDB_DUMP_FIELD_REFERENCE 6
+
+    // Inline payloads (struct values, string contents) are clamped to this
+    #define MDB_DUMP_MAX_VALUE_BYTES 256
+
+    /// <summary>
+    /// Serialize an object's fields — and, up to `depth` levels, the objects
+    /// they reference — into a flat record stream in one call: primitives and
+    /// small structs inline, string contents inline (capped), references as
+    /// (object, class) pairs. Field layouts are cached per class, reference
+    /// cycles are detected, and all game-memory reads are SEH-guarded, so a
+    /// destroyed object yields a truncated dump rather than a crash.
+    /// </summary>
+    /// <param name="instance">Object to dump</param>
+    /// <param name="depth">How many reference levels to recurse into (0-8)</param>
+    /// <param name="out_buffer">Destination buffer for the record stream</param>
+    /// <param name="buffer_size">Size of out_buffer in bytes</param>
+    /// <returns>Bytes written (stream may be truncated if the buffer filled),
+    /// or -1 on error</returns>
+    MDB_API int mdb_object_dump(void* instance, int depth, void* out_buffer, int buffer_size);
+
     // ==============================
     // Object Creation
     // ==============================
@@ -242,6 +492,38 @@ extern "C" {
     /// <param name="klass">Pointer to Il2CppClass</param>
     /// <returns>Pointer to new object, or nullptr on failure</returns>
     MDB_API void* mdb_object_new(void* klass);
+
+    // ==============================
+    // GC-Safe Object Handles
+    // ==============================
+
+    /// <summary>
+    /// Wrap an object in an IL2CPP GC handle and return a stable 64-bit
+    /// bridge handle. The object stays alive (and, if pinned, in place) until
+    /// mdb_gchandle_free, so mods can cache the handle across frames instead
+    /// of re-resolving raw pointers the GC may move or free.
+    /// </summary>
+    /// <param name="instance">Pointer to the object to protect</param>
+    /// <param name="pinned">True to also pin the object in memory</param>
+    /// <returns>Handle (>0), or -1 on failure</returns>
+    MDB_API int64_t mdb_gchandle_new(void* instance, bool pinned);
+
+    /// <summary>
+    /// Resolve a handle to the current object pointer. One lock-free table
+    /// read plus il2cpp_gchandle_get_target; the returned pointer is only
+    /// guaranteed stable for pinned handles.
+    /// </summary>
+    /// <param name="handle">Handle from mdb_gchandle_new</param>
+    /// <returns>Object pointer, or nullptr if the handle is invalid</returns>
+    MDB_API void* mdb_gchandle_get(int64_t handle);
+
+    /// <summary>
+    /// Release a handle, allowing the GC to collect the object. Stale or
+    /// double-freed handles are rejected via a generation check.
+    /// </summary>
+    /// <param name="handle">Handle from mdb_gchandle_new</param>
+    /// <returns>0 on success, -1 on invalid handle</returns>
+    MDB_API int mdb_gchandle_free(int64_t handle);
     
     /// <summary>
     /// Create a new IL2CPP string from a UTF-8 C string.
@@ -249,6 +531,17 @@ extern "C" {
     /// <param name="str">UTF-8 string</param>
     /// <returns>Pointer to Il2CppString, or nullptr on failure</returns>
     MDB_API void* mdb_string_new(const char* str);
+
+    /// <summary>
+    /// Interned variant of mdb_string_new for repeated literals (method
+    /// names, UI strings, tag names): the first call per content allocates
+    /// an IL2CPP string and roots it with a GC handle, repeats return the
+    /// shared instance from a native cache. Do not mutate or free the
+    /// returned string — it is shared for the process lifetime.
+    /// </summary>
+    /// <param name="str">UTF-8 string</param>
+    /// <returns>Pointer to the shared Il2CppString, or nullptr on failure</returns>
+    MDB_API void* mdb_string_new_interned(const char* str);
     
     /// <summary>
     /// Convert an IL2CPP string to UTF-8.
@@ -258,6 +551,18 @@ extern "C" {
     /// <param name="buffer_size">Size of buffer in bytes</param>
     /// <returns>Number of bytes written (excluding null terminator), or -1 on error</returns>
     MDB_API int mdb_string_to_utf8(void* str, char* buffer, int buffer_size);
+
+    /// <summary>
+    /// Get a zero-copy view of an IL2CPP string's UTF-16 data. The returned
+    /// pointer aims into the managed string — valid only while the string is
+    /// alive and not moved by the GC, so consume it immediately (one
+    /// marshal-free copy or an in-place read) rather than storing it.
+    /// </summary>
+    /// <param name="str">Pointer to Il2CppString</param>
+    /// <param name="out_data">Output: pointer to the UTF-16 character data</param>
+    /// <param name="out_len">Output: length in UTF-16 code units</param>
+    /// <returns>true on success</returns>
+    MDB_API bool mdb_string_get_chars(void* str, wchar_t** out_data, int* out_len);
     
     // ==============================
     // Utilities
@@ -292,7 +597,9 @@ extern "C" {
     MDB_API void* mdb_class_get_type(void* klass);
     
     /// <summary>
-    /// Get a System.Type reflection object from an Il2CppType*.
+    /// Get a System.Type reflection object from an Il2CppType*. The object is
+    /// materialized once per type, rooted behind a GC handle, and served from
+    /// a native cache on repeat calls without entering IL2CPP.
     /// </summary>
     /// <param name="il2cpp_type">Pointer to Il2CppType</param>
     /// <returns>Pointer to Il2CppReflectionType (System.Type), or nullptr on error</returns>
@@ -334,7 +641,37 @@ extern "C" {
     /// <param name="array">Pointer to IL2CPP array</param>
     /// <returns>Pointer to the element's Il2CppClass, or nullptr on error</returns>
     MDB_API void* mdb_array_get_element_class(void* array);
-    
+
+    /// <summary>
+    /// Copy a range of array elements into a caller-pinned buffer in one
+    /// call, replacing per-element mdb_array_get_element round trips.
+    /// Value-type elements are copied at their inline size; reference-type
+    /// elements are copied as pointers. The buffer must hold at least
+    /// count * mdb_array_get_element_size(array) bytes.
+    /// </summary>
+    /// <param name="array">Pointer to IL2CPP array</param>
+    /// <param name="start">First element index to copy</param>
+    /// <param name="count">Number of elements to copy</param>
+    /// <param name="out_buffer">Destination buffer</param>
+    /// <returns>Number of bytes copied, or -1 on error</returns>
+    MDB_API int mdb_array_copy(void* array, int start, int count, void* out_buffer);
+
+    /// <summary>
+    /// Expose an array's contiguous element storage directly for zero-copy
+    /// reads and in-place writes (e.g. a Span&lt;T&gt; over the raw pointer).
+    /// Value-type elements are stored inline at out_elem_size bytes;
+    /// reference-type elements are pointer slots. The pointer is valid only
+    /// while the caller keeps the array alive and the GC does not move it —
+    /// the caller's pinning discipline applies.
+    /// </summary>
+    /// <param name="array">Pointer to IL2CPP array</param>
+    /// <param name="out_data">Receives the element storage pointer</param>
+    /// <param name="out_length">Receives the element count (may be null)</param>
+    /// <param name="out_elem_size">Receives the element stride in bytes (may be null)</param>
+    /// <returns>true on success</returns>
+    MDB_API bool mdb_array_get_data(void* array, void** out_data, int* out_length, int* out_elem_size);
+
+
     /// <summary>
     /// Check if a class is a value type (struct).
     /// </summary>
@@ -360,7 +697,43 @@ extern "C" {
     /// </summary>
     /// <returns>MdbErrorCode value</returns>
     MDB_API int mdb_get_last_error_code();
-    
+
+    // ==============================
+    // Export Call Instrumentation
+    // ==============================
+
+    /// <summary>
+    /// One row of the export statistics table. name is a static string and
+    /// stays valid for the process lifetime.
+    /// </summary>
+    struct MdbExportStat {
+        const char* name;     // Export name
+        unsigned long long calls;   // Calls since enable/reset
+        unsigned long long cycles;  // Accumulated rdtsc cycles inside the export
+    };
+
+    /// <summary>
+    /// Enable or disable per-export call counting and cycle-timer latency.
+    /// Off by default; when off, instrumented exports pay one relaxed atomic
+    /// load per call.
+    /// </summary>
+    MDB_API void mdb_export_stats_set_enabled(bool enabled);
+
+    /// <summary>Check whether export instrumentation is enabled.</summary>
+    MDB_API bool mdb_export_stats_is_enabled();
+
+    /// <summary>Zero all call counts and cycle accumulators.</summary>
+    MDB_API void mdb_export_stats_reset();
+
+    /// <summary>
+    /// Copy the current statistics into the caller's buffer. Only exports
+    /// that have run at least once (since load) appear in the table.
+    /// </summary>
+    /// <param name="out_stats">Output array</param>
+    /// <param name="cap">Capacity of the output array</param>
+    /// <returns>Number of rows written</returns>
+    MDB_API int mdb_get_export_stats(MdbExportStat* out_stats, int cap);
+
     // ==============================
     // GameObject Component Helpers
     // ==============================
@@ -372,7 +745,20 @@ extern "C" {
     /// <param name="gameObject">Pointer to GameObject IL2CPP object</param>
     /// <returns>Pointer to Component[] array, or nullptr on failure</returns>
     MDB_API void* mdb_gameobject_get_components(void* gameObject);
-    
+
+    /// <summary>
+    /// Get the components of a GameObject matching a class, filtered on the
+    /// native side (subclass-aware via il2cpp_class_is_assignable_from)
+    /// instead of returning everything for managed per-entry filtering.
+    /// </summary>
+    /// <param name="gameObject">Pointer to GameObject IL2CPP object</param>
+    /// <param name="klass">Il2CppClass to match (base classes match subclasses)</param>
+    /// <param name="out">Caller buffer receiving matching component pointers</param>
+    /// <param name="cap">Capacity of out</param>
+    /// <returns>Number of matches written, or -1 on error</returns>
+    MDB_API int mdb_gameobject_get_components_of_class(void* gameObject, void* klass, void** out, int cap);
+
+
     /// <summary>
     /// Get the number of components on a GameObject (from the returned array).
     /// </summary>
@@ -467,6 +853,213 @@ extern "C" {
     /// </summary>
     MDB_API bool mdb_transform_set_local_scale(void* transform, float x, float y, float z);
 
+    /// <summary>
+    /// Read local position, euler angles, and scale in a single call.
+    /// out_trs receives 9 floats: position xyz, euler xyz, scale xyz.
+    /// Components that fail to read are zero-filled.
+    /// </summary>
+    MDB_API bool mdb_transform_get_trs(void* transform, float* out_trs);
+
+    /// <summary>
+    /// Batch variant of mdb_transform_get_trs: fills 9 floats per transform
+    /// into a flat buffer (count * 9 floats). Null or failed entries are
+    /// zero-filled. Returns the number of transforms read fully, or -1 on
+    /// setup failure.
+    /// </summary>
+    MDB_API int mdb_transform_get_trs_batch(void** transforms, int count, float* out_buffer);
+
+    /// <summary>
+    /// One node of an mdb_scene_snapshot record buffer.
+    /// </summary>
+    struct MdbSceneNode {
+        void* gameObject;     // GameObject pointer
+        void* transform;      // Transform pointer
+        int parent;           // Index of parent node, -1 for roots
+        int name_offset;      // Offset of UTF-8 name in name_buffer, -1 if unavailable
+        int active;           // activeSelf (0/1, -1 if unavailable)
+        int component_count;  // Attached component count, -1 if unavailable
+    };
+
+    /// <summary>
+    /// Traverse the hierarchies under the given root transforms natively
+    /// (iterative, breadth-first — parents always precede children) and emit
+    /// a flat record buffer plus a packed UTF-8 name buffer, replacing
+    /// thousands of per-node P/Invoke round trips with one call.
+    /// Traversal stops when either buffer is full.
+    /// </summary>
+    /// <param name="root_transforms">Root Transform pointers to start from</param>
+    /// <param name="root_count">Number of roots</param>
+    /// <param name="out_nodes">Record buffer</param>
+    /// <param name="node_cap">Capacity of out_nodes in records</param>
+    /// <param name="name_buffer">Buffer for NUL-terminated UTF-8 names</param>
+    /// <param name="name_buffer_cap">Capacity of name_buffer in bytes</param>
+    /// <returns>Number of records written, or -1 on setup failure</returns>
+    MDB_API int mdb_scene_snapshot(void** root_transforms, int root_count,
+                                   MdbSceneNode* out_nodes, int node_cap,
+                                   char* name_buffer, int name_buffer_cap);
+
+    /// <summary>Change bits of an MdbSceneDiffRecord (combinable).</summary>
+    enum MdbSceneDiffChange {
+        MDB_SCENE_DIFF_ADDED   = 1,
+        MDB_SCENE_DIFF_REMOVED = 2,
+        MDB_SCENE_DIFF_MOVED   = 4,  // parent or sibling order changed
+        MDB_SCENE_DIFF_RENAMED = 8
+    };
+
+    /// <summary>
+    /// One change record of an mdb_scene_snapshot_diff buffer.
+    /// </summary>
+    struct MdbSceneDiffRecord {
+        void* transform;        // Node identity (stale for removed nodes)
+        void* gameObject;       // GameObject pointer, null for removed nodes
+        void* parent_transform; // Current parent, null for roots and removed nodes
+        int sibling_index;      // Index among the parent's children, -1 for removed
+        int changes;            // MdbSceneDiffChange bits
+        int name_offset;        // UTF-8 name for added/renamed nodes, else -1
+    };
+
+    /// <summary>
+    /// Traverse the hierarchies under the given roots and emit only nodes
+    /// that were added, removed, moved, or renamed since the previous call,
+    /// diffed against a natively retained snapshot — in steady state a
+    /// refresh marshals a handful of records instead of the whole scene.
+    /// The first call (or the first after a reset) reports every node as
+    /// added.
+    /// </summary>
+    /// <param name="root_transforms">Root Transform pointers to start from</param>
+    /// <param name="root_count">Number of roots</param>
+    /// <param name="out_changes">Change record buffer</param>
+    /// <param name="change_cap">Capacity of out_changes in records</param>
+    /// <param name="name_buffer">Buffer for NUL-terminated UTF-8 names (may be null)</param>
+    /// <param name="name_buffer_cap">Capacity of name_buffer in bytes</param>
+    /// <returns>Total number of changes detected, or -1 on setup failure.
+    /// A value greater than change_cap means the buffer was too small —
+    /// fall back to a full mdb_scene_snapshot (the retained state is still
+    /// updated, so the next diff is consistent)</returns>
+    MDB_API int mdb_scene_snapshot_diff(void** root_transforms, int root_count,
+                                        MdbSceneDiffRecord* out_changes, int change_cap,
+                                        char* name_buffer, int name_buffer_cap);
+
+    /// <summary>
+    /// Drop the retained diff snapshot and the name index; the next
+    /// mdb_scene_snapshot_diff reports everything as added. Call after a
+    /// scene load.
+    /// </summary>
+    MDB_API void mdb_scene_snapshot_diff_reset();
+
+    /// <summary>
+    /// Resolve GameObjects by name through the native name index built by
+    /// mdb_scene_snapshot and kept current by mdb_scene_snapshot_diff.
+    /// Only the query string is marshaled; non-matching objects are never
+    /// touched. Returns objects known to the index at the last traversal —
+    /// run a snapshot or diff first.
+    /// </summary>
+    /// <param name="name">The UTF-8 GameObject name to look up</param>
+    /// <param name="out_objects">Output: matching GameObject pointers</param>
+    /// <param name="object_cap">Capacity of out_objects</param>
+    /// <returns>Number of objects written, or -1 on error</returns>
+    MDB_API int mdb_find_gameobject_by_name(const char* name, void** out_objects, int object_cap);
+
+    /// <summary>
+    /// Scan every loaded scene for live instances of a class, entirely in
+    /// native code. If klass is a GameObject type, matching GameObjects are
+    /// returned; otherwise each object's components are matched against it
+    /// (subclass-aware). Writes up to instance_cap object pointers.
+    /// </summary>
+    /// <param name="klass">The class to match instances against</param>
+    /// <param name="out_instances">Output: matching object pointers</param>
+    /// <param name="instance_cap">Capacity of out_instances</param>
+    /// <returns>Number of instances written, or -1 on error</returns>
+    MDB_API int mdb_find_instances(void* klass, void** out_instances, int instance_cap);
+
+    // ==============================
+    // Per-Frame Command Buffer
+    // ==============================
+
+    /// <summary>Operation kind of an MdbCommand.</summary>
+    enum MdbCommandType {
+        MDB_CMD_SET_LOCAL_POSITION = 1,      // target = Transform, xyz used
+        MDB_CMD_SET_LOCAL_EULER_ANGLES = 2,  // target = Transform, xyz used
+        MDB_CMD_SET_LOCAL_SCALE = 3,         // target = Transform, xyz used
+        MDB_CMD_SET_FIELD_VALUE = 4,         // target = instance, field + inline payload used
+        MDB_CMD_SET_FIELD_REFERENCE = 5      // target = instance, payload holds the object pointer
+    };
+
+    /// <summary>
+    /// One queued mutation. Commands are applied in append order at the next
+    /// flush point (the Present hook, or an explicit mdb_command_buffer_flush).
+    /// </summary>
+    struct MdbCommand {
+        int type;                   // MdbCommandType
+        int payload_size;           // Bytes used in payload for field value writes
+        void* target;               // Transform or object instance
+        void* field;                // FieldInfo for field commands, else null
+        float x, y, z;              // Vector payload for transform commands
+        unsigned char payload[16];  // Inline value payload for field commands
+    };
+
+    /// <summary>
+    /// Append commands to the shared native buffer. Thread-safe; commands are
+    /// not applied until the next flush, so appends cost no thread attach and
+    /// no IL2CPP transition.
+    /// </summary>
+    /// <param name="commands">Array of commands to queue</param>
+    /// <param name="count">Number of commands</param>
+    /// <returns>Number of commands accepted (less than count if the buffer is full)</returns>
+    MDB_API int mdb_command_buffer_append(const MdbCommand* commands, int count);
+
+    /// <summary>Number of commands currently queued.</summary>
+    MDB_API int mdb_command_buffer_pending();
+
+    /// <summary>
+    /// Apply all queued commands in one batch on the calling thread. Invoked
+    /// once per frame from the Present hook for deterministic apply timing;
+    /// also exported so mods without the overlay can drive flushing themselves.
+    /// </summary>
+    /// <returns>Number of commands applied successfully, or -1 if the thread
+    /// could not be attached (the queue is left intact)</returns>
+    MDB_API int mdb_command_buffer_flush();
+
+    // ==============================
+    // Frame-Budgeted Task Scheduler
+    // ==============================
+
+    /// <summary>
+    /// A frame task callback. Return 0 when the work is complete, or nonzero
+    /// to stay queued and be resumed on a later frame (for incremental work
+    /// like chunked scene scans).
+    /// </summary>
+    typedef int (*MdbFrameTaskFn)(void* user_data);
+
+    /// <summary>
+    /// Queue a work item for the frame-budgeted scheduler. Items run on the
+    /// render thread from the Present hook, which drains the queue for at
+    /// most the configured budget per frame; leftover items carry over.
+    /// Thread-safe.
+    /// </summary>
+    /// <param name="task">Task callback</param>
+    /// <param name="user_data">Opaque pointer passed to the callback</param>
+    /// <returns>0 on success, error code if the queue is full or task is null</returns>
+    MDB_API int mdb_frame_task_queue(MdbFrameTaskFn task, void* user_data);
+
+    /// <summary>
+    /// Set the per-frame drain budget in microseconds (clamped to 50-10000,
+    /// default 500). The budget is checked between tasks, so a single long
+    /// task can still overrun it — split heavy work into resumable chunks.
+    /// </summary>
+    MDB_API void mdb_frame_tasks_set_budget(int microseconds);
+
+    /// <summary>Number of tasks currently queued.</summary>
+    MDB_API int mdb_frame_tasks_pending();
+
+    /// <summary>
+    /// Run queued tasks until the budget expires. Called once per frame from
+    /// the Present hook; also exported so mods without the overlay can drive
+    /// draining themselves.
+    /// </summary>
+    /// <returns>Number of tasks that ran to completion this drain</returns>
+    MDB_API int mdb_frame_tasks_drain();
+
     // ==============================
     // SceneManager Helpers
     // ==============================
@@ -507,6 +1100,31 @@ extern "C" {
     /// <returns>Scene handle for DDOL scene, or -1 if not found</returns>
     MDB_API int mdb_get_dontdestroyonload_scene_handle();
 
+    /// <summary>
+    /// One scene record of an mdb_scenemanager_snapshot buffer.
+    /// </summary>
+    struct MdbSceneInfo {
+        int handle;       // Scene handle, -1 if unavailable
+        int root_count;   // Root GameObject count, -1 if unavailable
+        int name_offset;  // Offset of UTF-8 name in name_buffer, -1 if unavailable
+    };
+
+    /// <summary>
+    /// Enumerate every loaded scene in one call: handle, root count, and a
+    /// packed UTF-8 name per scene, plus the DontDestroyOnLoad handle —
+    /// replacing one P/Invoke per datum per scene with a single transition
+    /// and one GetSceneAt invoke per scene reused for all three values.
+    /// </summary>
+    /// <param name="out_scenes">Record buffer</param>
+    /// <param name="scene_cap">Capacity of out_scenes in records</param>
+    /// <param name="name_buffer">Buffer for NUL-terminated UTF-8 names (may be null)</param>
+    /// <param name="name_buffer_cap">Capacity of name_buffer in bytes</param>
+    /// <param name="out_ddol_handle">Receives the DontDestroyOnLoad handle, -1 if not found (may be null)</param>
+    /// <returns>Number of scene records written, or -1 on setup failure</returns>
+    MDB_API int mdb_scenemanager_snapshot(MdbSceneInfo* out_scenes, int scene_cap,
+                                          char* name_buffer, int name_buffer_cap,
+                                          int* out_ddol_handle);
+
     // ==============================
     // OnGUI Hooking
     // ==============================
@@ -519,11 +1137,20 @@ extern "C" {
     /// <summary>
     /// Register a callback to be called during Unity's OnGUI phase.
     /// This hooks into Unity's GUI system and dispatches to the managed callback.
+    /// Multiple callbacks may be registered (up to 32); they run in
+    /// registration order. Registering the same callback twice is a no-op.
     /// </summary>
     /// <param name="callback">The callback function to call during OnGUI</param>
     /// <returns>0 on success, non-zero on failure</returns>
     MDB_API int mdb_register_ongui_callback(OnGUICallbackFn callback);
-    
+
+    /// <summary>
+    /// Remove a previously registered OnGUI callback.
+    /// </summary>
+    /// <param name="callback">The callback to remove</param>
+    /// <returns>0 on success, non-zero if the callback was not registered</returns>
+    MDB_API int mdb_unregister_ongui_callback(OnGUICallbackFn callback);
+
     /// <summary>
     /// Manually trigger OnGUI dispatch (for testing or manual hooking).
     /// Call this from a hooked Unity method during the GUI phase.
@@ -583,6 +1210,29 @@ extern "C" {
     /// <param name="out_original">Output: pointer to trampoline for calling original</param>
     /// <returns>Hook handle (>0 on success), or negative error code</returns>
     MDB_API int64_t mdb_create_hook_ptr(void* target, void* detour, void** out_original);
+
+    /// <summary>
+    /// One entry of an mdb_create_hooks_batch call. Specify either an
+    /// absolute target pointer or an RVA into GameAssembly.
+    /// </summary>
+    struct MdbHookRequest {
+        uint64_t rva;   // Target RVA (used when target is null)
+        void* target;   // Absolute target pointer (takes precedence; filled in from rva)
+        void* detour;   // Detour function pointer
+        void* original; // Output: trampoline for calling the original
+        int64_t handle; // Output: hook handle (>0), or negative error code
+    };
+
+    /// <summary>
+    /// Create and enable many hooks with a single queued-enable commit, so
+    /// installing N patches costs one thread-suspension cycle instead of N.
+    /// Per-entry failures are reported in each request's handle field and do
+    /// not abort the batch.
+    /// </summary>
+    /// <param name="requests">Array of hook requests, updated in place</param>
+    /// <param name="count">Number of requests</param>
+    /// <returns>Number of hooks installed, or negative error code</returns>
+    MDB_API int mdb_create_hooks_batch(MdbHookRequest* requests, int count);
     
     /// <summary>
     /// Remove a hook by its handle.
@@ -598,7 +1248,134 @@ extern "C" {
     /// <param name="enabled">true to enable, false to disable</param>
     /// <returns>0 on success, non-zero on failure</returns>
     MDB_API int mdb_set_hook_enabled(int64_t hook_handle, bool enabled);
-    
+
+    /// <summary>
+    /// Per-hook overhead statistics, filled by mdb_get_hook_stats. Cycle
+    /// figures come from TSC deltas sampled around every 16th detour call,
+    /// so avg/min/max describe the sampled population, not every hit.
+    /// </summary>
+    struct MdbHookStats {
+        unsigned long long hit_count;     // Total detour invocations
+        unsigned long long sampled_count; // Invocations with a TSC sample
+        double avg_cycles;                // Mean cycles per sampled invocation
+        unsigned long long min_cycles;    // Fastest sampled invocation
+        unsigned long long max_cycles;    // Slowest sampled invocation
+        int instrumented;                 // 1 if the hook was created instrumented
+    };
+
+    /// <summary>
+    /// Create a hook on an IL2CPP method with per-hit instrumentation: the
+    /// bridge interposes a counting stub that tracks hit count and samples
+    /// a TSC delta around the callback on every 16th call, readable via
+    /// mdb_get_hook_stats. The sampled interval covers the whole detour
+    /// body, including any call into the original. The stub forwards the
+    /// first 12 integer/pointer arguments and an integer/pointer return;
+    /// hooks on methods taking or returning float/double must use the
+    /// uninstrumented mdb_create_hook instead.
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo to hook</param>
+    /// <param name="callback">The callback function to invoke instead</param>
+    /// <param name="out_original">Output: pointer to trampoline for calling original</param>
+    /// <returns>Hook handle (>0 on success), or negative error code</returns>
+    MDB_API int64_t mdb_create_hook_instrumented(void* method, HookCallbackFn callback, void** out_original);
+
+    /// <summary>
+    /// Create an instrumented hook by direct function pointer. Same stub
+    /// interposition and argument-forwarding limits as
+    /// mdb_create_hook_instrumented.
+    /// </summary>
+    /// <param name="target">The target function pointer to hook</param>
+    /// <param name="detour">The detour function pointer</param>
+    /// <param name="out_original">Output: pointer to trampoline for calling original</param>
+    /// <returns>Hook handle (>0 on success), or negative error code</returns>
+    MDB_API int64_t mdb_create_hook_ptr_instrumented(void* target, void* detour, void** out_original);
+
+    /// <summary>
+    /// Read the accumulated statistics for a hook. Succeeds for any valid
+    /// handle; for hooks created without instrumentation only hit data is
+    /// meaningful and instrumented is 0.
+    /// </summary>
+    /// <param name="hook_handle">The hook handle returned by mdb_create_hook*</param>
+    /// <param name="out_stats">Output: statistics structure to fill</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_get_hook_stats(int64_t hook_handle, MdbHookStats* out_stats);
+
+    /// <summary>
+    /// Reset a hook's counters and cycle samples to zero, e.g. to measure
+    /// a single gameplay section in isolation.
+    /// </summary>
+    /// <param name="hook_handle">The hook handle</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_reset_hook_stats(int64_t hook_handle);
+
+// Compare ops for mdb_hook_add_filter. Comparisons are unsigned after both
+// sides are truncated to the filter's width.
+#define MDB_HOOK_FILTER_EQ   0  // argument == value
+#define MDB_HOOK_FILTER_NE   1  // argument != value
+#define MDB_HOOK_FILTER_LT   2  // argument <  value
+#define MDB_HOOK_FILTER_LE   3  // argument <= value
+#define MDB_HOOK_FILTER_GT   4  // argument >  value
+#define MDB_HOOK_FILTER_GE   5  // argument >= value
+#define MDB_HOOK_FILTER_MASK 6  // (argument & value) != 0
+
+    /// <summary>
+    /// Create a hook on an IL2CPP method routed through a bridge stub so
+    /// native argument filters installed via mdb_hook_add_filter can gate
+    /// the callback. Without filters the stub adds only hit counting; no
+    /// TSC sampling is performed. Same argument-forwarding limits as
+    /// mdb_create_hook_instrumented (12 integer/pointer arguments, no
+    /// float/double anywhere in the signature).
+    /// </summary>
+    /// <param name="method">Pointer to MethodInfo to hook</param>
+    /// <param name="callback">The callback function to invoke instead</param>
+    /// <param name="out_original">Output: pointer to trampoline for calling original</param>
+    /// <returns>Hook handle (>0 on success), or negative error code</returns>
+    MDB_API int64_t mdb_create_hook_filtered(void* method, HookCallbackFn callback, void** out_original);
+
+    /// <summary>
+    /// Create a filterable hook by direct function pointer. Same stub
+    /// interposition and limits as mdb_create_hook_filtered.
+    /// </summary>
+    /// <param name="target">The target function pointer to hook</param>
+    /// <param name="detour">The detour function pointer</param>
+    /// <param name="out_original">Output: pointer to trampoline for calling original</param>
+    /// <returns>Hook handle (>0 on success), or negative error code</returns>
+    MDB_API int64_t mdb_create_hook_ptr_filtered(void* target, void* detour, void** out_original);
+
+    /// <summary>
+    /// Install a native argument filter on a filtered or instrumented hook.
+    /// The descriptor compares one forwarded integer argument (index 0 is
+    /// the first argument, i.e. the instance pointer for instance methods)
+    /// against a constant, both truncated to the given width. All installed
+    /// filters must pass for the callback to run; a rejected hit calls the
+    /// original directly, skipping the native-to-managed transition
+    /// entirely. Up to 4 filters per hook.
+    /// </summary>
+    /// <param name="hook_handle">The hook handle returned by mdb_create_hook_filtered or *_instrumented</param>
+    /// <param name="arg_index">Forwarded argument position, 0-11</param>
+    /// <param name="width">Bytes compared: 1, 2, 4 or 8</param>
+    /// <param name="compare_op">One of the MDB_HOOK_FILTER_* ops</param>
+    /// <param name="value">The comparison constant</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_hook_add_filter(int64_t hook_handle, int arg_index, int width, int compare_op, uint64_t value);
+
+    /// <summary>
+    /// Remove all filters from a hook, so every hit reaches the callback
+    /// again.
+    /// </summary>
+    /// <param name="hook_handle">The hook handle</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_hook_clear_filters(int64_t hook_handle);
+
+    /// <summary>
+    /// Read the number of hits rejected by filters since the hook was
+    /// created. Useful to verify a filter is actually matching.
+    /// </summary>
+    /// <param name="hook_handle">The hook handle</param>
+    /// <param name="out_count">Output: rejected hit count</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_hook_get_filtered_hits(int64_t hook_handle, unsigned long long* out_count);
+
     /// <summary>
     /// Get information about an IL2CPP method.
     /// </summary>
@@ -638,9 +1415,101 @@ extern "C" {
     /// <summary>Get a class from an image by index.</summary>
     MDB_API void* mdb_image_get_class(void* image, int index);
 
+    /// <summary>
+    /// Per-assembly record filled by mdb_get_assembly_snapshot. Pointers are
+    /// raw metadata pointers, stable for the process lifetime.
+    /// </summary>
+    struct MdbAssemblyInfo {
+        void* assembly;          // il2cppAssembly*
+        void* image;             // il2cppImage* (null if unavailable)
+        const char* image_name;  // e.g. "Assembly-CSharp.dll" (metadata pointer)
+        int class_count;         // number of classes in the image
+    };
+
+    /// <summary>
+    /// Capture every loaded assembly with its image, image name and class
+    /// count into one flat buffer — a single transition instead of O(n)
+    /// count/index/get-image/get-name calls per refresh.
+    /// Pass null/0 to query the required element count.
+    /// </summary>
+    /// <param name="out_infos">Caller-allocated array of MdbAssemblyInfo</param>
+    /// <param name="cap">Capacity of out_infos in elements</param>
+    /// <returns>Number of records written (total count when querying).</returns>
+    MDB_API int mdb_get_assembly_snapshot(MdbAssemblyInfo* out_infos, int cap);
+
     /// <summary>Get class flags (access, sealed, abstract, interface, etc.).</summary>
     MDB_API int mdb_class_get_flags(void* klass);
 
+    /// <summary>
+    /// Per-class record filled by mdb_class_get_info_batch. Name and namespace
+    /// are raw metadata pointers, stable for the process lifetime.
+    /// </summary>
+    struct MdbClassInfo {
+        const char* name;        // Class name (interned metadata pointer)
+        const char* name_space;  // Namespace (interned metadata pointer)
+        int flags;               // TypeAttributes flags
+        int is_valuetype;        // 1 if value type, 0 otherwise
+        void* parent;            // Parent class, null for System.Object/interfaces
+    };
+
+    /// <summary>
+    /// Fetch name, namespace, flags, valuetype bit and parent for an array of
+    /// classes in one call. Collapses the five-P/Invokes-per-class pattern the
+    /// assembly browser hits when enumerating images. Null entries in the input
+    /// produce zeroed records and are not counted.
+    /// </summary>
+    /// <param name="classes">Array of class pointers</param>
+    /// <param name="count">Number of entries</param>
+    /// <param name="out_infos">Output array of count records</param>
+    /// <returns>Number of non-null classes described</returns>
+    MDB_API int mdb_class_get_info_batch(void** classes, int count, MdbClassInfo* out_infos);
+
+    /// <summary>
+    /// Per-field record filled by mdb_class_enum_fields. The name is a raw
+    /// metadata pointer, stable for the process lifetime.
+    /// </summary>
+    struct MdbFieldRecord {
+        void* field;        // FieldInfo pointer
+        const char* name;   // Field name (interned metadata pointer)
+        void* type;         // Il2CppType pointer
+        int offset;         // Instance offset in the object (-1 for thread statics)
+        int flags;          // FieldAttributes flags (0 when the flags API is missing)
+        int is_static;      // 1 if static, 0 otherwise
+    };
+
+    /// <summary>
+    /// Per-method record filled by mdb_class_enum_methods.
+    /// </summary>
+    struct MdbMethodRecord {
+        void* method;             // MethodInfo pointer
+        const char* name;         // Method name (interned metadata pointer)
+        void* return_type;        // Il2CppType pointer of the return type
+        unsigned long long rva;   // Body RVA relative to GameAssembly base (0 if none)
+        int param_count;          // Number of parameters
+        int flags;                // MethodAttributes flags
+    };
+
+    /// <summary>
+    /// Enumerate every field of a class into one flat buffer — a single
+    /// transition instead of the per-member get-by-index/name/offset/type
+    /// calls the inspector issues today. Pass null/0 to query the count.
+    /// </summary>
+    /// <param name="klass">Class to enumerate</param>
+    /// <param name="out_records">Caller-allocated array of MdbFieldRecord</param>
+    /// <param name="cap">Capacity of out_records in elements</param>
+    /// <returns>Number of records written (total count when querying).</returns>
+    MDB_API int mdb_class_enum_fields(void* klass, MdbFieldRecord* out_records, int cap);
+
+    /// <summary>
+    /// Enumerate every method of a class into one flat buffer. Same contract
+    /// as mdb_class_enum_fields: pass null/0 to query the count.
+    /// </summary>
+    /// <param name="klass">Class to enumerate</param>
+    /// <param name="out_records">Caller-allocated array of MdbMethodRecord</param>
+    /// <param name="cap">Capacity of out_records in elements</param>
+    /// <returns>Number of records written (total count when querying).</returns>
+    MDB_API int mdb_class_enum_methods(void* klass, MdbMethodRecord* out_records, int cap);
+
     /// <summary>Get the field offset (instance offset in object).</summary>
     MDB_API int mdb_field_get_offset(void* field);
 
@@ -653,6 +1522,216 @@ extern "C" {
     /// <returns>Number of bytes actually read, or 0 on error</returns>
     MDB_API int mdb_read_memory(void* address, void* buffer, int size);
 
+    /// <summary>
+    /// One read request of an mdb_read_memory_batch call.
+    /// </summary>
+    struct MdbReadDescriptor {
+        void* address;    // Source address to read from
+        int size;         // Number of bytes to read (max 4096)
+        int dest_offset;  // Destination offset in the shared output buffer
+    };
+
+    /// <summary>
+    /// Vectored mdb_read_memory: perform many small reads in one call, each
+    /// landing at its descriptor's offset in the shared buffer. Unreadable
+    /// addresses zero-fill their slot rather than failing the batch. Intended
+    /// for pointer-chain dereferencing and vtable scans.
+    /// </summary>
+    /// <param name="descriptors">Array of read descriptors</param>
+    /// <param name="count">Number of descriptors</param>
+    /// <param name="buffer">Shared output buffer</param>
+    /// <param name="buffer_size">Size of the output buffer in bytes</param>
+    /// <returns>Number of descriptors read successfully</returns>
+    MDB_API int mdb_read_memory_batch(MdbReadDescriptor* descriptors, int count, void* buffer, int buffer_size);
+
+    /// <summary>
+    /// One write request of an mdb_write_memory_batch call.
+    /// </summary>
+    struct MdbWriteDescriptor {
+        void* address;    // Destination address to write to
+        int size;         // Number of bytes to write (max 4096)
+        int data_offset;  // Source offset in the shared data buffer
+    };
+
+    /// <summary>
+    /// Vectored write counterpart of mdb_read_memory_batch, intended for
+    /// byte-patch mods. Each affected page is made writable once for the
+    /// whole batch (one VirtualProtect pair per page, not per write) and
+    /// restored afterward; the instruction cache is flushed once at the
+    /// end. Unwritable addresses skip their descriptor rather than failing
+    /// the batch.
+    /// </summary>
+    /// <param name="descriptors">Array of write descriptors</param>
+    /// <param name="count">Number of descriptors</param>
+    /// <param name="data">Shared source data buffer</param>
+    /// <param name="data_size">Size of the data buffer in bytes</param>
+    /// <returns>Number of descriptors written successfully</returns>
+    MDB_API int mdb_write_memory_batch(MdbWriteDescriptor* descriptors, int count, const void* data, int data_size);
+
+    // ==============================
+    // Binary Metadata Cache
+    // ==============================
+
+    /// <summary>
+    /// Per-class record from the memory-mapped metadata cache. String pointers
+    /// point into the mapping and stay valid until mdb_metadata_cache_close.
+    /// </summary>
+    struct MdbCachedClassInfo {
+        const char* name;         // Class name
+        const char* name_space;   // Namespace ("" for global)
+        const char* image;        // Owning image name (e.g. "Assembly-CSharp.dll")
+        unsigned int flags;       // TypeAttributes flags
+        unsigned int method_count;
+        unsigned int field_count;
+        unsigned int instance_size;
+        int is_valuetype;         // 1 if value type, 0 otherwise
+    };
+
+    /// <summary>
+    /// Memory-map the binary metadata cache written by the dumper
+    /// (metadata.mdbc in the Generated directory). Rejects caches whose
+    /// recorded GameAssembly.dll size/timestamp no longer match, so stale
+    /// data is never served. Gives O(1) mapped access to class/method/field
+    /// descriptors without touching IL2CPP enumeration APIs.
+    /// </summary>
+    /// <param name="path">Full path to the cache file</param>
+    /// <returns>True if the cache was mapped and validated</returns>
+    MDB_API bool mdb_metadata_cache_open(const char* path);
+
+    /// <summary>Check if a validated metadata cache is currently mapped.</summary>
+    MDB_API bool mdb_metadata_cache_is_open();
+
+    /// <summary>Unmap the metadata cache. Invalidates all returned string pointers.</summary>
+    MDB_API void mdb_metadata_cache_close();
+
+    /// <summary>Get the number of classes in the open cache (0 when closed).</summary>
+    MDB_API int mdb_metadata_cache_get_class_count();
+
+    /// <summary>
+    /// Find a class in the open cache by namespace and name (binary search).
+    /// </summary>
+    /// <returns>Class index, or -1 if not found / cache closed</returns>
+    MDB_API int mdb_metadata_cache_find_class(const char* name_space, const char* name);
+
+    /// <summary>Fill a record for the cached class at the given index.</summary>
+    /// <returns>True on success, false on bad index or closed cache</returns>
+    MDB_API bool mdb_metadata_cache_get_class(int index, MdbCachedClassInfo* out_info);
+
+    /// <summary>
+    /// Get one method descriptor of a cached class by per-class ordinal.
+    /// The RVA is relative to the GameAssembly.dll base (0 if none).
+    /// </summary>
+    MDB_API bool mdb_metadata_cache_get_method(int class_index, int method_ordinal,
+                                               const char** out_name, unsigned int* out_param_count,
+                                               unsigned int* out_flags, unsigned long long* out_rva);
+
+    /// <summary>Get one field descriptor of a cached class by per-class ordinal.</summary>
+    MDB_API bool mdb_metadata_cache_get_field(int class_index, int field_ordinal,
+                                              const char** out_name, unsigned int* out_offset,
+                                              unsigned int* out_flags);
+
+    /// <summary>
+    /// Symbolize an address against the open metadata cache: binary-search a
+    /// sorted RVA index for the method whose entry point is nearest at or
+    /// below the given value. Accepts either an RVA or a raw pointer inside
+    /// GameAssembly.dll (values at or past the module base are rebased
+    /// automatically). String pointers point into the mapping and stay valid
+    /// until mdb_metadata_cache_close. The matched method's own entry RVA is
+    /// returned so callers can report an instruction offset.
+    /// </summary>
+    /// <param name="rva">RVA or absolute address to symbolize</param>
+    /// <returns>True if a method at or below the address was found</returns>
+    MDB_API bool mdb_resolve_rva_to_method(unsigned long long rva,
+                                           const char** out_namespace, const char** out_class_name,
+                                           const char** out_method_name, unsigned long long* out_method_rva);
+
+    // ==============================
+    // Dump Snapshot Capture & Replay
+    // ==============================
+
+    /// <summary>
+    /// Phase timings and counts from a snapshot replay of the dump pipeline.
+    /// Mirrors the dumper's internal per-phase breakdown (milliseconds, QPC).
+    /// </summary>
+    struct MdbDumpReplayStats {
+        double ms_image_hashing;
+        double ms_obfuscation_analysis;
+        double ms_collection;
+        double ms_registry;
+        double ms_generation;
+        double ms_file_io;
+        double ms_metadata_cache;
+        double ms_total;
+        unsigned long long total_assemblies;
+        unsigned long long total_classes;
+        unsigned long long total_wrappers;
+    };
+
+    /// <summary>
+    /// Serialize the dumper's raw traversal input (assemblies, class records,
+    /// the full type graph) from the live IL2CPP runtime to a .mdbs snapshot
+    /// file. The snapshot can later drive the full dump pipeline offline via
+    /// mdb_dump_replay_snapshot, with no game process required.
+    /// </summary>
+    /// <param name="path">Destination snapshot file path</param>
+    /// <returns>True if the snapshot was written</returns>
+    MDB_API bool mdb_dump_capture_snapshot(const char* path);
+
+    /// <summary>
+    /// Run the full name-resolution and wrapper-generation pipeline against a
+    /// captured snapshot instead of live metadata, writing wrappers to the
+    /// given output directory. Replaces the resolver's IL2CPP accessors with
+    /// snapshot-backed ones for the duration of the run — do not call while a
+    /// live dump is in progress. Each call reloads the snapshot so repeated
+    /// runs stay cold for benchmarking.
+    /// </summary>
+    /// <param name="snapshot_path">Path to a .mdbs snapshot file</param>
+    /// <param name="output_directory">Directory for generated wrappers</param>
+    /// <param name="out_stats">Receives phase timings (may be null)</param>
+    /// <returns>True if the replayed dump succeeded</returns>
+    MDB_API bool mdb_dump_replay_snapshot(const char* snapshot_path,
+                                          const char* output_directory,
+                                          MdbDumpReplayStats* out_stats);
+
+    // ==============================
+    // Memory Accounting
+    // ==============================
+
+    /// <summary>
+    /// Counters for one tagged allocation subsystem. Figures cover only
+    /// the call sites that tag their allocations (dump arena, name caches,
+    /// metadata cache mapping, snapshot replay graph, hook table, log
+    /// ring); node-based caches report an estimated per-entry overhead.
+    /// </summary>
+    struct MdbMemoryStats {
+        unsigned long long live_bytes;   // currently accounted
+        unsigned long long peak_bytes;   // high-water mark
+        unsigned long long alloc_count;  // accounted allocations so far
+    };
+
+    /// <summary>
+    /// Number of memory accounting tags. Valid tag indices for
+    /// mdb_get_memory_stats are 0 .. count-1.
+    /// </summary>
+    /// <returns>The tag count</returns>
+    MDB_API int mdb_get_memory_tag_count();
+
+    /// <summary>
+    /// Short stable name of an accounting tag ("dump_arena", "name_cache",
+    /// "metadata_cache", "snapshot", "hook_table", "log_ring").
+    /// </summary>
+    /// <param name="tag">Tag index</param>
+    /// <returns>The tag name, or "unknown" for an invalid index</returns>
+    MDB_API const char* mdb_get_memory_tag_name(int tag);
+
+    /// <summary>
+    /// Read the live/peak/count figures for one accounting tag.
+    /// </summary>
+    /// <param name="tag">Tag index</param>
+    /// <param name="out_stats">Output: statistics structure to fill</param>
+    /// <returns>0 on success, non-zero on failure</returns>
+    MDB_API int mdb_get_memory_stats(int tag, MdbMemoryStats* out_stats);
+
     // ==============================
     // ImGui Integration
     // ==============================
@@ -768,6 +1847,31 @@ extern "C" {
     /// <summary>Get property setter method.</summary>
     MDB_API void* mdb_property_get_set_method(void* prop);
 
+    /// <summary>
+    /// Resolve a property by name, walking the parent chain. One pass over
+    /// the property tables replaces the name-based get_X/set_X method probes
+    /// otherwise paid per accessor.
+    /// </summary>
+    /// <param name="klass">Pointer to Il2CppClass</param>
+    /// <param name="name">Property name</param>
+    /// <returns>Pointer to PropertyInfo, or nullptr if not found</returns>
+    MDB_API void* mdb_class_get_property(void* klass, const char* name);
+
+    /// <summary>
+    /// Resolve a property's accessors in one call: getter/setter MethodInfo
+    /// plus their native function pointers, cached keyed by the property
+    /// pointer so repeated resolution is a hash lookup. Any output can be
+    /// nullptr to skip it; missing accessors yield nullptr.
+    /// </summary>
+    /// <param name="prop">Pointer to PropertyInfo</param>
+    /// <param name="out_getter">Receives the getter MethodInfo</param>
+    /// <param name="out_setter">Receives the setter MethodInfo</param>
+    /// <param name="out_getter_ptr">Receives the getter's native function pointer</param>
+    /// <param name="out_setter_ptr">Receives the setter's native function pointer</param>
+    /// <returns>Bitmask: bit 0 = getter present, bit 1 = setter present; -1 on error</returns>
+    MDB_API int mdb_property_get_accessors(void* prop, void** out_getter, void** out_setter,
+                                           void** out_getter_ptr, void** out_setter_ptr);
+
     /// <summary>Get the number of methods in a class.</summary>
     MDB_API int mdb_class_get_method_count(void* klass);
 
@@ -789,6 +1893,17 @@ extern "C" {
     /// <summary>Get parent class.</summary>
     MDB_API void* mdb_class_get_parent(void* klass);
 
+    /// <summary>
+    /// Check whether an instance of class 'from' is assignable to a variable
+    /// of class 'to' (parent chain and interfaces included). The answer is
+    /// memoized natively per class pair, so hot type filters pay a hash
+    /// lookup instead of a hierarchy walk per check.
+    /// </summary>
+    /// <param name="from">Pointer to the candidate Il2CppClass</param>
+    /// <param name="to">Pointer to the target Il2CppClass</param>
+    /// <returns>true if assignable; false otherwise or on error</returns>
+    MDB_API bool mdb_class_is_assignable(void* from, void* to);
+
     /// <summary>Get field value directly (for primitives).</summary>
     MDB_API bool mdb_field_get_value_direct(void* instance, void* field, void* outBuffer, int bufferSize);
 
@@ -0,0 +1,167 @@
+#include "config.hpp"
+#include "mdb_log.h"
+
+#include <Windows.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace MDB {
+namespace Config {
+
+static Settings g_settings;
+
+const Settings& Get() {
+    return g_settings;
+}
+
+// ---------------------------------------------------------------------------
+// Parsing helpers — all in-place on the file buffer, no allocation
+// ---------------------------------------------------------------------------
+
+static char* TrimInPlace(char* s) {
+    while (*s == ' ' || *s == '\t') s++;
+    size_t len = strlen(s);
+    while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t'
+                       || s[len - 1] == '\r' || s[len - 1] == '\n')) {
+        s[--len] = '\0';
+    }
+    return s;
+}
+
+static bool ParseBool(const char* value, bool* out) {
+    if (_stricmp(value, "true") == 0 || _stricmp(value, "yes") == 0
+        || strcmp(value, "1") == 0) {
+        *out = true;
+        return true;
+    }
+    if (_stricmp(value, "false") == 0 || _stricmp(value, "no") == 0
+        || strcmp(value, "0") == 0) {
+        *out = false;
+        return true;
+    }
+    return false;
+}
+
+// Apply one key = value under `section`; false for unrecognized keys and
+// unparsable values so the caller can name the offending line
+static bool ApplyKey(const char* section, const char* key, const char* value) {
+    if (_stricmp(section, "pool") == 0) {
+        if (_stricmp(key, "threads") == 0) {
+            long parsed = strtol(value, nullptr, 10);
+            if (parsed < 0 || parsed > 256) {
+                return false;
+            }
+            g_settings.pool_threads = static_cast<int>(parsed);
+            return true;
+        }
+        return false;
+    }
+    if (_stricmp(section, "overlay") == 0) {
+        if (_stricmp(key, "hitch_threshold_ms") == 0) {
+            g_settings.hitch_threshold_ms = static_cast<float>(atof(value));
+            return true;
+        }
+        return false;
+    }
+    if (_stricmp(section, "instrumentation") == 0) {
+        if (_stricmp(key, "export_stats") == 0) {
+            return ParseBool(value, &g_settings.export_stats);
+        }
+        if (_stricmp(key, "startup_profiler") == 0) {
+            return ParseBool(value, &g_settings.startup_profiler);
+        }
+        return false;
+    }
+    if (_stricmp(section, "dump") == 0) {
+        if (_stricmp(key, "amalgamate") == 0) {
+            return ParseBool(value, &g_settings.dump_amalgamate);
+        }
+        if (_stricmp(key, "raw_dump") == 0) {
+            return ParseBool(value, &g_settings.dump_raw_dump);
+        }
+        return false;
+    }
+    if (_stricmp(section, "mods") == 0) {
+        if (_stricmp(key, "hot_reload") == 0) {
+            return ParseBool(value, &g_settings.mod_hot_reload);
+        }
+        return false;
+    }
+    return false;
+}
+
+bool Load(const std::wstring& mdb_dir) {
+    std::wstring path = mdb_dir + L"\\mdb_config.ini";
+    FILE* file = _wfopen(path.c_str(), L"rb");
+    if (!file) {
+        return false;  // absent is the common case — defaults apply
+    }
+
+    // One fixed buffer for the whole file; a config this size is a few
+    // hundred bytes, the cap just bounds a corrupt file
+    static char buffer[8192];
+    size_t read = fread(buffer, 1, sizeof(buffer) - 1, file);
+    fclose(file);
+    buffer[read] = '\0';
+
+    char section[32] = "";
+    int line_no = 0;
+
+    char* cursor = buffer;
+    while (cursor && *cursor) {
+        char* line = cursor;
+        char* newline = strchr(cursor, '\n');
+        if (newline) {
+            *newline = '\0';
+            cursor = newline + 1;
+        } else {
+            cursor = nullptr;
+        }
+        line_no++;
+
+        // Strip comments, then whitespace
+        if (char* comment = strpbrk(line, ";#")) {
+            *comment = '\0';
+        }
+        line = TrimInPlace(line);
+        if (*line == '\0') {
+            continue;
+        }
+
+        if (*line == '[') {
+            char* close = strchr(line, ']');
+            if (!close) {
+                LOG_WARN("[config] mdb_config.ini:%d: malformed section header", line_no);
+                continue;
+            }
+            *close = '\0';
+            strncpy_s(section, line + 1, _TRUNCATE);
+            continue;
+        }
+
+        char* eq = strchr(line, '=');
+        if (!eq) {
+            LOG_WARN("[config] mdb_config.ini:%d: expected key = value", line_no);
+            continue;
+        }
+        *eq = '\0';
+        char* key = TrimInPlace(line);
+        char* value = TrimInPlace(eq + 1);
+
+        if (!ApplyKey(section, key, value)) {
+            LOG_WARN("[config] mdb_config.ini:%d: unrecognized or invalid '%s%s%s = %s'",
+                     line_no, section, *section ? "." : "", key, value);
+        }
+    }
+
+    LOG_INFO("[config] Loaded mdb_config.ini (pool.threads=%d, overlay.hitch_threshold_ms=%.1f, "
+             "instrumentation.export_stats=%d, instrumentation.startup_profiler=%d, "
+             "dump.amalgamate=%d, dump.raw_dump=%d)",
+             g_settings.pool_threads, g_settings.hitch_threshold_ms,
+             g_settings.export_stats ? 1 : 0, g_settings.startup_profiler ? 1 : 0,
+             g_settings.dump_amalgamate ? 1 : 0, g_settings.dump_raw_dump ? 1 : 0);
+    return true;
+}
+
+} // namespace Config
+} // namespace MDB
@@ -0,0 +1,64 @@
+#pragma once
+// ============================================================================
+// Runtime Performance Configuration
+// ============================================================================
+// Typed knobs loaded once at startup from <exe_dir>\MDB\mdb_config.ini, so
+// users can tune thread counts and instrumentation without a rebuild — the
+// same binary has to serve 4-core laptops and 32-core desktops. Defaults are
+// compiled in; a missing file or missing key changes nothing. Environment
+// variables (MDB_POOL_THREADS, MDB_HITCH_THRESHOLD_MS, MDB_PROFILE_STARTUP)
+// keep precedence over the file so one-off diagnostic runs don't require
+// editing it.
+//
+// Per-channel log levels stay in log_channels.cfg (see log_backend.hpp) —
+// that file is read by the log backend before this one loads.
+//
+// Format: INI — [section] headers, key = value, ';' or '#' comments.
+//
+//   [pool]
+//   threads = 0               ; worker count; 0 = auto (half the hw threads)
+//
+//   [overlay]
+//   hitch_threshold_ms = 50   ; frame-hitch detector threshold; <= 0 disables
+//
+//   [instrumentation]
+//   export_stats = false      ; per-export call/cycle counters from startup
+//   startup_profiler = false  ; startup stack sampler (collapsed-stack file)
+//
+//   [dump]
+//   amalgamate = false        ; pack wrappers into a few ~5MB files instead
+//                             ; of one file per namespace (faster compiles)
+//   raw_dump = false          ; write the dump.cs diagnostic (off the
+//                             ; startup path unless someone needs it)
+//
+//   [mods]
+//   hot_reload = false        ; watch MDB\Mods and reload changed mod DLLs
+//                             ; in place (developer feature)
+//
+// The parser works in one fixed buffer — no per-key allocation.
+
+#include <string>
+
+namespace MDB {
+namespace Config {
+
+struct Settings {
+    int   pool_threads       = 0;      // 0 = auto
+    float hitch_threshold_ms = 50.0f;  // <= 0 disables the hitch detector
+    bool  export_stats       = false;
+    bool  startup_profiler   = false;
+    bool  dump_amalgamate    = false;
+    bool  dump_raw_dump      = false;
+    bool  mod_hot_reload     = false;
+};
+
+// Parse <mdb_dir>\mdb_config.ini into the shared settings. Call once from
+// the init thread before the consumers spin up; returns false (leaving
+// defaults) when the file does not exist.
+bool Load(const std::wstring& mdb_dir);
+
+// The shared settings — compiled-in defaults until Load() has run.
+const Settings& Get();
+
+} // namespace Config
+} // namespace MDB
@@ -5,9 +5,18 @@
 // to load and execute the managed mod assemblies.
 
 #include "bridge_exports.h"
+#include "core/config.hpp"
+#include "core/etw_provider.hpp"
+#include "core/log_backend.hpp"
 #include "core/mdb_log.h"
+#include "core/mem_stats.hpp"
+#include "core/startup_fs.hpp"
+#include "core/startup_profiler.hpp"
+#include "core/startup_trace.hpp"
+#include "core/thread_pool.hpp"
 #include "il2cpp/il2cpp_resolver.hpp"
 #include "il2cpp/il2cpp_dumper.hpp"
+#include "il2cpp/metadata_cache.hpp"
 #include "proxy/version_proxy.h"
 // wrapper_generator.hpp removed — dumper now generates wrappers directly
 
@@ -17,11 +26,16 @@ extern "C" void mdb_imgui_shutdown();
 #include "codegen/build_trigger.hpp"
 
 #include <windows.h>
+#include <winternl.h>
 #include <metahost.h>
 #include <mscoree.h>
 #include <string>
 #include <filesystem>
 #include <atomic>
+#include <climits>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #pragma comment(lib, "mscoree.lib")
 
@@ -40,6 +54,25 @@ static std::wstring get_mdb_directory() {
     return (exe_path.parent_path() / L"MDB").wstring();
 }
 
+// Run a static managed method in the default AppDomain for the build
+// trigger's in-process compile path. Returns the method's int result, or
+// INT_MIN when the host call itself failed (the caller falls back to
+// MSBuild on any nonzero value).
+static int execute_managed_method(const wchar_t* assembly, const wchar_t* type,
+                                  const wchar_t* method, const wchar_t* argument) {
+    if (!g_pRuntimeHost) {
+        return INT_MIN;
+    }
+    DWORD retVal = 0;
+    HRESULT hr = g_pRuntimeHost->ExecuteInDefaultAppDomain(assembly, type, method,
+                                                           argument, &retVal);
+    if (FAILED(hr)) {
+        LOG_ERROR("ExecuteInDefaultAppDomain(%ls.%ls) failed: 0x%08X", type, method, hr);
+        return INT_MIN;
+    }
+    return static_cast<int>(retVal);
+}
+
 // Initialize the .NET Framework CLR
 static bool initialize_clr() {
     if (g_clr_initialized) {
@@ -47,7 +80,7 @@ static bool initialize_clr() {
     }
     
     LOG_INFO("Initializing .NET Framework CLR...");
-    
+
     HRESULT hr;
     
     // Get the CLR meta host
@@ -89,6 +122,10 @@ static bool initialize_clr() {
     
     LOG_INFO("CLR initialized successfully");
     g_clr_initialized = true;
+
+    // Hand the build trigger a way into the default AppDomain — the
+    // in-process compile path waits on this registration
+    MDB::Build::SetManagedExecutor(&execute_managed_method);
     return true;
 }
 
@@ -110,7 +147,7 @@ static bool load_managed_assemblies() {
     std::wstring modhost_dll = managed_dir + L"\\GameSDK.ModHost.dll";
     
     // Check if the ModHost DLL exists
-    if (!std::filesystem::exists(modhost_dll)) {
+    if (!MDB::StartupFs::Exists(modhost_dll)) {
         LOG_ERROR("GameSDK.ModHost.dll not found at: %ls", modhost_dll.c_str());
         return false;
     }
@@ -141,38 +178,225 @@ static bool load_managed_assemblies() {
     return true;
 }
 
-// Cleanup CLR resources
-static void shutdown_clr() {
-    LOG_DEBUG("Shutting down CLR...");
-    
-    if (g_pRuntimeHost) {
-        g_pRuntimeHost->Stop();
-        g_pRuntimeHost->Release();
-        g_pRuntimeHost = nullptr;
+// ==============================
+// Mod Hot-Reload Watcher
+// ==============================
+// Opt-in ([mods] hot_reload in mdb_config.ini): watches MDB\Mods for mod DLL
+// writes and hands the changed path to ModManager.ReloadMod in the default
+// AppDomain, which tears down that mod's hooks and loads the new bytes —
+// the CLR, caches, dump, and overlay stay untouched. Turns the edit-test
+// loop from a full game relaunch into a couple of seconds.
+
+static void mod_hot_reload_thread_body() {
+    MDB::Profiler::ScopedThreadRegistration reg("mod_hot_reload");
+
+    std::wstring mods_dir = get_mdb_directory() + L"\\Mods";
+    std::wstring modhost_dll = get_mdb_directory() + L"\\Managed\\GameSDK.ModHost.dll";
+
+    HANDLE hDir = CreateFileW(mods_dir.c_str(), FILE_LIST_DIRECTORY,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (hDir == INVALID_HANDLE_VALUE) {
+        LOG_WARN("[hot-reload] Cannot open %ls for watching (error %lu)",
+                 mods_dir.c_str(), GetLastError());
+        return;
     }
-    
-    if (g_pRuntimeInfo) {
-        g_pRuntimeInfo->Release();
-        g_pRuntimeInfo = nullptr;
+
+    HANDLE hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+    if (!hEvent) {
+        CloseHandle(hDir);
+        return;
     }
-    
-    if (g_pMetaHost) {
-        g_pMetaHost->Release();
-        g_pMetaHost = nullptr;
+
+    LOG_INFO("[hot-reload] Watching %ls for mod changes", mods_dir.c_str());
+
+    // Paths seen but not yet reloaded, with the tick of their last write —
+    // build outputs arrive as several writes, so a change only fires after
+    // it has been quiet for the debounce window
+    constexpr ULONGLONG kDebounceMs = 500;
+    std::unordered_map<std::wstring, ULONGLONG> pending;
+
+    alignas(DWORD) char buffer[8192];
+    for (;;) {
+        OVERLAPPED ov{};
+        ov.hEvent = hEvent;
+        ResetEvent(hEvent);
+        if (!ReadDirectoryChangesW(hDir, buffer, sizeof(buffer), FALSE,
+                                   FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME
+                                   | FILE_NOTIFY_CHANGE_SIZE,
+                                   nullptr, &ov, nullptr)) {
+            LOG_WARN("[hot-reload] ReadDirectoryChangesW failed (error %lu); watcher stopping",
+                     GetLastError());
+            break;
+        }
+
+        // Block until a change arrives; once something is pending, wake on
+        // a short timer so the debounce window can expire
+        DWORD wait = WaitForSingleObject(hEvent, pending.empty() ? INFINITE : 100);
+
+        if (wait == WAIT_OBJECT_0) {
+            DWORD bytes = 0;
+            if (GetOverlappedResult(hDir, &ov, &bytes, FALSE) && bytes > 0) {
+                ULONGLONG now = GetTickCount64();
+                char* cursor = buffer;
+                for (;;) {
+                    auto* info = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(cursor);
+                    std::wstring name(info->FileName, info->FileNameLength / sizeof(wchar_t));
+                    if (name.size() > 4 && _wcsicmp(name.c_str() + name.size() - 4, L".dll") == 0) {
+                        pending[mods_dir + L"\\" + name] = now;
+                    }
+                    if (info->NextEntryOffset == 0) {
+                        break;
+                    }
+                    cursor += info->NextEntryOffset;
+                }
+            }
+        } else if (wait != WAIT_TIMEOUT) {
+            break;
+        }
+
+        // Fire every entry that has been quiet for the debounce window
+        ULONGLONG now = GetTickCount64();
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (now - it->second < kDebounceMs) {
+                ++it;
+                continue;
+            }
+            const std::wstring& path = it->first;
+            LOG_INFO("[hot-reload] Reloading %ls", path.c_str());
+            int rc = execute_managed_method(modhost_dll.c_str(),
+                                            L"GameSDK.ModHost.ModManager",
+                                            L"ReloadMod", path.c_str());
+            if (rc != 0) {
+                LOG_WARN("[hot-reload] ModManager.ReloadMod(%ls) returned %d", path.c_str(), rc);
+            }
+            it = pending.erase(it);
+        }
     }
-    
+
+    CloseHandle(hEvent);
+    CloseHandle(hDir);
+}
+
+static void start_mod_hot_reload_watcher() {
+    if (!MDB::Config::Get().mod_hot_reload) {
+        return;
+    }
+    std::thread(mod_hot_reload_thread_body).detach();
+}
+
+// Warm the OS file cache with every assembly the CLR is about to demand-page.
+// Sequential reads with FILE_FLAG_SEQUENTIAL_SCAN get the readahead-friendly
+// path; the data lands in the cache and the buffer is thrown away. Runs on a
+// pool worker while initialize_clr() spins up, so on cold HDD installs the
+// assembly I/O overlaps CLR startup instead of serializing after it.
+static void prefetch_managed_assemblies() {
+    namespace fs = std::filesystem;
+
+    std::wstring mdb_dir = get_mdb_directory();
+    const fs::path dirs[] = {
+        fs::path(mdb_dir) / L"Managed",
+        fs::path(mdb_dir) / L"Mods",
+    };
+
+    std::vector<char> buffer(1 << 20);
+    for (const fs::path& dir : dirs) {
+        std::error_code ec;
+        for (const auto& entry : fs::directory_iterator(dir, ec)) {
+            if (!entry.is_regular_file(ec)) continue;
+            if (_wcsicmp(entry.path().extension().c_str(), L".dll") != 0) continue;
+
+            HANDLE file = CreateFileW(entry.path().c_str(), GENERIC_READ,
+                                      FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file == INVALID_HANDLE_VALUE) continue;
+
+            DWORD read = 0;
+            while (ReadFile(file, buffer.data(), static_cast<DWORD>(buffer.size()), &read, nullptr) && read > 0) {
+            }
+            CloseHandle(file);
+        }
+    }
+}
+
+// ========== Deferred CLR Shutdown ==========
+// ICLRRuntimeHost::Stop() blocks on managed finalizers and can take seconds.
+// Running it under the loader lock in DLL_PROCESS_DETACH makes game exit
+// look like a hang, so shutdown_clr() only detaches the pointers (flag
+// flips) and hands the COM releases and final flushes to a worker thread
+// with a bounded wait.
+
+struct DeferredShutdownWork {
+    ICLRRuntimeHost* host;
+    ICLRRuntimeInfo* info;
+    ICLRMetaHost* meta;
+    HMODULE self;       // pin: released via FreeLibraryAndExitThread
+};
+
+static DWORD WINAPI deferred_shutdown_thread(LPVOID param) {
+    DeferredShutdownWork* work = static_cast<DeferredShutdownWork*>(param);
+
+    if (work->host) {
+        work->host->Stop();
+        work->host->Release();
+    }
+    if (work->info) {
+        work->info->Release();
+    }
+    if (work->meta) {
+        work->meta->Release();
+    }
+
+    HMODULE self = work->self;
+    delete work;
+    if (self) {
+        FreeLibraryAndExitThread(self, 0);
+    }
+    return 0;
+}
+
+// Cleanup CLR resources. The loader-lock path here is pointer swaps only;
+// the expensive work runs on deferred_shutdown_thread.
+static void shutdown_clr() {
+    LOG_DEBUG("Shutting down CLR...");
+
+    auto* work = new DeferredShutdownWork{};
+    work->host = g_pRuntimeHost;    g_pRuntimeHost = nullptr;
+    work->info = g_pRuntimeInfo;    g_pRuntimeInfo = nullptr;
+    work->meta = g_pMetaHost;       g_pMetaHost = nullptr;
     g_clr_initialized = false;
     g_mods_loaded = false;
-    
-    if (mdb_log_detail::log_file()) {
-        fclose(mdb_log_detail::log_file());
-        mdb_log_detail::log_file() = nullptr;
+
+    // The log backend's drain thread pins the module and tears itself
+    // down — flag flip only, safe under the loader lock
+    MDB::Log::RequestShutdown();
+
+    if (!work->host && !work->info && !work->meta) {
+        delete work;
+        return;
     }
-    
-    if (mdb_log_detail::console_allocated()) {
-        FreeConsole();
-        mdb_log_detail::console_allocated() = false;
+
+    // Pin our own module so a timed-out wait below cannot unmap the code
+    // the worker is still executing — the worker drops the pin when done.
+    GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+                       reinterpret_cast<LPCWSTR>(&deferred_shutdown_thread),
+                       &work->self);
+
+    HANDLE worker = CreateThread(nullptr, 0, deferred_shutdown_thread, work, 0, nullptr);
+    if (!worker) {
+        // No worker thread — fall back to the old inline teardown
+        HMODULE self = work->self;
+        work->self = nullptr;
+        deferred_shutdown_thread(work);
+        if (self) FreeLibrary(self);
+        return;
     }
+
+    // Bounded wait: give the releases a few seconds, then let teardown
+    // proceed — the pin keeps a straggling worker safe.
+    WaitForSingleObject(worker, 3000);
+    CloseHandle(worker);
 }
 
 // Create the expected directory structure next to the game executable.
@@ -207,6 +431,10 @@ static bool ensure_directory_structure() {
     return true;
 }
 
+// Set when prepare_game_sdk() started an async MDB_Core build that
+// wait_for_game_sdk_build() still has to join before mods can load.
+static bool g_sdk_build_pending = false;
+
 // Prepare game SDK by dumping and generating wrappers if needed
 static bool prepare_game_sdk() {
     std::wstring mdb_dir = get_mdb_directory();
@@ -219,7 +447,7 @@ static bool prepare_game_sdk() {
     auto managed_dll = mdb_path / L"Managed" / L"GameSDK.ModHost.dll";
     
     // Validate that MDB_Core.csproj exists
-    if (!std::filesystem::exists(core_project)) {
+    if (!MDB::StartupFs::Exists(core_project.wstring())) {
         LOG_ERROR("MDB_Core.csproj not found at: %ls", core_project.c_str());
         LOG_ERROR("Please deploy the MDB_Core project to: %ls", (mdb_path.parent_path() / L"MDB_Core").c_str());
         return false;
@@ -229,11 +457,18 @@ static bool prepare_game_sdk() {
     std::string generated_dir_str = generated_dir.string();
     std::string core_project_str = core_project.string();
     
-    bool dll_exists = std::filesystem::exists(managed_dll);
-    
+    bool dll_exists = MDB::StartupFs::Exists(managed_dll.wstring());
+    std::string metadata_cache_path = (generated_dir / L"metadata.mdbc").string();
+
     // Check if wrappers already exist and are fresh AND the built DLL exists
     if (MDB::Dumper::AreWrappersFresh(generated_dir_str) && dll_exists) {
         LOG_INFO("Game SDK wrappers and managed DLL are up to date, skipping");
+        // Warm start: map the binary metadata cache so runtime metadata
+        // queries skip IL2CPP enumeration entirely. Open() validates the
+        // cache against GameAssembly.dll and fails quietly when stale.
+        if (MDB::MetaCache::Open(metadata_cache_path)) {
+            LOG_VERBOSE("Metadata cache mapped: %s", metadata_cache_path.c_str());
+        }
         return true;
     }
     
@@ -252,8 +487,17 @@ static bool prepare_game_sdk() {
             return false;
         }
         
-        LOG_INFO("  Dumped %zu classes from %zu assemblies", 
-                 dump_result.total_classes, dump_result.total_assemblies);
+        LOG_INFO("  Dumped %zu classes from %zu assemblies in %.0f ms (%.0f classes/sec)",
+                 dump_result.total_classes, dump_result.total_assemblies,
+                 dump_result.ms_total,
+                 dump_result.ms_total > 0.0
+                     ? dump_result.total_classes * 1000.0 / dump_result.ms_total : 0.0);
+        LOG_VERBOSE("  Phases: hash %.0f ms | obfuscation %.0f ms | collect %.0f ms | "
+                    "registry %.0f ms | generate %.0f ms | cache %.0f ms (file I/O %.0f ms, overlapped)",
+                    dump_result.ms_image_hashing, dump_result.ms_obfuscation_analysis,
+                    dump_result.ms_collection, dump_result.ms_registry,
+                    dump_result.ms_generation, dump_result.ms_metadata_cache,
+                    dump_result.ms_file_io);
         LOG_VERBOSE("  Generated %zu wrapper files (%zu classes)",
                  dump_result.generated_files.size(), dump_result.total_wrappers_generated);
         if (dump_result.fake_methods_detected > 0 || dump_result.fake_classes_detected > 0) {
@@ -265,30 +509,78 @@ static bool prepare_game_sdk() {
             LOG_VERBOSE("  Deobfuscation: applied %zu friendly name mappings to SDK",
                       dump_result.mappings_loaded);
         }
+        if (!dump_result.metadata_cache_path.empty()) {
+            LOG_VERBOSE("  Metadata cache written: %s", dump_result.metadata_cache_path.c_str());
+            if (MDB::MetaCache::Open(dump_result.metadata_cache_path)) {
+                LOG_VERBOSE("  Metadata cache mapped");
+            }
+        }
     } else {
         LOG_INFO("Step 1/2: Wrappers up to date, skipping dump");
     }
     
-    // Step 2: Build MDB_Core project with MSBuild
+    // Step 2: Build MDB_Core project with MSBuild. The build runs
+    // asynchronously so CLR initialization overlaps the compile — only
+    // mod loading gates on completion (wait_for_game_sdk_build below).
+    if (need_build && dll_exists && MDB::Build::IsBuildCurrent(core_project_str)) {
+        // The dump regenerated wrappers byte-identical to what the last
+        // successful build compiled — nothing for MSBuild to do.
+        LOG_INFO("Step 2/2: Generated sources unchanged since last build, skipping");
+        need_build = false;
+
+        // Covers installs whose last build predates the NGEN warm-up:
+        // queues the native image for the existing DLL if it hasn't been
+        MDB::Build::EnsureNativeImage(core_project_str);
+    }
+
     if (need_build) {
-        LOG_INFO("Step 2/2: Building MDB_Core project...");
-        
-        auto build_result = MDB::Build::TriggerBuild(core_project_str);
-        
-        if (!build_result.success) {
-            LOG_ERROR("Failed to build MDB_Core: %s", build_result.error_message.c_str());
-            if (!build_result.build_output.empty()) {
-                LOG_ERROR("Build output:\n%s", build_result.build_output.c_str());
-            }
+        LOG_INFO("Step 2/2: Building MDB_Core project (in background)...");
+
+        std::string start_error;
+        bool started = MDB::Build::StartBuildAsync(
+            core_project_str,
+            [](const std::string& line) {
+                LOG_DEBUG("  [msbuild] %s", line.c_str());
+            },
+            &start_error);
+
+        if (!started) {
+            LOG_ERROR("Failed to start MDB_Core build: %s", start_error.c_str());
             return false;
         }
-        
-        LOG_INFO("  Build succeeded!");
+
+        g_sdk_build_pending = true;
+    } else {
+        LOG_INFO("=== Game SDK Ready ===");
+    }
+
+    return true;
+}
+
+// Join the async MDB_Core build started by prepare_game_sdk().
+// Called right before mod loading — the compile overlaps CLR warmup, but
+// the managed DLL must exist before load_managed_assemblies() runs.
+static bool wait_for_game_sdk_build() {
+    if (!g_sdk_build_pending) {
+        return true;
+    }
+    g_sdk_build_pending = false;
+
+    if (MDB::Build::IsBuildRunning()) {
+        LOG_INFO("Waiting for MDB_Core build to finish...");
+    }
+
+    auto build_result = MDB::Build::WaitForBuild();
+
+    if (!build_result.success) {
+        LOG_ERROR("Failed to build MDB_Core: %s", build_result.error_message.c_str());
         if (!build_result.build_output.empty()) {
-            LOG_DEBUG("Build output:\n%s", build_result.build_output.c_str());
+            LOG_ERROR("Build output:\n%s", build_result.build_output.c_str());
         }
+        return false;
     }
-    
+
+    LOG_INFO("  Build succeeded!");
     LOG_INFO("=== Game SDK Ready ===");
     return true;
 }
@@ -367,17 +659,10 @@ static void hooked_application_quit() {
 
     // 2. Suppress console re-allocation so no LOG_INFO after this
     //    can create a new console window (the flicker).
-    mdb_log_detail::console_suppressed() = true;
+    MDB::Log::SuppressConsole();
 
-    // 3. Free console + close log file
-    if (mdb_log_detail::console_allocated()) {
-        FreeConsole();
-        mdb_log_detail::console_allocated() = false;
-    }
-    if (mdb_log_detail::log_file()) {
-        fclose(mdb_log_detail::log_file());
-        mdb_log_detail::log_file() = nullptr;
-    }
+    // 3. Flush and release the log sinks (bounded — ExitProcess follows)
+    MDB::Log::Shutdown(500);
 
     // 4. Force-exit.  Do NOT call g_original_quit() — Unity's async
     //    teardown path is what causes the error dialog.  ExitProcess
@@ -422,30 +707,106 @@ static bool install_quit_hook() {
 
 // atexit fallback — called if the CRT tears down normally
 static void mdb_atexit_handler() {
-    mdb_log_detail::console_suppressed() = true;
+    MDB::Log::SuppressConsole();
     mdb_imgui_shutdown(); // idempotent
 }
 
 // Background thread for initialization
 // We delay initialization to ensure the game has loaded IL2CPP
-static DWORD WINAPI initialization_thread(LPVOID lpParam) {
-    // Wait for GameAssembly.dll to be loaded
-    LOG_DEBUG("Waiting for GameAssembly.dll...");
-    HMODULE hGameAssembly = nullptr;
-    for (int i = 0; i < 300 && !hGameAssembly; ++i) {  // Wait up to 30 seconds
-        hGameAssembly = GetModuleHandleA("GameAssembly.dll");
-        if (!hGameAssembly) {
+// ==============================
+// GameAssembly Load Gate
+// ==============================
+// Event-driven wait for GameAssembly.dll via the loader's DLL-load
+// notification callback — wakes the instant the module is mapped instead
+// of polling on a 100 ms timer. Falls back to the old poll loop if the
+// ntdll entry points are unavailable.
+
+namespace {
+    struct LdrDllNotificationData {
+        ULONG Flags;
+        const UNICODE_STRING* FullDllName;
+        const UNICODE_STRING* BaseDllName;
+        PVOID DllBase;
+        ULONG SizeOfImage;
+    };
+    constexpr ULONG kLdrDllNotificationReasonLoaded = 1;
+
+    using LdrNotifyFn     = VOID(CALLBACK*)(ULONG reason, const LdrDllNotificationData* data, PVOID context);
+    using LdrRegisterFn   = NTSTATUS(NTAPI*)(ULONG flags, LdrNotifyFn fn, PVOID context, PVOID* cookie);
+    using LdrUnregisterFn = NTSTATUS(NTAPI*)(PVOID cookie);
+}
+
+static VOID CALLBACK game_assembly_load_notify(ULONG reason, const LdrDllNotificationData* data, PVOID context) {
+    if (reason != kLdrDllNotificationReasonLoaded || !data || !data->BaseDllName) {
+        return;
+    }
+    const UNICODE_STRING* name = data->BaseDllName;
+    constexpr wchar_t kTarget[] = L"GameAssembly.dll";
+    constexpr USHORT kTargetChars = static_cast<USHORT>((sizeof(kTarget) / sizeof(wchar_t)) - 1);
+    if (name->Length == kTargetChars * sizeof(wchar_t)
+        && _wcsnicmp(name->Buffer, kTarget, kTargetChars) == 0) {
+        SetEvent(static_cast<HANDLE>(context));
+    }
+}
+
+static HMODULE wait_for_game_assembly(DWORD timeout_ms) {
+    HMODULE hModule = GetModuleHandleA("GameAssembly.dll");
+    if (hModule) {
+        return hModule;
+    }
+
+    HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
+    auto register_fn = ntdll
+        ? reinterpret_cast<LdrRegisterFn>(GetProcAddress(ntdll, "LdrRegisterDllNotification")) : nullptr;
+    auto unregister_fn = ntdll
+        ? reinterpret_cast<LdrUnregisterFn>(GetProcAddress(ntdll, "LdrUnregisterDllNotification")) : nullptr;
+
+    HANDLE loaded_event = (register_fn && unregister_fn)
+        ? CreateEventW(nullptr, TRUE, FALSE, nullptr) : nullptr;
+
+    if (!loaded_event) {
+        // Fallback: poll at 100 ms like the original loop
+        for (DWORD waited = 0; waited < timeout_ms && !hModule; waited += 100) {
             Sleep(100);
+            hModule = GetModuleHandleA("GameAssembly.dll");
         }
+        return hModule;
     }
-    
+
+    PVOID cookie = nullptr;
+    if (register_fn(0, game_assembly_load_notify, loaded_event, &cookie) == 0) {
+        // Re-check after registration: the module may have loaded between
+        // the probe above and the callback going live
+        hModule = GetModuleHandleA("GameAssembly.dll");
+        if (!hModule && WaitForSingleObject(loaded_event, timeout_ms) == WAIT_OBJECT_0) {
+            hModule = GetModuleHandleA("GameAssembly.dll");
+        }
+        unregister_fn(cookie);
+    }
+    CloseHandle(loaded_event);
+    return hModule;
+}
+
+static DWORD initialization_thread_body() {
+    // Wait for GameAssembly.dll to be loaded
+    LOG_DEBUG("Waiting for GameAssembly.dll...");
+    auto gaWaitSpan = MDB::Trace::BeginSpan("startup.wait_game_assembly");
+    HMODULE hGameAssembly = wait_for_game_assembly(30000);
+    MDB::Trace::EndSpan(gaWaitSpan);
+
     if (!hGameAssembly) {
         LOG_ERROR("GameAssembly.dll not found after 30 seconds");
         return 1;
     }
-    
+
     LOG_DEBUG("GameAssembly.dll found at: 0x%p", hGameAssembly);
-    
+
+    // Arm the readiness signal before anything else touches the runtime: a
+    // one-shot hook on il2cpp_init flips an event when the game finishes
+    // initializing IL2CPP, so the gate before mod loading wakes within
+    // microseconds instead of polling
+    mdb_arm_runtime_ready_signal();
+
     // Ensure P/Invoke can find MDB_Bridge.dll in our directory
     ensure_bridge_searchable();
     
@@ -454,10 +815,23 @@ static DWORD WINAPI initialization_thread(LPVOID lpParam) {
         LOG_ERROR("Failed to create required directory structure");
         return 1;
     }
+
+    // One bulk scan of the MDB and MDB_Core trees feeds every existence and
+    // freshness probe below from memory — on network-share installs the
+    // individual stat calls this replaces cost milliseconds each
+    {
+        MDB::Trace::ScopedSpan span("startup.fs_manifest");
+        std::filesystem::path mdb(get_mdb_directory());
+        MDB::StartupFs::Prime(mdb.wstring());
+        MDB::StartupFs::Prime((mdb.parent_path() / L"MDB_Core").wstring());
+    }
     
-    // Initialize IL2CPP bridge
+    // Initialize IL2CPP bridge (covers SignatureScanner::Initialize and
+    // ensure_exports inside the resolver)
     LOG_INFO("Initializing IL2CPP bridge...");
+    auto initSpan = MDB::Trace::BeginSpan("startup.mdb_init");
     int result = mdb_init();
+    MDB::Trace::EndSpan(initSpan);
     if (result != 0) {
         LOG_ERROR("mdb_init failed with code: %d (%s)", result, mdb_get_last_error());
         return 1;
@@ -471,36 +845,138 @@ static DWORD WINAPI initialization_thread(LPVOID lpParam) {
         LOG_DEBUG("Thread attached to IL2CPP domain");
     }
     
-    // Prepare Game SDK (dump + generate + build)
+    // Start CLR initialization on its own thread. CLRCreateInstance →
+    // GetRuntime → Start takes ~1.5s and has no data dependency on the
+    // IL2CPP dump or the SDK build, so it overlaps both; the join below
+    // happens before ExecuteInDefaultAppDomain needs the runtime host.
+    std::atomic<bool> clr_ok{ false };
+    std::thread clr_thread([&clr_ok]() {
+        MDB::Profiler::ScopedThreadRegistration reg("clr_init");
+        MDB::Trace::ScopedSpan span("startup.initialize_clr");
+        clr_ok.store(initialize_clr());
+    });
+
+    // Pull the ModHost and mod assemblies into the OS cache while the CLR
+    // starts. Fire-and-forget: the prefetch only reads, so even if it is
+    // still running when load_managed_assemblies() begins, the CLR just
+    // hits already-warm pages partway through.
+    MDB::Pool::Submit([] {
+        MDB::Trace::ScopedSpan span("startup.prefetch_assemblies");
+        prefetch_managed_assemblies();
+    });
+
+    // Prepare Game SDK (dump + generate; the MSBuild compile, if needed,
+    // keeps running in the background alongside CLR startup)
     LOG_INFO("Preparing Game SDK...");
-    if (!prepare_game_sdk()) {
+    auto sdkSpan = MDB::Trace::BeginSpan("startup.prepare_game_sdk");
+    bool sdk_ok = prepare_game_sdk();
+    MDB::Trace::EndSpan(sdkSpan);
+
+    // Join the CLR thread even on SDK failure so it can't outlive the stack
+    // variables it captured
+    clr_thread.join();
+
+    if (!sdk_ok) {
         LOG_ERROR("Failed to prepare Game SDK");
         return 1;
     }
-    
-    // Initialize CLR and load mods
-    if (!initialize_clr()) {
+
+    if (!clr_ok.load()) {
         LOG_ERROR("Failed to initialize CLR");
         return 1;
     }
-    
-    // Small delay to let the game initialize more
-    Sleep(1000);
-    
-    if (!load_managed_assemblies()) {
-        LOG_ERROR("Failed to load managed assemblies");
-        return 1;
+
+    // Mod loading needs the built managed DLL — join the async build here
+    {
+        MDB::Trace::ScopedSpan span("startup.wait_sdk_build");
+        if (!wait_for_game_sdk_build()) {
+            LOG_ERROR("Failed to prepare Game SDK");
+            return 1;
+        }
+    }
+
+    // Gate mod loading on the IL2CPP runtime being ready for managed
+    // interop (the domain existing is the precondition the load actually
+    // has). Event-driven via the il2cpp_init hook armed above; mdb_init
+    // already succeeded, so in practice the domain is up and this returns
+    // immediately.
+    {
+        MDB::Trace::ScopedSpan span("startup.wait_runtime_ready");
+        if (!mdb_wait_runtime_ready(1000)) {
+            LOG_WARN("IL2CPP runtime not ready after 1 s; continuing");
+        }
     }
 
+    {
+        MDB::Trace::ScopedSpan span("startup.load_managed_assemblies");
+        if (!load_managed_assemblies()) {
+            LOG_ERROR("Failed to load managed assemblies");
+            return 1;
+        }
+    }
+
+    // Startup is over — drop the filesystem manifest so nothing later can
+    // read a stale entry (and the memory goes back)
+    MDB::StartupFs::Reset();
+
+    // Watch for mod DLL rewrites if the developer opted in
+    start_mod_hot_reload_watcher();
+
     // Register atexit fallback for clean shutdown
     atexit(mdb_atexit_handler);
 
     // Hook Application.Quit so we detect when the game exits
     install_quit_hook();
-    
+
     return 0;
 }
 
+static DWORD WINAPI initialization_thread(LPVOID lpParam) {
+    (void)lpParam;
+
+    // Off the loader lock now — safe to LoadLibrary the real version.dll
+    // and resolve the full forward table before the game's first version
+    // API call has to do it through the first-call thunks
+    VersionProxy_Init();
+
+    // Tunable knobs, before any consumer spins up (pool sizing, hitch
+    // threshold, instrumentation toggles). Missing file leaves defaults.
+    if (MDB::Config::Load(get_mdb_directory())) {
+        if (MDB::Config::Get().export_stats) {
+            mdb_export_stats_set_enabled(true);
+        }
+    }
+
+    // Safe to register the ETW provider too, so the startup spans below
+    // are already visible to a recording session
+    MDB::Etw::Register();
+
+    // Stack sampler for the startup pipeline (no-op unless the
+    // MDB_PROFILE_STARTUP environment variable is set)
+    MDB::Profiler::Start();
+    MDB::Profiler::ScopedThreadRegistration profiler_reg("init");
+
+    auto totalSpan = MDB::Trace::BeginSpan("startup.initialization_thread");
+    DWORD rc = initialization_thread_body();
+    MDB::Trace::EndSpan(totalSpan);
+
+    // One timeline artifact per launch, written on success and failure alike
+    // — failed launches are exactly the ones we want profiles from
+    std::filesystem::path logs_dir = std::filesystem::path(get_mdb_directory()) / L"Logs";
+    if (MDB::Trace::WriteTimeline(logs_dir.string())) {
+        LOG_VERBOSE("Startup timeline written to %ls", logs_dir.c_str());
+    }
+    if (MDB::Profiler::StopAndWrite(logs_dir.string())) {
+        LOG_INFO("Startup profile written to %ls", logs_dir.c_str());
+    }
+
+    // Attribution snapshot once startup settles — the figure users compare
+    // against the RSS delta MDB added
+    MDB::Mem::LogSummary("startup");
+
+    return rc;
+}
+
 // Guard: only the FIRST loaded instance should initialise.
 // In proxy mode version.dll loads first, then P/Invoke loads MDB_Bridge.dll
 // from the MDB folder — that second load must be a no-op.
@@ -516,7 +992,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
             
             // NOTE: Do NOT call LoadLibrary (e.g. VersionProxy_Init) here —
             // we are under the loader lock and it can deadlock or crash.
-            // The version proxy functions lazy-load the real DLL on first call.
+            // The initialization thread resolves the proxy forward table;
+            // first-call thunks cover any version API call before that.
             
             // Process-wide init guard: only the first module to create
             // this event will proceed; subsequent loads see ALREADY_EXISTS.
@@ -536,20 +1013,27 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
             
         case DLL_PROCESS_DETACH:
             // Suppress console — if we're here the process is going away.
-            mdb_log_detail::console_suppressed() = true;
+            MDB::Log::SuppressConsole();
 
             if (lpReserved == nullptr) {
                 // Dynamic FreeLibrary — full cleanup is safe
+                mdb_invoke_async_shutdown();
+                MDB::Pool::Shutdown();
                 shutdown_clr();
+                MDB::MetaCache::Close();
                 il2cpp::cleanup();
+                MDB::Etw::Unregister();
                 VersionProxy_Cleanup();
             } else {
                 // Process termination — minimal cleanup
                 mdb_imgui_shutdown(); // idempotent
 
-                if (g_pRuntimeHost) {
-                    g_pRuntimeHost->Stop();
-                }
+                // Do NOT stop the CLR host here: Stop() blocks on managed
+                // finalizers for seconds under the loader lock, which users
+                // read as a crash on exit. The process is going away and
+                // the OS reclaims the runtime regardless — flags only.
+                g_clr_initialized = false;
+                g_mods_loaded = false;
             }
             if (g_init_event) { CloseHandle(g_init_event); g_init_event = nullptr; }
             break;
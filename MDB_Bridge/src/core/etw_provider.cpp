@@ -0,0 +1,77 @@
+#include "etw_provider.hpp"
+
+#include <Windows.h>
+#include <TraceLoggingProvider.h>
+
+#include <atomic>
+
+// Provider GUID {8f3c1b52-9d4e-4a81-b6a7-2c97e04d51c3} — fixed so capture
+// profiles and WPA presets keep working across releases.
+TRACELOGGING_DEFINE_PROVIDER(
+    g_mdbEtwProvider,
+    "MDB.Bridge",
+    (0x8f3c1b52, 0x9d4e, 0x4a81, 0xb6, 0xa7, 0x2c, 0x97, 0xe0, 0x4d, 0x51, 0xc3));
+
+namespace MDB {
+namespace Etw {
+
+static std::atomic<bool> g_registered{ false };
+
+void Register() {
+    bool expected = false;
+    if (!g_registered.compare_exchange_strong(expected, true)) {
+        return;
+    }
+    TraceLoggingRegister(g_mdbEtwProvider);
+}
+
+void Unregister() {
+    bool expected = true;
+    if (!g_registered.compare_exchange_strong(expected, false)) {
+        return;
+    }
+    TraceLoggingUnregister(g_mdbEtwProvider);
+}
+
+bool Enabled() {
+    return g_registered.load(std::memory_order_relaxed)
+        && TraceLoggingProviderEnabled(g_mdbEtwProvider, 0, 0);
+}
+
+void Span(const char* name, double duration_ms) {
+    TraceLoggingWrite(g_mdbEtwProvider, "Span",
+        TraceLoggingLevel(5 /*TRACE_LEVEL_VERBOSE*/),
+        TraceLoggingString(name, "name"),
+        TraceLoggingFloat64(duration_ms, "duration_ms"));
+}
+
+void Instant(const char* name) {
+    TraceLoggingWrite(g_mdbEtwProvider, "Instant",
+        TraceLoggingLevel(5 /*TRACE_LEVEL_VERBOSE*/),
+        TraceLoggingString(name, "name"));
+}
+
+void HookInstalled(const char* method_name, const void* target) {
+    TraceLoggingWrite(g_mdbEtwProvider, "HookInstalled",
+        TraceLoggingLevel(4 /*TRACE_LEVEL_INFORMATION*/),
+        TraceLoggingString(method_name ? method_name : "<unknown>", "method"),
+        TraceLoggingPointer(target, "target"));
+}
+
+void InvokeBatch(int count, int succeeded, double duration_ms) {
+    TraceLoggingWrite(g_mdbEtwProvider, "InvokeBatch",
+        TraceLoggingLevel(5 /*TRACE_LEVEL_VERBOSE*/),
+        TraceLoggingInt32(count, "count"),
+        TraceLoggingInt32(succeeded, "succeeded"),
+        TraceLoggingFloat64(duration_ms, "duration_ms"));
+}
+
+void FrameSpan(double replay_ms, double render_ms) {
+    TraceLoggingWrite(g_mdbEtwProvider, "OverlayFrame",
+        TraceLoggingLevel(5 /*TRACE_LEVEL_VERBOSE*/),
+        TraceLoggingFloat64(replay_ms, "replay_ms"),
+        TraceLoggingFloat64(render_ms, "render_ms"));
+}
+
+} // namespace Etw
+} // namespace MDB
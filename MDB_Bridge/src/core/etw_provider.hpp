@@ -0,0 +1,52 @@
+#pragma once
+// ============================================================================
+// ETW TraceLogging Provider for MDB Bridge
+// ============================================================================
+// Registers the "MDB.Bridge" TraceLogging provider so bridge activity shows
+// up in WPA/xperf traces alongside the game's CPU/GPU timelines instead of
+// as anonymous DLL samples. Every startup/dump span recorded through
+// MDB::Trace is mirrored as an ETW event automatically; hot paths that are
+// not span-based (hook installs, invoke batches, Present-hook frames) emit
+// through the helpers below.
+//
+// Capture with any ETW session, e.g.:
+//   wpr -start GeneralProfile && <play> && wpr -stop mdb.etl
+//   xperf: enable provider MDB.Bridge ({8f3c1b52-9d4e-4a81-b6a7-2c97e04d51c3})
+//
+// All emit helpers are safe to call before Register and after Unregister,
+// and cost one enable-mask check when no session is listening. Guard any
+// extra measurement work (QPC reads for durations) behind Enabled().
+
+#include <cstdint>
+
+namespace MDB {
+namespace Etw {
+
+// Register/unregister the provider. Idempotent; never call from DllMain
+// (TraceLoggingRegister is not loader-lock safe).
+void Register();
+void Unregister();
+
+// True while an ETW session has the provider enabled — use to skip
+// duration measurement work when nobody is recording.
+bool Enabled();
+
+// Completed span (name + duration). Mirrored from MDB::Trace::EndSpan,
+// callable directly for spans that bypass the startup recorder.
+void Span(const char* name, double duration_ms);
+
+// Point-in-time marker.
+void Instant(const char* name);
+
+// A detour was installed on a method (mdb_create_hook family).
+void HookInstalled(const char* method_name, const void* target);
+
+// One mdb_invoke_batch transition: command count, successes, total time.
+void InvokeBatch(int count, int succeeded, double duration_ms);
+
+// One Present-hook frame: overlay CPU cost split into command-buffer
+// replay and ImGui render/submit.
+void FrameSpan(double replay_ms, double render_ms);
+
+} // namespace Etw
+} // namespace MDB
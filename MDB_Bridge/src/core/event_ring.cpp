@@ -0,0 +1,99 @@
+#include "event_ring.hpp"
+
+#include <Windows.h>
+#include <atomic>
+
+namespace MDB {
+namespace Events {
+
+namespace {
+    constexpr size_t kMaxEntries = 4096;    // power of two
+
+    struct Slot {
+        std::atomic<int64_t> qpc{ 0 };      // published last (release)
+        Kind kind = Kind::Span;
+        const char* label = nullptr;
+        float duration_ms = 0.0f;
+    };
+}
+
+static Slot g_ring[kMaxEntries];
+static std::atomic<uint64_t> g_ring_pos{ 0 };
+static std::atomic<uint64_t> g_counts[static_cast<int>(Kind::Count_)];
+
+static const char* const kKindNames[static_cast<int>(Kind::Count_)] = {
+    "span",
+    "invoke",
+    "hook_hit",
+    "hook_install",
+    "log_flush",
+    "callback",
+};
+
+const char* KindName(Kind kind) {
+    int index = static_cast<int>(kind);
+    if (index < 0 || index >= static_cast<int>(Kind::Count_)) {
+        return "unknown";
+    }
+    return kKindNames[index];
+}
+
+void Count(Kind kind, uint64_t n) {
+    int index = static_cast<int>(kind);
+    if (index < 0 || index >= static_cast<int>(Kind::Count_)) {
+        return;
+    }
+    g_counts[index].fetch_add(n, std::memory_order_relaxed);
+}
+
+void Record(Kind kind, const char* label, float duration_ms) {
+    Count(kind);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+
+    uint64_t pos = g_ring_pos.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = g_ring[pos & (kMaxEntries - 1)];
+
+    // Invalidate while the payload is mid-update, then publish the real
+    // timestamp with release — a concurrent Collect sees qpc 0 (rejected
+    // by any window) or the complete record
+    slot.qpc.store(0, std::memory_order_relaxed);
+    slot.kind = kind;
+    slot.label = label;
+    slot.duration_ms = duration_ms;
+    slot.qpc.store(now.QuadPart, std::memory_order_release);
+}
+
+void SnapshotCounts(uint64_t* out) {
+    if (!out) return;
+    for (int i = 0; i < static_cast<int>(Kind::Count_); ++i) {
+        out[i] = g_counts[i].load(std::memory_order_relaxed);
+    }
+}
+
+size_t Collect(int64_t qpc_begin, int64_t qpc_end, Entry* out, size_t max) {
+    if (!out || max == 0) return 0;
+
+    // Walk the ring from oldest slot to newest so the output is roughly
+    // chronological; a writer racing the scan can tear ordering at the
+    // wrap point, which the hitch report tolerates
+    uint64_t pos = g_ring_pos.load(std::memory_order_acquire);
+    size_t written = 0;
+    for (size_t i = 0; i < kMaxEntries && written < max; ++i) {
+        const Slot& slot = g_ring[(pos + i) & (kMaxEntries - 1)];
+        int64_t qpc = slot.qpc.load(std::memory_order_acquire);
+        if (qpc < qpc_begin || qpc > qpc_end) {
+            continue;
+        }
+        out[written].qpc = qpc;
+        out[written].kind = slot.kind;
+        out[written].label = slot.label;
+        out[written].duration_ms = slot.duration_ms;
+        written++;
+    }
+    return written;
+}
+
+} // namespace Events
+} // namespace MDB
@@ -0,0 +1,63 @@
+#pragma once
+// ============================================================================
+// Timestamped Bridge Activity Ring
+// ============================================================================
+// A small lock-free record of what the bridge was doing and when, kept so
+// the frame-hitch detector in the Present hook can answer "what did MDB do
+// inside that slow frame?". Two tiers:
+//
+//   Count(kind)              — per-kind running counter only; cheap enough
+//                              for the invoke fast path (one relaxed add).
+//   Record(kind, label, ms)  — counter plus a ring entry with a QPC
+//                              timestamp, a string-literal label, and an
+//                              optional duration. For coarse events: trace
+//                              spans, hook installs, log flushes, overlay
+//                              callback batches.
+//
+// The ring holds the most recent kMaxEntries records; the hitch detector
+// reads counter deltas for exact per-frame totals and scans the ring for
+// the labeled events that fell inside the frame window. Entries are
+// published with a release store of the timestamp, so a reader sees either
+// a complete record or one it rejects by window.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MDB {
+namespace Events {
+
+enum class Kind : int {
+    Span = 0,       // startup/dump trace span completed (label = span name)
+    Invoke,         // managed->native method invocation
+    HookHit,        // instrumented hook stub fired (sampled hits only)
+    HookInstall,    // hook created
+    LogFlush,       // log drain thread wrote a batch
+    Callback,       // overlay callback/command-buffer batch ran
+    Count_
+};
+
+struct Entry {
+    int64_t qpc;        // timestamp (QueryPerformanceCounter)
+    Kind kind;
+    const char* label;  // string literal or null
+    float duration_ms;  // 0 when not measured
+};
+
+const char* KindName(Kind kind);
+
+// Bump the running counter for `kind` by `n` — no ring entry
+void Count(Kind kind, uint64_t n = 1);
+
+// Bump the counter and append a timestamped ring entry. `label` must be a
+// string literal (stored by pointer).
+void Record(Kind kind, const char* label, float duration_ms = 0.0f);
+
+// Copy the per-kind running counters (Kind::Count_ slots) into `out`
+void SnapshotCounts(uint64_t* out);
+
+// Collect up to `max` ring entries with qpc in [qpc_begin, qpc_end],
+// oldest first. Returns the number written.
+size_t Collect(int64_t qpc_begin, int64_t qpc_end, Entry* out, size_t max);
+
+} // namespace Events
+} // namespace MDB
@@ -0,0 +1,577 @@
+// ==============================
+// MDB Bridge - Async Log Backend
+// ==============================
+// Bounded MPSC ring (Vyukov-style sequence slots) drained by one
+// background thread. See log_backend.hpp for the contract.
+
+#include "log_backend.hpp"
+#include "event_ring.hpp"
+#include "mem_stats.hpp"
+
+#include <Windows.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+
+namespace MDB {
+namespace Log {
+
+namespace {
+
+// ========== Ring Storage ==========
+
+// 2048 slots x 488 bytes of text ≈ 1 MB. A full startup log is a few
+// hundred records, so the ring only fills if the drain thread is starved
+// for a long stretch — in which case dropping beats blocking the frame.
+constexpr uint32_t kSlots = 2048;           // power of two
+constexpr uint32_t kSlotText = 488;
+
+// Slot payload kinds
+constexpr uint8_t kKindText = 0;            // preformatted text, 'len' bytes
+constexpr uint8_t kKindDeferred = 1;        // DeferredRecord, formatted at drain
+
+struct Slot {
+    std::atomic<uint32_t> seq;
+    uint8_t kind;
+    uint16_t len;
+    char text[kSlotText];
+};
+
+// Payload of a deferred-format record. The capture timestamp rides along
+// so drain latency never skews the log timeline.
+struct DeferredRecord {
+    FILETIME ft;
+    const char* format;
+    uint8_t argc;
+    Arg args[kMaxDeferredArgs];
+};
+
+static_assert(sizeof(DeferredRecord) <= kSlotText,
+              "DeferredRecord must fit in a ring slot");
+
+// ========== Channel Levels ==========
+
+// Per-channel runtime levels, Info by default. Constructed during CRT
+// static init (DLL load), so producers never observe uninitialized
+// levels.
+struct ChannelLevels {
+    std::atomic<int> v[static_cast<int>(Channel::Count)];
+    ChannelLevels() {
+        for (auto& lvl : v) {
+            lvl.store(static_cast<int>(Level::Info), std::memory_order_relaxed);
+        }
+    }
+};
+ChannelLevels g_channel_levels;
+
+const char* const kChannelNames[static_cast<int>(Channel::Count)] = {
+    "core", "scanner", "resolver", "dumper", "hooks", "imgui", "build"
+};
+
+int ParseLevelName(const char* name) {
+    if (_stricmp(name, "off") == 0)     return static_cast<int>(Level::Off);
+    if (_stricmp(name, "error") == 0)   return static_cast<int>(Level::Error);
+    if (_stricmp(name, "warn") == 0)    return static_cast<int>(Level::Warn);
+    if (_stricmp(name, "info") == 0)    return static_cast<int>(Level::Info);
+    if (_stricmp(name, "verbose") == 0) return static_cast<int>(Level::Verbose);
+    return -1;
+}
+
+// Load per-channel levels from <exe_dir>\MDB\log_channels.cfg. Lines are
+// "channel=level" ('#' starts a comment); unknown names are ignored so a
+// stale config never breaks startup. Runs once on the drain thread —
+// records logged before the file is read see the Info default.
+void LoadChannelConfig() {
+    char path[MAX_PATH];
+    GetModuleFileNameA(nullptr, path, MAX_PATH);
+    std::filesystem::path exe_path(path);
+    auto cfg_path = exe_path.parent_path() / "MDB" / "log_channels.cfg";
+
+    FILE* f = fopen(cfg_path.string().c_str(), "r");
+    if (!f) {
+        return;  // no config — defaults apply
+    }
+
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+
+        char* eq = strchr(line, '=');
+        if (!eq) continue;
+        *eq = '\0';
+
+        // Trim both halves in place
+        auto trim = [](char* s) -> char* {
+            while (*s == ' ' || *s == '\t') s++;
+            char* end = s + strlen(s);
+            while (end > s && (end[-1] == ' ' || end[-1] == '\t' ||
+                               end[-1] == '\r' || end[-1] == '\n')) {
+                *--end = '\0';
+            }
+            return s;
+        };
+        char* name = trim(line);
+        char* value = trim(eq + 1);
+
+        int lvl = ParseLevelName(value);
+        if (lvl < 0) continue;
+
+        if (_stricmp(name, "all") == 0) {
+            for (auto& ch : g_channel_levels.v) {
+                ch.store(lvl, std::memory_order_relaxed);
+            }
+            continue;
+        }
+        for (int i = 0; i < static_cast<int>(Channel::Count); i++) {
+            if (_stricmp(name, kChannelNames[i]) == 0) {
+                g_channel_levels.v[i].store(lvl, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+    fclose(f);
+}
+
+Slot g_slots[kSlots];
+std::atomic<uint32_t> g_enqueue_pos{ 0 };
+uint32_t g_dequeue_pos = 0;                 // drain thread only
+std::atomic<uint64_t> g_dropped{ 0 };
+
+// ========== Backend State ==========
+
+std::once_flag g_start_once;
+std::atomic<bool> g_stop{ false };
+std::atomic<bool> g_sleeping{ false };      // drain is parked on g_wake
+std::atomic<bool> g_console_suppressed{ false };
+HANDLE g_wake = nullptr;                    // auto-reset event
+HANDLE g_thread = nullptr;
+
+FILE* g_file = nullptr;                     // drain thread only
+bool g_console = false;                     // drain thread only
+
+// ========== Sinks (drain thread only) ==========
+
+void OpenLogFile() {
+    char path[MAX_PATH];
+    GetModuleFileNameA(nullptr, path, MAX_PATH);
+    std::filesystem::path exe_path(path);
+    auto log_path = exe_path.parent_path() / "MDB" / "Logs" / "MDB.log";
+    std::filesystem::create_directories(log_path.parent_path());
+    g_file = fopen(log_path.string().c_str(), "a");
+}
+
+void AllocateConsole() {
+    if (g_console_suppressed.load(std::memory_order_relaxed) || g_console) {
+        return;
+    }
+
+    if (AllocConsole()) {
+        FILE* fp;
+        freopen_s(&fp, "CONOUT$", "w", stdout);
+        freopen_s(&fp, "CONOUT$", "w", stderr);
+        freopen_s(&fp, "CONIN$", "r", stdin);
+
+        SetConsoleTitleA("MDB Framework Console");
+
+        // Prevent the console's close button from killing the process
+        // or blocking shutdown.  Disable the X button entirely.
+        HWND hConsole = GetConsoleWindow();
+        if (hConsole) {
+            HMENU hMenu = GetSystemMenu(hConsole, FALSE);
+            if (hMenu) DeleteMenu(hMenu, SC_CLOSE, MF_BYCOMMAND);
+        }
+
+        // Install a handler so CTRL_CLOSE_EVENT (console being
+        // destroyed during process exit) doesn't block.
+        SetConsoleCtrlHandler([](DWORD event) -> BOOL {
+            // Accept all close/shutdown events — prevents conhost from
+            // blocking ExitProcess.
+            return TRUE;
+        }, TRUE);
+
+        HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        // Header in purple/magenta
+        SetConsoleTextAttribute(hOut, FOREGROUND_RED | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
+        printf("=== MDB Framework Console ===\n\n");
+        // Reset to default gray
+        SetConsoleTextAttribute(hOut, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+
+        g_console = true;
+    }
+}
+
+void WriteRecord(const char* text, size_t len) {
+    if (g_file) {
+        fwrite(text, 1, len, g_file);
+        fputc('\n', g_file);
+    }
+
+    if (g_console) {
+        HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+
+        // Set color based on log level
+        if (strstr(text, "[ERROR]")) {
+            SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_INTENSITY);
+        } else if (strstr(text, "[WARN]")) {
+            SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
+        } else {
+            SetConsoleTextAttribute(hConsole, FOREGROUND_BLUE | FOREGROUND_INTENSITY);
+        }
+
+        fwrite(text, 1, len, stdout);
+        fputc('\n', stdout);
+
+        // Reset to default gray
+        SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+    }
+
+    if (IsDebuggerPresent()) {
+        OutputDebugStringA("[MDB_Bridge] ");
+        OutputDebugStringA(text);
+        OutputDebugStringA("\n");
+    }
+}
+
+// Format a deferred record (drain thread only). The spec's length
+// modifiers are rewritten to match the 64-bit values the ring stores, so
+// call sites keep their natural "%d"/"%08X"-style formats.
+size_t FormatDeferred(const Slot& slot, char* out, size_t cap) {
+    DeferredRecord rec;
+    memcpy(&rec, slot.text, sizeof(rec));
+
+    // Timestamp captured at the call site
+    SYSTEMTIME utc, local;
+    FileTimeToSystemTime(&rec.ft, &utc);
+    SystemTimeToTzSpecificLocalTime(nullptr, &utc, &local);
+    int hn = snprintf(out, cap, "[%02d:%02d:%02d.%03d] ",
+                      local.wHour, local.wMinute, local.wSecond, local.wMilliseconds);
+    size_t n = hn > 0 ? static_cast<size_t>(hn) : 0;
+
+    const char* f = rec.format ? rec.format : "";
+    unsigned next_arg = 0;
+
+    while (*f && n + 1 < cap) {
+        if (*f != '%') {
+            out[n++] = *f++;
+            continue;
+        }
+        if (f[1] == '%') {
+            out[n++] = '%';
+            f += 2;
+            continue;
+        }
+
+        // Collect the conversion spec up to and including its conversion
+        // character, dropping length modifiers — we substitute our own
+        char spec[24];
+        int si = 0;
+        spec[si++] = *f++;  // '%'
+        char conv = 0;
+        while (*f && si < 20) {
+            char c = *f++;
+            if (strchr("diouxXeEfFgGpsc", c)) {
+                conv = c;
+                break;
+            }
+            if (c == 'l' || c == 'h' || c == 'z' || c == 'j' || c == 't') {
+                continue;  // length modifier — replaced below
+            }
+            spec[si++] = c;  // flags, width, precision
+        }
+        if (!conv || next_arg >= rec.argc) {
+            continue;  // malformed spec or missing argument — skip it
+        }
+
+        const Arg& a = rec.args[next_arg++];
+        size_t room = cap - n;
+        int w = 0;
+
+        switch (conv) {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': {
+            spec[si++] = 'l';
+            spec[si++] = 'l';
+            spec[si++] = conv;
+            spec[si] = '\0';
+            if (conv == 'd' || conv == 'i') {
+                long long v = (a.type == Arg::Type::F64)
+                    ? static_cast<long long>(a.f64) : a.i64;
+                w = snprintf(out + n, room, spec, v);
+            } else {
+                unsigned long long v = (a.type == Arg::Type::F64)
+                    ? static_cast<unsigned long long>(a.f64) : a.u64;
+                w = snprintf(out + n, room, spec, v);
+            }
+            break;
+        }
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': {
+            spec[si++] = conv;
+            spec[si] = '\0';
+            double v = (a.type == Arg::Type::F64)
+                ? a.f64 : static_cast<double>(a.i64);
+            w = snprintf(out + n, room, spec, v);
+            break;
+        }
+        case 'p': {
+            spec[si++] = 'p';
+            spec[si] = '\0';
+            w = snprintf(out + n, room, spec, a.ptr);
+            break;
+        }
+        case 's': {
+            spec[si++] = 's';
+            spec[si] = '\0';
+            const char* v = (a.type == Arg::Type::Str && a.str) ? a.str : "(?)";
+            w = snprintf(out + n, room, spec, v);
+            break;
+        }
+        case 'c': {
+            spec[si++] = 'c';
+            spec[si] = '\0';
+            w = snprintf(out + n, room, spec, static_cast<int>(a.i64));
+            break;
+        }
+        }
+
+        if (w > 0) {
+            n += (static_cast<size_t>(w) < room) ? static_cast<size_t>(w) : room - 1;
+        }
+    }
+
+    out[n] = '\0';
+    return n;
+}
+
+// Write every ready record; returns true if anything was written.
+// Flushes the file once per batch, not per record.
+bool DrainOnce() {
+    bool any = false;
+
+    for (;;) {
+        Slot& slot = g_slots[g_dequeue_pos & (kSlots - 1)];
+        uint32_t seq = slot.seq.load(std::memory_order_acquire);
+        if (static_cast<int32_t>(seq - (g_dequeue_pos + 1)) < 0) {
+            break;  // next slot not committed yet
+        }
+
+        if (slot.kind == kKindDeferred) {
+            char formatted[512];
+            size_t len = FormatDeferred(slot, formatted, sizeof(formatted));
+            WriteRecord(formatted, len);
+        } else {
+            WriteRecord(slot.text, slot.len);
+        }
+        slot.seq.store(g_dequeue_pos + kSlots, std::memory_order_release);
+        g_dequeue_pos++;
+        any = true;
+    }
+
+    uint64_t drops = g_dropped.exchange(0, std::memory_order_relaxed);
+    if (drops) {
+        char note[96];
+        int n = snprintf(note, sizeof(note),
+                         "[WARN] log ring overflow: %llu message(s) dropped",
+                         static_cast<unsigned long long>(drops));
+        WriteRecord(note, n > 0 ? static_cast<size_t>(n) : 0);
+        any = true;
+    }
+
+    if (any && g_file) {
+        fflush(g_file);
+    }
+    if (any) {
+        // Visible to the frame-hitch correlator: a flush landing inside a
+        // slow frame window is worth knowing about
+        Events::Record(Events::Kind::LogFlush, "log.flush");
+    }
+    return any;
+}
+
+DWORD WINAPI DrainThread(LPVOID) {
+    // Pin the module: shutdown may be requested from the loader lock,
+    // where nobody can join us — the pin keeps our code mapped until the
+    // final flush below finishes (same pattern as deferred CLR shutdown).
+    HMODULE self = nullptr;
+    GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+                       reinterpret_cast<LPCWSTR>(&DrainThread), &self);
+
+    LoadChannelConfig();
+    AllocateConsole();
+    OpenLogFile();
+
+    while (!g_stop.load(std::memory_order_acquire)) {
+        // Lazy retry in case the console was suppressed at startup and
+        // un-suppression never happens — cheap flag check
+        AllocateConsole();
+
+        if (!DrainOnce()) {
+            g_sleeping.store(true, std::memory_order_relaxed);
+            // Re-check after announcing the park so a producer racing the
+            // flag cannot leave us asleep with a full ring
+            Slot& next = g_slots[g_dequeue_pos & (kSlots - 1)];
+            if (static_cast<int32_t>(next.seq.load(std::memory_order_acquire)
+                                     - (g_dequeue_pos + 1)) < 0) {
+                WaitForSingleObject(g_wake, 100);
+            }
+            g_sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    // Final flush, then release the sinks
+    DrainOnce();
+    if (g_file) {
+        fclose(g_file);
+        g_file = nullptr;
+    }
+    if (g_console) {
+        FreeConsole();
+        g_console = false;
+    }
+
+    if (self) {
+        FreeLibraryAndExitThread(self, 0);
+    }
+    return 0;
+}
+
+void StartBackend() {
+    for (uint32_t i = 0; i < kSlots; i++) {
+        g_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    // The ring is static storage, but it is MDB RSS — account it once so
+    // the memory breakdown adds up
+    Mem::Account(Mem::Tag::LogRing, sizeof(g_slots));
+    g_wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    g_thread = CreateThread(nullptr, 0, DrainThread, nullptr, 0, nullptr);
+}
+
+// Claim a slot (Vyukov bounded-queue push): one fetch-add ticket in the
+// common case, nullptr (drop, counted) when the ring is full. The caller
+// fills the slot and publishes with PublishSlot.
+Slot* ClaimSlot(uint32_t& out_pos) {
+    uint32_t pos = g_enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &g_slots[pos & (kSlots - 1)];
+        uint32_t seq = slot->seq.load(std::memory_order_acquire);
+        int32_t dif = static_cast<int32_t>(seq - pos);
+        if (dif == 0) {
+            if (g_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                    std::memory_order_relaxed)) {
+                out_pos = pos;
+                return slot;
+            }
+        } else if (dif < 0) {
+            g_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            pos = g_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void PublishSlot(Slot* slot, uint32_t pos) {
+    slot->seq.store(pos + 1, std::memory_order_release);
+
+    // Only pay the SetEvent syscall when the drain thread is parked
+    if (g_sleeping.load(std::memory_order_relaxed) && g_wake) {
+        SetEvent(g_wake);
+    }
+}
+
+} // anonymous namespace
+
+// ========== Public API ==========
+
+bool ChannelEnabled(Channel c, Level l) {
+    int idx = static_cast<int>(c);
+    if (idx < 0 || idx >= static_cast<int>(Channel::Count)) {
+        return false;
+    }
+    return static_cast<int>(l)
+        <= g_channel_levels.v[idx].load(std::memory_order_relaxed);
+}
+
+void SetChannelLevel(Channel c, Level l) {
+    int idx = static_cast<int>(c);
+    if (idx < 0 || idx >= static_cast<int>(Channel::Count)) {
+        return;
+    }
+    g_channel_levels.v[idx].store(static_cast<int>(l),
+                                  std::memory_order_relaxed);
+}
+
+bool Enqueue(const char* text, size_t len) {
+    if (!text || g_stop.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    std::call_once(g_start_once, StartBackend);
+
+    uint32_t pos;
+    Slot* slot = ClaimSlot(pos);
+    if (!slot) {
+        return false;
+    }
+
+    if (len > kSlotText) {
+        len = kSlotText;
+    }
+    memcpy(slot->text, text, len);
+    slot->kind = kKindText;
+    slot->len = static_cast<uint16_t>(len);
+    PublishSlot(slot, pos);
+    return true;
+}
+
+bool EnqueueDeferred(const char* format, const Arg* args, unsigned count) {
+    if (!format || g_stop.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    std::call_once(g_start_once, StartBackend);
+
+    uint32_t pos;
+    Slot* slot = ClaimSlot(pos);
+    if (!slot) {
+        return false;
+    }
+
+    DeferredRecord rec;
+    GetSystemTimeAsFileTime(&rec.ft);   // no syscall — reads the shared page
+    rec.format = format;
+    rec.argc = static_cast<uint8_t>(count < kMaxDeferredArgs ? count : kMaxDeferredArgs);
+    for (unsigned i = 0; i < rec.argc; i++) {
+        rec.args[i] = args[i];
+    }
+
+    memcpy(slot->text, &rec, sizeof(rec));
+    slot->kind = kKindDeferred;
+    slot->len = static_cast<uint16_t>(sizeof(rec));
+    PublishSlot(slot, pos);
+    return true;
+}
+
+void SuppressConsole() {
+    g_console_suppressed.store(true, std::memory_order_relaxed);
+}
+
+void RequestShutdown() {
+    g_stop.store(true, std::memory_order_release);
+    if (g_wake) {
+        SetEvent(g_wake);
+    }
+}
+
+void Shutdown(unsigned timeout_ms) {
+    RequestShutdown();
+    if (g_thread) {
+        WaitForSingleObject(g_thread, timeout_ms);
+        CloseHandle(g_thread);
+        g_thread = nullptr;
+    }
+}
+
+} // namespace Log
+} // namespace MDB
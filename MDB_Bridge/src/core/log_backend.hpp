@@ -0,0 +1,139 @@
+// ==============================
+// MDB Bridge - Async Log Backend
+// ==============================
+// MPSC ring-buffer sink behind mdb_log.h. Producers copy one formatted
+// record into a slot (a fetch-add ticket plus a memcpy — no locks, no
+// I/O) and a background drain thread writes file, console and debugger
+// output in batches. Logging from the Present hook or the invoke path
+// no longer stalls on a slow console window.
+//
+// The drain thread pins this module and exits via
+// FreeLibraryAndExitThread, so RequestShutdown() is safe under the
+// loader lock (flag flip only); Shutdown() adds a bounded wait for the
+// final flush where blocking is allowed.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MDB {
+namespace Log {
+
+// ========== Per-Subsystem Channels ==========
+// Each subsystem logs on its own channel with an independent runtime
+// level, so one area can be turned up to verbose without firehosing the
+// rest (which perturbs the very timings being diagnosed). Levels load
+// from <exe_dir>\MDB\log_channels.cfg when the backend starts — lines
+// like "resolver=verbose" or "imgui=off"; "all=<level>" sets every
+// channel. Default is Info.
+
+enum class Channel : int {
+    Core = 0,       // dllmain, CLR hosting, shutdown
+    Scanner,        // metadata/memory scanning
+    Resolver,       // IL2CPP symbol resolution
+    Dumper,         // SDK dumping/codegen
+    Hooks,          // Present/WndProc/MinHook plumbing
+    ImGui,          // overlay integration
+    Build,          // MSBuild trigger / game SDK build
+    Count
+};
+
+enum class Level : int {
+    Off = 0,
+    Error,
+    Warn,
+    Info,
+    Verbose
+};
+
+// Compile-time floor: channel records above this level compile to
+// nothing (the condition sits behind `if constexpr`, so the call and its
+// argument evaluation are elided entirely). Define a lower value on the
+// command line to strip verbose records from a build.
+#ifndef MDB_LOG_COMPILED_LEVEL
+#define MDB_LOG_COMPILED_LEVEL 4    // Level::Verbose
+#endif
+
+constexpr bool CompiledIn(Level l) {
+    return static_cast<int>(l) <= MDB_LOG_COMPILED_LEVEL;
+}
+
+// Runtime gate: true when 'l' is at or below the channel's current
+// level. One relaxed atomic load — cheap enough for per-frame sites.
+bool ChannelEnabled(Channel c, Level l);
+
+// Override a channel's level at runtime (diagnostics/tools).
+void SetChannelLevel(Channel c, Level l);
+
+// Copy one already-formatted record into the ring. Wait-free after the
+// first call (which spins up the drain thread); drops the record and
+// counts the drop when the ring is full. Returns false on drop/shutdown.
+bool Enqueue(const char* text, size_t len);
+
+// ========== Deferred Formatting ==========
+// Hot paths can skip vsnprintf entirely: the call site stores the format
+// pointer plus raw argument bytes (a few ns) and the drain thread formats
+// at write time. The format string and any const char* arguments MUST be
+// string literals or otherwise outlive the drain — the ring stores only
+// the pointers. The in-process format pointer doubles as the message
+// catalog, so no ID registry is needed.
+
+struct Arg {
+    enum class Type : uint8_t { I64, U64, F64, Ptr, Str };
+    Type type;
+    union {
+        int64_t i64;
+        uint64_t u64;
+        double f64;
+        const void* ptr;
+        const char* str;
+    };
+};
+
+constexpr unsigned kMaxDeferredArgs = 8;
+
+// Enqueue a deferred-format record; same drop semantics as Enqueue.
+bool EnqueueDeferred(const char* format, const Arg* args, unsigned count);
+
+namespace detail {
+inline Arg MakeArg(int v)                { Arg a; a.type = Arg::Type::I64; a.i64 = v; return a; }
+inline Arg MakeArg(long v)               { Arg a; a.type = Arg::Type::I64; a.i64 = v; return a; }
+inline Arg MakeArg(long long v)          { Arg a; a.type = Arg::Type::I64; a.i64 = v; return a; }
+inline Arg MakeArg(unsigned v)           { Arg a; a.type = Arg::Type::U64; a.u64 = v; return a; }
+inline Arg MakeArg(unsigned long v)      { Arg a; a.type = Arg::Type::U64; a.u64 = v; return a; }
+inline Arg MakeArg(unsigned long long v) { Arg a; a.type = Arg::Type::U64; a.u64 = v; return a; }
+inline Arg MakeArg(float v)              { Arg a; a.type = Arg::Type::F64; a.f64 = v; return a; }
+inline Arg MakeArg(double v)             { Arg a; a.type = Arg::Type::F64; a.f64 = v; return a; }
+inline Arg MakeArg(const char* v)        { Arg a; a.type = Arg::Type::Str; a.str = v; return a; }
+inline Arg MakeArg(const void* v)        { Arg a; a.type = Arg::Type::Ptr; a.ptr = v; return a; }
+inline Arg MakeArg(void* v)              { Arg a; a.type = Arg::Type::Ptr; a.ptr = v; return a; }
+inline Arg MakeArg(bool v)               { Arg a; a.type = Arg::Type::I64; a.i64 = v ? 1 : 0; return a; }
+} // namespace detail
+
+inline bool Fast(const char* format) {
+    return EnqueueDeferred(format, nullptr, 0);
+}
+
+template <typename... Ts>
+bool Fast(const char* format, Ts... vals) {
+    static_assert(sizeof...(Ts) <= kMaxDeferredArgs,
+                  "too many arguments for a deferred log record");
+    Arg args[] = { detail::MakeArg(vals)... };
+    return EnqueueDeferred(format, args, static_cast<unsigned>(sizeof...(Ts)));
+}
+
+// Stop the console from being (re)allocated. Does not free an existing
+// console — that happens on drain-thread shutdown.
+void SuppressConsole();
+
+// Flag the drain thread to flush, close the file, free the console and
+// exit. Never blocks — safe under the loader lock.
+void RequestShutdown();
+
+// RequestShutdown plus a bounded wait for the drain thread to finish
+// its final flush. Only call where blocking is allowed.
+void Shutdown(unsigned timeout_ms);
+
+} // namespace Log
+} // namespace MDB
@@ -4,16 +4,20 @@
 // Provides LOG_INFO, LOG_WARN, LOG_ERROR (always on) and
 // LOG_DEBUG, LOG_TRACE (debug builds only) across all translation units.
 //
-// Implementation: header-only with inline statics. The first call to
-// mdb_log_message() opens the log file and allocates a console window.
+// Implementation: the call site formats the record into a stack buffer
+// and hands it to the async backend (log_backend.cpp) — an MPSC ring
+// drained by a background thread. No file, console or debugger I/O ever
+// runs on the caller's thread.
 
 #pragma once
 
+#include "log_backend.hpp"
+
 #include <Windows.h>
+#include <atomic>
 #include <cstdio>
 #include <cstdarg>
 #include <cstring>
-#include <filesystem>
 
 // ========== Debug/Release Logging Macros ==========
 
@@ -29,6 +33,17 @@
 #define LOG_WARN(fmt, ...)  mdb_log_message("[WARN] " fmt, ##__VA_ARGS__)
 #define LOG_INFO(fmt, ...)  mdb_log_message("[INFO] " fmt, ##__VA_ARGS__)
 
+// ========== Deferred-Format Logging (hot paths) ==========
+// These skip the call-site vsnprintf: only the format pointer and raw
+// argument bytes enter the ring (a few ns per record); the drain thread
+// formats at write time. Restrictions: the format and every const char*
+// argument must be string literals (the ring stores pointers, not
+// copies), and standard %d/%u/%x/%f/%s/%p specs only.
+
+#define LOG_FAST(fmt, ...)       MDB::Log::Fast("[INFO] " fmt, ##__VA_ARGS__)
+#define LOG_FAST_WARN(fmt, ...)  MDB::Log::Fast("[WARN] " fmt, ##__VA_ARGS__)
+#define LOG_FAST_ERROR(fmt, ...) MDB::Log::Fast("[ERROR] " fmt, ##__VA_ARGS__)
+
 // ========== Runtime Verbose Logging Toggle ==========
 // Set g_verbose_logging = true in code to enable detailed diagnostic output.
 // Disabled by default to keep logs clean in production.
@@ -54,112 +69,130 @@ inline bool mdb_get_verbose_logging() {
 #define LOG_VERBOSE(fmt, ...) \
     do { if (mdb_log_detail::verbose_logging()) mdb_log_message("[INFO] " fmt, ##__VA_ARGS__); } while(0)
 
-// ========== Implementation ==========
+// ========== Per-Subsystem Channel Logging ==========
+// LOG_CHAN_*(channel, ...) gates on that channel's runtime level instead
+// of the global verbose toggle, so one subsystem can be turned up to
+// verbose in <exe_dir>\MDB\log_channels.cfg ("resolver=verbose",
+// "imgui=off", "all=warn") without firehosing the rest. The channel name
+// is bare (Core, Scanner, Resolver, Dumper, Hooks, ImGui, Build) and is
+// stamped into the record. Records above MDB_LOG_COMPILED_LEVEL sit
+// behind `if constexpr` and compile to nothing — arguments included.
+//
+// LOG_CHAN_VERBOSE additionally honors the legacy global verbose toggle
+// so migrated LOG_VERBOSE sites keep responding to it.
+
+#define MDB_LOG_CHAN_IMPL(ch, lvl, prefix, fmt, ...)                          \
+    do {                                                                      \
+        if constexpr (MDB::Log::CompiledIn(MDB::Log::Level::lvl)) {           \
+            if (MDB::Log::ChannelEnabled(MDB::Log::Channel::ch,               \
+                                         MDB::Log::Level::lvl))               \
+                mdb_log_message(prefix " [" #ch "] " fmt, ##__VA_ARGS__);     \
+        }                                                                     \
+    } while (0)
+
+#define LOG_CHAN_ERROR(ch, fmt, ...) MDB_LOG_CHAN_IMPL(ch, Error, "[ERROR]", fmt, ##__VA_ARGS__)
+#define LOG_CHAN_WARN(ch, fmt, ...)  MDB_LOG_CHAN_IMPL(ch, Warn,  "[WARN]",  fmt, ##__VA_ARGS__)
+#define LOG_CHAN_INFO(ch, fmt, ...)  MDB_LOG_CHAN_IMPL(ch, Info,  "[INFO]",  fmt, ##__VA_ARGS__)
+
+#define LOG_CHAN_VERBOSE(ch, fmt, ...)                                        \
+    do {                                                                      \
+        if constexpr (MDB::Log::CompiledIn(MDB::Log::Level::Verbose)) {       \
+            if (MDB::Log::ChannelEnabled(MDB::Log::Channel::ch,               \
+                                         MDB::Log::Level::Verbose)            \
+                || mdb_log_detail::verbose_logging())                         \
+                mdb_log_message("[INFO] [" #ch "] " fmt, ##__VA_ARGS__);      \
+        }                                                                     \
+    } while (0)
+
+// ========== Rate-Limited / Sampled Logging (per-frame sites) ==========
+// Safe to leave in frame-critical code permanently: each macro site owns
+// its own atomic state, the fast (suppressed) path is one or two relaxed
+// atomic ops with no formatting, and suppressed records are summarized
+// on the next record that does get through rather than silently lost.
+//
+// LOG_RATELIMIT(hz, ...)       at most 'hz' records per second from this site
+// LOG_RATELIMIT_WARN(hz, ...)  same, at [WARN] level
+// LOG_SAMPLED(n, ...)          every n-th hit of this site (1st, n+1th, ...)
 
 namespace mdb_log_detail {
 
-inline FILE*& log_file() { static FILE* f = nullptr; return f; }
-inline bool& console_allocated() { static bool v = false; return v; }
-// Once set, allocate_console() becomes a no-op — prevents the console
-// from being re-created after it has been intentionally freed.
-inline bool& console_suppressed() { static bool v = false; return v; }
-
-inline void allocate_console() {
-    if (console_suppressed() || console_allocated()) return;
-
-    if (AllocConsole()) {
-        FILE* fp;
-        freopen_s(&fp, "CONOUT$", "w", stdout);
-        freopen_s(&fp, "CONOUT$", "w", stderr);
-        freopen_s(&fp, "CONIN$", "r", stdin);
-
-        SetConsoleTitleA("MDB Framework Console");
-
-        // Prevent the console's close button from killing the process
-        // or blocking shutdown.  Disable the X button entirely.
-        HWND hConsole = GetConsoleWindow();
-        if (hConsole) {
-            HMENU hMenu = GetSystemMenu(hConsole, FALSE);
-            if (hMenu) DeleteMenu(hMenu, SC_CLOSE, MF_BYCOMMAND);
+struct RateLimiter {
+    std::atomic<long long> next_ms{ 0 };            // GetTickCount64 deadline
+    std::atomic<unsigned long long> suppressed{ 0 };
+
+    // True when this record may be written; *out_suppressed receives the
+    // number of records dropped since the last one that got through.
+    bool Allow(unsigned hz, unsigned long long* out_suppressed) {
+        long long now = static_cast<long long>(GetTickCount64());
+        long long next = next_ms.load(std::memory_order_relaxed);
+        long long interval = 1000 / (hz ? hz : 1);
+        if (now < next ||
+            !next_ms.compare_exchange_strong(next, now + interval,
+                                             std::memory_order_relaxed)) {
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
         }
-
-        // Install a handler so CTRL_CLOSE_EVENT (console being
-        // destroyed during process exit) doesn't block.
-        SetConsoleCtrlHandler([](DWORD event) -> BOOL {
-            // Accept all close/shutdown events — prevents conhost from
-            // blocking ExitProcess.
-            return TRUE;
-        }, TRUE);
-
-        HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-        // Header in purple/magenta
-        SetConsoleTextAttribute(hOut, FOREGROUND_RED | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-        printf("=== MDB Framework Console ===\n\n");
-        // Reset to default gray
-        SetConsoleTextAttribute(hOut, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
-
-        console_allocated() = true;
+        *out_suppressed = suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
     }
-}
+};
 
 } // namespace mdb_log_detail
 
-inline void mdb_log_message(const char* format, ...) {
-    mdb_log_detail::allocate_console();
-
-    if (!mdb_log_detail::log_file()) {
-        char path[MAX_PATH];
-        GetModuleFileNameA(nullptr, path, MAX_PATH);
-        std::filesystem::path exe_path(path);
-        auto log_path = exe_path.parent_path() / "MDB" / "Logs" / "MDB.log";
-        std::filesystem::create_directories(log_path.parent_path());
-        mdb_log_detail::log_file() = fopen(log_path.string().c_str(), "a");
-    }
+#define MDB_LOG_RATELIMIT_IMPL(hz, prefix, fmt, ...)                          \
+    do {                                                                      \
+        static mdb_log_detail::RateLimiter mdb_rl_site;                       \
+        unsigned long long mdb_rl_suppressed = 0;                             \
+        if (mdb_rl_site.Allow((hz), &mdb_rl_suppressed)) {                    \
+            if (mdb_rl_suppressed)                                            \
+                mdb_log_message(prefix " " fmt " (+%llu suppressed)",         \
+                                ##__VA_ARGS__, mdb_rl_suppressed);            \
+            else                                                              \
+                mdb_log_message(prefix " " fmt, ##__VA_ARGS__);               \
+        }                                                                     \
+    } while (0)
+
+#define LOG_RATELIMIT(hz, fmt, ...)      MDB_LOG_RATELIMIT_IMPL(hz, "[INFO]", fmt, ##__VA_ARGS__)
+#define LOG_RATELIMIT_WARN(hz, fmt, ...) MDB_LOG_RATELIMIT_IMPL(hz, "[WARN]", fmt, ##__VA_ARGS__)
+
+#define LOG_SAMPLED(n, fmt, ...)                                              \
+    do {                                                                      \
+        static std::atomic<unsigned long long> mdb_smp_count{ 0 };            \
+        unsigned long long mdb_smp_c =                                        \
+            mdb_smp_count.fetch_add(1, std::memory_order_relaxed);            \
+        if (mdb_smp_c % ((n) ? (n) : 1) == 0)                                 \
+            mdb_log_message("[INFO] " fmt " (hit %llu, logging 1/%u)",        \
+                            ##__VA_ARGS__, mdb_smp_c + 1,                     \
+                            static_cast<unsigned>(n));                        \
+    } while (0)
 
-    va_list args;
-    va_start(args, format);
+// ========== Implementation ==========
+
+inline void mdb_log_message(const char* format, ...) {
+    char buffer[512];
 
     // Timestamp
     SYSTEMTIME st;
     GetLocalTime(&st);
-    char timestamp[32];
-    snprintf(timestamp, sizeof(timestamp), "[%02d:%02d:%02d.%03d] ",
-             st.wHour, st.wMinute, st.wSecond, st.wMilliseconds);
-
-    // Log to file
-    if (mdb_log_detail::log_file()) {
-        va_list file_args;
-        va_copy(file_args, args);
-        fprintf(mdb_log_detail::log_file(), "%s", timestamp);
-        vfprintf(mdb_log_detail::log_file(), format, file_args);
-        fprintf(mdb_log_detail::log_file(), "\n");
-        fflush(mdb_log_detail::log_file());
-        va_end(file_args);
+    int n = snprintf(buffer, sizeof(buffer), "[%02d:%02d:%02d.%03d] ",
+                     st.wHour, st.wMinute, st.wSecond, st.wMilliseconds);
+    if (n < 0) {
+        n = 0;
     }
 
-    // Also print to console if available
-    if (mdb_log_detail::console_allocated()) {
-        HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-
-        // Set color based on log level
-        if (strstr(format, "[ERROR]")) {
-            SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_INTENSITY);
-        } else if (strstr(format, "[WARN]")) {
-            SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY);
-        } else {
-            SetConsoleTextAttribute(hConsole, FOREGROUND_BLUE | FOREGROUND_INTENSITY);
-        }
-
-        va_list con_args;
-        va_copy(con_args, args);
-        printf("%s", timestamp);
-        vprintf(format, con_args);
-        printf("\n");
-        va_end(con_args);
+    va_list args;
+    va_start(args, format);
+    int m = vsnprintf(buffer + n, sizeof(buffer) - n, format, args);
+    va_end(args);
 
-        // Reset to default gray
-        SetConsoleTextAttribute(hConsole, FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+    size_t len;
+    if (m < 0) {
+        len = static_cast<size_t>(n);
+    } else if (static_cast<size_t>(n + m) >= sizeof(buffer)) {
+        len = sizeof(buffer) - 1;   // truncated
+    } else {
+        len = static_cast<size_t>(n + m);
     }
 
-    va_end(args);
+    MDB::Log::Enqueue(buffer, len);
 }
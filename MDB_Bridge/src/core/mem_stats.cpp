@@ -0,0 +1,105 @@
+#include "mem_stats.hpp"
+#include "mdb_log.h"
+
+#include <atomic>
+#include <cstdio>
+
+namespace MDB {
+namespace Mem {
+
+namespace {
+    struct TagCounters {
+        std::atomic<uint64_t> live{ 0 };
+        std::atomic<uint64_t> peak{ 0 };
+        std::atomic<uint64_t> allocs{ 0 };
+    };
+}
+
+static TagCounters g_counters[static_cast<int>(Tag::Count)];
+
+static const char* const kTagNames[static_cast<int>(Tag::Count)] = {
+    "dump_arena",
+    "name_cache",
+    "metadata_cache",
+    "snapshot",
+    "hook_table",
+    "log_ring",
+};
+
+const char* TagName(Tag tag) {
+    int index = static_cast<int>(tag);
+    if (index < 0 || index >= static_cast<int>(Tag::Count)) {
+        return "unknown";
+    }
+    return kTagNames[index];
+}
+
+void Account(Tag tag, size_t bytes) {
+    int index = static_cast<int>(tag);
+    if (index < 0 || index >= static_cast<int>(Tag::Count)) {
+        return;
+    }
+
+    TagCounters& counters = g_counters[index];
+    counters.allocs.fetch_add(1, std::memory_order_relaxed);
+    uint64_t live = counters.live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    // Peak is a relaxed CAS max — an interleaving can under-report by one
+    // allocation's worth, which is fine for a high-water mark
+    uint64_t peak = counters.peak.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !counters.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void Release(Tag tag, size_t bytes) {
+    int index = static_cast<int>(tag);
+    if (index < 0 || index >= static_cast<int>(Tag::Count)) {
+        return;
+    }
+    g_counters[index].live.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+TagStats Get(Tag tag) {
+    TagStats stats{ 0, 0, 0 };
+    int index = static_cast<int>(tag);
+    if (index < 0 || index >= static_cast<int>(Tag::Count)) {
+        return stats;
+    }
+
+    const TagCounters& counters = g_counters[index];
+    stats.live_bytes = counters.live.load(std::memory_order_relaxed);
+    stats.peak_bytes = counters.peak.load(std::memory_order_relaxed);
+    stats.alloc_count = counters.allocs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void LogSummary(const char* phase) {
+    // One line, non-zero tags only: "[mem] dump: dump_arena 12.4/13.1 MB ..."
+    char line[384];
+    int n = snprintf(line, sizeof(line), "[mem] %s:", phase ? phase : "?");
+    bool any = false;
+
+    for (int i = 0; i < static_cast<int>(Tag::Count); ++i) {
+        TagStats stats = Get(static_cast<Tag>(i));
+        if (stats.peak_bytes == 0) {
+            continue;
+        }
+        any = true;
+        int written = snprintf(line + n, sizeof(line) - n, " %s %.1f/%.1f MB",
+                               kTagNames[i],
+                               stats.live_bytes / (1024.0 * 1024.0),
+                               stats.peak_bytes / (1024.0 * 1024.0));
+        if (written < 0 || n + written >= static_cast<int>(sizeof(line))) {
+            break;
+        }
+        n += written;
+    }
+
+    if (any) {
+        LOG_CHAN_INFO(Core, "%s (live/peak)", line);
+    }
+}
+
+} // namespace Mem
+} // namespace MDB
@@ -0,0 +1,57 @@
+#pragma once
+// ============================================================================
+// Per-Subsystem Memory Accounting for MDB Bridge
+// ============================================================================
+// Users report MDB adding hundreds of MB of RSS to games, and without
+// attribution we cannot tell the dump arena from the name caches from the
+// log ring. Each subsystem that owns a sizeable allocation tags it here —
+// Account() when memory is obtained, Release() when it is returned — and
+// the per-tag counters (bytes live, peak bytes, allocation count) are
+// readable via mdb_get_memory_stats and summarized into the log at phase
+// boundaries.
+//
+// This is attribution, not a heap hook: only the call sites that tag their
+// allocations are counted, and some figures are deliberate approximations
+// (node-based caches charge an estimated per-entry overhead). The value is
+// the breakdown and the trend — and a measurable success criterion for
+// arena/pool work.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MDB {
+namespace Mem {
+
+enum class Tag : int {
+    DumpArena = 0,    // DumpStringArena blocks (per-run interned strings)
+    NameCache,        // dumper name-resolution caches (approximate)
+    MetadataCache,    // metadata.mdbc mapped view
+    Snapshot,         // .mdbs replay graph (dump_snapshot)
+    HookTable,        // hook slot table (fixed, counted once)
+    LogRing,          // async log ring slots (fixed, counted once)
+    Count
+};
+
+struct TagStats {
+    uint64_t live_bytes;    // currently accounted
+    uint64_t peak_bytes;    // high-water mark of live_bytes
+    uint64_t alloc_count;   // Account() calls since process start
+};
+
+// Short stable name for a tag ("dump_arena", "name_cache", ...)
+const char* TagName(Tag tag);
+
+// Record `bytes` obtained / returned under `tag`. Both are a handful of
+// relaxed atomic ops — fine for per-block call sites, do not put them on
+// per-byte ones.
+void Account(Tag tag, size_t bytes);
+void Release(Tag tag, size_t bytes);
+
+TagStats Get(Tag tag);
+
+// Write one compact "[mem]" summary line for the non-zero tags, labeled
+// with `phase` ("dump", "startup", ...). Called at phase boundaries.
+void LogSummary(const char* phase);
+
+} // namespace Mem
+} // namespace MDB
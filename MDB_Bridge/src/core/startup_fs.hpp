@@ -0,0 +1,50 @@
+#pragma once
+// ============================================================================
+// Startup Filesystem Manifest
+// ============================================================================
+// Startup probes the same directory trees over and over: existence checks in
+// dllmain and the build trigger, the dump/wrapper freshness comparisons, the
+// mapping sidecar discovery. Each probe is an individual stat call, and on a
+// network-share install those cost milliseconds apiece — well over a hundred
+// per launch. Prime() replaces them with one recursive FindFirstFileEx scan
+// per root: directory enumeration returns size and timestamps in bulk, and
+// every later query under a primed root is a hash lookup.
+//
+// The manifest is an accelerator, not an authority: a path that is not in it
+// falls back to the real filesystem, so a file created after the scan (the
+// built SDK DLL, a fresh dump) is still found. Positive entries can go stale
+// if the tree is mutated mid-startup — call Reset() after the dump or build
+// rewrites files whose timestamps matter.
+
+#include <cstdint>
+#include <string>
+
+namespace MDB {
+namespace StartupFs {
+
+// Recursively scan root into the manifest. Safe to call for several roots;
+// rescanning a root replaces its entries.
+void Prime(const std::wstring& root);
+
+// Does the path exist? Manifest hit under a primed root, real filesystem
+// otherwise.
+bool Exists(const std::wstring& path);
+bool Exists(const std::string& path);
+
+// Last write time as FILETIME ticks (100ns units since 1601), 0 when the
+// file does not exist.
+int64_t WriteTime(const std::wstring& path);
+int64_t WriteTime(const std::string& path);
+
+// Oldest write time among direct children of dir with the given extension
+// (compare ordinal, lowercase, e.g. L".cs"); 0 when there are none. Served
+// from the manifest when dir was scanned, one directory enumeration
+// otherwise.
+int64_t OldestWriteTimeWithExtension(const std::wstring& dir, const std::wstring& extension);
+
+// Drop all manifest entries. Queries fall back to the real filesystem until
+// the next Prime().
+void Reset();
+
+} // namespace StartupFs
+} // namespace MDB
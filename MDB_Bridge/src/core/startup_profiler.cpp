@@ -0,0 +1,282 @@
+#include "startup_profiler.hpp"
+#include "config.hpp"
+
+#include <Windows.h>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#pragma comment(lib, "winmm.lib")   // timeBeginPeriod for the ~1 kHz tick
+
+namespace MDB {
+namespace Profiler {
+
+// ============================================================================
+// Thread Registry
+// ============================================================================
+// Startup threads register themselves; the sampler iterates the registry.
+// Handles are duplicated so a registered thread's handle stays valid for
+// the sampler until the thread unregisters (which closes it). The registry
+// mutex is held for the whole sampling pass — registration is rare, so the
+// sampler never races a thread closing its own handle.
+
+namespace {
+    struct RegisteredThread {
+        HANDLE handle;      // duplicated, THREAD_SUSPEND_RESUME | GET_CONTEXT
+        DWORD tid;
+        const char* name;
+    };
+}
+
+static std::mutex g_registry_mutex;
+static std::vector<RegisteredThread> g_registry;
+
+void RegisterCurrentThread(const char* name) {
+    HANDLE dup = nullptr;
+    if (!DuplicateHandle(GetCurrentProcess(), GetCurrentThread(),
+                         GetCurrentProcess(), &dup,
+                         THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION,
+                         FALSE, 0)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    g_registry.push_back({ dup, GetCurrentThreadId(), name });
+}
+
+void UnregisterCurrentThread() {
+    DWORD tid = GetCurrentThreadId();
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    for (size_t i = 0; i < g_registry.size(); ++i) {
+        if (g_registry[i].tid == tid) {
+            CloseHandle(g_registry[i].handle);
+            g_registry.erase(g_registry.begin() + i);
+            return;
+        }
+    }
+}
+
+// ============================================================================
+// Stack Capture
+// ============================================================================
+// Suspend the target, snapshot its context, then walk with
+// RtlLookupFunctionEntry + RtlVirtualUnwind (x64 has no frame-pointer
+// chain to follow). Between SuspendThread and ResumeThread the sampler
+// calls only Rtl* and reads stack memory — no allocation, no CRT locks —
+// so it cannot deadlock against a suspended thread holding the heap lock.
+// A thread suspended mid-prologue can yield a context the unwinder
+// faults on; the walk is SEH-guarded and keeps whatever frames it got.
+
+static constexpr int kMaxFrames = 64;
+
+static int walk_stack(CONTEXT* ctx, void** frames, int max_frames) {
+    int count = 0;
+    __try {
+        while (count < max_frames && ctx->Rip != 0) {
+            frames[count++] = reinterpret_cast<void*>(ctx->Rip);
+
+            DWORD64 image_base = 0;
+            PRUNTIME_FUNCTION entry = RtlLookupFunctionEntry(ctx->Rip, &image_base, nullptr);
+            if (!entry) {
+                // Leaf function: the return address sits at Rsp
+                ctx->Rip = *reinterpret_cast<DWORD64*>(ctx->Rsp);
+                ctx->Rsp += 8;
+            } else {
+                PVOID handler_data = nullptr;
+                DWORD64 establisher = 0;
+                RtlVirtualUnwind(UNW_FLAG_NHANDLER, image_base, ctx->Rip, entry,
+                                 ctx, &handler_data, &establisher, nullptr);
+            }
+        }
+    } __except (EXCEPTION_EXECUTE_HANDLER) {
+        // Partial stack — still a valid sample
+    }
+    return count;
+}
+
+static int capture_thread_stack(HANDLE thread, void** frames, int max_frames) {
+    if (SuspendThread(thread) == static_cast<DWORD>(-1)) {
+        return 0;
+    }
+
+    int count = 0;
+    CONTEXT ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.ContextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER;
+    if (GetThreadContext(thread, &ctx)) {
+        count = walk_stack(&ctx, frames, max_frames);
+    }
+
+    ResumeThread(thread);
+    return count;
+}
+
+// ============================================================================
+// Sampler Thread & Aggregation
+// ============================================================================
+// Samples aggregate into a count per unique (thread name, stack) pair.
+// A full startup produces a few hundred unique stacks; the cap below is
+// pure paranoia against a pathological unwind.
+
+namespace {
+    struct StackKey {
+        const char* thread_name;
+        std::vector<void*> frames;  // leaf first, as captured
+
+        bool operator<(const StackKey& other) const {
+            if (thread_name != other.thread_name) return thread_name < other.thread_name;
+            return frames < other.frames;
+        }
+    };
+}
+
+static constexpr size_t kMaxUniqueStacks = 8192;
+
+static std::mutex g_samples_mutex;
+static std::map<StackKey, uint64_t> g_samples;
+
+static std::thread g_sampler;
+static std::atomic<bool> g_running{ false };
+static bool g_started = false;
+
+static void sampler_main() {
+    // 1 ms ticks need the 1 ms timer resolution; restored on exit
+    timeBeginPeriod(1);
+
+    void* frames[kMaxFrames];
+    while (g_running.load(std::memory_order_acquire)) {
+        {
+            std::lock_guard<std::mutex> lock(g_registry_mutex);
+            for (const RegisteredThread& thread : g_registry) {
+                int count = capture_thread_stack(thread.handle, frames, kMaxFrames);
+                if (count == 0) {
+                    continue;
+                }
+
+                StackKey key;
+                key.thread_name = thread.name;
+                key.frames.assign(frames, frames + count);
+
+                std::lock_guard<std::mutex> samples_lock(g_samples_mutex);
+                auto it = g_samples.find(key);
+                if (it != g_samples.end()) {
+                    it->second++;
+                } else if (g_samples.size() < kMaxUniqueStacks) {
+                    g_samples.emplace(std::move(key), 1);
+                }
+            }
+        }
+        Sleep(1);
+    }
+
+    timeEndPeriod(1);
+}
+
+// ============================================================================
+// Symbolization & Output
+// ============================================================================
+
+// Render a frame as module+offset ("GameAssembly.dll+0x1a2b30"); PDB-less
+// output that flamegraph tooling can resolve offline. Cached per address —
+// a profile has thousands of samples but few distinct frames.
+static std::string frame_to_string(void* address,
+                                   std::unordered_map<void*, std::string>& cache) {
+    auto it = cache.find(address);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    char buffer[MAX_PATH + 32];
+    HMODULE module = nullptr;
+    if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                           GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           reinterpret_cast<LPCWSTR>(address), &module) && module) {
+        wchar_t path[MAX_PATH] = L"";
+        GetModuleFileNameW(module, path, MAX_PATH);
+        const wchar_t* base_name = path;
+        for (const wchar_t* p = path; *p; ++p) {
+            if (*p == L'\\' || *p == L'/') base_name = p + 1;
+        }
+        snprintf(buffer, sizeof(buffer), "%ls+0x%llx", base_name,
+                 static_cast<unsigned long long>(
+                     reinterpret_cast<uintptr_t>(address) - reinterpret_cast<uintptr_t>(module)));
+    } else {
+        snprintf(buffer, sizeof(buffer), "0x%llx",
+                 static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(address)));
+    }
+
+    cache.emplace(address, buffer);
+    return cache[address];
+}
+
+void Start() {
+    if (g_started) {
+        return;
+    }
+    if (!std::getenv("MDB_PROFILE_STARTUP") && !Config::Get().startup_profiler) {
+        return;
+    }
+
+    g_started = true;
+    g_running.store(true, std::memory_order_release);
+    g_sampler = std::thread(sampler_main);
+}
+
+bool StopAndWrite(const std::string& output_dir) {
+    if (!g_started) {
+        return false;
+    }
+    g_started = false;
+
+    g_running.store(false, std::memory_order_release);
+    if (g_sampler.joinable()) {
+        g_sampler.join();
+    }
+
+    std::map<StackKey, uint64_t> samples;
+    {
+        std::lock_guard<std::mutex> lock(g_samples_mutex);
+        samples.swap(g_samples);
+    }
+    if (samples.empty()) {
+        return false;
+    }
+
+    // One artifact per launch: startup_profile_YYYYMMDD_HHMMSS.collapsed
+    time_t now = time(nullptr);
+    char filename[64];
+    strftime(filename, sizeof(filename), "startup_profile_%Y%m%d_%H%M%S.collapsed",
+             localtime(&now));
+    std::string path = output_dir + "\\" + filename;
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    // Collapsed format: root-first frames joined by ';', then the count.
+    // The thread name leads as a synthetic root so per-thread flamegraphs
+    // separate cleanly.
+    std::unordered_map<void*, std::string> frame_cache;
+    for (const auto& entry : samples) {
+        fprintf(file, "%s", entry.first.thread_name);
+        for (size_t i = entry.first.frames.size(); i > 0; --i) {
+            fprintf(file, ";%s", frame_to_string(entry.first.frames[i - 1], frame_cache).c_str());
+        }
+        fprintf(file, " %llu\n", static_cast<unsigned long long>(entry.second));
+    }
+    fclose(file);
+    return true;
+}
+
+} // namespace Profiler
+} // namespace MDB
@@ -0,0 +1,56 @@
+#pragma once
+// ============================================================================
+// Startup Sampling Profiler for MDB Bridge
+// ============================================================================
+// The startup timeline (startup_trace.hpp) says WHICH phase is slow; this
+// module says WHERE inside it the time goes. A sampler thread walks the
+// registered startup threads' stacks at ~1 kHz while the first-launch
+// pipeline runs (scan + dump + detect + build) and writes a collapsed-stack
+// file into MDB\Logs\ — feed it to flamegraph.pl or speedscope.app for the
+// hot-path picture of a game we have never seen, from a single launch.
+//
+// Frames are written as module+offset (MDB_Bridge.dll+0x1a2b3); resolve
+// against the matching PDB offline. Sampling is opt-in: Start() is a no-op
+// unless the MDB_PROFILE_STARTUP environment variable is set, because
+// suspend-and-walk sampling is a diagnostic tool, not something every
+// launch should pay for.
+//
+// Usage:
+//   MDB::Profiler::Start();                       // gated on MDB_PROFILE_STARTUP
+//   MDB::Profiler::ScopedThreadRegistration reg("init");
+//   ...                                           // startup pipeline
+//   MDB::Profiler::StopAndWrite(logs_dir);        // once, when startup settles
+
+#include <string>
+
+namespace MDB {
+namespace Profiler {
+
+// Make the current thread visible to the sampler under `name` (a string
+// literal, stored by pointer). Registration is cheap and always recorded,
+// so threads that start before Start() is called are still covered.
+void RegisterCurrentThread(const char* name);
+void UnregisterCurrentThread();
+
+// RAII registration covering the enclosing scope (thread entry functions)
+class ScopedThreadRegistration {
+public:
+    explicit ScopedThreadRegistration(const char* name) { RegisterCurrentThread(name); }
+    ~ScopedThreadRegistration() { UnregisterCurrentThread(); }
+
+    ScopedThreadRegistration(const ScopedThreadRegistration&) = delete;
+    ScopedThreadRegistration& operator=(const ScopedThreadRegistration&) = delete;
+};
+
+// Begin sampling the registered threads at ~1 kHz. No-op unless the
+// MDB_PROFILE_STARTUP environment variable is set, or if already started.
+void Start();
+
+// Stop the sampler and write the aggregated stacks as a collapsed-stack
+// file (one "thread;frame;...;frame count" line per unique stack) into
+// output_dir. Returns false when sampling was never active or collected
+// nothing.
+bool StopAndWrite(const std::string& output_dir);
+
+} // namespace Profiler
+} // namespace MDB
@@ -0,0 +1,121 @@
+#include "startup_trace.hpp"
+#include "etw_provider.hpp"
+#include "event_ring.hpp"
+
+#include <Windows.h>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+namespace MDB {
+namespace Trace {
+
+namespace {
+    struct TraceEvent {
+        const char* name;
+        DWORD tid;
+        int64_t start_qpc;
+        int64_t end_qpc;
+    };
+}
+
+static std::mutex g_mutex;
+static std::vector<TraceEvent> g_events;
+
+// Spans past this cap are dropped; a full startup records a few dozen
+static constexpr size_t kMaxEvents = 1024;
+
+static int64_t QpcNow() {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+SpanToken BeginSpan(const char* name) {
+    return { name, QpcNow() };
+}
+
+void EndSpan(const SpanToken& token) {
+    int64_t end = QpcNow();
+
+    static LARGE_INTEGER freq = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return f;
+    }();
+    double ms = (end - token.start_qpc) * 1000.0 / static_cast<double>(freq.QuadPart);
+
+    // Mirror every span into the ETW provider so WPA traces line bridge
+    // phases up against the game timeline; one mask check when idle
+    if (Etw::Enabled()) {
+        Etw::Span(token.name, ms);
+    }
+
+    // And into the activity ring, so a span finishing inside a slow frame
+    // shows up in the hitch correlation record
+    Events::Record(Events::Kind::Span, token.name, static_cast<float>(ms));
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (g_events.size() >= kMaxEvents) {
+        return;
+    }
+    g_events.push_back({ token.name, GetCurrentThreadId(), token.start_qpc, end });
+}
+
+bool WriteTimeline(const std::string& output_dir) {
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        events.swap(g_events);
+    }
+    if (events.empty()) {
+        return false;
+    }
+
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    double us_per_tick = 1000000.0 / static_cast<double>(freq.QuadPart);
+
+    // Timestamps are relative to the earliest recorded span so the timeline
+    // starts at zero regardless of when QPC began counting
+    int64_t origin = events[0].start_qpc;
+    for (const auto& event : events) {
+        if (event.start_qpc < origin) origin = event.start_qpc;
+    }
+
+    // One artifact per launch: startup_trace_YYYYMMDD_HHMMSS.json
+    time_t now = time(nullptr);
+    char filename[64];
+    strftime(filename, sizeof(filename), "startup_trace_%Y%m%d_%H%M%S.json",
+             localtime(&now));
+    std::string path = output_dir + "\\" + filename;
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+
+    DWORD pid = GetCurrentProcessId();
+
+    // Complete events ("ph":"X") — one object per span, ts/dur in microseconds
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        double ts = static_cast<double>(event.start_qpc - origin) * us_per_tick;
+        double dur = static_cast<double>(event.end_qpc - event.start_qpc) * us_per_tick;
+        fprintf(file,
+                "  {\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\","
+                "\"ts\":%.1f,\"dur\":%.1f,\"pid\":%lu,\"tid\":%lu}%s\n",
+                event.name, ts, dur,
+                static_cast<unsigned long>(pid),
+                static_cast<unsigned long>(event.tid),
+                i + 1 < events.size() ? "," : "");
+    }
+    fprintf(file, "]}\n");
+    fclose(file);
+    return true;
+}
+
+} // namespace Trace
+} // namespace MDB
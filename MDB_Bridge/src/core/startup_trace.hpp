@@ -0,0 +1,54 @@
+#pragma once
+// ============================================================================
+// Startup Timeline Tracing for MDB Bridge
+// ============================================================================
+// QueryPerformanceCounter spans across the startup path, written once per
+// launch as a chrome://tracing JSON timeline into MDB\Logs\. Open the file
+// at chrome://tracing (or ui.perfetto.dev) to see exactly where injection
+// time goes — the artifact is what users should attach to "injection takes
+// too long" reports.
+//
+// Usage:
+//   { MDB::Trace::ScopedSpan span("startup.mdb_init"); ... }
+//
+//   auto token = MDB::Trace::BeginSpan("dump.collect");
+//   ...
+//   MDB::Trace::EndSpan(token);
+//
+//   MDB::Trace::WriteTimeline(logs_dir);    // once, when startup settles
+
+#include <cstdint>
+#include <string>
+
+namespace MDB {
+namespace Trace {
+
+// Open span handle — BeginSpan costs one QPC read; nothing is recorded
+// until EndSpan. The name must be a string literal (stored by pointer).
+struct SpanToken {
+    const char* name;
+    int64_t start_qpc;
+};
+
+SpanToken BeginSpan(const char* name);
+void EndSpan(const SpanToken& token);
+
+// RAII span covering the enclosing scope
+class ScopedSpan {
+public:
+    explicit ScopedSpan(const char* name) : m_token(BeginSpan(name)) {}
+    ~ScopedSpan() { EndSpan(m_token); }
+
+    ScopedSpan(const ScopedSpan&) = delete;
+    ScopedSpan& operator=(const ScopedSpan&) = delete;
+
+private:
+    SpanToken m_token;
+};
+
+// Write every recorded span as chrome://tracing JSON into output_dir —
+// one timestamped file per launch — and clear the recording.
+bool WriteTimeline(const std::string& output_dir);
+
+} // namespace Trace
+} // namespace MDB
@@ -0,0 +1,269 @@
+#include "thread_pool.hpp"
+#include "config.hpp"
+#include "startup_profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MDB {
+namespace Pool {
+
+// ============================================================================
+// Task Queues
+// ============================================================================
+// One mutex-guarded deque per worker plus a shared queue for external
+// submissions. Owners push and pop at the back (LIFO keeps caches warm);
+// thieves steal from the front (oldest task first, so large fork-joins
+// spread across the pool).
+
+namespace {
+
+class TaskQueue {
+public:
+    void Push(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    bool Pop(std::function<void()>& task) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty()) return false;
+        task = std::move(m_tasks.back());
+        m_tasks.pop_back();
+        return true;
+    }
+
+    bool Steal(std::function<void()>& task) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty()) return false;
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        return true;
+    }
+
+private:
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+};
+
+struct PoolState {
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<TaskQueue>> queues;  // one per worker
+    TaskQueue external;                              // non-worker submissions
+
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    size_t pending = 0;              // queued tasks (guarded by wake_mutex)
+    std::atomic<bool> running{ false };
+    std::atomic<size_t> next_victim{ 0 };
+
+    std::mutex init_mutex;
+};
+
+} // anonymous namespace
+
+static PoolState g_pool;
+
+// Index of the current thread inside the pool, or -1 for foreign threads
+static thread_local int t_worker_index = -1;
+
+// Pull the next task: own queue first, then the shared queue, then steal
+// from the other workers round-robin.
+static bool TryGetTask(int self, std::function<void()>& task) {
+    if (self >= 0 && g_pool.queues[static_cast<size_t>(self)]->Pop(task)) {
+        return true;
+    }
+    if (g_pool.external.Steal(task)) {
+        return true;
+    }
+
+    size_t count = g_pool.queues.size();
+    size_t start = g_pool.next_victim.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        size_t victim = (start + i) % count;
+        if (static_cast<int>(victim) == self) continue;
+        if (g_pool.queues[victim]->Steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void NoteTaskTaken() {
+    std::lock_guard<std::mutex> lock(g_pool.wake_mutex);
+    if (g_pool.pending > 0) g_pool.pending--;
+}
+
+static void WorkerMain(int index) {
+    t_worker_index = index;
+
+    // Visible to the startup stack sampler — the dump's fork-joins run here
+    Profiler::ScopedThreadRegistration profiler_reg("pool_worker");
+
+    std::function<void()> task;
+    while (g_pool.running.load(std::memory_order_acquire)) {
+        if (TryGetTask(index, task)) {
+            NoteTaskTaken();
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(g_pool.wake_mutex);
+        g_pool.wake.wait(lock, [] {
+            return g_pool.pending > 0 ||
+                   !g_pool.running.load(std::memory_order_acquire);
+        });
+    }
+}
+
+// Default worker count: the MDB_POOL_THREADS knob when set, then the
+// [pool] threads value from mdb_config.ini, else half the hardware
+// threads — the game's own job system owns the other half.
+static size_t DefaultWorkerCount() {
+    if (const char* knob = std::getenv("MDB_POOL_THREADS")) {
+        long parsed = std::strtol(knob, nullptr, 10);
+        if (parsed > 0 && parsed <= 256) {
+            return static_cast<size_t>(parsed);
+        }
+    }
+
+    int configured = Config::Get().pool_threads;
+    if (configured > 0) {
+        return static_cast<size_t>(configured);
+    }
+
+    size_t cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 2;
+    size_t workers = cores / 2;
+    return workers > 0 ? workers : 1;
+}
+
+void Initialize(size_t thread_count) {
+    std::lock_guard<std::mutex> lock(g_pool.init_mutex);
+    if (g_pool.running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    size_t count = thread_count > 0 ? thread_count : DefaultWorkerCount();
+
+    g_pool.queues.clear();
+    g_pool.queues.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        g_pool.queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+
+    g_pool.running.store(true, std::memory_order_release);
+    g_pool.workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        g_pool.workers.emplace_back(WorkerMain, static_cast<int>(i));
+    }
+}
+
+void Shutdown() {
+    std::lock_guard<std::mutex> lock(g_pool.init_mutex);
+    if (!g_pool.running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> wake_lock(g_pool.wake_mutex);
+        g_pool.running.store(false, std::memory_order_release);
+    }
+    g_pool.wake.notify_all();
+
+    for (auto& worker : g_pool.workers) {
+        if (worker.joinable()) worker.join();
+    }
+    g_pool.workers.clear();
+    g_pool.queues.clear();
+    g_pool.pending = 0;
+}
+
+size_t WorkerCount() {
+    Initialize();
+    return g_pool.queues.size();
+}
+
+void Submit(std::function<void()> task) {
+    Initialize();
+
+    if (t_worker_index >= 0) {
+        g_pool.queues[static_cast<size_t>(t_worker_index)]->Push(std::move(task));
+    } else {
+        g_pool.external.Push(std::move(task));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_pool.wake_mutex);
+        g_pool.pending++;
+    }
+    g_pool.wake.notify_one();
+}
+
+void ForkJoin(unsigned lanes, const std::function<void(unsigned)>& body) {
+    if (lanes <= 1) {
+        body(0);
+        return;
+    }
+
+    Initialize();
+
+    // remaining is guarded by done_mutex; the last lane decrements and
+    // notifies under the lock, so once the caller observes zero every
+    // worker is finished touching this frame.
+    std::mutex done_mutex;
+    std::condition_variable done;
+    unsigned remaining = lanes - 1;
+
+    for (unsigned lane = 1; lane < lanes; ++lane) {
+        Submit([&, lane]() {
+            body(lane);
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (--remaining == 0) {
+                done.notify_one();
+            }
+        });
+    }
+
+    body(0);
+
+    // Help drain the pool while waiting — the sibling lanes may still be
+    // queued behind other work, and running them here both finishes the
+    // join sooner and makes a saturated pool unable to deadlock it.
+    std::function<void()> task;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            if (remaining == 0) return;
+        }
+
+        if (TryGetTask(t_worker_index, task)) {
+            NoteTaskTaken();
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done.wait_for(lock, std::chrono::milliseconds(1),
+                      [&] { return remaining == 0; });
+        if (remaining == 0) return;
+    }
+}
+
+unsigned LaneCount(size_t itemCount) {
+    size_t lanes = WorkerCount() + 1;   // workers + the calling thread
+    if (itemCount < lanes) lanes = itemCount;
+    return lanes > 0 ? static_cast<unsigned>(lanes) : 1u;
+}
+
+} // namespace Pool
+} // namespace MDB
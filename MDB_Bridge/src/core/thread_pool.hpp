@@ -0,0 +1,50 @@
+#pragma once
+// ============================================================================
+// Shared Worker Pool for MDB Bridge
+// ============================================================================
+// One bridge-owned work-stealing thread pool shared by every parallel
+// subsystem (dumper phases, obfuscation analysis, async invokes). Spawning
+// ad-hoc std::thread batches inside a game process is costly and
+// oversubscribes the game's own job system, so the bridge keeps a single
+// fixed set of workers — default cores/2 — created lazily on first use.
+// mdb_init() warms the pool so thread creation lands before the first
+// parallel phase.
+//
+// Usage:
+//   MDB::Pool::ForkJoin(lanes, [&](unsigned lane) { ... });  // fork-join
+//   MDB::Pool::Submit([] { ... });                           // fire & forget
+
+#include <cstddef>
+#include <functional>
+
+namespace MDB {
+namespace Pool {
+
+// Create the worker threads if they do not exist yet. thread_count 0 picks
+// the default: the MDB_POOL_THREADS environment variable when set, else
+// max(1, cores / 2). Safe to call repeatedly; later calls are no-ops.
+void Initialize(size_t thread_count = 0);
+
+// Join and destroy all workers. Queued tasks that never started are dropped.
+void Shutdown();
+
+// Number of pool worker threads (initializes the pool on first call).
+size_t WorkerCount();
+
+// Queue a task on the pool (fire-and-forget). Tasks submitted from a pool
+// worker go to that worker's own queue; others land in the shared queue.
+void Submit(std::function<void()> task);
+
+// Fork-join helper for the dump/scan workloads: runs body(lane) once per
+// lane and returns when every lane has finished. Lane 0 runs on the calling
+// thread; the remaining lanes are distributed to pool workers, and the
+// caller helps drain the pool while it waits so a saturated pool cannot
+// deadlock the join.
+void ForkJoin(unsigned lanes, const std::function<void(unsigned)>& body);
+
+// Lane count for a fork-join over itemCount independent items: pool workers
+// plus the calling thread, capped by the number of items.
+unsigned LaneCount(size_t itemCount);
+
+} // namespace Pool
+} // namespace MDB
@@ -0,0 +1,1086 @@
+#include "dump_snapshot.hpp"
+#include "il2cpp_resolver.hpp"
+#include "core/mem_stats.hpp"
+
+#include <Il2CppTypes.hpp>
+
+#define NOMINMAX
+#include <Windows.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Convenience aliases into the resolver's internal namespace
+namespace api = il2cpp::_internal;
+using namespace il2cpp::_internal::unity_structs;
+
+namespace MDB {
+namespace DumpSnapshot {
+
+// ============================================================================
+// Snapshot File Format
+// ============================================================================
+// All cross-references are array indices (kInvalidIndex = none); strings are
+// offsets into a NUL-terminated table at the end of the file (offset 0 = "").
+// Variable-length lists (per-image class order, generic argument vectors)
+// live in a shared uint32 pool referenced by first/count pairs, so every
+// section is a flat array of fixed-size records.
+
+static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+static constexpr uint32_t kSnapshotVersion = 1;
+
+#pragma pack(push, 1)
+struct FileHeader {
+    char     magic[4];        // "MDBS"
+    uint32_t version;         // kSnapshotVersion
+    uint32_t image_count;
+    uint32_t assembly_count;
+    uint32_t class_count;
+    uint32_t type_count;
+    uint32_t field_count;
+    uint32_t method_count;
+    uint32_t param_count;
+    uint32_t property_count;
+    uint32_t u32_pool_count;
+    uint32_t reserved;
+    uint64_t strings_size;
+};
+
+struct ImageRec {
+    uint32_t name_off;
+    uint32_t first_class;     // u32 pool range: class indices in image order
+    uint32_t class_count;
+};
+
+struct AssemblyRec {
+    uint32_t image_idx;
+};
+
+struct ClassRec {
+    uint32_t name_off;
+    uint32_t ns_off;
+    uint32_t parent_idx;
+    uint32_t declaring_idx;
+    uint32_t self_type_idx;
+    int32_t  flags;           // TYPE_ATTRIBUTE_* flags
+    uint32_t instance_size;
+    uint8_t  is_valuetype;
+    uint8_t  is_enum;
+    uint8_t  pad[2];
+    uint32_t first_field;     // contiguous record ranges, like the metadata cache
+    uint32_t field_count;
+    uint32_t first_method;
+    uint32_t method_count;
+    uint32_t first_property;
+    uint32_t property_count;
+};
+
+struct TypeRec {
+    uint16_t attrs;
+    uint8_t  type_enum;       // IL2CPP_TYPE_*
+    uint8_t  byref;
+    // Meaning depends on type_enum: element type index (SZARRAY), generic
+    // parameter index (VAR/MVAR), otherwise the resolved class index
+    uint32_t data;
+    uint32_t inst_first;      // u32 pool range: GENERICINST argument type indices
+    uint32_t inst_count;
+};
+
+struct FieldRec {
+    uint32_t name_off;
+    uint32_t type_idx;
+    int32_t  offset;
+    uint32_t attrs;           // FIELD_ATTRIBUTE_* flags
+    uint32_t has_literal_value;
+    uint64_t literal_value;   // enum/const literals (GenerateEnum reads these)
+};
+
+struct MethodRec {
+    uint32_t name_off;
+    uint32_t return_type_idx;
+    uint32_t first_param;
+    uint32_t param_count;
+    uint32_t flags;           // METHOD_ATTRIBUTE_* flags
+    uint64_t rva;             // method pointer minus GameAssembly base (0 if none)
+    uint8_t  is_generic;
+    uint8_t  is_inflated;
+    uint8_t  pad[2];
+    int32_t  generic_argc;    // type parameter count for generic definitions
+};
+
+struct ParamRec {
+    uint32_t name_off;
+    uint32_t type_idx;
+};
+
+struct PropertyRec {
+    uint32_t name_off;
+    uint32_t get_method_idx;
+    uint32_t set_method_idx;
+};
+#pragma pack(pop)
+
+// ============================================================================
+// Capture
+// ============================================================================
+// Breadth-first over the class graph: the per-image walks seed the worklist,
+// and parent/declaring/type references pull in classes the image walk never
+// yields directly (array classes, inflated generics). Types are memoized by
+// pointer so shared signatures serialize once.
+
+namespace {
+
+struct CaptureContext {
+    std::vector<ImageRec> images;
+    std::vector<AssemblyRec> assemblies;
+    std::vector<ClassRec> classes;
+    std::vector<TypeRec> types;
+    std::vector<FieldRec> fields;
+    std::vector<MethodRec> methods;
+    std::vector<ParamRec> params;
+    std::vector<PropertyRec> properties;
+    std::vector<uint32_t> u32_pool;
+    std::string strings;
+
+    std::unordered_map<std::string, uint32_t> string_offsets;
+    std::unordered_map<const void*, uint32_t> class_indices;
+    std::unordered_map<const void*, uint32_t> type_indices;
+    std::unordered_map<const void*, uint32_t> method_indices;
+    std::vector<std::pair<uint32_t, il2cppClass*>> pending_classes;
+
+    uintptr_t ga_base = 0;
+
+    uint32_t InternString(const char* s) {
+        if (!s || !*s) return 0;
+        auto it = string_offsets.find(s);
+        if (it != string_offsets.end()) return it->second;
+        uint32_t off = static_cast<uint32_t>(strings.size());
+        strings.append(s);
+        strings.push_back('\0');
+        string_offsets.emplace(s, off);
+        return off;
+    }
+
+    /// Allocate (or find) the record slot for a class and queue its body for
+    /// capture. Bodies are filled from the worklist so reference chains never
+    /// recurse through partially-captured records.
+    uint32_t AddClassRef(il2cppClass* klass) {
+        if (!klass) return kInvalidIndex;
+        auto it = class_indices.find(klass);
+        if (it != class_indices.end()) return it->second;
+
+        uint32_t idx = static_cast<uint32_t>(classes.size());
+        classes.push_back(ClassRec{});
+        auto& rec = classes.back();
+        rec.parent_idx = rec.declaring_idx = rec.self_type_idx = kInvalidIndex;
+        rec.first_field = rec.first_method = rec.first_property = kInvalidIndex;
+        class_indices.emplace(klass, idx);
+        pending_classes.emplace_back(idx, klass);
+        return idx;
+    }
+
+    uint32_t AddType(const il2cppType* type) {
+        if (!type) return kInvalidIndex;
+        auto it = type_indices.find(type);
+        if (it != type_indices.end()) return it->second;
+
+        uint32_t idx = static_cast<uint32_t>(types.size());
+        types.push_back(TypeRec{});
+        type_indices.emplace(type, idx);
+
+        // Fill through the index, not a reference — recursive AddType calls
+        // below may reallocate the vector
+        types[idx].attrs = static_cast<uint16_t>(type->m_uAttributes);
+        types[idx].type_enum = static_cast<uint8_t>(type->m_uType);
+        types[idx].byref = static_cast<uint8_t>(type->m_uByref);
+        types[idx].data = kInvalidIndex;
+        types[idx].inst_first = 0;
+        types[idx].inst_count = 0;
+
+        switch (type->m_uType) {
+        case IL2CPP_TYPE_SZARRAY:
+            types[idx].data = AddType(type->m_pType);
+            break;
+        case IL2CPP_TYPE_VAR:
+        case IL2CPP_TYPE_MVAR:
+            types[idx].data = type->m_uGenericParameterIndex;
+            break;
+        case IL2CPP_TYPE_PTR:
+            break;  // erased to IntPtr by the dumper; element not needed
+        case IL2CPP_TYPE_GENERICINST: {
+            if (api::il2cpp_class_from_type) {
+                types[idx].data = AddClassRef(api::il2cpp_class_from_type(type));
+            }
+            auto* genericClass = type->m_pGenericClass;
+            auto* classInst = genericClass ? genericClass->m_Context.m_pClassInst : nullptr;
+            if (classInst && classInst->m_uTypeArgc > 0 && classInst->m_pTypeArgv) {
+                std::vector<uint32_t> args;
+                args.reserve(classInst->m_uTypeArgc);
+                for (uint32_t i = 0; i < classInst->m_uTypeArgc; ++i) {
+                    args.push_back(AddType(classInst->m_pTypeArgv[i]));
+                }
+                types[idx].inst_first = static_cast<uint32_t>(u32_pool.size());
+                types[idx].inst_count = static_cast<uint32_t>(args.size());
+                u32_pool.insert(u32_pool.end(), args.begin(), args.end());
+            }
+            break;
+        }
+        default:
+            // Class-backed types (CLASS, VALUETYPE, primitives the dumper
+            // resolves by name) — record the class so class_from_type works
+            if (api::il2cpp_class_from_type) {
+                types[idx].data = AddClassRef(api::il2cpp_class_from_type(type));
+            }
+            break;
+        }
+        return idx;
+    }
+
+    void CaptureClassBody(uint32_t idx, il2cppClass* klass) {
+        const auto* meta = il2cpp::get_class_meta(klass);
+        classes[idx].name_off = InternString(meta ? meta->name : "");
+        classes[idx].ns_off = InternString(meta ? meta->namespaze : "");
+        classes[idx].flags = meta ? meta->flags : 0;
+        classes[idx].instance_size = meta ? meta->instance_size : 0;
+        classes[idx].is_valuetype = meta && meta->is_valuetype ? 1 : 0;
+        classes[idx].is_enum = meta && meta->is_enum ? 1 : 0;
+        classes[idx].parent_idx = AddClassRef(meta ? meta->parent : nullptr);
+
+        il2cppClass* declaring = api::il2cpp_class_get_declaring_type
+            ? api::il2cpp_class_get_declaring_type(klass)
+            : klass->m_pDeclareClass;
+        classes[idx].declaring_idx = AddClassRef(declaring);
+
+        if (api::il2cpp_class_get_type) {
+            classes[idx].self_type_idx = AddType(api::il2cpp_class_get_type(klass));
+        }
+
+        // ---- Fields ----
+        if (api::il2cpp_class_get_fields) {
+            classes[idx].first_field = static_cast<uint32_t>(fields.size());
+            void* iter = nullptr;
+            while (auto* fi = api::il2cpp_class_get_fields(klass, &iter)) {
+                FieldRec rec{};
+                rec.name_off = InternString(api::il2cpp_field_get_name
+                                                ? api::il2cpp_field_get_name(fi) : nullptr);
+                rec.type_idx = api::il2cpp_field_get_type
+                    ? AddType(api::il2cpp_field_get_type(fi)) : kInvalidIndex;
+                rec.offset = api::il2cpp_field_get_offset
+                    ? static_cast<int32_t>(api::il2cpp_field_get_offset(fi))
+                    : fi->m_iOffset;
+                rec.attrs = api::il2cpp_field_get_flags
+                    ? static_cast<uint32_t>(api::il2cpp_field_get_flags(fi)) : 0;
+                // Enum/const literal values — the only static reads the dump
+                // pipeline performs (GenerateEnum)
+                if ((rec.attrs & FIELD_ATTRIBUTE_LITERAL) && api::il2cpp_field_static_get_value) {
+                    uint64_t value = 0;
+                    api::il2cpp_field_static_get_value(fi, &value);
+                    rec.literal_value = value;
+                    rec.has_literal_value = 1;
+                }
+                fields.push_back(rec);
+            }
+            classes[idx].field_count =
+                static_cast<uint32_t>(fields.size()) - classes[idx].first_field;
+        }
+
+        // ---- Methods ----
+        if (api::il2cpp_class_get_methods) {
+            classes[idx].first_method = static_cast<uint32_t>(methods.size());
+            void* iter = nullptr;
+            while (auto* mi = api::il2cpp_class_get_methods(klass, &iter)) {
+                uint32_t methodIdx = static_cast<uint32_t>(methods.size());
+                method_indices.emplace(mi, methodIdx);
+
+                MethodRec rec{};
+                rec.name_off = InternString(api::il2cpp_method_get_name
+                                                ? api::il2cpp_method_get_name(mi) : nullptr);
+                rec.return_type_idx = api::il2cpp_method_get_return_type
+                    ? AddType(api::il2cpp_method_get_return_type(mi)) : kInvalidIndex;
+                rec.flags = api::il2cpp_method_get_flags
+                    ? api::il2cpp_method_get_flags(mi, nullptr) : 0;
+
+                rec.first_param = static_cast<uint32_t>(params.size());
+                uint32_t paramCount = api::il2cpp_method_get_param_count
+                    ? api::il2cpp_method_get_param_count(mi) : 0;
+                for (uint32_t p = 0; p < paramCount; ++p) {
+                    ParamRec param{};
+                    param.name_off = InternString(api::il2cpp_method_get_param_name
+                                                      ? api::il2cpp_method_get_param_name(mi, p)
+                                                      : nullptr);
+                    param.type_idx = api::il2cpp_method_get_param
+                        ? AddType(api::il2cpp_method_get_param(mi, p)) : kInvalidIndex;
+                    params.push_back(param);
+                }
+                rec.param_count = static_cast<uint32_t>(params.size()) - rec.first_param;
+
+                uintptr_t ptr = reinterpret_cast<uintptr_t>(mi->m_pMethodPointer);
+                if (ptr > ga_base) rec.rva = static_cast<uint64_t>(ptr - ga_base);
+                rec.is_generic = mi->m_uGeneric ? 1 : 0;
+                rec.is_inflated = mi->m_uInflated ? 1 : 0;
+                if (mi->m_uGeneric && mi->m_pGenericContainer) {
+                    rec.generic_argc = reinterpret_cast<il2cppGenericContainer*>(
+                        mi->m_pGenericContainer)->m_iTypeArgc;
+                }
+                methods.push_back(rec);
+            }
+            classes[idx].method_count =
+                static_cast<uint32_t>(methods.size()) - classes[idx].first_method;
+        }
+
+        // ---- Properties ----
+        // Accessor methods were just captured above, so the index lookups hit
+        if (api::il2cpp_class_get_properties) {
+            classes[idx].first_property = static_cast<uint32_t>(properties.size());
+            void* iter = nullptr;
+            while (auto* pi = api::il2cpp_class_get_properties(klass, &iter)) {
+                PropertyRec rec{};
+                rec.name_off = InternString(api::il2cpp_property_get_name
+                                                ? api::il2cpp_property_get_name(
+                                                      const_cast<il2cppPropertyInfo*>(pi))
+                                                : nullptr);
+                rec.get_method_idx = rec.set_method_idx = kInvalidIndex;
+                auto findMethod = [this](const il2cppMethodInfo* mi) -> uint32_t {
+                    if (!mi) return kInvalidIndex;
+                    auto mit = method_indices.find(mi);
+                    return mit != method_indices.end() ? mit->second : kInvalidIndex;
+                };
+                if (api::il2cpp_property_get_get_method) {
+                    rec.get_method_idx = findMethod(api::il2cpp_property_get_get_method(
+                        const_cast<il2cppPropertyInfo*>(pi)));
+                }
+                if (api::il2cpp_property_get_set_method) {
+                    rec.set_method_idx = findMethod(api::il2cpp_property_get_set_method(
+                        const_cast<il2cppPropertyInfo*>(pi)));
+                }
+                properties.push_back(rec);
+            }
+            classes[idx].property_count =
+                static_cast<uint32_t>(properties.size()) - classes[idx].first_property;
+        }
+    }
+};
+
+} // namespace
+
+bool Capture(const std::string& path, std::string* error) {
+    auto fail = [&](const char* message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    if (api::ensure_exports() != Il2CppStatus::OK) {
+        return fail("IL2CPP exports not resolved");
+    }
+    if (!api::il2cpp_domain_get || !api::il2cpp_domain_get_assemblies ||
+        !api::il2cpp_assembly_get_image || !api::il2cpp_image_get_name ||
+        !api::il2cpp_image_get_class_count || !api::il2cpp_image_get_class) {
+        return fail("Required snapshot capture APIs not resolved");
+    }
+    il2cpp::ensure_thread_attached();
+
+    auto domain = api::il2cpp_domain_get();
+    if (!domain) return fail("Failed to get IL2CPP domain");
+    size_t assemblyCount = 0;
+    auto assemblies = api::il2cpp_domain_get_assemblies(domain, &assemblyCount);
+    if (!assemblies) return fail("Failed to get assemblies");
+
+    CaptureContext ctx;
+    ctx.strings.push_back('\0');  // offset 0 = ""
+    ctx.ga_base = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
+
+    // Seed: every class of every image, preserving image order so replayed
+    // il2cpp_image_get_class walks match the live traversal
+    for (size_t i = 0; i < assemblyCount; ++i) {
+        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+        if (!image) continue;
+
+        ImageRec imageRec{};
+        imageRec.name_off = ctx.InternString(api::il2cpp_image_get_name(image));
+        imageRec.first_class = static_cast<uint32_t>(ctx.u32_pool.size());
+
+        size_t classCount = api::il2cpp_image_get_class_count(image);
+        for (size_t j = 0; j < classCount; ++j) {
+            auto klass = api::il2cpp_image_get_class(image, j);
+            if (!klass) continue;
+            ctx.u32_pool.push_back(ctx.AddClassRef(klass));
+        }
+        imageRec.class_count =
+            static_cast<uint32_t>(ctx.u32_pool.size()) - imageRec.first_class;
+
+        AssemblyRec assemblyRec{};
+        assemblyRec.image_idx = static_cast<uint32_t>(ctx.images.size());
+        ctx.images.push_back(imageRec);
+        ctx.assemblies.push_back(assemblyRec);
+    }
+
+    // Drain the worklist — bodies enqueue parents, declaring types, and
+    // type-graph classes as they are discovered
+    while (!ctx.pending_classes.empty()) {
+        auto [idx, klass] = ctx.pending_classes.back();
+        ctx.pending_classes.pop_back();
+        ctx.CaptureClassBody(idx, klass);
+    }
+
+    // ---- Serialize ----
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return fail("Failed to open snapshot file for writing");
+
+    FileHeader header{};
+    std::memcpy(header.magic, "MDBS", 4);
+    header.version = kSnapshotVersion;
+    header.image_count = static_cast<uint32_t>(ctx.images.size());
+    header.assembly_count = static_cast<uint32_t>(ctx.assemblies.size());
+    header.class_count = static_cast<uint32_t>(ctx.classes.size());
+    header.type_count = static_cast<uint32_t>(ctx.types.size());
+    header.field_count = static_cast<uint32_t>(ctx.fields.size());
+    header.method_count = static_cast<uint32_t>(ctx.methods.size());
+    header.param_count = static_cast<uint32_t>(ctx.params.size());
+    header.property_count = static_cast<uint32_t>(ctx.properties.size());
+    header.u32_pool_count = static_cast<uint32_t>(ctx.u32_pool.size());
+    header.strings_size = ctx.strings.size();
+
+    auto writeAll = [&](const void* data, size_t bytes) {
+        return bytes == 0 || fwrite(data, 1, bytes, file) == bytes;
+    };
+    bool ok = writeAll(&header, sizeof(header)) &&
+              writeAll(ctx.images.data(), ctx.images.size() * sizeof(ImageRec)) &&
+              writeAll(ctx.assemblies.data(), ctx.assemblies.size() * sizeof(AssemblyRec)) &&
+              writeAll(ctx.classes.data(), ctx.classes.size() * sizeof(ClassRec)) &&
+              writeAll(ctx.types.data(), ctx.types.size() * sizeof(TypeRec)) &&
+              writeAll(ctx.fields.data(), ctx.fields.size() * sizeof(FieldRec)) &&
+              writeAll(ctx.methods.data(), ctx.methods.size() * sizeof(MethodRec)) &&
+              writeAll(ctx.params.data(), ctx.params.size() * sizeof(ParamRec)) &&
+              writeAll(ctx.properties.data(), ctx.properties.size() * sizeof(PropertyRec)) &&
+              writeAll(ctx.u32_pool.data(), ctx.u32_pool.size() * sizeof(uint32_t)) &&
+              writeAll(ctx.strings.data(), ctx.strings.size());
+    fclose(file);
+
+    if (!ok) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return fail("Failed to write snapshot file");
+    }
+    return true;
+}
+
+// ============================================================================
+// Replay: In-Memory Graph Reconstruction
+// ============================================================================
+// The loader rebuilds the snapshot as the same mirror structs the dumper is
+// compiled against, so direct field reads (m_pDeclareClass, m_pMethodPointer,
+// the il2cppType union, generic context chains) behave exactly like a live
+// walk. Each runtime record embeds its mirror struct as the first member, so
+// the snapshot-backed accessors below are plain casts and field reads — no
+// hash lookups on the hot path. Class records carry a zeroed tail large
+// enough for the runtime instance-size slot the layout probe reads.
+
+namespace {
+
+struct RtType {
+    il2cppType type{};
+    il2cppClass* klass = nullptr;   // class_from_type target
+};
+
+struct RtField {
+    il2cppFieldInfo field{};
+    uint32_t attrs = 0;
+    uint32_t has_literal = 0;
+    uint64_t literal = 0;
+};
+
+struct RtMethod {
+    il2cppMethodInfo method{};
+    uint32_t flags = 0;
+};
+
+struct RtClassSide {
+    RtField* fields = nullptr;
+    uint32_t field_count = 0;
+    RtMethod* methods = nullptr;
+    uint32_t method_count = 0;
+    il2cppPropertyInfo* properties = nullptr;
+    uint32_t property_count = 0;
+    RtType* self_type = nullptr;
+    int32_t flags = 0;
+    uint8_t is_valuetype = 0;
+    uint8_t is_enum = 0;
+};
+
+// The layout probe reads instance_size at a runtime-corrected offset from the
+// class base (compiled seed 0xF8, scanned ±0x40); the tail keeps any offset
+// in that window inside the allocation
+constexpr size_t kClassTailBytes = 0x400;
+
+struct RtClass {
+    il2cppClass cls{};
+    unsigned char tail[kClassTailBytes]{};
+    RtClassSide side{};
+};
+
+struct RtImage {
+    il2cppImage image{};
+    il2cppClass** classes = nullptr;
+    size_t class_count = 0;
+};
+
+struct LoadedSnapshot {
+    std::vector<char> strings;
+    std::vector<RtImage> images;
+    std::vector<il2cppAssembly> assemblies;
+    std::vector<il2cppAssembly*> assembly_ptrs;
+    std::vector<RtClass> classes;
+    std::vector<RtType> types;
+    std::vector<RtField> fields;
+    std::vector<RtMethod> methods;
+    std::vector<il2cppParameterInfo> params;
+    std::vector<il2cppPropertyInfo> properties;
+    std::vector<il2cppClass*> image_class_ptrs;
+    std::vector<il2cppGenericClass> generic_classes;
+    std::vector<il2cppGenericInst> generic_insts;
+    std::vector<il2cppType*> generic_args;
+    std::vector<il2cppGenericContainer> containers;
+};
+
+// Active snapshot for the duration of a replay (accessors have no context
+// argument). Replay is single-entry by contract.
+LoadedSnapshot* g_active = nullptr;
+int g_replay_domain = 0;  // opaque non-null domain token
+
+const char* SnapString(const LoadedSnapshot& snap, uint32_t off) {
+    return off < snap.strings.size() ? snap.strings.data() + off : "";
+}
+
+std::unique_ptr<LoadedSnapshot> LoadSnapshotFile(const std::string& path, std::string* error) {
+    auto fail = [&](const char* message) -> std::unique_ptr<LoadedSnapshot> {
+        if (error) *error = message;
+        return nullptr;
+    };
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return fail("Failed to open snapshot file");
+
+    FileHeader header{};
+    if (fread(&header, 1, sizeof(header), file) != sizeof(header) ||
+        std::memcmp(header.magic, "MDBS", 4) != 0 ||
+        header.version != kSnapshotVersion) {
+        fclose(file);
+        return fail("Snapshot file is malformed or has an unsupported version");
+    }
+
+    auto readVec = [&](auto& vec, uint32_t count) {
+        vec.resize(count);
+        size_t bytes = count * sizeof(vec[0]);
+        return bytes == 0 || fread(vec.data(), 1, bytes, file) == bytes;
+    };
+
+    std::vector<ImageRec> imageRecs;
+    std::vector<AssemblyRec> assemblyRecs;
+    std::vector<ClassRec> classRecs;
+    std::vector<TypeRec> typeRecs;
+    std::vector<FieldRec> fieldRecs;
+    std::vector<MethodRec> methodRecs;
+    std::vector<ParamRec> paramRecs;
+    std::vector<PropertyRec> propertyRecs;
+    std::vector<uint32_t> u32Pool;
+    auto snap = std::make_unique<LoadedSnapshot>();
+
+    bool ok = readVec(imageRecs, header.image_count) &&
+              readVec(assemblyRecs, header.assembly_count) &&
+              readVec(classRecs, header.class_count) &&
+              readVec(typeRecs, header.type_count) &&
+              readVec(fieldRecs, header.field_count) &&
+              readVec(methodRecs, header.method_count) &&
+              readVec(paramRecs, header.param_count) &&
+              readVec(propertyRecs, header.property_count) &&
+              readVec(u32Pool, header.u32_pool_count) &&
+              readVec(snap->strings, static_cast<uint32_t>(header.strings_size));
+    fclose(file);
+    if (!ok) return fail("Snapshot file is truncated");
+
+    // Exact-size allocations up front: every wiring step below stores raw
+    // pointers into these vectors, so they must never reallocate
+    snap->images.resize(header.image_count);
+    snap->assemblies.resize(header.assembly_count);
+    snap->classes.resize(header.class_count);
+    snap->types.resize(header.type_count);
+    snap->fields.resize(header.field_count);
+    snap->methods.resize(header.method_count);
+    snap->params.resize(header.param_count);
+    snap->properties.resize(header.property_count);
+    snap->containers.resize(header.method_count);
+    snap->image_class_ptrs.reserve(header.u32_pool_count);
+
+    auto classPtr = [&](uint32_t idx) -> il2cppClass* {
+        return idx < header.class_count ? &snap->classes[idx].cls : nullptr;
+    };
+    auto typePtr = [&](uint32_t idx) -> il2cppType* {
+        return idx < header.type_count ? &snap->types[idx].type : nullptr;
+    };
+
+    // ---- Types (pass 1: scalars, pass 2 below wires generic vectors) ----
+    size_t genericInstCount = 0;
+    for (uint32_t i = 0; i < header.type_count; ++i) {
+        if (typeRecs[i].type_enum == IL2CPP_TYPE_GENERICINST) ++genericInstCount;
+    }
+    snap->generic_classes.resize(genericInstCount);
+    snap->generic_insts.resize(genericInstCount);
+    snap->generic_args.reserve(header.u32_pool_count);
+
+    size_t nextGeneric = 0;
+    for (uint32_t i = 0; i < header.type_count; ++i) {
+        const TypeRec& rec = typeRecs[i];
+        RtType& rt = snap->types[i];
+        rt.type.m_uAttributes = rec.attrs;
+        rt.type.m_uType = rec.type_enum;
+        rt.type.m_uByref = rec.byref;
+
+        switch (rec.type_enum) {
+        case IL2CPP_TYPE_SZARRAY:
+            rt.type.m_pType = typePtr(rec.data);
+            break;
+        case IL2CPP_TYPE_VAR:
+        case IL2CPP_TYPE_MVAR:
+            rt.type.m_uGenericParameterIndex = rec.data;
+            break;
+        case IL2CPP_TYPE_PTR:
+            break;
+        case IL2CPP_TYPE_GENERICINST: {
+            rt.klass = classPtr(rec.data);
+            auto& genericClass = snap->generic_classes[nextGeneric];
+            auto& inst = snap->generic_insts[nextGeneric];
+            ++nextGeneric;
+            inst.m_uTypeArgc = 0;
+            inst.m_pTypeArgv = nullptr;
+            if (rec.inst_count > 0 &&
+                rec.inst_first + rec.inst_count <= u32Pool.size()) {
+                il2cppType** argv = snap->generic_args.data() + snap->generic_args.size();
+                for (uint32_t a = 0; a < rec.inst_count; ++a) {
+                    snap->generic_args.push_back(typePtr(u32Pool[rec.inst_first + a]));
+                }
+                inst.m_uTypeArgc = rec.inst_count;
+                inst.m_pTypeArgv = argv;
+            }
+            genericClass.m_Context.m_pClassInst = &inst;
+            genericClass.m_Context.m_pMethodInst = nullptr;
+            genericClass.m_pCachedClass = rt.klass;
+            rt.type.m_pGenericClass = &genericClass;
+            break;
+        }
+        default:
+            rt.klass = classPtr(rec.data);
+            break;
+        }
+    }
+
+    // ---- Fields ----
+    for (uint32_t i = 0; i < header.field_count; ++i) {
+        const FieldRec& rec = fieldRecs[i];
+        RtField& rt = snap->fields[i];
+        rt.field.m_pName = SnapString(*snap, rec.name_off);
+        rt.field.m_pType = typePtr(rec.type_idx);
+        rt.field.m_iOffset = rec.offset;
+        rt.attrs = rec.attrs;
+        rt.has_literal = rec.has_literal_value;
+        rt.literal = rec.literal_value;
+    }
+
+    // ---- Methods & parameters ----
+    for (uint32_t i = 0; i < header.param_count; ++i) {
+        snap->params[i].m_pName = SnapString(*snap, paramRecs[i].name_off);
+        snap->params[i].m_iPosition = 0;
+        snap->params[i].m_pParameterType = typePtr(paramRecs[i].type_idx);
+    }
+    for (uint32_t i = 0; i < header.method_count; ++i) {
+        const MethodRec& rec = methodRecs[i];
+        RtMethod& rt = snap->methods[i];
+        rt.method.m_pName = SnapString(*snap, rec.name_off);
+        rt.method.m_pReturnType = typePtr(rec.return_type_idx);
+        if (rec.param_count > 0 && rec.first_param + rec.param_count <= header.param_count) {
+            rt.method.m_pParameters = &snap->params[rec.first_param];
+            for (uint32_t p = 0; p < rec.param_count; ++p) {
+                snap->params[rec.first_param + p].m_iPosition = static_cast<int>(p);
+            }
+        }
+        rt.method.m_uArgsCount = static_cast<unsigned char>(rec.param_count);
+        // RVAs stay numeric — there is no GameAssembly to point into offline.
+        // Consumers either subtract a base (manifest hashing yields 0) or
+        // read through SEH guards (stub pattern checks fail safely).
+        rt.method.m_pMethodPointer = reinterpret_cast<void*>(static_cast<uintptr_t>(rec.rva));
+        rt.method.m_uFlags = static_cast<unsigned short>(rec.flags);
+        rt.method.m_uSlot = 0xFFFF;
+        rt.method.m_uGeneric = rec.is_generic ? 1 : 0;
+        rt.method.m_uInflated = rec.is_inflated ? 1 : 0;
+        rt.flags = rec.flags;
+        if (rec.generic_argc > 0) {
+            snap->containers[i].m_iOwnerIndex = static_cast<int32_t>(i);
+            snap->containers[i].m_iTypeArgc = rec.generic_argc;
+            rt.method.m_pGenericContainer = &snap->containers[i];
+        }
+    }
+
+    // ---- Properties ----
+    for (uint32_t i = 0; i < header.property_count; ++i) {
+        const PropertyRec& rec = propertyRecs[i];
+        snap->properties[i].m_pName = SnapString(*snap, rec.name_off);
+        snap->properties[i].m_pGet = rec.get_method_idx < header.method_count
+            ? &snap->methods[rec.get_method_idx].method : nullptr;
+        snap->properties[i].m_pSet = rec.set_method_idx < header.method_count
+            ? &snap->methods[rec.set_method_idx].method : nullptr;
+    }
+
+    // ---- Classes ----
+    size_t instanceSizeOffset = il2cpp::_internal::g_class_layout.instance_size;
+    for (uint32_t i = 0; i < header.class_count; ++i) {
+        const ClassRec& rec = classRecs[i];
+        RtClass& rt = snap->classes[i];
+        rt.cls.m_pName = SnapString(*snap, rec.name_off);
+        rt.cls.m_pNamespace = SnapString(*snap, rec.ns_off);
+        rt.cls.m_pParentClass = classPtr(rec.parent_idx);
+        rt.cls.m_pDeclareClass = classPtr(rec.declaring_idx);
+        rt.side.flags = rec.flags;
+        rt.side.is_valuetype = rec.is_valuetype;
+        rt.side.is_enum = rec.is_enum;
+        rt.side.self_type = rec.self_type_idx < header.type_count
+            ? &snap->types[rec.self_type_idx] : nullptr;
+
+        if (rec.field_count > 0 && rec.first_field + rec.field_count <= header.field_count) {
+            rt.side.fields = &snap->fields[rec.first_field];
+            rt.side.field_count = rec.field_count;
+            for (uint32_t f = 0; f < rec.field_count; ++f) {
+                snap->fields[rec.first_field + f].field.m_pParentClass = &rt.cls;
+            }
+        }
+        if (rec.method_count > 0 && rec.first_method + rec.method_count <= header.method_count) {
+            rt.side.methods = &snap->methods[rec.first_method];
+            rt.side.method_count = rec.method_count;
+            for (uint32_t m = 0; m < rec.method_count; ++m) {
+                snap->methods[rec.first_method + m].method.m_pClass = &rt.cls;
+            }
+        }
+        if (rec.property_count > 0 &&
+            rec.first_property + rec.property_count <= header.property_count) {
+            rt.side.properties = &snap->properties[rec.first_property];
+            rt.side.property_count = rec.property_count;
+            for (uint32_t p = 0; p < rec.property_count; ++p) {
+                snap->properties[rec.first_property + p].m_pParentClass = &rt.cls;
+            }
+        }
+
+        // Feed the runtime instance-size slot get_class_meta reads directly
+        if (instanceSizeOffset + sizeof(uint32_t) <= sizeof(il2cppClass) + kClassTailBytes) {
+            *reinterpret_cast<uint32_t*>(
+                reinterpret_cast<uintptr_t>(&rt.cls) + instanceSizeOffset) = rec.instance_size;
+        }
+    }
+
+    // ---- Images & assemblies ----
+    for (uint32_t i = 0; i < header.image_count; ++i) {
+        const ImageRec& rec = imageRecs[i];
+        RtImage& rt = snap->images[i];
+        rt.image.m_pName = SnapString(*snap, rec.name_off);
+        rt.image.m_oNameNoExt = rt.image.m_pName;
+        if (rec.class_count > 0 && rec.first_class + rec.class_count <= u32Pool.size()) {
+            rt.classes = snap->image_class_ptrs.data() + snap->image_class_ptrs.size();
+            for (uint32_t c = 0; c < rec.class_count; ++c) {
+                snap->image_class_ptrs.push_back(classPtr(u32Pool[rec.first_class + c]));
+            }
+            rt.class_count = rec.class_count;
+        }
+    }
+    for (uint32_t i = 0; i < header.assembly_count; ++i) {
+        uint32_t imageIdx = assemblyRecs[i].image_idx;
+        snap->assemblies[i].m_pImage =
+            imageIdx < header.image_count ? &snap->images[imageIdx].image : nullptr;
+        snap->assemblies[i].m_aName.m_pName =
+            imageIdx < header.image_count ? snap->images[imageIdx].image.m_pName : "";
+        snap->assembly_ptrs.push_back(&snap->assemblies[i]);
+    }
+
+    return snap;
+}
+
+// ============================================================================
+// Snapshot-Backed Accessors
+// ============================================================================
+// Signatures match the resolver's function-pointer slots exactly. Iterator
+// protocols store a 1-based index in *iter, mirroring how the bridge's other
+// metadata consumers treat the cursor as opaque.
+
+void* __fastcall snap_domain_get() {
+    return &g_replay_domain;
+}
+
+il2cppAssembly** __fastcall snap_domain_get_assemblies(void*, size_t* out_count) {
+    if (out_count) *out_count = g_active->assembly_ptrs.size();
+    return g_active->assembly_ptrs.data();
+}
+
+il2cppImage* __fastcall snap_assembly_get_image(const il2cppAssembly* assembly) {
+    return assembly ? assembly->m_pImage : nullptr;
+}
+
+const char* __fastcall snap_image_get_name(const il2cppImage* image) {
+    return image ? image->m_pName : "";
+}
+
+size_t __fastcall snap_image_get_class_count(const il2cppImage* image) {
+    return image ? reinterpret_cast<const RtImage*>(image)->class_count : 0;
+}
+
+il2cppClass* __fastcall snap_image_get_class(const il2cppImage* image, size_t index) {
+    auto* rt = reinterpret_cast<const RtImage*>(image);
+    return rt && index < rt->class_count ? rt->classes[index] : nullptr;
+}
+
+il2cppType* __fastcall snap_class_get_type(il2cppClass* klass) {
+    auto* side = klass ? &reinterpret_cast<RtClass*>(klass)->side : nullptr;
+    return side && side->self_type ? &side->self_type->type : nullptr;
+}
+
+il2cppClass* __fastcall snap_class_from_type(const il2cppType* type) {
+    return type ? reinterpret_cast<const RtType*>(type)->klass : nullptr;
+}
+
+const char* __fastcall snap_class_get_name(il2cppClass* klass) {
+    return klass ? klass->m_pName : "";
+}
+
+const char* __fastcall snap_class_get_namespace(il2cppClass* klass) {
+    return klass ? klass->m_pNamespace : "";
+}
+
+int __fastcall snap_class_get_flags(const il2cppClass* klass) {
+    return klass ? reinterpret_cast<const RtClass*>(klass)->side.flags : 0;
+}
+
+bool __fastcall snap_class_is_valuetype(const il2cppClass* klass) {
+    return klass && reinterpret_cast<const RtClass*>(klass)->side.is_valuetype != 0;
+}
+
+bool __fastcall snap_class_is_enum(const il2cppClass* klass) {
+    return klass && reinterpret_cast<const RtClass*>(klass)->side.is_enum != 0;
+}
+
+il2cppClass* __fastcall snap_class_get_parent(il2cppClass* klass) {
+    return klass ? klass->m_pParentClass : nullptr;
+}
+
+il2cppClass* __fastcall snap_class_get_declaring_type(il2cppClass* klass) {
+    return klass ? klass->m_pDeclareClass : nullptr;
+}
+
+il2cppFieldInfo* __fastcall snap_class_get_fields(il2cppClass* klass, void** iter) {
+    if (!klass || !iter) return nullptr;
+    auto& side = reinterpret_cast<RtClass*>(klass)->side;
+    uintptr_t index = reinterpret_cast<uintptr_t>(*iter);
+    if (index >= side.field_count) return nullptr;
+    *iter = reinterpret_cast<void*>(index + 1);
+    return &side.fields[index].field;
+}
+
+const il2cppMethodInfo* __fastcall snap_class_get_methods(il2cppClass* klass, void** iter) {
+    if (!klass || !iter) return nullptr;
+    auto& side = reinterpret_cast<RtClass*>(klass)->side;
+    uintptr_t index = reinterpret_cast<uintptr_t>(*iter);
+    if (index >= side.method_count) return nullptr;
+    *iter = reinterpret_cast<void*>(index + 1);
+    return &side.methods[index].method;
+}
+
+const il2cppPropertyInfo* __fastcall snap_class_get_properties(il2cppClass* klass, void** iter) {
+    if (!klass || !iter) return nullptr;
+    auto& side = reinterpret_cast<RtClass*>(klass)->side;
+    uintptr_t index = reinterpret_cast<uintptr_t>(*iter);
+    if (index >= side.property_count) return nullptr;
+    *iter = reinterpret_cast<void*>(index + 1);
+    return &side.properties[index];
+}
+
+const char* __fastcall snap_field_get_name(il2cppFieldInfo* field) {
+    return field ? field->m_pName : "";
+}
+
+const il2cppType* __fastcall snap_field_get_type(il2cppFieldInfo* field) {
+    return field ? field->m_pType : nullptr;
+}
+
+int __fastcall snap_field_get_flags(il2cppFieldInfo* field) {
+    return field ? static_cast<int>(reinterpret_cast<RtField*>(field)->attrs) : 0;
+}
+
+size_t __fastcall snap_field_get_offset(il2cppFieldInfo* field) {
+    return field ? static_cast<size_t>(field->m_iOffset) : 0;
+}
+
+void __fastcall snap_field_static_get_value(il2cppFieldInfo* field, void* out_value) {
+    if (!field || !out_value) return;
+    auto* rt = reinterpret_cast<RtField*>(field);
+    // GenerateEnum always reads through a uint64_t
+    std::memcpy(out_value, &rt->literal, sizeof(rt->literal));
+}
+
+const char* __fastcall snap_method_get_name(const il2cppMethodInfo* method) {
+    return method ? method->m_pName : "";
+}
+
+uint32_t __fastcall snap_method_get_flags(const il2cppMethodInfo* method, uint32_t* out_flags2) {
+    if (out_flags2) *out_flags2 = 0;
+    return method ? reinterpret_cast<const RtMethod*>(method)->flags : 0;
+}
+
+uint32_t __fastcall snap_method_get_param_count(const il2cppMethodInfo* method) {
+    return method ? method->m_uArgsCount : 0;
+}
+
+const il2cppType* __fastcall snap_method_get_param(const il2cppMethodInfo* method, uint32_t index) {
+    if (!method || !method->m_pParameters || index >= method->m_uArgsCount) return nullptr;
+    return method->m_pParameters[index].m_pParameterType;
+}
+
+const char* __fastcall snap_method_get_param_name(const il2cppMethodInfo* method, uint32_t index) {
+    if (!method || !method->m_pParameters || index >= method->m_uArgsCount) return "";
+    return method->m_pParameters[index].m_pName;
+}
+
+const il2cppType* __fastcall snap_method_get_return_type(const il2cppMethodInfo* method) {
+    return method ? method->m_pReturnType : nullptr;
+}
+
+const char* __fastcall snap_property_get_name(il2cppPropertyInfo* prop) {
+    return prop ? prop->m_pName : "";
+}
+
+const il2cppMethodInfo* __fastcall snap_property_get_get_method(il2cppPropertyInfo* prop) {
+    return prop ? prop->m_pGet : nullptr;
+}
+
+const il2cppMethodInfo* __fastcall snap_property_get_set_method(il2cppPropertyInfo* prop) {
+    return prop ? prop->m_pSet : nullptr;
+}
+
+bool __fastcall snap_type_is_byref(const il2cppType* type) {
+    return type && type->m_uByref != 0;
+}
+
+// Every resolver slot the dump pipeline (dumper, detector, metadata cache)
+// reaches, paired with its snapshot-backed replacement
+#define MDB_SNAPSHOT_OVERRIDES(X)                                         \
+    X(il2cpp_domain_get,               snap_domain_get)                   \
+    X(il2cpp_domain_get_assemblies,    snap_domain_get_assemblies)        \
+    X(il2cpp_assembly_get_image,       snap_assembly_get_image)           \
+    X(il2cpp_image_get_name,           snap_image_get_name)               \
+    X(il2cpp_image_get_class_count,    snap_image_get_class_count)        \
+    X(il2cpp_image_get_class,          snap_image_get_class)              \
+    X(il2cpp_class_get_type,           snap_class_get_type)               \
+    X(il2cpp_class_from_type,          snap_class_from_type)              \
+    X(il2cpp_class_get_name,           snap_class_get_name)               \
+    X(il2cpp_class_get_namespace,      snap_class_get_namespace)          \
+    X(il2cpp_class_get_flags,          snap_class_get_flags)              \
+    X(il2cpp_class_is_valuetype,       snap_class_is_valuetype)           \
+    X(il2cpp_class_is_enum,            snap_class_is_enum)                \
+    X(il2cpp_class_get_parent,         snap_class_get_parent)             \
+    X(il2cpp_class_get_declaring_type, snap_class_get_declaring_type)     \
+    X(il2cpp_class_get_fields,         snap_class_get_fields)             \
+    X(il2cpp_class_get_methods,        snap_class_get_methods)            \
+    X(il2cpp_class_get_properties,     snap_class_get_properties)         \
+    X(il2cpp_field_get_name,           snap_field_get_name)               \
+    X(il2cpp_field_get_type,           snap_field_get_type)               \
+    X(il2cpp_field_get_flags,          snap_field_get_flags)              \
+    X(il2cpp_field_get_offset,         snap_field_get_offset)             \
+    X(il2cpp_field_static_get_value,   snap_field_static_get_value)       \
+    X(il2cpp_method_get_name,          snap_method_get_name)              \
+    X(il2cpp_method_get_flags,         snap_method_get_flags)             \
+    X(il2cpp_method_get_param_count,   snap_method_get_param_count)       \
+    X(il2cpp_method_get_param,         snap_method_get_param)             \
+    X(il2cpp_method_get_param_name,    snap_method_get_param_name)        \
+    X(il2cpp_method_get_return_type,   snap_method_get_return_type)       \
+    X(il2cpp_property_get_name,        snap_property_get_name)            \
+    X(il2cpp_property_get_get_method,  snap_property_get_get_method)      \
+    X(il2cpp_property_get_set_method,  snap_property_get_set_method)      \
+    X(il2cpp_type_is_byref,            snap_type_is_byref)
+
+struct SavedApi {
+#define MDB_SNAPSHOT_DECL(slot, fn) decltype(api::slot) slot;
+    MDB_SNAPSHOT_OVERRIDES(MDB_SNAPSHOT_DECL)
+#undef MDB_SNAPSHOT_DECL
+};
+
+SavedApi InstallOverrides() {
+    SavedApi saved{};
+#define MDB_SNAPSHOT_SAVE(slot, fn) saved.slot = api::slot; api::slot = &fn;
+    MDB_SNAPSHOT_OVERRIDES(MDB_SNAPSHOT_SAVE)
+#undef MDB_SNAPSHOT_SAVE
+    return saved;
+}
+
+void RestoreOverrides(const SavedApi& saved) {
+#define MDB_SNAPSHOT_RESTORE(slot, fn) api::slot = saved.slot;
+    MDB_SNAPSHOT_OVERRIDES(MDB_SNAPSHOT_RESTORE)
+#undef MDB_SNAPSHOT_RESTORE
+}
+
+// Accounted footprint of the rebuilt graph — vector capacities only; the
+// per-struct fixed tails dominate, so this tracks the real cost closely
+size_t SnapshotBytes(const LoadedSnapshot& snap) {
+    return snap.strings.capacity() +
+           snap.images.capacity() * sizeof(RtImage) +
+           snap.assemblies.capacity() * sizeof(il2cppAssembly) +
+           snap.assembly_ptrs.capacity() * sizeof(il2cppAssembly*) +
+           snap.classes.capacity() * sizeof(RtClass) +
+           snap.types.capacity() * sizeof(RtType) +
+           snap.fields.capacity() * sizeof(RtField) +
+           snap.methods.capacity() * sizeof(RtMethod) +
+           snap.params.capacity() * sizeof(il2cppParameterInfo) +
+           snap.properties.capacity() * sizeof(il2cppPropertyInfo) +
+           snap.image_class_ptrs.capacity() * sizeof(il2cppClass*) +
+           snap.generic_classes.capacity() * sizeof(il2cppGenericClass) +
+           snap.generic_insts.capacity() * sizeof(il2cppGenericInst) +
+           snap.generic_args.capacity() * sizeof(il2cppType*) +
+           snap.containers.capacity() * sizeof(il2cppGenericContainer);
+}
+
+} // namespace
+
+bool Replay(const std::string& snapshot_path, const std::string& output_directory,
+            Dumper::DumpResult* out, std::string* error) {
+    auto snap = LoadSnapshotFile(snapshot_path, error);
+    if (!snap) return false;
+
+    size_t snapshot_bytes = SnapshotBytes(*snap);
+    Mem::Account(Mem::Tag::Snapshot, snapshot_bytes);
+
+    // The dumper still resolves exports and the GameAssembly module handle on
+    // entry, so a loaded (mock or real) GameAssembly must exist before the
+    // override goes in; the override then shadows every slot the pipeline uses
+    if (api::ensure_exports() != Il2CppStatus::OK) {
+        if (error) *error = "IL2CPP exports not resolved (GameAssembly.dll must be loaded)";
+        Mem::Release(Mem::Tag::Snapshot, snapshot_bytes);
+        return false;
+    }
+
+    g_active = snap.get();
+    SavedApi saved = InstallOverrides();
+
+    Dumper::DumpResult result = Dumper::DumpIL2CppRuntime(output_directory);
+
+    RestoreOverrides(saved);
+    g_active = nullptr;
+    snap.reset();
+    Mem::Release(Mem::Tag::Snapshot, snapshot_bytes);
+
+    if (out) *out = result;
+    if (!result.success) {
+        if (error) *error = result.error_message;
+        return false;
+    }
+    return true;
+}
+
+} // namespace DumpSnapshot
+} // namespace MDB
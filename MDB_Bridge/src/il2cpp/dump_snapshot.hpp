@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+
+#include "il2cpp_dumper.hpp"
+
+// ============================================================================
+// Dump Traversal Snapshot (capture & offline replay)
+// ============================================================================
+// Dumper performance work (parallelism, interning, memoization) needs
+// reproducible input, but DumpIL2CppRuntime only runs against a live game.
+// This module serializes the raw traversal input — assemblies, images,
+// classes, fields, methods, properties, and the type graph (including
+// generic instantiations) — into a .mdbs snapshot file, and can later
+// rebuild that graph in memory as layout-compatible mirror structs and
+// point the resolver's il2cpp_* function pointers at snapshot-backed
+// accessors. DumpIL2CppRuntime then runs its full name-resolution and
+// wrapper-generation pipeline against the snapshot with no game process,
+// producing the same per-phase timings as a live dump.
+//
+// The snapshot is distinct from the binary metadata cache (metadata.mdbc):
+// the cache is a flattened lookup surface for mods, while the snapshot
+// preserves the pointer graph exactly as the dumper walks it — parent and
+// declaring-type chains, generic argument vectors, enum literal values —
+// so replay exercises the same code paths at the same fan-out.
+//
+// Replay swaps the resolver function pointers for the duration of the run
+// and restores them afterwards; it must not race a live dump. The intended
+// host is the offline replay benchmark (MDB_Bench_DumpReplay), which runs
+// next to the mock GameAssembly so export resolution succeeds before the
+// override is installed.
+
+namespace MDB {
+namespace DumpSnapshot {
+
+/// Walk the live IL2CPP metadata and serialize the dump traversal input to
+/// `path`. Requires resolved IL2CPP exports (i.e. a live or mock game).
+/// Returns false and fills `error` (when non-null) on failure; a partial
+/// file is removed.
+bool Capture(const std::string& path, std::string* error);
+
+/// Load the snapshot at `snapshot_path`, install snapshot-backed accessors
+/// over the resolver function pointers, run DumpIL2CppRuntime against
+/// `output_directory`, then restore the original pointers. Fills `out`
+/// with the dump result (phase timings included). Each call reloads the
+/// snapshot into fresh allocations so per-pointer memo caches stay cold
+/// between repetitions. Returns false and fills `error` on failure.
+bool Replay(const std::string& snapshot_path, const std::string& output_directory,
+            Dumper::DumpResult* out, std::string* error);
+
+} // namespace DumpSnapshot
+} // namespace MDB
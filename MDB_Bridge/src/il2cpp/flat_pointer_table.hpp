@@ -0,0 +1,208 @@
+#pragma once
+// ============================================================================
+// Flat Pointer-Keyed Hash Tables for MDB Bridge
+// ============================================================================
+// Open-addressing set/count-map for pointer-sized keys. The obfuscation
+// detector inserts and probes millions of method pointers per analysis; the
+// node-based std containers pay one allocation per entry and a cache miss per
+// probe. These tables keep everything in one flat array: power-of-two
+// capacity, multiplicative hashing, linear probing, grown at 50% load.
+//
+// Key 0 cannot live in the slot array (it marks an empty slot) and is tracked
+// out-of-band, so null method pointers behave like any other key.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace MDB {
+
+namespace _flat_detail {
+
+// Fibonacci multiplicative hash — spreads the low entropy of aligned
+// pointers across the high bits, which the index mask uses
+inline size_t MixPointer(uintptr_t key) {
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 17);
+}
+
+} // namespace _flat_detail
+
+// ============================================================================
+// FlatPointerSet — open-addressing set of pointer-sized keys
+// ============================================================================
+
+class FlatPointerSet {
+public:
+    void Clear() {
+        m_slots.clear();
+        m_size = 0;
+        m_has_zero = false;
+    }
+
+    void Reserve(size_t count) {
+        size_t needed = NextCapacity(count);
+        if (needed > m_slots.size()) Rehash(needed);
+    }
+
+    /// Insert a key. Returns true if it was not already present.
+    bool Insert(uintptr_t key) {
+        if (key == 0) {
+            if (m_has_zero) return false;
+            m_has_zero = true;
+            return true;
+        }
+        if ((m_size + 1) * 2 > m_slots.size()) Rehash(NextCapacity(m_size + 1));
+        size_t mask = m_slots.size() - 1;
+        size_t idx = _flat_detail::MixPointer(key) & mask;
+        while (m_slots[idx] != 0) {
+            if (m_slots[idx] == key) return false;
+            idx = (idx + 1) & mask;
+        }
+        m_slots[idx] = key;
+        m_size++;
+        return true;
+    }
+
+    bool Insert(const void* key) { return Insert(reinterpret_cast<uintptr_t>(key)); }
+
+    bool Contains(uintptr_t key) const {
+        if (key == 0) return m_has_zero;
+        if (m_slots.empty()) return false;
+        size_t mask = m_slots.size() - 1;
+        size_t idx = _flat_detail::MixPointer(key) & mask;
+        while (m_slots[idx] != 0) {
+            if (m_slots[idx] == key) return true;
+            idx = (idx + 1) & mask;
+        }
+        return false;
+    }
+
+    bool Contains(const void* key) const { return Contains(reinterpret_cast<uintptr_t>(key)); }
+
+    size_t Size() const { return m_size + (m_has_zero ? 1 : 0); }
+
+    /// Visit every key (unspecified order)
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+        if (m_has_zero) fn(static_cast<uintptr_t>(0));
+        for (uintptr_t slot : m_slots) {
+            if (slot != 0) fn(slot);
+        }
+    }
+
+private:
+    static size_t NextCapacity(size_t count) {
+        size_t cap = 16;
+        while (cap < count * 2) cap <<= 1;
+        return cap;
+    }
+
+    void Rehash(size_t newCapacity) {
+        std::vector<uintptr_t> old = std::move(m_slots);
+        m_slots.assign(newCapacity, 0);
+        size_t mask = newCapacity - 1;
+        for (uintptr_t key : old) {
+            if (key == 0) continue;
+            size_t idx = _flat_detail::MixPointer(key) & mask;
+            while (m_slots[idx] != 0) idx = (idx + 1) & mask;
+            m_slots[idx] = key;
+        }
+    }
+
+    std::vector<uintptr_t> m_slots;   // 0 = empty
+    size_t m_size = 0;                // non-zero keys only
+    bool m_has_zero = false;
+};
+
+// ============================================================================
+// FlatPointerCountMap — open-addressing map from pointer-sized key to count
+// ============================================================================
+
+class FlatPointerCountMap {
+public:
+    void Clear() {
+        m_slots.clear();
+        m_size = 0;
+        m_zero_count = 0;
+    }
+
+    void Reserve(size_t count) {
+        size_t needed = NextCapacity(count);
+        if (needed > m_slots.size()) Rehash(needed);
+    }
+
+    /// Add `delta` to the count stored for `key`
+    void Add(uintptr_t key, uint32_t delta) {
+        if (key == 0) {
+            m_zero_count += delta;
+            return;
+        }
+        if ((m_size + 1) * 2 > m_slots.size()) Rehash(NextCapacity(m_size + 1));
+        size_t mask = m_slots.size() - 1;
+        size_t idx = _flat_detail::MixPointer(key) & mask;
+        while (m_slots[idx].key != 0) {
+            if (m_slots[idx].key == key) {
+                m_slots[idx].count += delta;
+                return;
+            }
+            idx = (idx + 1) & mask;
+        }
+        m_slots[idx].key = key;
+        m_slots[idx].count = delta;
+        m_size++;
+    }
+
+    /// Count stored for `key`, or 0 if absent
+    uint32_t Get(uintptr_t key) const {
+        if (key == 0) return m_zero_count;
+        if (m_slots.empty()) return 0;
+        size_t mask = m_slots.size() - 1;
+        size_t idx = _flat_detail::MixPointer(key) & mask;
+        while (m_slots[idx].key != 0) {
+            if (m_slots[idx].key == key) return m_slots[idx].count;
+            idx = (idx + 1) & mask;
+        }
+        return 0;
+    }
+
+    size_t Size() const { return m_size + (m_zero_count > 0 ? 1 : 0); }
+
+    /// Visit every (key, count) pair (unspecified order)
+    template <typename Fn>
+    void ForEach(Fn&& fn) const {
+        if (m_zero_count > 0) fn(static_cast<uintptr_t>(0), m_zero_count);
+        for (const Slot& slot : m_slots) {
+            if (slot.key != 0) fn(slot.key, slot.count);
+        }
+    }
+
+private:
+    struct Slot {
+        uintptr_t key = 0;   // 0 = empty
+        uint32_t count = 0;
+    };
+
+    static size_t NextCapacity(size_t count) {
+        size_t cap = 16;
+        while (cap < count * 2) cap <<= 1;
+        return cap;
+    }
+
+    void Rehash(size_t newCapacity) {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.assign(newCapacity, Slot{});
+        size_t mask = newCapacity - 1;
+        for (const Slot& slot : old) {
+            if (slot.key == 0) continue;
+            size_t idx = _flat_detail::MixPointer(slot.key) & mask;
+            while (m_slots[idx].key != 0) idx = (idx + 1) & mask;
+            m_slots[idx] = slot;
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    size_t m_size = 0;          // non-zero keys only
+    uint32_t m_zero_count = 0;
+};
+
+} // namespace MDB
@@ -2,6 +2,12 @@
 #include "il2cpp_resolver.hpp"
 #include "obfuscation_detector.hpp"
 #include "mapping_loader.hpp"
+#include "metadata_cache.hpp"
+#include "core/config.hpp"
+#include "core/mem_stats.hpp"
+#include "core/startup_fs.hpp"
+#include "core/startup_trace.hpp"
+#include "core/thread_pool.hpp"
 
 #include <Il2CppTableDefine.hpp>
 #include <Il2CppTypes.hpp>
@@ -19,6 +25,19 @@
 #include <set>
 #include <algorithm>
 #include <functional>
+#include <iterator>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <condition_variable>
+#include <unordered_map>
+#include <unordered_set>
+#include <shared_mutex>
+#include <mutex>
+#include <memory>
+#include <string_view>
+#include <cstring>
+#include <cstdio>
 
 // Convenience aliases into the resolver's internal namespace
 namespace api = il2cpp::_internal;
@@ -31,8 +50,11 @@ namespace Dumper {
 // Constants & Configuration
 // ============================================================================
 
-// Namespaces whose types should NOT be wrapped (BCL / Unity internals)
-static const std::set<std::string> SKIP_NAMESPACES = {
+// Namespaces whose types should NOT be wrapped (BCL / Unity internals).
+// These checks run for every class and every type reference in the dump's
+// innermost loops, so they are hash sets keyed by string_view (O(1), no
+// per-lookup string copies) rather than ordered tree sets.
+static const std::unordered_set<std::string_view> SKIP_NAMESPACES = {
     "System", "System.Collections", "System.Collections.Generic", "System.IO", "System.Text",
     "System.Threading", "System.Threading.Tasks", "System.Linq", "System.Reflection",
     "System.Runtime", "System.Runtime.CompilerServices", "System.Runtime.InteropServices",
@@ -41,18 +63,24 @@ static const std::set<std::string> SKIP_NAMESPACES = {
     "UnityEngine.Internal", "UnityEngineInternal"
 };
 
-static bool ShouldSkipNamespace(const std::string& ns) {
+// A handful of prefixes checked linearly — at this size a flat scan beats
+// any hashed structure
+static constexpr std::string_view SKIP_NAMESPACE_PREFIXES[] = {
+    "System.", "Mono.", "Internal.", "Microsoft.", "MS."
+};
+
+static bool ShouldSkipNamespace(std::string_view ns) {
     if (SKIP_NAMESPACES.find(ns) != SKIP_NAMESPACES.end()) return true;
-    if (ns.rfind("System.", 0) == 0) return true;
-    if (ns.rfind("Mono.", 0) == 0) return true;
-    if (ns.rfind("Internal.", 0) == 0) return true;
-    if (ns.rfind("Microsoft.", 0) == 0) return true;
-    if (ns.rfind("MS.", 0) == 0) return true;
+    for (std::string_view prefix : SKIP_NAMESPACE_PREFIXES) {
+        if (ns.substr(0, prefix.size()) == prefix) return true;
+    }
     return false;
 }
 
-// Set of fully-qualified type names that will be emitted (populated between Phase 1 and Phase 2)
-static std::set<std::string> g_knownTypes;
+// Set of fully-qualified type names that will be emitted (populated between
+// Phase 1 and Phase 2). Views are interned in the dump string arena; cleared
+// before the arena resets at the end of each run.
+static std::unordered_set<std::string_view> g_knownTypes;
 
 // Obfuscation fake method detector (populated early in DumpIL2CppRuntime)
 static MDB::Obfuscation::Detector* g_obfuscation_detector = nullptr;
@@ -60,13 +88,146 @@ static MDB::Obfuscation::Detector* g_obfuscation_detector = nullptr;
 // Deobfuscation mapping lookup (loaded from mappings.json during dump)
 static MDB::Mappings::MappingLookup g_mappingLookup;
 
+// ============================================================================
+// Dump-Time String Arena & Interning
+// ============================================================================
+// A dump builds ClassInfo records for tens of thousands of classes, and the
+// same namespace, DLL, and type-name strings recur constantly. Interning them
+// in a per-run bump arena stores each distinct string once, hands out stable
+// views, and releases everything with a single Reset() at the end of the run
+// instead of tens of thousands of individual frees inside the game heap.
+// Intern() is mutex-guarded because Phase 1 runs on a worker pool; the views
+// stay valid until Reset().
+
+class DumpStringArena {
+public:
+    std::string_view Intern(std::string_view s) {
+        if (s.empty()) return {};
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = interned_.find(s);
+        if (it != interned_.end()) return *it;
+
+        char* mem = Allocate(s.size());
+        std::memcpy(mem, s.data(), s.size());
+        std::string_view view(mem, s.size());
+        interned_.insert(view);
+        return view;
+    }
+
+    /// Free every block at once. Invalidates all views handed out so far.
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        interned_.clear();
+        blocks_.clear();
+        Mem::Release(Mem::Tag::DumpArena, block_bytes_);
+        block_bytes_ = 0;
+        cur_ = nullptr;
+        remaining_ = 0;
+    }
+
+private:
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    // Caller holds mutex_
+    char* Allocate(size_t n) {
+        if (n > kBlockSize) {
+            // Oversized string: give it a dedicated block, keep the current
+            // bump block untouched
+            blocks_.push_back(std::make_unique<char[]>(n));
+            block_bytes_ += n;
+            Mem::Account(Mem::Tag::DumpArena, n);
+            return blocks_.back().get();
+        }
+        if (n > remaining_) {
+            blocks_.push_back(std::make_unique<char[]>(kBlockSize));
+            block_bytes_ += kBlockSize;
+            Mem::Account(Mem::Tag::DumpArena, kBlockSize);
+            cur_ = blocks_.back().get();
+            remaining_ = kBlockSize;
+        }
+        char* mem = cur_;
+        cur_ += n;
+        remaining_ -= n;
+        return mem;
+    }
+
+    std::mutex mutex_;
+    std::unordered_set<std::string_view> interned_;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* cur_ = nullptr;
+    size_t remaining_ = 0;
+    size_t block_bytes_ = 0;
+};
+
+// Per-run arena backing every ClassInfo string view
+static DumpStringArena g_stringArena;
+
+// ============================================================================
+// Chunked Wrapper Text Builder
+// ============================================================================
+// The largest generated wrappers exceed a megabyte; composing them through a
+// single growing buffer reallocates and copies the accumulated text over and
+// over. RopeBuilder collects the file as a sequence of chunks instead:
+// small appends fill fixed-size tail chunks, large generator outputs are
+// moved in as chunks of their own, and existing data is never copied again.
+// The writer thread gathers the chunks straight to disk.
+
+class RopeBuilder {
+public:
+    /// Append text by copy into the current tail chunk (spilling into a new
+    /// chunk when full). Meant for headers, separators, and other small runs.
+    void Append(std::string_view text) {
+        if (text.empty()) return;
+        if (!tail_open_ || chunks_.back().size() + text.size() > kChunkSize) {
+            chunks_.emplace_back();
+            chunks_.back().reserve(kChunkSize);
+            tail_open_ = true;
+        }
+        chunks_.back().append(text.data(), text.size());
+        size_ += text.size();
+    }
+
+    /// Take ownership of a completed string as its own chunk — no copy.
+    /// Meant for generator outputs, which can be hundreds of KB each.
+    void AppendOwned(std::string&& text) {
+        if (text.empty()) return;
+        size_ += text.size();
+        chunks_.push_back(std::move(text));
+        tail_open_ = false;  // never grow into an owned chunk
+    }
+
+    /// Release the chunk sequence (builder becomes empty).
+    std::vector<std::string> TakeChunks() {
+        tail_open_ = false;
+        size_ = 0;
+        return std::move(chunks_);
+    }
+
+    size_t Size() const { return size_; }
+
+private:
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    std::vector<std::string> chunks_;
+    bool tail_open_ = false;
+    size_t size_ = 0;
+};
+
 // Namespaces whose types are not available in .NET Framework 4.7.2
-static bool IsBlockedNamespace(const std::string& ns) {
-    if (ns == "Mono" || ns.rfind("Mono.", 0) == 0) return true;
-    if (ns == "Internal" || ns.rfind("Internal.", 0) == 0) return true;
-    if (ns == "UnityEngineInternal" || ns == "UnityEngine.Internal") return true;
-    if (ns == "System.IO.Enumeration") return true;
-    if (ns == "System.Net.Http") return true;
+static const std::unordered_set<std::string_view> BLOCKED_NAMESPACES = {
+    "Mono", "Internal", "UnityEngineInternal", "UnityEngine.Internal",
+    "System.IO.Enumeration", "System.Net.Http"
+};
+
+static constexpr std::string_view BLOCKED_NAMESPACE_PREFIXES[] = {
+    "Mono.", "Internal."
+};
+
+static bool IsBlockedNamespace(std::string_view ns) {
+    if (BLOCKED_NAMESPACES.find(ns) != BLOCKED_NAMESPACES.end()) return true;
+    for (std::string_view prefix : BLOCKED_NAMESPACE_PREFIXES) {
+        if (ns.substr(0, prefix.size()) == prefix) return true;
+    }
     return false;
 }
 
@@ -168,11 +329,63 @@ static std::string GetFullyQualifiedTypeName(const il2cppType* type, const std::
                                               uint32_t mvarBaseIndex = 0);
 static std::string GetFullyQualifiedClassName(il2cppClass* klass, const std::string& currentNamespace);
 
+// ============================================================================
+// Name Resolution Memoization
+// ============================================================================
+// Common types (Vector3, GameObject, string lists, …) appear in tens of
+// thousands of signatures; resolving each occurrence from scratch repeats the
+// same namespace walks, sanitization, and mapping lookups. Results are cached
+// per metadata pointer, sub-keyed by the namespace of the file being generated
+// (a type resolves to its short name inside its own namespace). The caches
+// must be dropped whenever the inputs change mid-dump (g_knownTypes registry
+// build, mappings.json load). Guarded by a shared mutex because the dump
+// phases run on a worker pool.
+
+static std::shared_mutex g_nameCacheMutex;
+static std::unordered_map<const void*, std::map<std::string, std::string>> g_classNameCache;
+static std::unordered_map<const void*, std::map<std::string, std::string>> g_typeNameCache;
+
+// Approximate accounted footprint of both caches (guarded by the cache
+// mutex). Node-based containers hide their true cost, so each entry is
+// charged its string bytes plus an estimated per-node overhead.
+static size_t g_nameCacheBytes = 0;
+static constexpr size_t kNameCacheNodeOverhead = 64;
+
+static void ClearNameCaches() {
+    std::unique_lock lock(g_nameCacheMutex);
+    g_classNameCache.clear();
+    g_typeNameCache.clear();
+    Mem::Release(Mem::Tag::NameCache, g_nameCacheBytes);
+    g_nameCacheBytes = 0;
+}
+
+/// Look up a cached resolution. Returns true and fills `out` on a hit.
+static bool NameCacheGet(const std::unordered_map<const void*, std::map<std::string, std::string>>& cache,
+                         const void* key, const std::string& currentNamespace, std::string& out) {
+    std::shared_lock lock(g_nameCacheMutex);
+    auto it = cache.find(key);
+    if (it == cache.end()) return false;
+    auto nsIt = it->second.find(currentNamespace);
+    if (nsIt == it->second.end()) return false;
+    out = nsIt->second;
+    return true;
+}
+
+static void NameCachePut(std::unordered_map<const void*, std::map<std::string, std::string>>& cache,
+                         const void* key, const std::string& currentNamespace, const std::string& value) {
+    std::unique_lock lock(g_nameCacheMutex);
+    cache[key][currentNamespace] = value;
+
+    size_t bytes = currentNamespace.size() + value.size() + kNameCacheNodeOverhead;
+    g_nameCacheBytes += bytes;
+    Mem::Account(Mem::Tag::NameCache, bytes);
+}
+
 /// Get the fully-qualified C# type name from an il2cppClass.
 /// If the type lives in `currentNamespace`, returns the short name.
 /// Otherwise, returns `global::Full.Namespace.TypeName`.
 /// Validates game types against g_knownTypes registry when populated.
-static std::string GetFullyQualifiedClassName(il2cppClass* klass, const std::string& currentNamespace) {
+static std::string GetFullyQualifiedClassNameUncached(il2cppClass* klass, const std::string& currentNamespace) {
     if (!klass) return "object";
 
     const char* name = api::il2cpp_class_get_name(klass);
@@ -271,11 +484,23 @@ static std::string GetFullyQualifiedClassName(il2cppClass* klass, const std::str
     return "global::" + effectiveNs + "." + safeName;
 }
 
+/// Memoizing wrapper around GetFullyQualifiedClassNameUncached.
+static std::string GetFullyQualifiedClassName(il2cppClass* klass, const std::string& currentNamespace) {
+    if (!klass) return "object";
+
+    std::string cached;
+    if (NameCacheGet(g_classNameCache, klass, currentNamespace, cached)) return cached;
+
+    std::string resolved = GetFullyQualifiedClassNameUncached(klass, currentNamespace);
+    NameCachePut(g_classNameCache, klass, currentNamespace, resolved);
+    return resolved;
+}
+
 /// Get the fully-qualified C# type name from an il2cppType.
 /// When methodGenericParams is non-null, IL2CPP_TYPE_MVAR types are resolved to
 /// the named type parameters (T, T0, T1, …) instead of being erased to "object".
 /// mvarBaseIndex is the global generic-parameter index of the method's first type param.
-static std::string GetFullyQualifiedTypeName(const il2cppType* type, const std::string& currentNamespace,
+static std::string GetFullyQualifiedTypeNameUncached(const il2cppType* type, const std::string& currentNamespace,
                                               const std::vector<std::string>* methodGenericParams,
                                               uint32_t mvarBaseIndex) {
     if (!type) return "object";
@@ -430,6 +655,28 @@ static std::string GetFullyQualifiedTypeName(const il2cppType* type, const std::
     return GetFullyQualifiedClassName(klass, currentNamespace);
 }
 
+/// Memoizing wrapper around GetFullyQualifiedTypeNameUncached. Lookups that
+/// carry method generic parameters are not cached: an MVAR anywhere in the
+/// type (including nested generic arguments) resolves against the current
+/// method's parameter list, so the result is not a pure function of the
+/// type pointer.
+static std::string GetFullyQualifiedTypeName(const il2cppType* type, const std::string& currentNamespace,
+                                              const std::vector<std::string>* methodGenericParams,
+                                              uint32_t mvarBaseIndex) {
+    if (!type) return "object";
+
+    if (methodGenericParams && !methodGenericParams->empty()) {
+        return GetFullyQualifiedTypeNameUncached(type, currentNamespace, methodGenericParams, mvarBaseIndex);
+    }
+
+    std::string cached;
+    if (NameCacheGet(g_typeNameCache, type, currentNamespace, cached)) return cached;
+
+    std::string resolved = GetFullyQualifiedTypeNameUncached(type, currentNamespace, methodGenericParams, mvarBaseIndex);
+    NameCachePut(g_typeNameCache, type, currentNamespace, resolved);
+    return resolved;
+}
+
 // ============================================================================
 // Type Classification Helpers
 // ============================================================================
@@ -437,22 +684,24 @@ static std::string GetFullyQualifiedTypeName(const il2cppType* type, const std::
 enum class TypeKind { Delegate, Enum, Interface, Struct, Class };
 
 struct ClassInfo {
+    // All string fields are views into g_stringArena (or string literals) —
+    // valid until the arena is Reset() at the end of the dump run
     il2cppClass* klass;
-    std::string name;          // display name (friendly if mapped, else sanitized)
-    std::string rawName;       // raw IL2CPP name (unsanitized, always obfuscated)
-    std::string ns;            // effective namespace (empty→"Global")
-    std::string rawNs;         // raw IL2CPP namespace (may be empty)
-    std::string dll;
+    std::string_view name;     // display name (friendly if mapped, else sanitized)
+    std::string_view rawName;  // raw IL2CPP name (unsanitized, always obfuscated)
+    std::string_view ns;       // effective namespace (empty→"Global")
+    std::string_view rawNs;    // raw IL2CPP namespace (may be empty)
+    std::string_view dll;
     int flags;
     bool is_valuetype;
     bool is_enum;
     bool is_interface;
     TypeKind kind;
-    std::string visibility;
+    std::string_view visibility;
     bool is_abstract;
     bool is_sealed;
     bool is_static;
-    std::string base_class;    // fully qualified base class for wrappers
+    std::string_view base_class;  // fully qualified base class for wrappers
 };
 
 static std::string GetVisibility(int flags) {
@@ -472,34 +721,34 @@ static std::string GetFieldVisibility(uint32_t attrs) {
 
 /// Check if a class is a delegate (parent is System.MulticastDelegate)
 static bool IsDelegate(il2cppClass* klass) {
-    auto* parent = api::il2cpp_class_get_parent(klass);
+    const auto* meta = il2cpp::get_class_meta(klass);
+    const auto* parent = meta ? il2cpp::get_class_meta(meta->parent) : nullptr;
     if (!parent) return false;
-    const char* parentName = api::il2cpp_class_get_name(parent);
-    const char* parentNs   = api::il2cpp_class_get_namespace(parent);
-    if (!parentName || !parentNs) return false;
-    return (std::string(parentNs) == "System" &&
-            (std::string(parentName) == "MulticastDelegate" || std::string(parentName) == "Delegate"));
+    return (std::string_view(parent->namespaze) == "System" &&
+            (std::string_view(parent->name) == "MulticastDelegate" ||
+             std::string_view(parent->name) == "Delegate"));
 }
 
 /// Classify a type and fill in ClassInfo
 static ClassInfo ClassifyType(il2cppClass* klass, const std::string& dllName, const std::string& effectiveNamespace) {
     ClassInfo info{};
     info.klass = klass;
-    const char* rawClassName = api::il2cpp_class_get_name(klass);
-    info.rawName = rawClassName ? rawClassName : "";
-    info.name = SanitizeTypeName(info.rawName);
-    const char* rawNs = api::il2cpp_class_get_namespace(klass);
-    info.rawNs = rawNs ? rawNs : "";
-    info.ns = effectiveNamespace;
-    info.dll = dllName;
-    info.flags = api::il2cpp_class_get_flags(klass);
-    info.is_valuetype = api::il2cpp_class_is_valuetype(klass);
-    info.is_enum = api::il2cpp_class_is_enum(klass);
+    // One cached snapshot instead of six accessor calls per class —
+    // classification touches every class in every image
+    const auto* meta = il2cpp::get_class_meta(klass);
+    info.rawName = g_stringArena.Intern(meta->name);
+    info.name = g_stringArena.Intern(SanitizeTypeName(std::string(info.rawName)));
+    info.rawNs = g_stringArena.Intern(meta->namespaze);
+    info.ns = g_stringArena.Intern(effectiveNamespace);
+    info.dll = g_stringArena.Intern(dllName);
+    info.flags = meta->flags;
+    info.is_valuetype = meta->is_valuetype;
+    info.is_enum = meta->is_enum;
     info.is_interface = (info.flags & TYPE_ATTRIBUTE_INTERFACE) != 0;
     info.is_abstract = (info.flags & TYPE_ATTRIBUTE_ABSTRACT) != 0;
     info.is_sealed = (info.flags & TYPE_ATTRIBUTE_SEALED) != 0;
     info.is_static = info.is_abstract && info.is_sealed;
-    info.visibility = GetVisibility(info.flags);
+    info.visibility = g_stringArena.Intern(GetVisibility(info.flags));
 
     // Determine kind
     if (IsDelegate(klass)) {
@@ -516,14 +765,13 @@ static ClassInfo ClassifyType(il2cppClass* klass, const std::string& dllName, co
 
     // Determine base class for class wrappers
     if (info.kind == TypeKind::Class) {
-        auto* parent = api::il2cpp_class_get_parent(klass);
+        auto* parent = meta->parent;
         if (parent) {
             auto parentType = api::il2cpp_class_get_type(parent);
             if (parentType && parentType->m_uType != IL2CPP_TYPE_OBJECT) {
-                const char* parentName = api::il2cpp_class_get_name(parent);
-                const char* parentNs = api::il2cpp_class_get_namespace(parent);
-                std::string pName(parentName ? parentName : "");
-                std::string pNs(parentNs ? parentNs : "");
+                const auto* parentMeta = il2cpp::get_class_meta(parent);
+                std::string pName(parentMeta->name);
+                std::string pNs(parentMeta->namespaze);
 
                 // Skip synthetic base types
                 if (pNs == "System" && (pName == "ValueType" || pName == "Enum" ||
@@ -533,7 +781,7 @@ static ClassInfo ClassifyType(il2cppClass* klass, const std::string& dllName, co
                     // System/framework types don't have IL2CPP wrapper IntPtr constructors
                     info.base_class = "";
                 } else {
-                    info.base_class = GetFullyQualifiedClassName(parent, effectiveNamespace);
+                    info.base_class = g_stringArena.Intern(GetFullyQualifiedClassName(parent, effectiveNamespace));
                 }
             }
         }
@@ -790,6 +1038,29 @@ static std::string GenerateStruct(il2cppClass* klass, const std::string& current
 // Class Generation (Fields, Properties, Methods)
 // ============================================================================
 
+/// Map a generated C# type name to the blittable type used in a direct-call
+/// delegate signature. Returns false when the type cannot cross a native
+/// function-pointer boundary without marshaling. bool and char are widened
+/// explicitly (byte/ushort) because default delegate marshaling (4-byte BOOL,
+/// ANSI char) does not match IL2CPP's 1-byte bool / UTF-16 char. Also used
+/// as the eligibility test for cached-offset field accessors, which read and
+/// write the same set of types through raw pointers.
+static bool DirectCallNativeType(const std::string& csType, std::string& nativeType) {
+    static const std::unordered_map<std::string_view, std::string_view> kBlittable = {
+        { "int",    "int"    }, { "uint",   "uint"   },
+        { "long",   "long"   }, { "ulong",  "ulong"  },
+        { "short",  "short"  }, { "ushort", "ushort" },
+        { "byte",   "byte"   }, { "sbyte",  "sbyte"  },
+        { "float",  "float"  }, { "double", "double" },
+        { "bool",   "byte"   }, { "char",   "ushort" },
+        { "IntPtr", "IntPtr" }, { "UIntPtr", "UIntPtr" },
+    };
+    auto it = kBlittable.find(csType);
+    if (it == kBlittable.end()) return false;
+    nativeType.assign(it->second);
+    return true;
+}
+
 /// Generate the field-as-property wrappers for a class
 static std::string GenerateClassFields(il2cppClass* klass, const std::string& currentNamespace,
                                        const std::string& obfClassName) {
@@ -797,6 +1068,14 @@ static std::string GenerateClassFields(il2cppClass* klass, const std::string& cu
     bool hasFields = false;
     std::set<std::string> emittedFieldNames;
 
+    const char* classNsRaw = api::il2cpp_class_get_namespace(klass);
+    const char* classNameRaw = api::il2cpp_class_get_name(klass);
+    std::string className(classNameRaw ? classNameRaw : "");
+    std::string staticNs = (classNsRaw && classNsRaw[0] != '\0') ? classNsRaw : "Global";
+
+    // Per-class ordinal for cached-offset accessor members
+    int fieldOffsetIndex = 0;
+
     void* iter = nullptr;
     while (auto field = api::il2cpp_class_get_fields(klass, &iter)) {
         auto attrs = api::il2cpp_field_get_flags(field);
@@ -852,13 +1131,57 @@ static std::string GenerateClassFields(il2cppClass* klass, const std::string& cu
             hasFields = true;
         }
 
+        // Primitive fields get a cached-offset accessor: resolve the field
+        // offset once (lazily), then read/write through raw pointer
+        // arithmetic over the instance pointer instead of paying the
+        // class/field/offset resolution on every access. Resolution failure
+        // (-1) falls back to GetField/SetField permanently.
+        std::string derefNative;
+        bool directField = DirectCallNativeType(typeName, derefNative);
+        std::string offsetIdx;
+        if (directField) {
+            offsetIdx = std::to_string(fieldOffsetIndex++);
+            ss << "        private static int __mdbFo" << offsetIdx << " = -2;\n";
+        }
+
         if (fieldIsDeobfuscated) {
             ss << "        /// <summary>Deobfuscated field. IL2CPP name: '" << fieldNameStr << "'</summary>\n";
         }
         ss << "        " << vis << " " << typeName << " " << displayFieldName << "\n";
         ss << "        {\n";
-        ss << "            get => Il2CppRuntime.GetField<" << typeName << ">(this, \"" << fieldNameStr << "\");\n";
-        ss << "            set => Il2CppRuntime.SetField<" << typeName << ">(this, \"" << fieldNameStr << "\", value);\n";
+        if (directField) {
+            std::string fo = "__mdbFo" + offsetIdx;
+            ss << "            get\n";
+            ss << "            {\n";
+            ss << "                if (" << fo << " == -2) " << fo << " = Il2CppRuntime.ResolveFieldOffset(\""
+               << staticNs << "\", \"" << className << "\", \"" << fieldNameStr << "\");\n";
+            ss << "                if (" << fo << " >= 0 && NativePtr != IntPtr.Zero)\n";
+            if (typeName == "bool") {
+                ss << "                    unsafe { return *((byte*)NativePtr + " << fo << ") != 0; }\n";
+            } else {
+                ss << "                    unsafe { return *(" << typeName << "*)((byte*)NativePtr + " << fo << "); }\n";
+            }
+            ss << "                return Il2CppRuntime.GetField<" << typeName << ">(this, \"" << fieldNameStr << "\");\n";
+            ss << "            }\n";
+            ss << "            set\n";
+            ss << "            {\n";
+            ss << "                if (" << fo << " == -2) " << fo << " = Il2CppRuntime.ResolveFieldOffset(\""
+               << staticNs << "\", \"" << className << "\", \"" << fieldNameStr << "\");\n";
+            ss << "                if (" << fo << " >= 0 && NativePtr != IntPtr.Zero)\n";
+            ss << "                {\n";
+            if (typeName == "bool") {
+                ss << "                    unsafe { *((byte*)NativePtr + " << fo << ") = (byte)(value ? 1 : 0); }\n";
+            } else {
+                ss << "                    unsafe { *(" << typeName << "*)((byte*)NativePtr + " << fo << ") = value; }\n";
+            }
+            ss << "                    return;\n";
+            ss << "                }\n";
+            ss << "                Il2CppRuntime.SetField<" << typeName << ">(this, \"" << fieldNameStr << "\", value);\n";
+            ss << "            }\n";
+        } else {
+            ss << "            get => Il2CppRuntime.GetField<" << typeName << ">(this, \"" << fieldNameStr << "\");\n";
+            ss << "            set => Il2CppRuntime.SetField<" << typeName << ">(this, \"" << fieldNameStr << "\", value);\n";
+        }
         ss << "        }\n\n";
     }
 
@@ -1027,6 +1350,9 @@ static std::string GenerateClassMethods(il2cppClass* klass, const std::string& c
     // Track emitted method signatures to avoid CS0111 duplicates after type erasure
     std::set<std::string> emittedMethodSigs;
 
+    // Per-class ordinal for direct-call stub members (overloads share a name)
+    int directStubIndex = 0;
+
     void* iter = nullptr;
     while (auto method = api::il2cpp_class_get_methods(klass, &iter)) {
         const char* methodName = api::il2cpp_method_get_name(method);
@@ -1178,11 +1504,57 @@ static std::string GenerateClassMethods(il2cppClass* klass, const std::string& c
         sigKey += ")";
         if (!emittedMethodSigs.insert(sigKey).second) continue;  // skip duplicate
 
+        // ── Direct-pointer call eligibility ───────────────────────────────
+        // Non-generic, non-virtual methods whose whole signature is blittable
+        // skip il2cpp_runtime_invoke: the wrapper fetches m_pMethodPointer
+        // once and calls it through a typed native delegate, avoiding boxing
+        // and argument-array construction per call. Virtual methods keep the
+        // runtime-invoke path for correct vtable dispatch.
+        bool directCall = !isGenericMethod && !(flags & METHOD_ATTRIBUTE_VIRTUAL);
+        std::string directRetType = "void";
+        std::vector<std::string> directParamTypes;
+        if (directCall && !isVoid && !DirectCallNativeType(returnTypeName, directRetType))
+            directCall = false;
+        for (uint32_t i = 0; directCall && i < paramCount; ++i) {
+            std::string nativeType;
+            if (!paramRefKind[i].empty() || !DirectCallNativeType(paramTypeNames[i], nativeType)) {
+                directCall = false;
+                break;
+            }
+            directParamTypes.push_back(nativeType);
+        }
+
         if (!hasMethods) {
             ss << "\n        // Methods\n";
             hasMethods = true;
         }
 
+        // Direct-call support members: typed delegate matching the IL2CPP
+        // native signature (instance pointer first, MethodInfo* last), the
+        // resolved delegate, the MethodInfo* it was bound to, and a miss flag
+        // so a failed resolution falls back permanently instead of retrying.
+        std::string stubIdx;
+        if (directCall) {
+            stubIdx = std::to_string(directStubIndex++);
+            ss << "        [global::System.Runtime.InteropServices.UnmanagedFunctionPointer(global::System.Runtime.InteropServices.CallingConvention.Cdecl)]\n";
+            ss << "        private delegate " << directRetType << " __MdbDirect" << stubIdx << "(";
+            bool firstDelParam = true;
+            if (!isStatic) {
+                ss << "IntPtr __this";
+                firstDelParam = false;
+            }
+            for (uint32_t i = 0; i < paramCount; ++i) {
+                if (!firstDelParam) ss << ", ";
+                ss << directParamTypes[i] << " " << paramNames[i];
+                firstDelParam = false;
+            }
+            if (!firstDelParam) ss << ", ";
+            ss << "IntPtr __method);\n";
+            ss << "        private static __MdbDirect" << stubIdx << " __mdbFp" << stubIdx << ";\n";
+            ss << "        private static IntPtr __mdbMi" << stubIdx << ";\n";
+            ss << "        private static bool __mdbMiss" << stubIdx << ";\n";
+        }
+
         // Signature
         if (methodIsDeobfuscated) {
             ss << "        /// <summary>Deobfuscated method. IL2CPP name: '" << methodNameStr << "'</summary>\n";
@@ -1245,6 +1617,62 @@ static std::string GenerateClassMethods(il2cppClass* klass, const std::string& c
             genericArgsExpr += " }";
         }
 
+        // Direct-call fast path: resolve the method pointer lazily on first
+        // call, then dispatch through the typed delegate. Any resolution
+        // failure (or a null instance) drops through to the runtime-invoke
+        // path below, so behavior is unchanged when the fast path is
+        // unavailable. Calls must come from an il2cpp-attached thread.
+        if (directCall) {
+            ss << "            if (__mdbFp" << stubIdx << " == null && !__mdbMiss" << stubIdx << ")\n";
+            ss << "            {\n";
+            ss << "                IntPtr __fp = Il2CppRuntime.ResolveDirectCall(\"" << staticNs << "\", \""
+               << className << "\", \"" << methodNameStr << "\", " << paramCount << ", out __mdbMi" << stubIdx << ");\n";
+            ss << "                if (__fp != IntPtr.Zero)\n";
+            ss << "                    __mdbFp" << stubIdx << " = (__MdbDirect" << stubIdx
+               << ")global::System.Runtime.InteropServices.Marshal.GetDelegateForFunctionPointer(__fp, typeof(__MdbDirect" << stubIdx << "));\n";
+            ss << "                else\n";
+            ss << "                    __mdbMiss" << stubIdx << " = true;\n";
+            ss << "            }\n";
+            if (isStatic) {
+                ss << "            if (__mdbFp" << stubIdx << " != null)\n";
+            } else {
+                ss << "            if (__mdbFp" << stubIdx << " != null && NativePtr != IntPtr.Zero)\n";
+            }
+            ss << "            {\n";
+
+            std::string callExpr = "__mdbFp" + stubIdx + "(";
+            bool firstCallArg = true;
+            if (!isStatic) {
+                callExpr += "NativePtr";
+                firstCallArg = false;
+            }
+            for (uint32_t i = 0; i < paramCount; ++i) {
+                if (!firstCallArg) callExpr += ", ";
+                if (paramTypeNames[i] == "bool") {
+                    callExpr += "(byte)(" + paramNames[i] + " ? 1 : 0)";
+                } else if (paramTypeNames[i] == "char") {
+                    callExpr += "(ushort)" + paramNames[i];
+                } else {
+                    callExpr += paramNames[i];
+                }
+                firstCallArg = false;
+            }
+            if (!firstCallArg) callExpr += ", ";
+            callExpr += "__mdbMi" + stubIdx + ")";
+
+            if (isVoid) {
+                ss << "                " << callExpr << ";\n";
+                ss << "                return;\n";
+            } else if (returnTypeName == "bool") {
+                ss << "                return " << callExpr << " != 0;\n";
+            } else if (returnTypeName == "char") {
+                ss << "                return (char)" << callExpr << ";\n";
+            } else {
+                ss << "                return " << callExpr << ";\n";
+            }
+            ss << "            }\n";
+        }
+
         // Method body — use CallGeneric/InvokeGenericVoid for generic methods
         if (isGenericMethod) {
             // Generic method invocation (requires inflation)
@@ -1300,8 +1728,8 @@ static std::string GenerateClass(const ClassInfo& info, const std::string& curre
     std::stringstream ss;
 
     // Determine display name (info.name may already be friendly after Phase 1.6)
-    std::string displayName = info.name;
-    bool isDeobfuscated = (info.name != SanitizeTypeName(info.rawName));
+    std::string displayName(info.name);
+    bool isDeobfuscated = (info.name != SanitizeTypeName(std::string(info.rawName)));
 
     if (isDeobfuscated) {
         ss << "    /// <summary>Deobfuscated class. IL2CPP name: '" << info.rawName << "'</summary>\n";
@@ -1317,15 +1745,16 @@ static std::string GenerateClass(const ClassInfo& info, const std::string& curre
     ss << "        public " << displayName << "(IntPtr nativePtr) : base(nativePtr) { }\n";
 
     // Fields as properties (skip for static classes)
+    std::string rawName(info.rawName);
     if (!info.is_static) {
-        ss << GenerateClassFields(info.klass, currentNamespace, info.rawName);
+        ss << GenerateClassFields(info.klass, currentNamespace, rawName);
     }
 
     // Properties
-    ss << GenerateClassProperties(info.klass, currentNamespace, info.is_static, info.rawName);
+    ss << GenerateClassProperties(info.klass, currentNamespace, info.is_static, rawName);
 
     // Methods
-    ss << GenerateClassMethods(info.klass, currentNamespace, info.is_static, info.rawName);
+    ss << GenerateClassMethods(info.klass, currentNamespace, info.is_static, rawName);
 
     ss << "    }\n";
     return ss.str();
@@ -1377,6 +1806,39 @@ static std::string BuildUsingStatements(const std::string& fileNamespace) {
     return ss.str();
 }
 
+// ============================================================================
+// Phase Timing
+// ============================================================================
+
+/// QueryPerformanceCounter stopwatch for the DumpResult phase breakdown.
+class PhaseTimer {
+public:
+    PhaseTimer() { QueryPerformanceCounter(&start_); }
+
+    double ElapsedMs() const {
+        LARGE_INTEGER now, freq;
+        QueryPerformanceCounter(&now);
+        QueryPerformanceFrequency(&freq);
+        return static_cast<double>(now.QuadPart - start_.QuadPart) * 1000.0 /
+               static_cast<double>(freq.QuadPart);
+    }
+
+private:
+    LARGE_INTEGER start_;
+};
+
+/// Worker count for the parallel dump phases: the shared bridge pool's lanes
+/// (workers + the calling thread), capped by the number of independent items.
+static unsigned DumpWorkerCount(size_t itemCount) {
+    return MDB::Pool::LaneCount(itemCount);
+}
+
+/// Run `worker` on `workers` lanes of the shared bridge pool and join.
+/// Falls back to running inline when only one lane is needed.
+static void RunDumpWorkers(unsigned workers, const std::function<void()>& worker) {
+    MDB::Pool::ForkJoin(workers, [&](unsigned) { worker(); });
+}
+
 /// Produce a safe filename from a namespace: dots → underscores
 static std::string SafeFileName(const std::string& ns) {
     std::string safe = ns;
@@ -1385,12 +1847,222 @@ static std::string SafeFileName(const std::string& ns) {
     return safe;
 }
 
+// ============================================================================
+// Selective Dump Scopes
+// ============================================================================
+// Most mods touch a handful of namespaces, but a full dump processes every
+// class in every image. MDB\Dump\dump_scope.txt restricts wrapper generation
+// to the requested surface:
+//
+//     # one entry per line; '#' starts a comment
+//     UnityEngine                  namespace (sub-namespaces included)
+//     image:Assembly-CSharp.dll    every class in an image
+//
+// The requested surface is expanded with its transitive type dependencies
+// (base classes, field types, method parameter/return types) resolved from
+// the class metadata, so generated wrappers never reference a type that was
+// scoped out. A missing or empty file means "dump everything".
+
+struct DumpScope {
+    bool active = false;
+    std::vector<std::string> namespaces;        // matched with sub-namespaces
+    std::set<std::string, std::less<>> images;  // exact image names
+};
+
+static DumpScope LoadDumpScope(const std::string& path) {
+    DumpScope scope;
+    std::ifstream in(path);
+    if (!in.is_open()) return scope;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        // Trim trailing CR/whitespace and leading whitespace
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t')) {
+            line.pop_back();
+        }
+        size_t start = line.find_first_not_of(" \t");
+        if (start == std::string::npos) continue;
+        line = line.substr(start);
+        if (line[0] == '#') continue;
+
+        if (line.rfind("image:", 0) == 0) {
+            std::string img = line.substr(6);
+            if (!img.empty()) scope.images.insert(img);
+        } else {
+            scope.namespaces.push_back(line);
+        }
+    }
+
+    scope.active = !scope.namespaces.empty() || !scope.images.empty();
+    return scope;
+}
+
+/// True if `ns` is a scoped namespace or a sub-namespace of one.
+static bool ScopeMatchesNamespace(const DumpScope& scope, std::string_view ns) {
+    for (const auto& want : scope.namespaces) {
+        if (ns == want) return true;
+        if (ns.size() > want.size() && ns[want.size()] == '.' &&
+            ns.substr(0, want.size()) == want) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Collect the classes a wrapper for `klass` can reference: the base class
+/// chain link, field types, and method parameter/return types.
+static void CollectClassDependencies(il2cppClass* klass, std::vector<il2cppClass*>& out) {
+    auto addType = [&out](const il2cppType* t) {
+        if (!t || !api::il2cpp_class_from_type) return;
+        if (auto* c = api::il2cpp_class_from_type(t)) out.push_back(c);
+    };
+
+    if (api::il2cpp_class_get_parent) {
+        if (auto* parent = api::il2cpp_class_get_parent(klass)) out.push_back(parent);
+    }
+
+    if (api::il2cpp_class_get_fields && api::il2cpp_field_get_type) {
+        void* iter = nullptr;
+        while (auto* fi = api::il2cpp_class_get_fields(klass, &iter)) {
+            addType(api::il2cpp_field_get_type(fi));
+        }
+    }
+
+    if (api::il2cpp_class_get_methods) {
+        void* iter = nullptr;
+        while (auto* mi = api::il2cpp_class_get_methods(klass, &iter)) {
+            if (api::il2cpp_method_get_return_type) {
+                addType(api::il2cpp_method_get_return_type(mi));
+            }
+            if (api::il2cpp_method_get_param && api::il2cpp_method_get_param_count) {
+                uint32_t paramCount = api::il2cpp_method_get_param_count(mi);
+                for (uint32_t p = 0; p < paramCount; ++p) {
+                    addType(api::il2cpp_method_get_param(mi, p));
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Incremental Invalidation Manifest
+// ============================================================================
+// Game patches typically touch one or two of the ~60 images, so a stale dump
+// rarely needs full regeneration. Each image gets a content hash (name, class
+// count, class identities, method pointer RVAs) recorded in a manifest next
+// to the generated wrappers. On the next dump, namespaces whose types all
+// come from unchanged images keep their existing .cs files; only namespaces
+// touched by a changed image are regenerated. A missing or unreadable
+// manifest — and any change to mappings.json, which renames types globally —
+// falls back to a full regeneration.
+
+static constexpr uint64_t kFnvOffset = 1469598103934665603ull;
+static constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+static void FnvMix(uint64_t& h, const void* data, size_t len) {
+    const auto* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < len; ++i) {
+        h ^= p[i];
+        h *= kFnvPrime;
+    }
+}
+
+static void FnvMixString(uint64_t& h, const char* s) {
+    if (s) FnvMix(h, s, std::strlen(s));
+    FnvMix(h, "\0", 1);  // delimiter so "ab"+"c" != "a"+"bc"
+}
+
+/// Content hash of one assembly image: image name, class count, per-class
+/// name/namespace, and the method-pointer RVA table. Catches added/removed
+/// classes and any recompiled method body that moved.
+static uint64_t HashAssemblyImage(il2cppImage* image, uintptr_t gaBase) {
+    uint64_t h = kFnvOffset;
+
+    FnvMixString(h, api::il2cpp_image_get_name(image));
+    size_t classCount = api::il2cpp_image_get_class_count(image);
+    FnvMix(h, &classCount, sizeof(classCount));
+
+    for (size_t j = 0; j < classCount; ++j) {
+        auto klass = api::il2cpp_image_get_class(image, j);
+        if (!klass) continue;
+        FnvMixString(h, api::il2cpp_class_get_name(klass));
+        FnvMixString(h, api::il2cpp_class_get_namespace(klass));
+
+        if (api::il2cpp_class_get_methods) {
+            void* iter = nullptr;
+            while (auto* mi = api::il2cpp_class_get_methods(klass, &iter)) {
+                uint64_t rva = 0;
+                uintptr_t ptr = reinterpret_cast<uintptr_t>(mi->m_pMethodPointer);
+                if (ptr > gaBase) rva = static_cast<uint64_t>(ptr - gaBase);
+                FnvMix(h, &rva, sizeof(rva));
+            }
+        }
+    }
+    return h;
+}
+
+/// Hash of the deobfuscation mappings file (size + mtime). Mappings rename
+/// types across every namespace, so any change forces a full regeneration.
+static uint64_t HashMappingsFile(const std::string& path) {
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec) || ec) return 0;
+
+    uint64_t h = kFnvOffset;
+    uint64_t size = static_cast<uint64_t>(std::filesystem::file_size(path, ec));
+    if (ec) return 0;
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) return 0;
+    uint64_t ticks = static_cast<uint64_t>(mtime.time_since_epoch().count());
+    FnvMix(h, &size, sizeof(size));
+    FnvMix(h, &ticks, sizeof(ticks));
+    return h;
+}
+
+/// Read the manifest: one "hash<TAB>name" line per entry. Returns an empty
+/// map when missing or malformed (caller treats that as "regenerate all").
+static std::map<std::string, uint64_t> LoadDumpManifest(const std::string& path) {
+    std::map<std::string, uint64_t> manifest;
+    std::ifstream in(path);
+    if (!in.is_open()) return manifest;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        auto tab = line.find('\t');
+        if (tab == std::string::npos) continue;
+        uint64_t hash = 0;
+        try {
+            hash = std::stoull(line.substr(0, tab), nullptr, 16);
+        } catch (...) {
+            continue;
+        }
+        manifest[line.substr(tab + 1)] = hash;
+    }
+    return manifest;
+}
+
+static void WriteDumpManifest(const std::string& path, const std::map<std::string, uint64_t>& manifest) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return;
+    for (const auto& [name, hash] : manifest) {
+        char buf[17];
+        snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(hash));
+        out << buf << "\t" << name << "\n";
+    }
+}
+
 // ============================================================================
 // Main Dump & Generate Function
 // ============================================================================
 
 DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
     DumpResult result = { false, "", "", "", 0, 0, {}, 0, 0, 0, 0 };
+    PhaseTimer totalTimer;
+
+    // Drop memoized name resolutions and interned strings left over from any
+    // previous dump run (error paths may not have reached the end-of-run reset)
+    ClearNameCaches();
+    g_knownTypes.clear();
+    g_stringArena.Reset();
 
     // ---- Wait for GameAssembly.dll ----
     uintptr_t gaBase = GetGameAssemblyBaseAddress();
@@ -1428,13 +2100,6 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
     obfConfig.whitelist_vtable_methods = true;
     obfConfig.check_stub_patterns = true;
     MDB::Obfuscation::Detector obfuscation_detector(obfConfig);
-    obfuscation_detector.Analyze(assemblies, size);
-    g_obfuscation_detector = &obfuscation_detector;
-
-    result.fake_methods_detected = obfuscation_detector.GetTotalFakeMethods();
-    result.fake_classes_detected = obfuscation_detector.GetTotalFakeClasses();
-
-    // Write BeeByte report to MDB/Dump/fake_methods.txt
     {
         char exePath[MAX_PATH];
         GetModuleFileNameA(nullptr, exePath, MAX_PATH);
@@ -1444,76 +2109,244 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
         std::string dumpDir = exeDir + "\\MDB\\Dump";
         std::filesystem::create_directories(dumpDir);
         std::string fakeReportPath = dumpDir + "\\fake_methods.txt";
-        obfuscation_detector.WriteFakeReport(fakeReportPath);
+        std::string analysisCachePath = dumpDir + "\\fake_methods.cache";
+
+        // Detection is deterministic for a given binary — a persisted
+        // analysis keyed to the GameAssembly stamp replaces the re-scan
+        // while the binary is unchanged (the report on disk from the run
+        // that wrote the cache is still current then too)
+        PhaseTimer obfTimer;
+        MDB::Trace::ScopedSpan obfSpan("dump.obfuscation");
+        if (!obfuscation_detector.LoadAnalysisCache(analysisCachePath)) {
+            obfuscation_detector.Analyze(assemblies, size);
+            obfuscation_detector.WriteFakeReport(fakeReportPath);
+            obfuscation_detector.SaveAnalysisCache(analysisCachePath);
+        }
+        result.ms_obfuscation_analysis = obfTimer.ElapsedMs();
         result.fake_report_path = fakeReportPath;
     }
+    g_obfuscation_detector = &obfuscation_detector;
+
+    result.fake_methods_detected = obfuscation_detector.GetTotalFakeMethods();
+    result.fake_classes_detected = obfuscation_detector.GetTotalFakeClasses();
+
+    // ---- Incremental invalidation: hash each image, diff the manifest ----
+    // Namespaces fed only by unchanged images keep their existing wrapper
+    // files in Phase 2. Hashing walks every method table, so it is fanned
+    // out across the worker pool like the other phases.
+    std::string manifestPath = output_directory + "\\dump_manifest.txt";
+    std::map<std::string, uint64_t> currentHashes;
+    std::set<std::string, std::less<>> changedImages;
+    bool fullRegen = false;
+    DumpScope dumpScope;
+    {
+        PhaseTimer hashTimer;
+        MDB::Trace::ScopedSpan hashSpan("dump.image_hashing");
+        std::vector<uint64_t> perImageHash(size, 0);
+        std::atomic<size_t> nextImage{0};
+        RunDumpWorkers(DumpWorkerCount(size), [&]() {
+            il2cpp::ensure_thread_attached();
+            for (;;) {
+                size_t i = nextImage.fetch_add(1);
+                if (i >= size) break;
+                auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+                if (image) perImageHash[i] = HashAssemblyImage(image, gaBase);
+            }
+        });
+
+        for (size_t i = 0; i < size; ++i) {
+            auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+            if (!image) continue;
+            const char* imageName = api::il2cpp_image_get_name(image);
+            if (imageName) currentHashes[imageName] = perImageHash[i];
+        }
+
+        // Mappings rename types in every namespace and the scope file changes
+        // which types exist at all — treat a change to either as global
+        {
+            char exePathM[MAX_PATH];
+            GetModuleFileNameA(nullptr, exePathM, MAX_PATH);
+            std::string exeDirM(exePathM);
+            size_t lsM = exeDirM.find_last_of("\\/");
+            if (lsM != std::string::npos) exeDirM = exeDirM.substr(0, lsM);
+            currentHashes["__mappings__"] = HashMappingsFile(exeDirM + "\\MDB\\Dump\\mappings.json");
+
+            std::string scopePath = exeDirM + "\\MDB\\Dump\\dump_scope.txt";
+            dumpScope = LoadDumpScope(scopePath);
+            currentHashes["__scope__"] = HashMappingsFile(scopePath);
+        }
+
+        auto previousHashes = LoadDumpManifest(manifestPath);
+        if (previousHashes.empty() ||
+            previousHashes["__mappings__"] != currentHashes["__mappings__"] ||
+            previousHashes["__scope__"] != currentHashes["__scope__"]) {
+            fullRegen = true;
+        } else {
+            for (const auto& [imgName, imgHash] : currentHashes) {
+                auto prev = previousHashes.find(imgName);
+                if (prev == previousHashes.end() || prev->second != imgHash) {
+                    changedImages.insert(imgName);
+                }
+            }
+        }
+        result.ms_image_hashing = hashTimer.ElapsedMs();
+    }
 
     // ---- Phase 1: Collect all types grouped by effective namespace ----
+    // Per-assembly collection is independent work, so it is fanned out across
+    // a worker pool. Each worker fills its assembly's own bucket slot; the
+    // slots are merged in assembly order afterwards so the generated output
+    // stays deterministic. All il2cpp_* calls here are read-only metadata
+    // queries, and the detector is only queried after Analyze() completes.
     std::map<std::string, std::vector<ClassInfo>> typesByNamespace;
     size_t totalClasses = 0;
 
-    // Also build the image list for the raw diagnostic dump
+    // Also build the image list for the raw diagnostic dump — but only
+    // when someone asked for it ([dump] raw_dump in mdb_config.ini); the
+    // diagnostic is rarely opened and sits on the startup critical path
+    const bool wantRawDump = MDB::Config::Get().dump_raw_dump;
     std::stringstream rawDump;
-    for (size_t i = 0; i < size; ++i) {
-        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
-        rawDump << "// Image " << i << ": " << api::il2cpp_image_get_name(image) << "\n";
+    if (wantRawDump) {
+        for (size_t i = 0; i < size; ++i) {
+            auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+            rawDump << "// Image " << i << ": " << api::il2cpp_image_get_name(image) << "\n";
+        }
     }
 
-    for (size_t i = 0; i < size; ++i) {
-        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
-        std::string dllName = api::il2cpp_image_get_name(image);
-        auto classCount = api::il2cpp_image_get_class_count(image);
-        totalClasses += classCount;
+    PhaseTimer collectTimer;
+    auto collectSpan = MDB::Trace::BeginSpan("dump.collect");
+    std::vector<std::map<std::string, std::vector<ClassInfo>>> perAssemblyTypes(size);
+    std::vector<size_t> perAssemblyClassCount(size, 0);
+    {
+        std::atomic<size_t> nextAssembly{0};
+        RunDumpWorkers(DumpWorkerCount(size), [&]() {
+            il2cpp::ensure_thread_attached();
+            for (;;) {
+                size_t i = nextAssembly.fetch_add(1);
+                if (i >= size) break;
 
-        for (size_t j = 0; j < classCount; ++j) {
-            auto klass = api::il2cpp_image_get_class(image, j);
-            if (!klass) continue;
+                auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+                std::string dllName = api::il2cpp_image_get_name(image);
+                auto classCount = api::il2cpp_image_get_class_count(image);
+                perAssemblyClassCount[i] = classCount;
+                auto& buckets = perAssemblyTypes[i];
 
-            const char* ns = api::il2cpp_class_get_namespace(klass);
-            const char* name = api::il2cpp_class_get_name(klass);
-            if (!name) continue;
+                for (size_t j = 0; j < classCount; ++j) {
+                    auto klass = api::il2cpp_image_get_class(image, j);
+                    if (!klass) continue;
 
-            std::string nsStr(ns ? ns : "");
-            std::string nameStr(name);
+                    const char* ns = api::il2cpp_class_get_namespace(klass);
+                    const char* name = api::il2cpp_class_get_name(klass);
+                    if (!name) continue;
 
-            // Skip compiler-generated types
-            if (nameStr.find('<') != std::string::npos) continue;
-            if (nameStr.find('>') != std::string::npos) continue;
-            if (nameStr.find('/') != std::string::npos) continue;
+                    std::string nsStr(ns ? ns : "");
+                    std::string nameStr(name);
 
-            // Skip system/internal namespaces (check raw namespace first)
-            if (ShouldSkipNamespace(nsStr)) continue;
+                    // Skip compiler-generated types
+                    if (nameStr.find('<') != std::string::npos) continue;
+                    if (nameStr.find('>') != std::string::npos) continue;
+                    if (nameStr.find('/') != std::string::npos) continue;
 
-            // Skip non-public types
-            int flags = api::il2cpp_class_get_flags(klass);
-            auto vis = flags & TYPE_ATTRIBUTE_VISIBILITY_MASK;
-            if (vis != TYPE_ATTRIBUTE_PUBLIC && vis != TYPE_ATTRIBUTE_NESTED_PUBLIC) continue;
+                    // Skip system/internal namespaces (check raw namespace first)
+                    if (ShouldSkipNamespace(nsStr)) continue;
 
-            // Obfuscation filter: skip entirely-fake classes
-            if (g_obfuscation_detector && g_obfuscation_detector->IsEntirelyFakeClass(klass)) continue;
+                    // Skip non-public types
+                    int flags = api::il2cpp_class_get_flags(klass);
+                    auto vis = flags & TYPE_ATTRIBUTE_VISIBILITY_MASK;
+                    if (vis != TYPE_ATTRIBUTE_PUBLIC && vis != TYPE_ATTRIBUTE_NESTED_PUBLIC) continue;
 
-            // Resolve effective namespace: nested types inherit their declaring type's namespace
-            std::string resolvedNs = nsStr.empty() ? ResolveEffectiveNamespace(klass) : nsStr;
+                    // Obfuscation filter: skip entirely-fake classes
+                    if (g_obfuscation_detector && g_obfuscation_detector->IsEntirelyFakeClass(klass)) continue;
 
-            // Re-check the resolved namespace — nested types from System/Mono/etc. must also be skipped
-            if (resolvedNs != nsStr && ShouldSkipNamespace(resolvedNs)) continue;
+                    // Resolve effective namespace: nested types inherit their declaring type's namespace
+                    std::string resolvedNs = nsStr.empty() ? ResolveEffectiveNamespace(klass) : nsStr;
 
-            std::string bucketNs = resolvedNs.empty() ? "Global" : resolvedNs;
+                    // Re-check the resolved namespace — nested types from System/Mono/etc. must also be skipped
+                    if (resolvedNs != nsStr && ShouldSkipNamespace(resolvedNs)) continue;
 
-            ClassInfo info = ClassifyType(klass, dllName, bucketNs);
-            typesByNamespace[bucketNs].push_back(info);
-        }
+                    std::string bucketNs = resolvedNs.empty() ? "Global" : resolvedNs;
+
+                    ClassInfo info = ClassifyType(klass, dllName, bucketNs);
+                    buckets[bucketNs].push_back(info);
+                }
+            }
+        });
+    }
+
+    // Merge per-assembly buckets in assembly order (same ordering as the old
+    // single-threaded walk)
+    for (size_t i = 0; i < size; ++i) {
+        totalClasses += perAssemblyClassCount[i];
+        for (auto& [mergeNs, mergeTypes] : perAssemblyTypes[i]) {
+            auto& bucket = typesByNamespace[mergeNs];
+            bucket.insert(bucket.end(),
+                          std::make_move_iterator(mergeTypes.begin()),
+                          std::make_move_iterator(mergeTypes.end()));
+        }
+        perAssemblyTypes[i].clear();
     }
     result.total_classes = totalClasses;
+    result.ms_collection = collectTimer.ElapsedMs();
+    MDB::Trace::EndSpan(collectSpan);
+
+    // ---- Apply dump scope: requested surface + transitive dependencies ----
+    // Runs before the known-types registry is built, so references to types
+    // outside the final selection erase to "object" in the generated code
+    // instead of naming wrappers that were never emitted.
+    if (dumpScope.active) {
+        std::unordered_set<il2cppClass*> selected;
+        std::unordered_set<il2cppClass*> dumpedClasses;
+
+        for (const auto& [seedNs, seedTypes] : typesByNamespace) {
+            for (const auto& seedInfo : seedTypes) {
+                dumpedClasses.insert(seedInfo.klass);
+                if (ScopeMatchesNamespace(dumpScope, seedInfo.ns) ||
+                    dumpScope.images.count(seedInfo.dll) != 0) {
+                    selected.insert(seedInfo.klass);
+                }
+            }
+        }
+
+        // Breadth-first closure over the dumped set: anything a selected
+        // wrapper can reference gets pulled in too
+        std::vector<il2cppClass*> pending(selected.begin(), selected.end());
+        std::vector<il2cppClass*> deps;
+        while (!pending.empty()) {
+            il2cppClass* k = pending.back();
+            pending.pop_back();
+
+            deps.clear();
+            CollectClassDependencies(k, deps);
+            for (auto* dep : deps) {
+                if (dumpedClasses.find(dep) == dumpedClasses.end()) continue;
+                if (selected.insert(dep).second) pending.push_back(dep);
+            }
+        }
+
+        for (auto it = typesByNamespace.begin(); it != typesByNamespace.end();) {
+            auto& scopedTypes = it->second;
+            scopedTypes.erase(std::remove_if(scopedTypes.begin(), scopedTypes.end(),
+                                             [&](const ClassInfo& ci) {
+                                                 return selected.find(ci.klass) == selected.end();
+                                             }),
+                              scopedTypes.end());
+            if (scopedTypes.empty()) it = typesByNamespace.erase(it);
+            else ++it;
+        }
+    }
 
     // ---- Phase 1.5: Build known types registry ----
+    PhaseTimer registryTimer;
+    auto registrySpan = MDB::Trace::BeginSpan("dump.registry");
     g_knownTypes.clear();
+    g_knownTypes.reserve(totalClasses);
     for (const auto& [regNs, regTypes] : typesByNamespace) {
         for (const auto& regInfo : regTypes) {
             // Use the effective namespace (which includes resolved declaring type namespace)
-            std::string effectiveNs = regInfo.ns == "Global" ? "" : regInfo.ns;
-            std::string fqn = effectiveNs.empty() ? regInfo.name : (effectiveNs + "." + regInfo.name);
-            g_knownTypes.insert(fqn);
+            std::string effectiveNs = regInfo.ns == "Global" ? std::string() : std::string(regInfo.ns);
+            std::string fqn = effectiveNs.empty() ? std::string(regInfo.name)
+                                                  : (effectiveNs + "." + std::string(regInfo.name));
+            g_knownTypes.insert(g_stringArena.Intern(fqn));
         }
     }
 
@@ -1532,15 +2365,22 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
             // Update ClassInfo display names with friendly names from mappings
             for (auto& [mapNs, mapTypes] : typesByNamespace) {
                 for (auto& mapInfo : mapTypes) {
-                    std::string friendly = g_mappingLookup.ResolveType(mapInfo.rawName);
+                    std::string friendly = g_mappingLookup.ResolveType(std::string(mapInfo.rawName));
                     if (!friendly.empty()) {
-                        mapInfo.name = friendly;
+                        mapInfo.name = g_stringArena.Intern(friendly);
                     }
                 }
             }
         }
     }
 
+    // Drop name resolutions memoized during Phase 1: the g_knownTypes
+    // registry and friendly-name mappings both change what a pointer
+    // resolves to, so everything from here on must be recomputed once
+    if (result.mappings_loaded > 0 || !g_knownTypes.empty()) {
+        ClearNameCaches();
+    }
+
     // Re-validate base classes against known types registry
     // (Now that g_mappingLookup is loaded, GetFullyQualifiedClassName will
     //  apply friendly name remapping to base class references too)
@@ -1549,12 +2389,12 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
             if (valInfo.kind == TypeKind::Class && !valInfo.base_class.empty() && valInfo.base_class != "Il2CppObject") {
                 auto* parent = api::il2cpp_class_get_parent(valInfo.klass);
                 if (parent) {
-                    valInfo.base_class = GetFullyQualifiedClassName(parent, valInfo.ns);
+                    valInfo.base_class = g_stringArena.Intern(GetFullyQualifiedClassName(parent, std::string(valInfo.ns)));
                     if (valInfo.base_class.empty() || valInfo.base_class == "object") {
                         valInfo.base_class = "Il2CppObject";
                     }
                     // Detect circular base type (e.g., FancyScrollView<T,U> extends FancyScrollView<T>)
-                    std::string baseTail = valInfo.base_class;
+                    std::string baseTail(valInfo.base_class);
                     auto lastDot = baseTail.rfind('.');
                     if (lastDot != std::string::npos) baseTail = baseTail.substr(lastDot + 1);
                     if (baseTail == valInfo.name) {
@@ -1565,91 +2405,338 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
         }
     }
 
+    result.ms_registry = registryTimer.ElapsedMs();
+    MDB::Trace::EndSpan(registrySpan);
+
     // ---- Phase 2: Generate .cs files per namespace ----
+    // Each namespace file is generated independently, so generation is
+    // parallelized the same way as Phase 1. g_knownTypes and the mapping
+    // lookup are frozen by now, so the generators only do concurrent reads.
+    // File I/O is pipelined: generation workers push completed buffers into
+    // a queue and a single dedicated writer thread drains it with large
+    // buffered writes, so slow writes (antivirus-scanned game directories)
+    // overlap with CPU-bound generation instead of stalling it. Per-slot
+    // outputs keep generated_files in namespace order.
+    //
+    // Amalgamated mode ([dump] amalgamate in mdb_config.ini): the writer
+    // packs the per-namespace buffers into a few large files capped at
+    // ~5MB instead of one file per namespace. Thousands of small files pay
+    // file-create overhead here and per-file open overhead at compile time
+    // (both inflated by antivirus scanning game directories); the content
+    // is identical, just bundled. Using directives move inside each
+    // namespace block so segments concatenate into legal C#.
     std::filesystem::create_directories(output_directory);
 
-    for (auto& [ns, types] : typesByNamespace) {
-        if (types.empty()) continue;
+    const bool amalgamate = MDB::Config::Get().dump_amalgamate;
+    constexpr size_t kAmalgamatedFileCap = 5u * 1024 * 1024;
 
-        std::stringstream file;
+    // The csproj globs Generated\*.cs, so leftovers from the other layout
+    // would compile alongside the new output as duplicate definitions —
+    // clear them when the mode has changed since the last dump
+    {
+        std::error_code cleanEc;
+        for (const auto& cleanEntry : std::filesystem::directory_iterator(output_directory, cleanEc)) {
+            std::string cleanName = cleanEntry.path().filename().string();
+            bool isBundle = cleanName.rfind("GameSDK.Amalgamated", 0) == 0;
+            bool isWrapper = cleanName.rfind("GameSDK.", 0) == 0
+                             && cleanEntry.path().extension() == ".cs";
+            if (amalgamate ? (isWrapper && !isBundle) : isBundle) {
+                std::filesystem::remove(cleanEntry.path(), cleanEc);
+            }
+        }
+    }
 
-        // File header
-        file << "// Auto-generated Il2Cpp wrapper classes\n";
-        file << "// Namespace: " << ns << "\n";
-        file << "// Do not edit manually\n\n";
-        file << "#pragma warning disable 0108, 0114, 0162, 0168, 0219\n\n";
+    std::vector<std::pair<const std::string*, std::vector<ClassInfo>*>> nsWork;
+    nsWork.reserve(typesByNamespace.size());
+    for (auto& [workNs, workTypes] : typesByNamespace) {
+        if (!workTypes.empty()) nsWork.emplace_back(&workNs, &workTypes);
+    }
+
+    std::vector<std::string> nsFilePaths(nsWork.size());
+    std::vector<size_t> nsWrapperCounts(nsWork.size(), 0);
+    std::vector<std::string> nsErrors(nsWork.size());
+    PhaseTimer generationTimer;
+    auto generationSpan = MDB::Trace::BeginSpan("dump.generate");
+    double writerIoMs = 0.0;
+    {
+        // Producer/consumer pipeline between generation workers and the
+        // writer thread
+        struct PendingFile {
+            size_t slot;
+            std::string path;
+            std::vector<std::string> chunks;  // rope chunks, written in order
+        };
+        std::deque<PendingFile> writeQueue;
+        std::mutex writeMutex;
+        std::condition_variable writeCv;
+        bool generationDone = false;
+
+        std::thread writerThread([&]() {
+            // Large stream buffer so each file goes out in a few big writes
+            std::vector<char> ioBuffer(1 << 20);
+
+            // Amalgamated-mode state: the current bundle stays open across
+            // jobs and rolls over once it passes the size cap
+            std::ofstream bundleFile;
+            std::string bundlePath;
+            size_t bundleBytes = 0;
+            unsigned bundleIndex = 0;
+
+            for (;;) {
+                PendingFile job;
+                {
+                    std::unique_lock<std::mutex> lock(writeMutex);
+                    writeCv.wait(lock, [&]() { return !writeQueue.empty() || generationDone; });
+                    if (writeQueue.empty()) break;  // generationDone && drained
+                    job = std::move(writeQueue.front());
+                    writeQueue.pop_front();
+                }
+
+                PhaseTimer writeTimer;
+                if (amalgamate) {
+                    // Roll over between namespaces, never mid-segment, so
+                    // each bundle is a self-contained compilable file
+                    if (!bundleFile.is_open() || bundleBytes >= kAmalgamatedFileCap) {
+                        if (bundleFile.is_open()) bundleFile.close();
+                        char bundleName[64];
+                        snprintf(bundleName, sizeof(bundleName), "GameSDK.Amalgamated%04u.cs", ++bundleIndex);
+                        bundlePath = (std::filesystem::path(output_directory) / bundleName).string();
+                        bundleFile.rdbuf()->pubsetbuf(ioBuffer.data(), static_cast<std::streamsize>(ioBuffer.size()));
+                        bundleFile.open(bundlePath);
+                        bundleBytes = 0;
+                    }
+                    if (!bundleFile.is_open()) {
+                        nsErrors[job.slot] = "Failed to write: " + bundlePath;
+                        writerIoMs += writeTimer.ElapsedMs();
+                        continue;
+                    }
+                    for (const auto& chunk : job.chunks) {
+                        bundleFile.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                        bundleBytes += chunk.size();
+                    }
+                    writerIoMs += writeTimer.ElapsedMs();
+                    nsFilePaths[job.slot] = bundlePath;
+                    continue;
+                }
 
-        // Using statements
-        file << BuildUsingStatements(ns) << "\n";
+                std::ofstream outFile;
+                outFile.rdbuf()->pubsetbuf(ioBuffer.data(), static_cast<std::streamsize>(ioBuffer.size()));
+                outFile.open(job.path);
+                if (!outFile.is_open()) {
+                    nsErrors[job.slot] = "Failed to write: " + job.path;
+                    continue;
+                }
+                // Gather: each rope chunk goes out through the stream buffer
+                // without ever being concatenated into one allocation
+                for (const auto& chunk : job.chunks) {
+                    outFile.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                }
+                outFile.close();
+                writerIoMs += writeTimer.ElapsedMs();
 
-        // Namespace declaration
-        file << "namespace " << ns << "\n";
-        file << "{\n";
+                nsFilePaths[job.slot] = job.path;
+            }
 
-        // Sort types: delegates → enums → interfaces → structs → classes
-        std::stable_sort(types.begin(), types.end(), [](const ClassInfo& a, const ClassInfo& b) {
-            return static_cast<int>(a.kind) < static_cast<int>(b.kind);
+            if (bundleFile.is_open()) {
+                PhaseTimer closeTimer;
+                bundleFile.close();
+                writerIoMs += closeTimer.ElapsedMs();
+            }
         });
 
-        // Track emitted type names to avoid CS0101 duplicate definitions
-        std::set<std::string> emittedTypes;
+        std::atomic<size_t> nextNs{0};
+        RunDumpWorkers(DumpWorkerCount(nsWork.size()), [&]() {
+            il2cpp::ensure_thread_attached();
+            for (;;) {
+                size_t w = nextNs.fetch_add(1);
+                if (w >= nsWork.size()) break;
+
+                const std::string& ns = *nsWork[w].first;
+                std::vector<ClassInfo>& types = *nsWork[w].second;
+
+                std::filesystem::path existingPath =
+                    std::filesystem::path(output_directory) / ("GameSDK." + SafeFileName(ns) + ".cs");
+
+                // Incremental skip: every type in this namespace comes from an
+                // unchanged image and the wrapper file is already on disk —
+                // keep it as-is and just record it in generated_files.
+                // (Not applicable in amalgamated mode — a namespace has no
+                // file of its own to keep, so every dump regenerates all.)
+                if (!fullRegen && !amalgamate) {
+                    bool dirty = false;
+                    for (const auto& checkInfo : types) {
+                        if (changedImages.count(checkInfo.dll) != 0) { dirty = true; break; }
+                    }
+                    std::error_code existsEc;
+                    if (!dirty && std::filesystem::exists(existingPath, existsEc) && !existsEc) {
+                        nsFilePaths[w] = existingPath.string();
+                        continue;
+                    }
+                }
 
-        for (const auto& info : types) {
-            // Skip duplicate type names within the same namespace
-            if (!emittedTypes.insert(info.name).second) continue;
+                RopeBuilder file;
+
+                // File header
+                file.Append("// Auto-generated Il2Cpp wrapper classes\n");
+                file.Append("// Namespace: ");
+                file.Append(ns);
+                file.Append("\n");
+                file.Append("// Do not edit manually\n\n");
+                file.Append("#pragma warning disable 0108, 0114, 0162, 0168, 0219\n\n");
+
+                // Using statements: top-level normally; inside the namespace
+                // block in amalgamated mode, because C# forbids top-level
+                // using directives after the first namespace declaration and
+                // bundles hold many namespaces per file
+                if (!amalgamate) {
+                    file.AppendOwned(BuildUsingStatements(ns));
+                    file.Append("\n");
+                }
 
-            switch (info.kind) {
-            case TypeKind::Delegate:
-                file << GenerateDelegate(info.klass, ns, info.rawName) << "\n";
-                break;
-            case TypeKind::Enum:
-                file << GenerateEnum(info.klass, info.rawName) << "\n";
-                break;
-            case TypeKind::Interface:
-                file << GenerateInterface(info.klass, info.rawName) << "\n";
-                break;
-            case TypeKind::Struct:
-                file << GenerateStruct(info.klass, ns, info.rawName) << "\n";
-                break;
-            case TypeKind::Class:
-                file << GenerateClass(info, ns) << "\n";
-                result.total_wrappers_generated++;
-                break;
-            }
-        }
+                // Namespace declaration
+                file.Append("namespace ");
+                file.Append(ns);
+                file.Append("\n");
+                file.Append("{\n");
+                if (amalgamate) {
+                    file.AppendOwned(BuildUsingStatements(ns));
+                    file.Append("\n");
+                }
 
-        file << "}\n";
+                // Sort types: delegates → enums → interfaces → structs → classes
+                std::stable_sort(types.begin(), types.end(), [](const ClassInfo& a, const ClassInfo& b) {
+                    return static_cast<int>(a.kind) < static_cast<int>(b.kind);
+                });
+
+                // Track emitted type names to avoid CS0101 duplicate definitions
+                std::set<std::string> emittedTypes;
+
+                for (const auto& info : types) {
+                    // Skip duplicate type names within the same namespace
+                    if (!emittedTypes.insert(std::string(info.name)).second) continue;
+
+                    switch (info.kind) {
+                    case TypeKind::Delegate:
+                        file.AppendOwned(GenerateDelegate(info.klass, ns, std::string(info.rawName)));
+                        file.Append("\n");
+                        break;
+                    case TypeKind::Enum:
+                        file.AppendOwned(GenerateEnum(info.klass, std::string(info.rawName)));
+                        file.Append("\n");
+                        break;
+                    case TypeKind::Interface:
+                        file.AppendOwned(GenerateInterface(info.klass, std::string(info.rawName)));
+                        file.Append("\n");
+                        break;
+                    case TypeKind::Struct:
+                        file.AppendOwned(GenerateStruct(info.klass, ns, std::string(info.rawName)));
+                        file.Append("\n");
+                        break;
+                    case TypeKind::Class:
+                        file.AppendOwned(GenerateClass(info, ns));
+                        file.Append("\n");
+                        nsWrapperCounts[w]++;
+                        break;
+                    }
+                }
+
+                file.Append("}\n");
 
-        // Write file: GameSDK.<SafeNamespace>.cs
-        std::string safeName = SafeFileName(ns);
-        std::string filename = "GameSDK." + safeName + ".cs";
-        std::filesystem::path filePath = std::filesystem::path(output_directory) / filename;
+                // Hand the finished buffer to the writer thread:
+                // GameSDK.<SafeNamespace>.cs (the path is ignored in
+                // amalgamated mode — the writer assigns the bundle file)
+                std::string safeName = SafeFileName(ns);
+                std::string filename = "GameSDK." + safeName + ".cs";
+                std::filesystem::path filePath = std::filesystem::path(output_directory) / filename;
 
-        std::ofstream outFile(filePath);
-        if (!outFile.is_open()) {
-            result.error_message = "Failed to write: " + filePath.string();
+                {
+                    std::lock_guard<std::mutex> lock(writeMutex);
+                    writeQueue.push_back({ w, filePath.string(), file.TakeChunks() });
+                }
+                writeCv.notify_one();
+            }
+        });
+
+        // Generation finished — let the writer drain the queue and exit
+        {
+            std::lock_guard<std::mutex> lock(writeMutex);
+            generationDone = true;
+        }
+        writeCv.notify_one();
+        writerThread.join();
+    }
+    result.ms_generation = generationTimer.ElapsedMs();
+    MDB::Trace::EndSpan(generationSpan);
+    result.ms_file_io = writerIoMs;  // overlaps ms_generation by design
+
+    // Merge per-namespace results; surface the first write failure (matching
+    // the old single-threaded error behavior)
+    for (size_t w = 0; w < nsWork.size(); ++w) {
+        if (!nsErrors[w].empty()) {
+            result.error_message = nsErrors[w];
             return result;
         }
-        outFile << file.str();
-        outFile.close();
+        result.total_wrappers_generated += nsWrapperCounts[w];
+        if (amalgamate) {
+            // Many namespaces share each bundle — record each file once.
+            // The bundle count is small, so a linear scan is fine.
+            if (std::find(result.generated_files.begin(), result.generated_files.end(),
+                          nsFilePaths[w]) == result.generated_files.end()) {
+                result.generated_files.push_back(nsFilePaths[w]);
+            }
+        } else {
+            result.generated_files.push_back(nsFilePaths[w]);
+        }
+    }
 
-        result.generated_files.push_back(filePath.string());
+    // ---- Phase 3: Write raw dump.cs for diagnostics (opt-in) ----
+    // Nothing downstream consumes dump.cs; when raw_dump is off the result
+    // simply carries no dump_path and any stale file is left untouched
+    if (wantRawDump) {
+        std::string dumpPath = output_directory + "\\dump.cs";
+        std::ofstream rawOut(dumpPath);
+        if (rawOut.is_open()) {
+            rawOut << rawDump.str();
+            rawOut.close();
+        }
+        result.dump_path = dumpPath;
     }
 
-    // ---- Phase 3: Write raw dump.cs for diagnostics ----
-    std::string dumpPath = output_directory + "\\dump.cs";
-    std::ofstream rawOut(dumpPath);
-    if (rawOut.is_open()) {
-        rawOut << rawDump.str();
-        rawOut.close();
+    // ---- Phase 4: Write the binary metadata cache for warm starts ----
+    // Mods that want metadata at runtime can memory-map this instead of
+    // re-walking live IL2CPP structures. A write failure is non-fatal: the
+    // dump itself succeeded and the bridge falls back to live enumeration.
+    {
+        PhaseTimer cacheTimer;
+        MDB::Trace::ScopedSpan cacheSpan("dump.metadata_cache");
+        std::string cachePath = output_directory + "\\metadata.mdbc";
+        std::string cacheError;
+        if (MetaCache::Write(cachePath, &cacheError)) {
+            result.metadata_cache_path = cachePath;
+        }
+        result.ms_metadata_cache = cacheTimer.ElapsedMs();
     }
-    result.dump_path = dumpPath;
+
+    // Record per-image hashes for the next run's incremental diff — only
+    // once everything above succeeded, so a failed dump re-does all work
+    WriteDumpManifest(manifestPath, currentHashes);
 
     // Clean up global detector pointer (stack-allocated, about to go out of scope)
     g_obfuscation_detector = nullptr;
 
+    // Peak attribution before the release below collapses the live figures
+    Mem::LogSummary("dump");
+
+    // Release memoized name resolutions, the known-types registry, and the
+    // string arena in one shot. typesByNamespace still holds views into the
+    // arena but is not touched after this point.
+    ClearNameCaches();
+    g_knownTypes.clear();
+    g_stringArena.Reset();
+
     // Note: g_mappingLookup persists for potential future use but is harmless
 
+    result.ms_total = totalTimer.ElapsedMs();
     result.success = true;
     return result;
 }
@@ -1658,53 +2745,34 @@ DumpResult DumpIL2CppRuntime(const std::string& output_directory) {
 // Freshness Checks
 // ============================================================================
 
-bool IsDumpFresh(const std::string& dump_path) {
-    if (!std::filesystem::exists(dump_path)) return false;
+// Both checks compare against GameAssembly.dll and run through the startup
+// filesystem manifest, so on a primed launch neither touches the disk.
 
+static int64_t GameAssemblyWriteTime() {
     HMODULE hGA = GetModuleHandleW(L"GameAssembly.dll");
-    if (!hGA) return false;
+    if (!hGA) return 0;
 
     wchar_t gaPath[MAX_PATH];
-    if (GetModuleFileNameW(hGA, gaPath, MAX_PATH) == 0) return false;
+    if (GetModuleFileNameW(hGA, gaPath, MAX_PATH) == 0) return 0;
 
-    try {
-        auto dumpTime = std::filesystem::last_write_time(dump_path);
-        auto gaTime   = std::filesystem::last_write_time(gaPath);
-        return dumpTime > gaTime;
-    } catch (...) {
-        return false;
-    }
+    return StartupFs::WriteTime(std::wstring(gaPath));
 }
 
-bool AreWrappersFresh(const std::string& output_directory) {
-    if (!std::filesystem::exists(output_directory)) return false;
-
-    bool hasFiles = false;
-    for (const auto& entry : std::filesystem::directory_iterator(output_directory)) {
-        if (entry.path().extension() == ".cs") { hasFiles = true; break; }
-    }
-    if (!hasFiles) return false;
-
-    HMODULE hGA = GetModuleHandleW(L"GameAssembly.dll");
-    if (!hGA) return false;
+bool IsDumpFresh(const std::string& dump_path) {
+    int64_t dumpTime = StartupFs::WriteTime(dump_path);
+    if (dumpTime == 0) return false;
 
-    wchar_t gaPath[MAX_PATH];
-    if (GetModuleFileNameW(hGA, gaPath, MAX_PATH) == 0) return false;
+    int64_t gaTime = GameAssemblyWriteTime();
+    return gaTime != 0 && dumpTime > gaTime;
+}
 
-    try {
-        auto gaTime = std::filesystem::last_write_time(gaPath);
-        std::filesystem::file_time_type oldestWrapper = (std::filesystem::file_time_type::max)();
+bool AreWrappersFresh(const std::string& output_directory) {
+    int64_t oldestWrapper = StartupFs::OldestWriteTimeWithExtension(
+        std::filesystem::path(output_directory).wstring(), L".cs");
+    if (oldestWrapper == 0) return false;  // missing directory or no wrappers
 
-        for (const auto& entry : std::filesystem::directory_iterator(output_directory)) {
-            if (entry.path().extension() == ".cs") {
-                auto wTime = std::filesystem::last_write_time(entry.path());
-                if (wTime < oldestWrapper) oldestWrapper = wTime;
-            }
-        }
-        return oldestWrapper > gaTime;
-    } catch (...) {
-        return false;
-    }
+    int64_t gaTime = GameAssemblyWriteTime();
+    return gaTime != 0 && oldestWrapper > gaTime;
 }
 
 } // namespace Dumper
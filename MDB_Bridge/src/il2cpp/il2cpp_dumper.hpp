@@ -16,7 +16,7 @@ namespace Dumper {
 
 struct DumpResult {
     bool success;
-    std::string dump_path;                         // Path to raw dump.cs (diagnostic)
+    std::string dump_path;                         // Path to raw dump.cs (empty unless [dump] raw_dump)
     std::string fake_report_path;                  // Path to fake_methods.txt (BeeByte report)
     std::string error_message;
     size_t total_classes;
@@ -28,6 +28,19 @@ struct DumpResult {
     size_t fake_classes_detected;
     // Deobfuscation stats
     size_t mappings_loaded;                        // Number of friendly name mappings applied
+    // Binary metadata cache (empty if the cache write failed — non-fatal)
+    std::string metadata_cache_path;
+    // Per-phase wall times in milliseconds (QueryPerformanceCounter).
+    // ms_file_io is the writer thread's active write time and overlaps
+    // ms_generation, so the phases do not sum to ms_total.
+    double ms_image_hashing;         // incremental manifest hashing
+    double ms_obfuscation_analysis;  // BeeByte fake method detection
+    double ms_collection;            // Phase 1 assembly/class walk
+    double ms_registry;              // Phase 1.5/1.6 registry + mappings + re-validation
+    double ms_generation;            // Phase 2 wrapper emission (wall)
+    double ms_file_io;               // writer-thread file writes
+    double ms_metadata_cache;        // Phase 4 binary cache write
+    double ms_total;                 // whole DumpIL2CppRuntime call
 };
 
 // Main dumper function - dumps IL2CPP metadata and generates buildable C# wrappers
@@ -4,12 +4,15 @@
 // il2cpp_resolver.hpp (v2.2)
 // ==============================
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <unordered_map>
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
 #include <type_traits>
 #include <fstream>
 #include <sstream>
@@ -17,6 +20,8 @@
 #include <windows.h>
 #include <Psapi.h>
 
+#include <Il2CppTableDefine.hpp>
+
 #pragma comment(lib, "psapi.lib")
 
 #ifndef WIN32_LEAN_AND_MEAN
@@ -324,6 +329,30 @@ namespace il2cpp {
 				std::uint8_t bitflags2;
 			};
 
+			// Pin every offset the resolver and dumper read through these
+			// mirrors. A layout drift now fails the build instead of
+			// producing silent garbage reads; version-specific drift is
+			// handled at runtime by the layout probe (ensure_class_layout).
+			static_assert(sizeof(void*) == 8,
+				"unity_structs mirrors assume x64");
+			static_assert(offsetof(Il2CppClass_1, name) == 0x10,
+				"Il2CppClass_1::name moved");
+			static_assert(offsetof(Il2CppClass_1, namespaze) == 0x18,
+				"Il2CppClass_1::namespaze moved");
+			static_assert(offsetof(Il2CppClass_1, parent) == 0x58,
+				"Il2CppClass_1::parent moved");
+			static_assert(offsetof(Il2CppClass_1, interfaceOffsets) == 0xB0,
+				"Il2CppClass_1::interfaceOffsets moved");
+			static_assert(sizeof(Il2CppClass_1) == 0xB8,
+				"Il2CppClass_1 size changed");
+			static_assert(offsetof(Il2CppClass_2, instance_size) == 0x30,
+				"Il2CppClass_2::instance_size moved");
+			static_assert(offsetof(Il2CppClass_2, vtable_count) == 0x5E,
+				"Il2CppClass_2::vtable_count moved");
+			static_assert(offsetof(il2cppMethodInfo, m_uToken) == 0x48,
+				"il2cppMethodInfo tail fields misaligned "
+				"(m_pVirtualCallMethodPointer present since Unity 2021)");
+
 			typedef void(*Il2CppMethodPointer)();
 			struct VirtualInvokeData {
 				Il2CppMethodPointer methodPtr;
@@ -383,8 +412,44 @@ namespace il2cpp {
 
 		inline HMODULE p_game_assembly = nullptr;
 
+		// ---- Version-adaptive class layout ----
+		// Byte offsets the resolver reads directly out of il2cppClass,
+		// seeded from the compiled mirrors (pinned by the static_asserts
+		// above) and corrected once at runtime by ensure_class_layout()
+		// when the engine's layout drifted. Accessors read through this
+		// table with no per-access validation.
+		struct ResolvedClassLayout {
+			size_t instance_size;   // Il2CppClass_2::instance_size from the class base
+		};
+		inline ResolvedClassLayout g_class_layout{
+			sizeof(unity_structs::Il2CppClass_1) + sizeof(void*) * 2
+				+ offsetof(unity_structs::Il2CppClass_2, instance_size)
+		};
+		inline std::once_flag g_class_layout_once;
+
+		// Reader-writer lock: lookups vastly outnumber insertions (writes only
+		// happen on first resolution), so concurrent mod threads take shared
+		// locks and never contend on the steady-state read path.
 		inline std::unordered_map<std::string, unity_structs::il2cppAssembly*> g_assembly_cache;
-		inline std::mutex g_cache_mtx;
+		inline std::shared_mutex g_cache_mtx;
+
+		// ---- Derived class metadata cache ----
+		// Flat snapshot of the class fields hot introspection paths keep
+		// re-deriving through accessor calls and Il2CppClass_1/_2 pointer
+		// chasing — the dumper and detector together touch the same classes
+		// millions of times over cold memory. Keyed by class pointer,
+		// populated on first touch (see il2cpp::get_class_meta), guarded by
+		// g_cache_mtx like the other caches.
+		struct ClassMeta {
+			const char* name;        // raw IL2CPP name ("" when unavailable)
+			const char* namespaze;   // raw namespace ("" when unavailable)
+			unity_structs::il2cppClass* parent;
+			int flags;
+			uint32_t instance_size;
+			bool is_valuetype;
+			bool is_enum;
+		};
+		inline std::unordered_map<const void*, ClassMeta> g_class_meta_cache;
 
 		// Forward declaration
 		inline Result<HMODULE> ensure_game_assembly();
@@ -454,48 +519,113 @@ namespace il2cpp {
 			}
 		}
 
-		// Find export by suffix pattern
-		inline uintptr_t find_export_by_suffix(HMODULE hModule, const char* suffix) {
-			auto dosHeader = reinterpret_cast<PIMAGE_DOS_HEADER>(hModule);
-			if (dosHeader->e_magic != IMAGE_DOS_SIGNATURE) return 0;
+		// =============================================
+		// Persistent Resolved-Export Cache
+		// =============================================
+		// On obfuscated titles the suffix/scan fallbacks re-derive the same
+		// name -> address mapping every launch. The resolved map is persisted
+		// as name -> RVA alongside the metadata dump, keyed by the
+		// GameAssembly identity, and loaded before any scanning so second
+		// launches bind straight from disk.
 
-			auto ntHeaders = reinterpret_cast<PIMAGE_NT_HEADERS>(
-				reinterpret_cast<BYTE*>(hModule) + dosHeader->e_lfanew);
-			if (ntHeaders->Signature != IMAGE_NT_SIGNATURE) return 0;
+		inline std::unordered_map<std::string, uintptr_t> g_export_rva_cache;
+		inline bool g_export_cache_loaded = false;
+		inline bool g_export_cache_dirty = false;
 
-			auto& exportDir = ntHeaders->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
-			if (exportDir.VirtualAddress == 0) return 0;
+		inline std::string export_cache_path() {
+			char exePath[MAX_PATH];
+			GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+			std::string exeDir(exePath);
+			size_t lastSlash = exeDir.find_last_of("\\/");
+			if (lastSlash != std::string::npos) {
+				exeDir = exeDir.substr(0, lastSlash);
+			}
+			return exeDir + "\\MDB\\Dump\\resolved_exports_cache.txt";
+		}
 
-			auto exports = reinterpret_cast<PIMAGE_EXPORT_DIRECTORY>(
-				reinterpret_cast<BYTE*>(hModule) + exportDir.VirtualAddress);
+		// Identity of the GameAssembly on disk: size + write time. A game
+		// update invalidates the cached RVAs automatically.
+		inline std::string compute_game_assembly_identity(HMODULE hModule) {
+			char modPath[MAX_PATH];
+			if (!GetModuleFileNameA(hModule, modPath, MAX_PATH)) return {};
 
-			auto names = reinterpret_cast<DWORD*>(
-				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfNames);
-			auto ordinals = reinterpret_cast<WORD*>(
-				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfNameOrdinals);
-			auto functions = reinterpret_cast<DWORD*>(
-				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfFunctions);
+			WIN32_FILE_ATTRIBUTE_DATA attr{};
+			if (!GetFileAttributesExA(modPath, GetFileExInfoStandard, &attr)) return {};
 
-			size_t suffixLen = strlen(suffix);
-			for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
-				const char* name = reinterpret_cast<const char*>(
-					reinterpret_cast<BYTE*>(hModule) + names[i]);
-				size_t nameLen = strlen(name);
-
-				if (nameLen > suffixLen && strcmp(name + nameLen - suffixLen, suffix) == 0) {
-					// Store the found obfuscated name for logging
-					auto it = SUFFIX_TO_ORIGINAL.find(suffix);
-					if (it != SUFFIX_TO_ORIGINAL.end()) {
-						std::string originalName = "il2cpp" + it->second;
-						g_obfuscated_exports[originalName] = name;
-					}
-					return reinterpret_cast<uintptr_t>(hModule) + functions[ordinals[i]];
-				}
+			uint64_t fileSize = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+			uint64_t writeTime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32)
+				| attr.ftLastWriteTime.dwLowDateTime;
+
+			std::stringstream ss;
+			ss << fileSize << "-" << writeTime;
+			return ss.str();
+		}
+
+		inline void load_export_cache(HMODULE hModule) {
+			if (g_export_cache_loaded) return;
+			g_export_cache_loaded = true;
+
+			std::string identity = compute_game_assembly_identity(hModule);
+			if (identity.empty()) return;
+
+			std::ifstream file(export_cache_path());
+			if (!file.is_open()) return;
+
+			std::string storedIdentity;
+			if (!std::getline(file, storedIdentity) || storedIdentity != identity) {
+				return;  // stale (game updated) or corrupt — rebuild via scanning
+			}
+
+			std::string name;
+			uintptr_t rva = 0;
+			while (file >> name >> std::hex >> rva) {
+				g_export_rva_cache.emplace(name, rva);
+			}
+		}
+
+		inline void save_export_cache(HMODULE hModule) {
+			if (!g_export_cache_dirty) return;
+			g_export_cache_dirty = false;
+
+			std::string identity = compute_game_assembly_identity(hModule);
+			if (identity.empty()) return;
+
+			// Ensure MDB/Dump exists (same layout write_export_log uses)
+			char exePath[MAX_PATH];
+			GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+			std::string exeDir(exePath);
+			size_t lastSlash = exeDir.find_last_of("\\/");
+			if (lastSlash != std::string::npos) {
+				exeDir = exeDir.substr(0, lastSlash);
+			}
+			CreateDirectoryA((exeDir + "\\MDB").c_str(), nullptr);
+			CreateDirectoryA((exeDir + "\\MDB\\Dump").c_str(), nullptr);
+
+			std::ofstream file(export_cache_path(), std::ios::trunc);
+			if (!file.is_open()) return;
+
+			file << identity << "\n";
+			for (const auto& [name, rva] : g_export_rva_cache) {
+				file << name << " " << std::hex << rva << "\n";
+			}
+		}
+
+		inline void cache_resolved_export(HMODULE hModule, const std::string& name, uintptr_t address) {
+			uintptr_t base = reinterpret_cast<uintptr_t>(hModule);
+			if (address <= base) return;
+			if (g_export_rva_cache.emplace(name, address - base).second) {
+				g_export_cache_dirty = true;
 			}
-			return 0;
 		}
 
-		// Scan PE exports and build obfuscation map
+		// One-pass export table snapshot: name -> absolute address. Built on
+		// the first resolve_export call and shared by every binding, so the
+		// ~40 exports ensure_exports resolves cost one PE walk total instead
+		// of one GetProcAddress (plus independent obfuscation fallbacks) each.
+		inline std::unordered_map<std::string, uintptr_t> g_export_table;
+
+		// Scan PE exports once: snapshot all names and classify obfuscation
+		// patterns in the same pass.
 		inline void scan_pe_exports() {
 			if (g_exports_scanned) return;
 			g_exports_scanned = true;
@@ -519,14 +649,30 @@ namespace il2cpp {
 
 			auto names = reinterpret_cast<DWORD*>(
 				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfNames);
+			auto ordinals = reinterpret_cast<WORD*>(
+				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfNameOrdinals);
+			auto functions = reinterpret_cast<DWORD*>(
+				reinterpret_cast<BYTE*>(hModule) + exports->AddressOfFunctions);
+
+			const uintptr_t exportDirStart = reinterpret_cast<uintptr_t>(hModule) + exportDir.VirtualAddress;
+			const uintptr_t exportDirEnd = exportDirStart + exportDir.Size;
+
+			g_export_table.reserve(exports->NumberOfNames);
 
-			// Scan all export names for obfuscation patterns
 			for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
 				const char* name = reinterpret_cast<const char*>(
 					reinterpret_cast<BYTE*>(hModule) + names[i]);
 
 				std::string exportName(name);
 
+				// Snapshot the address; skip forwarded exports (RVA inside the
+				// export directory is a forwarder string, not code) — those
+				// resolve through the GetProcAddress fallback instead.
+				uintptr_t addr = reinterpret_cast<uintptr_t>(hModule) + functions[ordinals[i]];
+				if (addr < exportDirStart || addr >= exportDirEnd) {
+					g_export_table.emplace(exportName, addr);
+				}
+
 				// Check each obfuscation suffix
 				for (int s = 0; OBFUSCATION_SUFFIXES[s] != nullptr; ++s) {
 					const char* suffix = OBFUSCATION_SUFFIXES[s];
@@ -568,48 +714,50 @@ namespace il2cpp {
 		}
 
 		// Unified export resolution with fallback chain:
-		// 1. Standard GetProcAddress
-		// 2. Suffix-based pattern matching for obfuscated exports
+		// 1. One-time export table snapshot (shared by all bindings)
+		// 2. Obfuscation mapping classified during the same snapshot pass
+		// 3. GetProcAddress for forwarded/ordinal exports the snapshot skips
 		template <class T>
 		inline Result<T> resolve_export(std::string_view name) {
 			auto mod = ensure_game_assembly();
 			if (!mod) return { mod.status, nullptr };
-			
+
 			std::string exportName(name);
-			
-			// Strategy 1: Standard GetProcAddress
-			auto p = reinterpret_cast<T>(::GetProcAddress(mod.value, exportName.c_str()));
-			if (p) {
-				log_export_resolution(exportName, exportName, reinterpret_cast<uintptr_t>(p), "GetProcAddress");
-				return { Il2CppStatus::OK, p };
+
+			// Strategy 0: Persisted RVA cache from a previous launch — skips
+			// all table walks and obfuscation work when the game is unchanged
+			load_export_cache(mod.value);
+			if (auto it = g_export_rva_cache.find(exportName); it != g_export_rva_cache.end()) {
+				uintptr_t addr = reinterpret_cast<uintptr_t>(mod.value) + it->second;
+				log_export_resolution(exportName, exportName, addr, "DiskCache");
+				return { Il2CppStatus::OK, reinterpret_cast<T>(addr) };
 			}
-			
-			// Strategy 2: Check for cached obfuscated name
+
+			// Strategy 1: Export table snapshot (one PE pass for all exports)
 			scan_pe_exports();
-			auto it = g_obfuscated_exports.find(exportName);
-			if (it != g_obfuscated_exports.end()) {
-				p = reinterpret_cast<T>(::GetProcAddress(mod.value, it->second.c_str()));
-				if (p) {
-					log_export_resolution(exportName, it->second, reinterpret_cast<uintptr_t>(p), "SuffixMatch");
-					return { Il2CppStatus::OK, p };
-				}
+			if (auto it = g_export_table.find(exportName); it != g_export_table.end()) {
+				log_export_resolution(exportName, exportName, it->second, "ExportTable");
+				cache_resolved_export(mod.value, exportName, it->second);
+				return { Il2CppStatus::OK, reinterpret_cast<T>(it->second) };
 			}
-			
-			// Strategy 3: Direct suffix scan for this specific export
-			for (int i = 0; OBFUSCATION_SUFFIXES[i] != nullptr; ++i) {
-				uintptr_t addr = find_export_by_suffix(mod.value, OBFUSCATION_SUFFIXES[i]);
-				if (addr) {
-					// Get the actual name that was found
-					std::string foundName = "<suffix:" + std::string(OBFUSCATION_SUFFIXES[i]) + ">";
-					auto obfIt = g_obfuscated_exports.find(exportName);
-					if (obfIt != g_obfuscated_exports.end()) {
-						foundName = obfIt->second;
-					}
-					log_export_resolution(exportName, foundName, addr, "SuffixScan");
-					return { Il2CppStatus::OK, reinterpret_cast<T>(addr) };
+
+			// Strategy 2: Obfuscated name mapping built during the same pass
+			if (auto it = g_obfuscated_exports.find(exportName); it != g_obfuscated_exports.end()) {
+				if (auto addrIt = g_export_table.find(it->second); addrIt != g_export_table.end()) {
+					log_export_resolution(exportName, it->second, addrIt->second, "SuffixMatch");
+					cache_resolved_export(mod.value, exportName, addrIt->second);
+					return { Il2CppStatus::OK, reinterpret_cast<T>(addrIt->second) };
 				}
 			}
-			
+
+			// Strategy 3: GetProcAddress fallback (forwarded exports carry a
+			// forwarder string instead of code and are skipped by the snapshot)
+			auto p = reinterpret_cast<T>(::GetProcAddress(mod.value, exportName.c_str()));
+			if (p) {
+				log_export_resolution(exportName, exportName, reinterpret_cast<uintptr_t>(p), "GetProcAddress");
+				return { Il2CppStatus::OK, p };
+			}
+
 			return { Il2CppStatus::GetProcAddressFailed, nullptr };
 		}
 
@@ -672,93 +820,60 @@ namespace il2cpp {
 		// --------------------------
 		// Validate exports & bind (LAZY RESOLUTION)
 		// --------------------------
+
+		// Flat compile-time view of the binding table (Il2CppTableDefine.hpp).
+		// The binder below expands the same X-macros directly over the typed
+		// slots; this array is the data-only form for diagnostics and sizing.
+		struct ExportBindingDesc {
+			const char* name;
+			bool required;
+		};
+
+#define MDB_REQUIRED_DESC(fn, err) ExportBindingDesc{ #fn, true },
+#define MDB_OPTIONAL_DESC(fn)      ExportBindingDesc{ #fn, false },
+		inline constexpr auto k_export_bindings = std::array{
+			MDB_IL2CPP_REQUIRED_EXPORTS(MDB_REQUIRED_DESC)
+			MDB_IL2CPP_OPTIONAL_EXPORTS(MDB_OPTIONAL_DESC)
+		};
+#undef MDB_REQUIRED_DESC
+#undef MDB_OPTIONAL_DESC
+
 		inline Il2CppStatus ensure_exports() {
 			// Skip if already initialized
 			static bool s_initialized = false;
 			if (s_initialized && il2cpp_domain_get) return Il2CppStatus::OK;
-			
-			// Resolve all exports now (lazy)
-			auto r_il2cpp_domain_get = resolve_export<void* (__fastcall*)(void)>("il2cpp_domain_get");
-			auto r_il2cpp_thread_attach = resolve_export<void* (__fastcall*)(void*)>("il2cpp_thread_attach");
-			// Uses unified resolve_export with automatic suffix fallback
-			auto r_il2cpp_domain_get_assemblies = resolve_export<unity_structs::il2cppAssembly** (__fastcall*)(void*, size_t*)>("il2cpp_domain_get_assemblies");
-			auto r_il2cpp_class_from_name = resolve_export<unity_structs::il2cppClass* (__fastcall*)(unity_structs::il2cppImage*, const char*, const char*)>("il2cpp_class_from_name");
-			auto r_il2cpp_class_get_method_from_name = resolve_export<unity_structs::il2cppMethodInfo* (__fastcall*)(unity_structs::il2cppClass*, const char*, int)>("il2cpp_class_get_method_from_name");
-			auto r_il2cpp_class_get_field_from_name = resolve_export<unity_structs::il2cppFieldInfo* (__fastcall*)(unity_structs::il2cppClass*, const char*)>("il2cpp_class_get_field_from_name");
-			auto r_il2cpp_field_get_value = resolve_export<void(__fastcall*)(void*, unity_structs::il2cppFieldInfo*, void*)>("il2cpp_field_get_value");
-			auto r_il2cpp_field_set_value = resolve_export<void(__fastcall*)(void*, unity_structs::il2cppFieldInfo*, void*)>("il2cpp_field_set_value");
-			auto r_il2cpp_field_static_get_value = resolve_export<void(__fastcall*)(unity_structs::il2cppFieldInfo*, void*)>("il2cpp_field_static_get_value");
-			auto r_il2cpp_field_static_set_value = resolve_export<void(__fastcall*)(unity_structs::il2cppFieldInfo*, void*)>("il2cpp_field_static_set_value");
-			auto r_il2cpp_string_new = resolve_export<void* (__fastcall*)(const char*)>("il2cpp_string_new");
-			auto r_il2cpp_object_new = resolve_export<void* (__fastcall*)(unity_structs::il2cppClass*)>("il2cpp_object_new");
-			
-			auto bind = [](auto& dst, auto& res, Il2CppStatus err) -> Il2CppStatus {
-				if (res.status != Il2CppStatus::OK || !res.value) return err;
-				dst = res.value; return Il2CppStatus::OK;
+
+			// Required exports: one table entry each, abort with the entry's
+			// status when missing. The slot type is deduced from the slot
+			// itself, so the table stays signature-free.
+			auto bind_required = [](auto& dst, const char* name, Il2CppStatus err) -> Il2CppStatus {
+				auto r = resolve_export<std::remove_reference_t<decltype(dst)>>(name);
+				if (r.status != Il2CppStatus::OK || !r.value) return err;
+				dst = r.value;
+				return Il2CppStatus::OK;
 				};
 
-			if (auto s = bind(il2cpp_domain_get, r_il2cpp_domain_get, Il2CppStatus::Missing_domain_get); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_thread_attach, r_il2cpp_thread_attach, Il2CppStatus::Missing_thread_attach); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_domain_get_assemblies, r_il2cpp_domain_get_assemblies, Il2CppStatus::Missing_domain_get_assemblies); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_class_from_name, r_il2cpp_class_from_name, Il2CppStatus::Missing_class_from_name); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_class_get_method_from_name, r_il2cpp_class_get_method_from_name, Il2CppStatus::Missing_class_get_method_from_name); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_class_get_field_from_name, r_il2cpp_class_get_field_from_name, Il2CppStatus::Missing_class_get_field_from_name); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_field_get_value, r_il2cpp_field_get_value, Il2CppStatus::Missing_field_get_set); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_field_set_value, r_il2cpp_field_set_value, Il2CppStatus::Missing_field_get_set); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_field_static_get_value, r_il2cpp_field_static_get_value, Il2CppStatus::Missing_field_get_set); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_field_static_set_value, r_il2cpp_field_static_set_value, Il2CppStatus::Missing_field_get_set); s != Il2CppStatus::OK) return s;
-			if (auto s = bind(il2cpp_object_new, r_il2cpp_object_new, Il2CppStatus::GetProcAddressFailed); s != Il2CppStatus::OK) return s;
-
-			if (r_il2cpp_string_new) il2cpp_string_new = r_il2cpp_string_new.value;
-
-			// -- Dumper/introspection APIs (best-effort, not required for bridge) --
+#define MDB_BIND_REQUIRED(fn, err) \
+			if (auto s = bind_required(fn, #fn, Il2CppStatus::err); s != Il2CppStatus::OK) return s;
+			MDB_IL2CPP_REQUIRED_EXPORTS(MDB_BIND_REQUIRED)
+#undef MDB_BIND_REQUIRED
+
+			// Optional exports: best-effort, features degrade without them
 			auto try_bind = [](auto& dst, const char* name) {
 				auto r = resolve_export<std::remove_reference_t<decltype(dst)>>(name);
 				if (r && r.value) dst = r.value;
-			};
-			try_bind(il2cpp_assembly_get_image,      "il2cpp_assembly_get_image");
-			try_bind(il2cpp_image_get_name,           "il2cpp_image_get_name");
-			try_bind(il2cpp_image_get_class_count,    "il2cpp_image_get_class_count");
-			try_bind(il2cpp_image_get_class,          "il2cpp_image_get_class");
-			try_bind(il2cpp_class_get_type,           "il2cpp_class_get_type");
-			try_bind(il2cpp_class_from_type,          "il2cpp_class_from_type");
-			try_bind(il2cpp_class_get_namespace,      "il2cpp_class_get_namespace");
-			try_bind(il2cpp_class_get_flags,          "il2cpp_class_get_flags");
-			try_bind(il2cpp_class_is_valuetype,       "il2cpp_class_is_valuetype");
-			try_bind(il2cpp_class_is_enum,            "il2cpp_class_is_enum");
-			try_bind(il2cpp_class_get_name,           "il2cpp_class_get_name");
-			try_bind(il2cpp_class_get_declaring_type, "il2cpp_class_get_declaring_type");
-			try_bind(il2cpp_class_get_parent,         "il2cpp_class_get_parent");
-			try_bind(il2cpp_class_get_interfaces,     "il2cpp_class_get_interfaces");
-			try_bind(il2cpp_class_get_fields,         "il2cpp_class_get_fields");
-			try_bind(il2cpp_field_get_flags,          "il2cpp_field_get_flags");
-			try_bind(il2cpp_field_get_type,           "il2cpp_field_get_type");
-			try_bind(il2cpp_field_get_name,           "il2cpp_field_get_name");
-			try_bind(il2cpp_field_get_offset,         "il2cpp_field_get_offset");
-			try_bind(il2cpp_class_get_properties,     "il2cpp_class_get_properties");
-			try_bind(il2cpp_property_get_get_method,  "il2cpp_property_get_get_method");
-			try_bind(il2cpp_property_get_set_method,  "il2cpp_property_get_set_method");
-			try_bind(il2cpp_property_get_name,        "il2cpp_property_get_name");
-			try_bind(il2cpp_method_get_flags,         "il2cpp_method_get_flags");
-			try_bind(il2cpp_method_get_return_type,   "il2cpp_method_get_return_type");
-			try_bind(il2cpp_method_get_param,         "il2cpp_method_get_param");
-			try_bind(il2cpp_class_get_methods,        "il2cpp_class_get_methods");
-			try_bind(il2cpp_type_is_byref,            "il2cpp_type_is_byref");
-			try_bind(il2cpp_method_get_name,          "il2cpp_method_get_name");
-			try_bind(il2cpp_method_get_param_count,   "il2cpp_method_get_param_count");
-			try_bind(il2cpp_method_get_param_name,    "il2cpp_method_get_param_name");
-
-			// Generic method inflation
-			try_bind(il2cpp_method_get_object,         "il2cpp_method_get_object");
-			try_bind(il2cpp_method_get_from_reflection,"il2cpp_method_get_from_reflection");
-			try_bind(il2cpp_type_get_object,           "il2cpp_type_get_object");
-			try_bind(il2cpp_object_get_class,          "il2cpp_object_get_class");
-			try_bind(il2cpp_array_new,                 "il2cpp_array_new");
-			try_bind(il2cpp_runtime_invoke,            "il2cpp_runtime_invoke");
+				};
+
+#define MDB_BIND_OPTIONAL(fn) try_bind(fn, #fn);
+			MDB_IL2CPP_OPTIONAL_EXPORTS(MDB_BIND_OPTIONAL)
+#undef MDB_BIND_OPTIONAL
 
 			// Write export resolution log to game folder
 			write_export_log();
-			
+
+			// Persist newly resolved RVAs for the next launch
+			if (p_game_assembly) save_export_cache(p_game_assembly);
+
 			s_initialized = true;
 			return Il2CppStatus::OK;
 		}
@@ -774,7 +889,7 @@ namespace il2cpp {
 				return { s, nullptr };
 
 			{   // Cache
-				std::scoped_lock lk(g_cache_mtx);
+				std::shared_lock lk(g_cache_mtx);
 				if (auto it = g_assembly_cache.find(std::string(assembly_name)); it != g_assembly_cache.end())
 					return { Il2CppStatus::OK, it->second };
 			}
@@ -799,24 +914,102 @@ namespace il2cpp {
 			}
 			return { Il2CppStatus::AssemblyNotFound, nullptr };
 		}
+
+		// --------------------------
+		// Global class index
+		// --------------------------
+		// One-time index of (assembly, namespace, name) -> il2cppClass*, built
+		// lazily on the first find_class call. SDK warmup resolves thousands of
+		// classes back-to-back; after the single enumeration pass each lookup is
+		// a hash probe instead of a runtime call into il2cpp_class_from_name.
+		inline std::unordered_map<std::string, unity_structs::il2cppClass*> g_class_index;
+		inline bool g_class_index_built = false;
+
+		inline std::string class_index_key(std::string_view assembly_name,
+			std::string_view ns,
+			std::string_view class_name) {
+			std::string key;
+			key.reserve(assembly_name.size() + ns.size() + class_name.size() + 2);
+			key.append(assembly_name);
+			key.push_back('\n');
+			key.append(ns);
+			key.push_back('\n');
+			key.append(class_name);
+			return key;
+		}
+
+		// Builds the index by enumerating every class of every loaded assembly.
+		// Needs the best-effort introspection exports; if any are missing the
+		// index stays empty and find_class falls back to il2cpp_class_from_name.
+		// Caller must hold g_cache_mtx.
+		inline void ensure_class_index() {
+			if (g_class_index_built) return;
+
+			if (!il2cpp_image_get_class_count || !il2cpp_image_get_class ||
+				!il2cpp_class_get_name || !il2cpp_class_get_namespace) {
+				g_class_index_built = true;
+				return;
+			}
+
+			auto domain = il2cpp_domain_get ? il2cpp_domain_get() : nullptr;
+			if (!domain) return;
+
+			size_t count = 0;
+			auto assemblies = il2cpp_domain_get_assemblies(domain, &count);
+			if (!assemblies || count == 0) return;
+
+			for (size_t i = 0; i < count; ++i) {
+				const auto* a = assemblies[i];
+				if (!a || !a->m_pImage) continue;
+
+				// Index under both naming schemes find_assembly accepts
+				const char* meta = a->m_aName.m_pName;
+				const char* noext = a->m_pImage->m_oNameNoExt;
+
+				size_t classCount = il2cpp_image_get_class_count(a->m_pImage);
+				for (size_t c = 0; c < classCount; ++c) {
+					auto* klass = il2cpp_image_get_class(a->m_pImage, c);
+					if (!klass) continue;
+					const char* name = il2cpp_class_get_name(klass);
+					if (!name) continue;
+					const char* ns = il2cpp_class_get_namespace(klass);
+					if (meta)
+						g_class_index.emplace(class_index_key(meta, ns ? ns : "", name), klass);
+					if (noext && (!meta || strcmp(meta, noext) != 0))
+						g_class_index.emplace(class_index_key(noext, ns ? ns : "", name), klass);
+				}
+			}
+
+			g_class_index_built = true;
+		}
 	} // namespace _internal
 
 	// ------------------------------------
 	// Thread-Attach
 	// ------------------------------------
+	namespace _internal {
+		// Bumped whenever attachment state may have been invalidated (cleanup,
+		// domain teardown), forcing every thread through the slow path once.
+		inline std::atomic<uint32_t> g_attach_generation{ 1 };
+	}
+
 	inline Il2CppStatus ensure_thread_attached() {
+		// Steady state: one TLS read plus a relaxed-ish atomic load. The export
+		// checks and domain call only run the first time per thread (or after
+		// the generation is bumped).
+		thread_local uint32_t t_attached_gen = 0;
+		const uint32_t gen = _internal::g_attach_generation.load(std::memory_order_acquire);
+		if (t_attached_gen == gen) return Il2CppStatus::OK;
+
 		auto s = _internal::ensure_exports();
 		if (s != Il2CppStatus::OK) return s;
 		if (!_internal::il2cpp_domain_get || !_internal::il2cpp_thread_attach)
 			return Il2CppStatus::ThreadAttachUnavailable;
 
-		thread_local bool t_attached = false;
-		if (!t_attached) {
-			auto domain = _internal::il2cpp_domain_get();
-			if (!domain) return Il2CppStatus::DomainUnavailable;
-			_internal::il2cpp_thread_attach(domain);
-			t_attached = true;
-		}
+		auto domain = _internal::il2cpp_domain_get();
+		if (!domain) return Il2CppStatus::DomainUnavailable;
+		_internal::il2cpp_thread_attach(domain);
+		t_attached_gen = gen;
 		return Il2CppStatus::OK;
 	}
 
@@ -832,15 +1025,90 @@ namespace il2cpp {
 		if (class_name.empty() || assembly_name.empty())
 			return { Il2CppStatus::InvalidArgs, nullptr };
 
+		if (auto s = _internal::ensure_exports(); s != Il2CppStatus::OK)
+			return { s, nullptr };
+
+		// Global index (built once, shared with get_class_size/mdb_find_class).
+		// Steady state takes only a shared lock; the exclusive lock is needed
+		// just for the one-time build pass.
+		bool index_ready = false;
+		{
+			std::shared_lock lk(_internal::g_cache_mtx);
+			if (_internal::g_class_index_built) {
+				index_ready = true;
+				auto it = _internal::g_class_index.find(
+					_internal::class_index_key(assembly_name, ns, class_name));
+				if (it != _internal::g_class_index.end())
+					return { Il2CppStatus::OK, it->second };
+			}
+		}
+		if (!index_ready) {
+			std::scoped_lock lk(_internal::g_cache_mtx);
+			_internal::ensure_class_index();
+			auto it = _internal::g_class_index.find(
+				_internal::class_index_key(assembly_name, ns, class_name));
+			if (it != _internal::g_class_index.end())
+				return { Il2CppStatus::OK, it->second };
+		}
+
+		// Fallback: nested names and assemblies loaded after the index build
+		// still resolve through the runtime; memoize the result for next time.
 		auto a = _internal::find_assembly(assembly_name);
 		if (!a) return { a.status, nullptr };
 		if (!a.value->m_pImage) return { Il2CppStatus::ImageUnavailable, nullptr };
 
 		auto* klass = _internal::il2cpp_class_from_name(a.value->m_pImage, ns.c_str(), class_name.c_str());
 		if (!klass) return { Il2CppStatus::ClassNotFound, nullptr };
+
+		{
+			std::scoped_lock lk(_internal::g_cache_mtx);
+			_internal::g_class_index.emplace(
+				_internal::class_index_key(assembly_name, ns, class_name), klass);
+		}
 		return { Il2CppStatus::OK, klass };
 	}
 
+	// One-time layout probe: verifies the compiled instance_size offset
+	// against boxed sizes that are invariant across every supported Unity
+	// version (Int32 -> 0x14, Boolean -> 0x11 on x64) and, when the
+	// engine's layout drifted, relocates the field by scanning nearby
+	// offsets for the same invariant pair. Selecting the layout once here
+	// is what lets the accessors below read with no defensive checks.
+	inline void ensure_class_layout() {
+		std::call_once(_internal::g_class_layout_once, [] {
+			auto i32 = find_class("System", "Int32", "mscorlib");
+			auto bln = find_class("System", "Boolean", "mscorlib");
+			if (!i32 || !bln) return;   // keep the compiled offsets
+
+			constexpr uint32_t kBoxedInt32Size = 0x14;
+			constexpr uint32_t kBoxedBooleanSize = 0x11;
+			auto read_u32 = [](void* base, size_t off) {
+				return *reinterpret_cast<uint32_t*>(
+					reinterpret_cast<uintptr_t>(base) + off);
+				};
+
+			size_t& off = _internal::g_class_layout.instance_size;
+			if (read_u32(i32.value, off) == kBoxedInt32Size &&
+				read_u32(bln.value, off) == kBoxedBooleanSize) {
+				return;                 // compiled layout matches this engine
+			}
+
+			// Drifted engines shift the size block by whole fields; scan a
+			// window around the compiled offset, nearest candidates first
+			for (ptrdiff_t delta = 4; delta <= 0x40; delta += 4) {
+				for (ptrdiff_t d : { -delta, delta }) {
+					size_t cand = off + d;
+					if (read_u32(i32.value, cand) == kBoxedInt32Size &&
+						read_u32(bln.value, cand) == kBoxedBooleanSize) {
+						off = cand;
+						return;
+					}
+				}
+			}
+			// No candidate found — leave the compiled offset in place
+			});
+	}
+
 	// Class size
 	inline Result<size_t>
 		get_class_size(const std::string& ns,
@@ -854,13 +1122,11 @@ namespace il2cpp {
 		auto c = find_class(ns, class_name, assembly_name);
 		if (!c) return { c.status, 0 };
 
-		auto base_addr = reinterpret_cast<uintptr_t>(c.value);
-
-		size_t offset = sizeof(_internal::unity_structs::Il2CppClass_1) + sizeof(void*) * 2;
-
-		offset += offsetof(_internal::unity_structs::Il2CppClass_2, instance_size);
+		ensure_class_layout();
 
-		auto instance_size = *reinterpret_cast<uint32_t*>(base_addr + offset);
+		auto base_addr = reinterpret_cast<uintptr_t>(c.value);
+		auto instance_size = *reinterpret_cast<uint32_t*>(
+			base_addr + _internal::g_class_layout.instance_size);
 
 		return { Il2CppStatus::OK, static_cast<size_t>(instance_size) };
 	}
@@ -870,15 +1136,59 @@ namespace il2cpp {
 	{
 		if (!klass) return { Il2CppStatus::InvalidArgs, 0 };
 
+		ensure_class_layout();
+
 		auto base_addr = reinterpret_cast<uintptr_t>(klass);
+		auto instance_size = *reinterpret_cast<uint32_t*>(
+			base_addr + _internal::g_class_layout.instance_size);
 
-		size_t offset = sizeof(_internal::unity_structs::Il2CppClass_1) + sizeof(void*) * 2;
+		return { Il2CppStatus::OK, static_cast<size_t>(instance_size) };
+	}
 
-		offset += offsetof(_internal::unity_structs::Il2CppClass_2, instance_size);
+	// ========= Derived class metadata =========
 
-		auto instance_size = *reinterpret_cast<uint32_t*>(base_addr + offset);
+	using ClassMeta = _internal::ClassMeta;
 
-		return { Il2CppStatus::OK, static_cast<size_t>(instance_size) };
+	// Cached flat snapshot of the per-class fields hot paths re-derive
+	// (name, namespace, parent, flags, valuetype/enum, instance size).
+	// One accessor burst on first touch, a shared-lock hash probe after.
+	// Returns nullptr only for a null class; entries are stable for the
+	// process lifetime (class pointers never move).
+	inline const ClassMeta*
+		get_class_meta(_internal::unity_structs::il2cppClass* klass)
+	{
+		if (!klass) return nullptr;
+
+		{   // Cache
+			std::shared_lock lk(_internal::g_cache_mtx);
+			if (auto it = _internal::g_class_meta_cache.find(klass);
+				it != _internal::g_class_meta_cache.end())
+				return &it->second;
+		}
+
+		// Derive outside the lock — accessors are pure reads
+		ClassMeta meta{};
+		const char* name = _internal::il2cpp_class_get_name
+			? _internal::il2cpp_class_get_name(klass) : nullptr;
+		meta.name = name ? name : "";
+		const char* ns = _internal::il2cpp_class_get_namespace
+			? _internal::il2cpp_class_get_namespace(klass) : nullptr;
+		meta.namespaze = ns ? ns : "";
+		meta.parent = _internal::il2cpp_class_get_parent
+			? _internal::il2cpp_class_get_parent(klass) : nullptr;
+		meta.flags = _internal::il2cpp_class_get_flags
+			? _internal::il2cpp_class_get_flags(klass) : 0;
+		meta.is_valuetype = _internal::il2cpp_class_is_valuetype
+			&& _internal::il2cpp_class_is_valuetype(klass);
+		meta.is_enum = _internal::il2cpp_class_is_enum
+			&& _internal::il2cpp_class_is_enum(klass);
+
+		ensure_class_layout();
+		meta.instance_size = *reinterpret_cast<uint32_t*>(
+			reinterpret_cast<uintptr_t>(klass) + _internal::g_class_layout.instance_size);
+
+		std::scoped_lock lk(_internal::g_cache_mtx);
+		return &_internal::g_class_meta_cache.emplace(klass, meta).first->second;
 	}
 
 	inline Result<_internal::unity_structs::il2cppMethodInfo*>
@@ -1177,7 +1487,10 @@ namespace il2cpp {
 
 	inline void cleanup() {
 		if (_internal::il2cpp_thread_detach) _internal::il2cpp_thread_detach();
+		_internal::g_attach_generation.fetch_add(1, std::memory_order_release);
 		std::scoped_lock lk(_internal::g_cache_mtx);
 		_internal::g_assembly_cache.clear();
+		_internal::g_class_index.clear();
+		_internal::g_class_index_built = false;
 	}
 } // namespace il2cpp
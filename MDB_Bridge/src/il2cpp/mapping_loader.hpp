@@ -12,11 +12,28 @@
 //       "ParentType": null, ... }, ... ]
 //
 // SymbolType: 0=Type, 1=Field, 2=Property, 3=Method
+//
+// The first load compiles the JSON into a binary sidecar (mappings.mdbm):
+// open-addressed hash tables with precomputed "parent::member" keys over a
+// shared string table. Later launches memory-map the sidecar and resolve
+// directly out of mapped memory — no parsing, no per-entry allocations. The
+// sidecar is stamped with the JSON's size/mtime and recompiled when it
+// changes.
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
 
+#include "core/mapped_cache.hpp"
+
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <fstream>
-#include <sstream>
+#include <utility>
 #include <vector>
 
 namespace MDB {
@@ -24,46 +41,43 @@ namespace Mappings {
 
 class MappingLookup {
 public:
+    MappingLookup() = default;
+    ~MappingLookup() { CloseBinary(); }
+    MappingLookup(const MappingLookup&) = delete;
+    MappingLookup& operator=(const MappingLookup&) = delete;
+
     /// Load mappings from a JSON file. Returns true if successfully parsed.
+    /// Uses the memory-mapped binary sidecar when it is current; otherwise
+    /// parses the JSON and (re)compiles the sidecar for the next launch.
     bool Load(const std::string& path) {
-        std::ifstream file(path);
-        if (!file.is_open()) return false;
-
-        std::stringstream buf;
-        buf << file.rdbuf();
-        std::string json = buf.str();
-        file.close();
-
+        CloseBinary();
         type_map_.clear();
-        member_map_.clear();
+        member_map_.Clear();
 
-        auto objects = SplitJsonObjects(json);
-        for (const auto& obj : objects) {
-            std::string obfName     = ExtractJsonString(obj, "ObfuscatedName");
-            std::string friendlyName = ExtractJsonString(obj, "FriendlyName");
-            int symbolType           = ExtractJsonInt(obj, "SymbolType");
-            std::string parentType   = ExtractJsonString(obj, "ParentType");
+        uint64_t srcSize = 0, srcMtime = 0;
+        if (!GetFileStamp(path, &srcSize, &srcMtime)) return false;
 
-            if (obfName.empty() || friendlyName.empty()) continue;
+        // mappings.json -> mappings.mdbm
+        std::string sidecar = path;
+        size_t dot = sidecar.find_last_of('.');
+        if (dot != std::string::npos) sidecar.resize(dot);
+        sidecar += ".mdbm";
 
-            if (symbolType == 0) {
-                // Type (class, enum, interface, struct, delegate)
-                type_map_[obfName] = friendlyName;
-            } else {
-                // Member (field=1, property=2, method=3)
-                std::string key = parentType.empty()
-                    ? obfName
-                    : (parentType + "::" + obfName);
-                member_map_[key] = friendlyName;
-            }
-        }
+        if (TryOpenBinary(sidecar, srcSize, srcMtime)) return true;
 
+        if (!LoadJson(path)) return false;
+        WriteBinary(sidecar, srcSize, srcMtime);   // best-effort
         return true;
     }
 
     /// Look up a type's friendly name by its obfuscated name.
     /// Returns empty string if not found.
     std::string ResolveType(const std::string& obfuscated_name) const {
+        if (mapped_base_) {
+            const char* found = MappedFind(type_slots_, type_bucket_count_,
+                                           Fnv1a(obfuscated_name), obfuscated_name);
+            return found ? std::string(found) : std::string();
+        }
         auto it = type_map_.find(obfuscated_name);
         return (it != type_map_.end()) ? it->second : std::string();
     }
@@ -71,120 +85,517 @@ public:
     /// Look up a member's friendly name by parent type + member obfuscated name.
     /// Returns empty string if not found.
     std::string ResolveMember(const std::string& parent_obf, const std::string& member_obf) const {
-        // Try with parent context first
+        if (mapped_base_) {
+            // Try with parent context first — hash and compare the
+            // "parent::member" key piecewise, no concatenation
+            if (!parent_obf.empty()) {
+                uint64_t h = Fnv1a(parent_obf);
+                h = Fnv1a("::", h);
+                h = Fnv1a(member_obf, h);
+                const char* found = MappedFindMember(h, parent_obf, member_obf);
+                if (found) return std::string(found);
+            }
+            // Fall back to standalone lookup (no parent context)
+            const char* found = MappedFind(member_slots_, member_bucket_count_,
+                                           Fnv1a(member_obf), member_obf);
+            return found ? std::string(found) : std::string();
+        }
+
+        // Try with parent context first — probed piecewise, no key built
         if (!parent_obf.empty()) {
-            auto it = member_map_.find(parent_obf + "::" + member_obf);
-            if (it != member_map_.end()) return it->second;
+            const std::string* found = member_map_.Find(parent_obf, member_obf);
+            if (found) return *found;
         }
         // Fall back to standalone lookup (no parent context)
-        auto it = member_map_.find(member_obf);
-        return (it != member_map_.end()) ? it->second : std::string();
+        const std::string* found = member_map_.Find(member_obf);
+        return found ? *found : std::string();
     }
 
-    bool HasMappings() const { return !type_map_.empty() || !member_map_.empty(); }
-    size_t TypeCount() const { return type_map_.size(); }
-    size_t MemberCount() const { return member_map_.size(); }
-    size_t TotalCount() const { return type_map_.size() + member_map_.size(); }
+    bool HasMappings() const { return TypeCount() + MemberCount() > 0; }
+    size_t TypeCount() const { return mapped_base_ ? mapped_type_count_ : type_map_.size(); }
+    size_t MemberCount() const { return mapped_base_ ? mapped_member_count_ : member_map_.Size(); }
+    size_t TotalCount() const { return TypeCount() + MemberCount(); }
+
+    /// Whether lookups are served from the memory-mapped sidecar.
+    bool IsMapped() const { return mapped_base_ != nullptr; }
 
 private:
+    static uint64_t Fnv1a(std::string_view s, uint64_t hash = 1469598103934665603ull) {
+        for (char c : s) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // ========================================================================
+    // In-memory member table
+    // ========================================================================
+    // Open-addressed map from "parent::member" (or standalone member) to the
+    // friendly name, probed heterogeneously: lookups hash and compare the
+    // parent and member pieces in place, so no query ever concatenates a key.
+    // The dumper resolves every method, field, and property it emits — with
+    // std::unordered_map that was a temporary std::string per query.
+
+    class MemberTable {
+    public:
+        void Clear() {
+            slots_.clear();
+            size_ = 0;
+        }
+
+        /// Insert or overwrite (matches operator[] assignment semantics)
+        void Insert(std::string key, std::string value) {
+            if ((size_ + 1) * 2 > slots_.size()) Grow();
+            uint64_t hash = Fnv1a(key);
+            size_t mask = slots_.size() - 1;
+            size_t idx = static_cast<size_t>(hash) & mask;
+            while (!slots_[idx].key.empty()) {
+                if (slots_[idx].hash == hash && slots_[idx].key == key) {
+                    slots_[idx].value = std::move(value);
+                    return;
+                }
+                idx = (idx + 1) & mask;
+            }
+            slots_[idx].hash = hash;
+            slots_[idx].key = std::move(key);
+            slots_[idx].value = std::move(value);
+            size_++;
+        }
+
+        /// Find by combined "parent::member" key without building it
+        const std::string* Find(std::string_view parent, std::string_view member) const {
+            if (slots_.empty()) return nullptr;
+            uint64_t hash = Fnv1a(member, Fnv1a("::", Fnv1a(parent)));
+            size_t mask = slots_.size() - 1;
+            size_t idx = static_cast<size_t>(hash) & mask;
+            while (!slots_[idx].key.empty()) {
+                if (slots_[idx].hash == hash) {
+                    std::string_view stored = slots_[idx].key;
+                    if (stored.size() == parent.size() + 2 + member.size() &&
+                        stored.compare(0, parent.size(), parent) == 0 &&
+                        stored[parent.size()] == ':' && stored[parent.size() + 1] == ':' &&
+                        stored.compare(parent.size() + 2, member.size(), member) == 0) {
+                        return &slots_[idx].value;
+                    }
+                }
+                idx = (idx + 1) & mask;
+            }
+            return nullptr;
+        }
+
+        /// Find by standalone key
+        const std::string* Find(std::string_view key) const {
+            if (slots_.empty()) return nullptr;
+            uint64_t hash = Fnv1a(key);
+            size_t mask = slots_.size() - 1;
+            size_t idx = static_cast<size_t>(hash) & mask;
+            while (!slots_[idx].key.empty()) {
+                if (slots_[idx].hash == hash && slots_[idx].key == key) {
+                    return &slots_[idx].value;
+                }
+                idx = (idx + 1) & mask;
+            }
+            return nullptr;
+        }
+
+        size_t Size() const { return size_; }
+
+        template <typename Fn>
+        void ForEach(Fn&& fn) const {
+            for (const Slot& slot : slots_) {
+                if (!slot.key.empty()) fn(slot.key, slot.value);
+            }
+        }
+
+    private:
+        struct Slot {
+            uint64_t hash = 0;
+            std::string key;     // empty = unused slot (keys are never empty)
+            std::string value;
+        };
+
+        void Grow() {
+            size_t newCapacity = slots_.empty() ? 16 : slots_.size() * 2;
+            std::vector<Slot> old = std::move(slots_);
+            slots_.clear();
+            slots_.resize(newCapacity);
+            size_t mask = newCapacity - 1;
+            for (Slot& slot : old) {
+                if (slot.key.empty()) continue;
+                size_t idx = static_cast<size_t>(slot.hash) & mask;
+                while (!slots_[idx].key.empty()) idx = (idx + 1) & mask;
+                slots_[idx] = std::move(slot);
+            }
+        }
+
+        std::vector<Slot> slots_;
+        size_t size_ = 0;
+    };
+
     std::unordered_map<std::string, std::string> type_map_;    // obf_name -> friendly
-    std::unordered_map<std::string, std::string> member_map_;  // "parent::member" -> friendly
+    MemberTable member_map_;                                   // "parent::member" -> friendly
 
-    // ---- Minimal JSON helpers (no external dependency) ----
+    // ========================================================================
+    // Binary sidecar format (mappings.mdbm)
+    // ========================================================================
+    // MappingCacheHeader
+    // MappingSlot[type_bucket_count]      open-addressed, linear probing
+    // MappingSlot[member_bucket_count]
+    // string table                        NUL-terminated, offset 0 = ""
+    //
+    // Slot key_off 0 marks an empty bucket (real strings start at offset 1).
+    // Bucket counts are powers of two sized at <= 50% load.
 
-    /// Split a JSON array string into individual object strings.
-    static std::vector<std::string> SplitJsonObjects(const std::string& json) {
-        std::vector<std::string> objects;
-        int depth = 0;
-        size_t start = 0;
-        bool inString = false;
-        bool escape = false;
-
-        for (size_t i = 0; i < json.size(); ++i) {
-            char c = json[i];
-            if (escape) { escape = false; continue; }
-            if (c == '\\') { escape = true; continue; }
-            if (c == '"') { inString = !inString; continue; }
-            if (inString) continue;
+#pragma pack(push, 1)
+    struct MappingCacheHeader {
+        char magic[4];                 // "MDBM"
+        uint32_t version;              // kBinaryVersion
+        uint64_t src_size;             // mappings.json stamp
+        uint64_t src_mtime;
+        uint32_t type_count;
+        uint32_t member_count;
+        uint32_t type_bucket_count;    // power of two
+        uint32_t member_bucket_count;  // power of two
+        uint32_t strings_bytes;
+    };
 
-            if (c == '{') {
-                if (depth == 0) start = i;
-                depth++;
-            } else if (c == '}') {
-                depth--;
-                if (depth == 0) {
-                    objects.push_back(json.substr(start, i - start + 1));
+    struct MappingSlot {
+        uint32_t key_off;              // 0 = empty bucket
+        uint32_t value_off;
+    };
+#pragma pack(pop)
+
+    static constexpr uint32_t kBinaryVersion = 1;
+
+    // Mapped view state (null when serving from the in-memory maps)
+    MappedCache::View mapped_view_;
+    const uint8_t* mapped_base_ = nullptr;
+    const MappingSlot* type_slots_ = nullptr;
+    const MappingSlot* member_slots_ = nullptr;
+    const char* mapped_strings_ = nullptr;
+    uint32_t mapped_strings_bytes_ = 0;
+    uint32_t type_bucket_count_ = 0;
+    uint32_t member_bucket_count_ = 0;
+    size_t mapped_type_count_ = 0;
+    size_t mapped_member_count_ = 0;
+
+    void CloseBinary() {
+        MappedCache::Close(&mapped_view_);
+        mapped_base_ = nullptr;
+        type_slots_ = nullptr;
+        member_slots_ = nullptr;
+        mapped_strings_ = nullptr;
+        mapped_strings_bytes_ = 0;
+        type_bucket_count_ = 0;
+        member_bucket_count_ = 0;
+        mapped_type_count_ = 0;
+        mapped_member_count_ = 0;
+    }
+
+    static bool GetFileStamp(const std::string& path, uint64_t* out_size, uint64_t* out_mtime) {
+        WIN32_FILE_ATTRIBUTE_DATA attr{};
+        if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attr)) return false;
+        *out_size = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+        *out_mtime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                     attr.ftLastWriteTime.dwLowDateTime;
+        return true;
+    }
+
+    static uint32_t BucketCountFor(size_t entries) {
+        uint32_t buckets = 16;
+        while (buckets < entries * 2) buckets <<= 1;
+        return buckets;
+    }
+
+    bool TryOpenBinary(const std::string& sidecar, uint64_t srcSize, uint64_t srcMtime) {
+        // Shared mapping utility: large pages when the privilege allows, a
+        // pre-faulted copy-on-write view otherwise
+        if (!MappedCache::Open(sidecar, &mapped_view_)) return false;
+        if (mapped_view_.size < sizeof(MappingCacheHeader)) {
+            MappedCache::Close(&mapped_view_);
+            return false;
+        }
+        const uint8_t* base = mapped_view_.base;
+
+        const auto* header = reinterpret_cast<const MappingCacheHeader*>(base);
+        const uint64_t totalSize = mapped_view_.size;
+        bool valid =
+            memcmp(header->magic, "MDBM", 4) == 0 &&
+            header->version == kBinaryVersion &&
+            header->src_size == srcSize &&
+            header->src_mtime == srcMtime &&
+            // Power-of-two bucket counts — the lookup mask depends on it
+            header->type_bucket_count != 0 &&
+            (header->type_bucket_count & (header->type_bucket_count - 1)) == 0 &&
+            header->member_bucket_count != 0 &&
+            (header->member_bucket_count & (header->member_bucket_count - 1)) == 0 &&
+            // All three sections must fit in the file
+            sizeof(MappingCacheHeader) +
+                (static_cast<uint64_t>(header->type_bucket_count) +
+                 header->member_bucket_count) * sizeof(MappingSlot) +
+                header->strings_bytes <= totalSize &&
+            // String table must be NUL-terminated so compares can't run off
+            header->strings_bytes > 0 &&
+            base[sizeof(MappingCacheHeader) +
+                 (static_cast<uint64_t>(header->type_bucket_count) +
+                  header->member_bucket_count) * sizeof(MappingSlot) +
+                 header->strings_bytes - 1] == '\0';
+
+        if (!valid) {
+            MappedCache::Close(&mapped_view_);
+            return false;
+        }
+
+        mapped_base_ = base;
+        type_slots_ = reinterpret_cast<const MappingSlot*>(base + sizeof(MappingCacheHeader));
+        member_slots_ = type_slots_ + header->type_bucket_count;
+        mapped_strings_ = reinterpret_cast<const char*>(member_slots_ + header->member_bucket_count);
+        mapped_strings_bytes_ = header->strings_bytes;
+        type_bucket_count_ = header->type_bucket_count;
+        member_bucket_count_ = header->member_bucket_count;
+        mapped_type_count_ = header->type_count;
+        mapped_member_count_ = header->member_count;
+        return true;
+    }
+
+    /// Probe a mapped slot array for an exact key. Returns the friendly name
+    /// (NUL-terminated, inside the mapped string table) or null.
+    const char* MappedFind(const MappingSlot* slots, uint32_t bucketCount,
+                           uint64_t hash, std::string_view key) const {
+        uint32_t mask = bucketCount - 1;
+        uint32_t idx = static_cast<uint32_t>(hash) & mask;
+        for (uint32_t probes = 0; probes <= mask; ++probes) {
+            const MappingSlot& slot = slots[idx];
+            if (slot.key_off == 0) return nullptr;
+            if (slot.key_off < mapped_strings_bytes_ && slot.value_off < mapped_strings_bytes_) {
+                const char* stored = mapped_strings_ + slot.key_off;
+                if (key.compare(stored) == 0) return mapped_strings_ + slot.value_off;
+            }
+            idx = (idx + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    /// Probe the member table for "parent::member" without building the key.
+    const char* MappedFindMember(uint64_t hash, std::string_view parent,
+                                 std::string_view member) const {
+        uint32_t mask = member_bucket_count_ - 1;
+        uint32_t idx = static_cast<uint32_t>(hash) & mask;
+        for (uint32_t probes = 0; probes <= mask; ++probes) {
+            const MappingSlot& slot = member_slots_[idx];
+            if (slot.key_off == 0) return nullptr;
+            if (slot.key_off < mapped_strings_bytes_ && slot.value_off < mapped_strings_bytes_) {
+                const char* stored = mapped_strings_ + slot.key_off;
+                if (strncmp(stored, parent.data(), parent.size()) == 0 &&
+                    stored[parent.size()] == ':' && stored[parent.size() + 1] == ':' &&
+                    member.compare(stored + parent.size() + 2) == 0) {
+                    return mapped_strings_ + slot.value_off;
                 }
             }
+            idx = (idx + 1) & mask;
         }
-        return objects;
+        return nullptr;
     }
 
-    /// Extract a string value for a given key from a JSON object string.
-    /// Returns empty string if key not found or value is null.
-    static std::string ExtractJsonString(const std::string& json, const std::string& key) {
-        std::string pattern = "\"" + key + "\"";
-        size_t pos = json.find(pattern);
-        if (pos == std::string::npos) return "";
-
-        pos += pattern.size();
-        pos = json.find(':', pos);
-        if (pos == std::string::npos) return "";
-        pos++;
-
-        // Skip whitespace
-        while (pos < json.size() && (json[pos] == ' ' || json[pos] == '\t' ||
-               json[pos] == '\n' || json[pos] == '\r'))
-            pos++;
+    /// Compile the in-memory maps into the sidecar. Failure is non-fatal —
+    /// the in-memory maps keep serving this run and the JSON is re-parsed
+    /// next launch.
+    bool WriteBinary(const std::string& sidecar, uint64_t srcSize, uint64_t srcMtime) const {
+        std::string strings(1, '\0');   // offset 0 reserved for empty slots
 
-        if (pos >= json.size()) return "";
-        if (json[pos] == 'n') return "";  // null
-        if (json[pos] != '"') return "";  // not a string value
+        auto intern = [&strings](const std::string& s) -> uint32_t {
+            uint32_t off = static_cast<uint32_t>(strings.size());
+            strings.append(s);
+            strings.push_back('\0');
+            return off;
+        };
 
-        pos++;  // skip opening quote
-        std::string result;
-        while (pos < json.size() && json[pos] != '"') {
-            if (json[pos] == '\\' && pos + 1 < json.size()) {
+        uint32_t typeBuckets = BucketCountFor(type_map_.size());
+        uint32_t memberBuckets = BucketCountFor(member_map_.Size());
+        std::vector<MappingSlot> typeSlots(typeBuckets, MappingSlot{ 0, 0 });
+        std::vector<MappingSlot> memberSlots(memberBuckets, MappingSlot{ 0, 0 });
+
+        auto insert = [&](std::vector<MappingSlot>& slots, uint32_t bucketCount,
+                          const std::string& key, const std::string& value) {
+            uint32_t mask = bucketCount - 1;
+            uint32_t idx = static_cast<uint32_t>(Fnv1a(key)) & mask;
+            while (slots[idx].key_off != 0) idx = (idx + 1) & mask;
+            slots[idx].key_off = intern(key);
+            slots[idx].value_off = intern(value);
+        };
+
+        for (const auto& [key, value] : type_map_) insert(typeSlots, typeBuckets, key, value);
+        member_map_.ForEach([&](const std::string& key, const std::string& value) {
+            insert(memberSlots, memberBuckets, key, value);
+        });
+
+        MappingCacheHeader header{};
+        memcpy(header.magic, "MDBM", 4);
+        header.version = kBinaryVersion;
+        header.src_size = srcSize;
+        header.src_mtime = srcMtime;
+        header.type_count = static_cast<uint32_t>(type_map_.size());
+        header.member_count = static_cast<uint32_t>(member_map_.Size());
+        header.type_bucket_count = typeBuckets;
+        header.member_bucket_count = memberBuckets;
+        header.strings_bytes = static_cast<uint32_t>(strings.size());
+
+        std::ofstream file(sidecar, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(typeSlots.data()),
+                   static_cast<std::streamsize>(typeSlots.size() * sizeof(MappingSlot)));
+        file.write(reinterpret_cast<const char*>(memberSlots.data()),
+                   static_cast<std::streamsize>(memberSlots.size() * sizeof(MappingSlot)));
+        file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+        return file.good();
+    }
+
+    // ========================================================================
+    // JSON parsing (first launch / stale sidecar)
+    // ========================================================================
+
+    /// Single pass over the file buffer — field values are taken as
+    /// string_views into it and only copied once, directly into the maps.
+    bool LoadJson(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        std::string json;
+        json.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!json.empty()) file.read(&json[0], static_cast<std::streamsize>(json.size()));
+        file.close();
+
+        std::string_view view(json);
+        const size_t n = view.size();
+        size_t pos = 0;
+
+        // Fields of the object currently being parsed
+        std::string obfName, friendlyName, parentType, value;
+        int symbolType = -1;
+
+        while (pos < n) {
+            char c = view[pos];
+
+            if (c == '{') {
+                obfName.clear();
+                friendlyName.clear();
+                parentType.clear();
+                symbolType = -1;
+                pos++;
+            } else if (c == '}') {
+                if (!obfName.empty() && !friendlyName.empty()) {
+                    if (symbolType == 0) {
+                        // Type (class, enum, interface, struct, delegate)
+                        type_map_[std::move(obfName)] = std::move(friendlyName);
+                    } else {
+                        // Member (field=1, property=2, method=3)
+                        std::string key = parentType.empty()
+                            ? std::move(obfName)
+                            : (parentType + "::" + obfName);
+                        member_map_.Insert(std::move(key), std::move(friendlyName));
+                    }
+                    obfName.clear();
+                    friendlyName.clear();
+                }
+                pos++;
+            } else if (c == '"') {
+                // Key — values are consumed right after their ':' below, so
+                // any string the loop itself meets is in key position
+                if (!ParseJsonString(view, pos, value)) break;
+                std::string key = std::move(value);
+
+                SkipJsonWhitespace(view, pos);
+                if (pos >= n || view[pos] != ':') continue;
                 pos++;
-                switch (json[pos]) {
-                case '"':  result += '"';  break;
-                case '\\': result += '\\'; break;
-                case '/':  result += '/';  break;
-                case 'n':  result += '\n'; break;
-                case 't':  result += '\t'; break;
-                case 'r':  result += '\r'; break;
-                default:   result += json[pos]; break;
+                SkipJsonWhitespace(view, pos);
+                if (pos >= n) break;
+
+                if (view[pos] == '"') {
+                    if (!ParseJsonString(view, pos, value)) break;
+                    if (key == "ObfuscatedName")      obfName = std::move(value);
+                    else if (key == "FriendlyName")   friendlyName = std::move(value);
+                    else if (key == "ParentType")     parentType = std::move(value);
+                } else if (view[pos] == '-' || (view[pos] >= '0' && view[pos] <= '9')) {
+                    int parsed = ParseJsonInt(view, pos);
+                    if (key == "SymbolType") symbolType = parsed;
                 }
+                // null / true / false values fall through and are skipped
+                // character by character like any other filler
             } else {
-                result += json[pos];
+                pos++;
             }
-            pos++;
         }
-        return result;
+
+        return true;
     }
 
-    /// Extract an integer value for a given key from a JSON object string.
-    static int ExtractJsonInt(const std::string& json, const std::string& key, int defaultVal = -1) {
-        std::string pattern = "\"" + key + "\"";
-        size_t pos = json.find(pattern);
-        if (pos == std::string::npos) return defaultVal;
+    // ---- Minimal JSON helpers (no external dependency) ----
 
-        pos += pattern.size();
-        pos = json.find(':', pos);
-        if (pos == std::string::npos) return defaultVal;
-        pos++;
+    static void SkipJsonWhitespace(std::string_view s, size_t& pos) {
+        while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t' ||
+               s[pos] == '\n' || s[pos] == '\r'))
+            pos++;
+    }
 
-        while (pos < json.size() && (json[pos] == ' ' || json[pos] == '\t' ||
-               json[pos] == '\n' || json[pos] == '\r'))
+    /// Parse the string starting at s[pos] == '"' into `out`, leaving pos
+    /// just past the closing quote. The raw span is scanned once and copied
+    /// straight into `out`; the unescape loop only runs if a backslash was
+    /// seen. Returns false on an unterminated string.
+    static bool ParseJsonString(std::string_view s, size_t& pos, std::string& out) {
+        pos++;  // skip opening quote
+        size_t start = pos;
+        bool hasEscape = false;
+        while (pos < s.size()) {
+            char c = s[pos];
+            if (c == '\\') { hasEscape = true; pos += 2; continue; }
+            if (c == '"') break;
             pos++;
+        }
+        if (pos >= s.size()) return false;
+        std::string_view raw = s.substr(start, pos - start);
+        pos++;  // skip closing quote
 
-        if (pos >= json.size()) return defaultVal;
+        if (!hasEscape) {
+            out.assign(raw.data(), raw.size());
+            return true;
+        }
 
-        try {
-            return std::stoi(json.substr(pos));
-        } catch (...) {
-            return defaultVal;
+        out.clear();
+        out.reserve(raw.size());
+        for (size_t i = 0; i < raw.size(); ++i) {
+            if (raw[i] == '\\' && i + 1 < raw.size()) {
+                ++i;
+                switch (raw[i]) {
+                case '"':  out += '"';  break;
+                case '\\': out += '\\'; break;
+                case '/':  out += '/';  break;
+                case 'n':  out += '\n'; break;
+                case 't':  out += '\t'; break;
+                case 'r':  out += '\r'; break;
+                default:   out += raw[i]; break;
+                }
+            } else {
+                out += raw[i];
+            }
+        }
+        return true;
+    }
+
+    /// Parse an integer starting at s[pos], leaving pos past the last digit.
+    static int ParseJsonInt(std::string_view s, size_t& pos, int defaultVal = -1) {
+        bool negative = false;
+        if (pos < s.size() && s[pos] == '-') { negative = true; pos++; }
+        if (pos >= s.size() || s[pos] < '0' || s[pos] > '9') return defaultVal;
+
+        int value = 0;
+        while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9') {
+            value = value * 10 + (s[pos] - '0');
+            pos++;
         }
+        return negative ? -value : value;
     }
 };
 
@@ -0,0 +1,469 @@
+#include "metadata_cache.hpp"
+#include "il2cpp_resolver.hpp"
+#include "core/mapped_cache.hpp"
+#include "core/mem_stats.hpp"
+
+#include <Il2CppTypes.hpp>
+
+#define NOMINMAX
+#include <Windows.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace api = il2cpp::_internal;
+using namespace il2cpp::_internal::unity_structs;
+
+namespace MDB {
+namespace MetaCache {
+
+// ============================================================================
+// Shared Helpers
+// ============================================================================
+
+static const char kMagic[4] = { 'M', 'D', 'B', 'C' };
+
+/// Size and last-write FILETIME of the currently loaded GameAssembly.dll.
+/// Returns false if the module is not loaded or the file is unreadable.
+static bool GetGameAssemblyStamp(uint64_t* out_size, uint64_t* out_mtime) {
+    HMODULE hGA = GetModuleHandleW(L"GameAssembly.dll");
+    if (!hGA) return false;
+
+    wchar_t gaPath[MAX_PATH];
+    if (GetModuleFileNameW(hGA, gaPath, MAX_PATH) == 0) return false;
+
+    WIN32_FILE_ATTRIBUTE_DATA attr{};
+    if (!GetFileAttributesExW(gaPath, GetFileExInfoStandard, &attr)) return false;
+
+    *out_size = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+    *out_mtime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                 attr.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+namespace {
+
+/// Deduplicating string table builder. Offset 0 is always the empty string.
+class StringTable {
+public:
+    StringTable() { data_.push_back('\0'); }
+
+    uint32_t Add(const char* s) {
+        if (!s || !*s) return 0;
+        std::string_view key(s);
+        auto it = offsets_.find(key);
+        if (it != offsets_.end()) return it->second;
+
+        uint32_t off = static_cast<uint32_t>(data_.size());
+        data_.insert(data_.end(), key.begin(), key.end());
+        data_.push_back('\0');
+        // Key views point into data_, which may reallocate — key by a copy
+        offsets_.emplace(std::string(key), off);
+        return off;
+    }
+
+    const std::vector<char>& Data() const { return data_; }
+
+private:
+    std::vector<char> data_;
+    std::unordered_map<std::string, uint32_t> offsets_;
+};
+
+} // anonymous namespace
+
+bool Write(const std::string& path, std::string* error) {
+    auto fail = [&](const char* msg) {
+        if (error) *error = msg;
+        return false;
+    };
+
+    if (api::ensure_exports() != Il2CppStatus::OK) return fail("IL2CPP exports not resolved");
+    if (!api::il2cpp_domain_get || !api::il2cpp_domain_get_assemblies ||
+        !api::il2cpp_assembly_get_image || !api::il2cpp_image_get_name ||
+        !api::il2cpp_image_get_class_count || !api::il2cpp_image_get_class ||
+        !api::il2cpp_class_get_name || !api::il2cpp_class_get_namespace ||
+        !api::il2cpp_class_get_flags) {
+        return fail("Required metadata APIs not resolved");
+    }
+
+    uint64_t gaSize = 0, gaMtime = 0;
+    if (!GetGameAssemblyStamp(&gaSize, &gaMtime)) return fail("GameAssembly.dll not found");
+    uintptr_t gaBase = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
+
+    auto domain = api::il2cpp_domain_get();
+    if (!domain) return fail("Failed to get IL2CPP domain");
+    size_t assemblyCount = 0;
+    auto assemblies = api::il2cpp_domain_get_assemblies(domain, &assemblyCount);
+    if (!assemblies) return fail("Failed to get assemblies");
+
+    StringTable strings;
+    std::vector<MethodRecord> methods;
+    std::vector<FieldRecord> fields;
+
+    // Collect sorted by (namespace, name) so the reader can binary-search
+    std::map<std::pair<std::string, std::string>, ClassRecord> sortedClasses;
+
+    for (size_t i = 0; i < assemblyCount; ++i) {
+        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+        if (!image) continue;
+        const char* imageName = api::il2cpp_image_get_name(image);
+        uint32_t imageOff = strings.Add(imageName);
+
+        size_t classCount = api::il2cpp_image_get_class_count(image);
+        for (size_t j = 0; j < classCount; ++j) {
+            auto klass = api::il2cpp_image_get_class(image, j);
+            if (!klass) continue;
+
+            const char* name = api::il2cpp_class_get_name(klass);
+            const char* ns = api::il2cpp_class_get_namespace(klass);
+            if (!name || !*name) continue;
+
+            ClassRecord rec{};
+            rec.name_off = strings.Add(name);
+            rec.ns_off = strings.Add(ns);
+            rec.image_off = imageOff;
+            rec.flags = static_cast<uint32_t>(api::il2cpp_class_get_flags(klass));
+            rec.is_valuetype = api::il2cpp_class_is_valuetype && api::il2cpp_class_is_valuetype(klass) ? 1u : 0u;
+            if (auto sz = il2cpp::get_class_size(klass)) {
+                rec.instance_size = static_cast<uint32_t>(sz.value);
+            }
+
+            // Methods
+            rec.first_method = static_cast<uint32_t>(methods.size());
+            if (api::il2cpp_class_get_methods && api::il2cpp_method_get_name) {
+                void* iter = nullptr;
+                while (auto* mi = api::il2cpp_class_get_methods(klass, &iter)) {
+                    MethodRecord m{};
+                    m.name_off = strings.Add(api::il2cpp_method_get_name(mi));
+                    if (api::il2cpp_method_get_param_count) {
+                        m.param_count = api::il2cpp_method_get_param_count(mi);
+                    }
+                    if (api::il2cpp_method_get_flags) {
+                        uint32_t iflags = 0;
+                        m.flags = api::il2cpp_method_get_flags(mi, &iflags);
+                    }
+                    if (mi->m_pMethodPointer && gaBase) {
+                        uintptr_t ptr = reinterpret_cast<uintptr_t>(mi->m_pMethodPointer);
+                        if (ptr > gaBase) m.rva = static_cast<uint64_t>(ptr - gaBase);
+                    }
+                    methods.push_back(m);
+                }
+            }
+            rec.method_count = static_cast<uint32_t>(methods.size()) - rec.first_method;
+
+            // Fields
+            rec.first_field = static_cast<uint32_t>(fields.size());
+            if (api::il2cpp_class_get_fields && api::il2cpp_field_get_name) {
+                void* iter = nullptr;
+                while (auto* fi = api::il2cpp_class_get_fields(klass, &iter)) {
+                    FieldRecord f{};
+                    f.name_off = strings.Add(api::il2cpp_field_get_name(fi));
+                    if (api::il2cpp_field_get_offset) {
+                        f.offset = static_cast<uint32_t>(api::il2cpp_field_get_offset(fi));
+                    }
+                    if (api::il2cpp_field_get_flags) {
+                        f.flags = static_cast<uint32_t>(api::il2cpp_field_get_flags(fi));
+                    }
+                    fields.push_back(f);
+                }
+            }
+            rec.field_count = static_cast<uint32_t>(fields.size()) - rec.first_field;
+
+            sortedClasses[{ std::string(ns ? ns : ""), std::string(name) }] = rec;
+        }
+    }
+
+    std::vector<ClassRecord> classes;
+    classes.reserve(sortedClasses.size());
+    for (auto& [key, rec] : sortedClasses) classes.push_back(rec);
+
+    // ---- Lay out the file ----
+    CacheHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kCacheVersion;
+    header.ga_size = gaSize;
+    header.ga_mtime = gaMtime;
+    header.class_count = static_cast<uint32_t>(classes.size());
+    header.method_count = static_cast<uint32_t>(methods.size());
+    header.field_count = static_cast<uint32_t>(fields.size());
+    header.classes_off = sizeof(CacheHeader);
+    header.methods_off = header.classes_off + classes.size() * sizeof(ClassRecord);
+    header.fields_off = header.methods_off + methods.size() * sizeof(MethodRecord);
+    header.strings_off = header.fields_off + fields.size() * sizeof(FieldRecord);
+    header.strings_size = strings.Data().size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) return fail("Failed to open cache file for writing");
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(classes.data()),
+              static_cast<std::streamsize>(classes.size() * sizeof(ClassRecord)));
+    out.write(reinterpret_cast<const char*>(methods.data()),
+              static_cast<std::streamsize>(methods.size() * sizeof(MethodRecord)));
+    out.write(reinterpret_cast<const char*>(fields.data()),
+              static_cast<std::streamsize>(fields.size() * sizeof(FieldRecord)));
+    out.write(strings.Data().data(), static_cast<std::streamsize>(strings.Data().size()));
+    out.close();
+
+    if (!out.good()) {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);  // never leave a truncated cache behind
+        return fail("Failed to write cache file");
+    }
+
+    return true;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+namespace {
+
+struct Mapping {
+    MappedCache::View view;
+
+    const CacheHeader* header = nullptr;
+    const ClassRecord* classes = nullptr;
+    const MethodRecord* methods = nullptr;
+    const FieldRecord* fields = nullptr;
+    const char* strings = nullptr;
+
+    // Lazily built reverse-symbolization index: method entry RVAs sorted
+    // ascending paired with their method index, plus method index → owning
+    // class index (method records are grouped per class, but classes are
+    // re-sorted by name at write time, so the grouping is not monotonic
+    // and cannot be binary-searched directly)
+    bool symbol_index_built = false;
+    std::vector<std::pair<uint64_t, uint32_t>> rva_index;
+    std::vector<uint32_t> method_class;
+};
+
+std::mutex g_cache_mutex;
+Mapping g_mapping;
+
+// Caller holds g_cache_mutex
+void CloseLocked() {
+    if (g_mapping.view.base) {
+        Mem::Release(Mem::Tag::MetadataCache, static_cast<size_t>(g_mapping.view.size));
+    }
+    MappedCache::Close(&g_mapping.view);
+    g_mapping = Mapping{};
+}
+
+// Caller holds g_cache_mutex. Resolve a string table offset defensively —
+// a corrupt offset yields "" rather than a wild read past the mapping.
+const char* StringAt(uint32_t off) {
+    if (!g_mapping.strings || off >= g_mapping.header->strings_size) return "";
+    return g_mapping.strings + off;
+}
+
+} // anonymous namespace
+
+bool Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    CloseLocked();
+
+    // Shared mapping utility: large pages when the privilege allows, a
+    // pre-faulted copy-on-write view otherwise
+    if (!MappedCache::Open(path, &g_mapping.view)) return false;
+    if (g_mapping.view.size < sizeof(CacheHeader)) {
+        CloseLocked();
+        return false;
+    }
+    const uint8_t* base = g_mapping.view.base;
+
+    // File-backed pages come and go with OS pressure (a large-page copy is
+    // plainly resident), but either way it is RSS users attribute to MDB
+    Mem::Account(Mem::Tag::MetadataCache, static_cast<size_t>(g_mapping.view.size));
+
+    // ---- Validate header & section bounds ----
+    const auto* header = reinterpret_cast<const CacheHeader*>(base);
+    bool valid = std::memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 &&
+                 header->version == kCacheVersion;
+
+    if (valid) {
+        uint64_t classesEnd = header->classes_off + static_cast<uint64_t>(header->class_count) * sizeof(ClassRecord);
+        uint64_t methodsEnd = header->methods_off + static_cast<uint64_t>(header->method_count) * sizeof(MethodRecord);
+        uint64_t fieldsEnd = header->fields_off + static_cast<uint64_t>(header->field_count) * sizeof(FieldRecord);
+        uint64_t stringsEnd = header->strings_off + header->strings_size;
+        valid = classesEnd <= g_mapping.view.size && methodsEnd <= g_mapping.view.size &&
+                fieldsEnd <= g_mapping.view.size && stringsEnd <= g_mapping.view.size &&
+                header->strings_size > 0;
+    }
+
+    // ---- Reject stale caches: GameAssembly.dll changed since write time ----
+    if (valid) {
+        uint64_t gaSize = 0, gaMtime = 0;
+        valid = GetGameAssemblyStamp(&gaSize, &gaMtime) &&
+                gaSize == header->ga_size && gaMtime == header->ga_mtime;
+    }
+
+    if (!valid) {
+        CloseLocked();
+        return false;
+    }
+
+    g_mapping.header = header;
+    g_mapping.classes = reinterpret_cast<const ClassRecord*>(base + header->classes_off);
+    g_mapping.methods = reinterpret_cast<const MethodRecord*>(base + header->methods_off);
+    g_mapping.fields = reinterpret_cast<const FieldRecord*>(base + header->fields_off);
+    g_mapping.strings = reinterpret_cast<const char*>(base + header->strings_off);
+    return true;
+}
+
+bool IsOpen() {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    return g_mapping.header != nullptr;
+}
+
+void Close() {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    CloseLocked();
+}
+
+uint32_t GetClassCount() {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    return g_mapping.header ? g_mapping.header->class_count : 0;
+}
+
+int FindClass(const char* name_space, const char* name) {
+    if (!name || !*name) return -1;
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    if (!g_mapping.header) return -1;
+
+    const char* ns = name_space ? name_space : "";
+
+    // Records are sorted by (namespace, name) at write time
+    int lo = 0;
+    int hi = static_cast<int>(g_mapping.header->class_count) - 1;
+    while (lo <= hi) {
+        int mid = lo + (hi - lo) / 2;
+        const ClassRecord& rec = g_mapping.classes[mid];
+        int cmp = std::strcmp(StringAt(rec.ns_off), ns);
+        if (cmp == 0) cmp = std::strcmp(StringAt(rec.name_off), name);
+        if (cmp == 0) return mid;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -1;
+}
+
+bool GetClass(uint32_t index, ClassView* out) {
+    if (!out) return false;
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    if (!g_mapping.header || index >= g_mapping.header->class_count) return false;
+
+    const ClassRecord& rec = g_mapping.classes[index];
+    out->name = StringAt(rec.name_off);
+    out->name_space = StringAt(rec.ns_off);
+    out->image = StringAt(rec.image_off);
+    out->flags = rec.flags;
+    out->method_count = rec.method_count;
+    out->field_count = rec.field_count;
+    out->instance_size = rec.instance_size;
+    out->is_valuetype = rec.is_valuetype != 0;
+    return true;
+}
+
+bool GetMethod(uint32_t class_index, uint32_t method_ordinal,
+               const char** out_name, uint32_t* out_param_count,
+               uint32_t* out_flags, uint64_t* out_rva) {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    if (!g_mapping.header || class_index >= g_mapping.header->class_count) return false;
+
+    const ClassRecord& rec = g_mapping.classes[class_index];
+    if (method_ordinal >= rec.method_count) return false;
+    uint32_t idx = rec.first_method + method_ordinal;
+    if (idx >= g_mapping.header->method_count) return false;
+
+    const MethodRecord& m = g_mapping.methods[idx];
+    if (out_name) *out_name = StringAt(m.name_off);
+    if (out_param_count) *out_param_count = m.param_count;
+    if (out_flags) *out_flags = m.flags;
+    if (out_rva) *out_rva = m.rva;
+    return true;
+}
+
+bool GetField(uint32_t class_index, uint32_t field_ordinal,
+              const char** out_name, uint32_t* out_offset, uint32_t* out_flags) {
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    if (!g_mapping.header || class_index >= g_mapping.header->class_count) return false;
+
+    const ClassRecord& rec = g_mapping.classes[class_index];
+    if (field_ordinal >= rec.field_count) return false;
+    uint32_t idx = rec.first_field + field_ordinal;
+    if (idx >= g_mapping.header->field_count) return false;
+
+    const FieldRecord& f = g_mapping.fields[idx];
+    if (out_name) *out_name = StringAt(f.name_off);
+    if (out_offset) *out_offset = f.offset;
+    if (out_flags) *out_flags = f.flags;
+    return true;
+}
+
+// ============================================================================
+// Reverse Symbolization
+// ============================================================================
+
+/// Caller holds g_cache_mutex with an open cache. One pass over the mapped
+/// records builds both index arrays; the sort dominates and runs once per
+/// mapping, so every later lookup is a plain binary search.
+static void BuildSymbolIndexLocked() {
+    if (g_mapping.symbol_index_built) return;
+    g_mapping.symbol_index_built = true;
+
+    const uint32_t methodCount = g_mapping.header->method_count;
+    g_mapping.method_class.assign(methodCount, 0);
+    for (uint32_t c = 0; c < g_mapping.header->class_count; ++c) {
+        const ClassRecord& rec = g_mapping.classes[c];
+        uint64_t end = static_cast<uint64_t>(rec.first_method) + rec.method_count;
+        if (end > methodCount) continue;  // defensive against corrupt records
+        for (uint32_t m = rec.first_method; m < end; ++m) {
+            g_mapping.method_class[m] = c;
+        }
+    }
+
+    g_mapping.rva_index.reserve(methodCount);
+    for (uint32_t m = 0; m < methodCount; ++m) {
+        if (g_mapping.methods[m].rva) {
+            g_mapping.rva_index.emplace_back(g_mapping.methods[m].rva, m);
+        }
+    }
+    std::sort(g_mapping.rva_index.begin(), g_mapping.rva_index.end());
+}
+
+bool ResolveRva(uint64_t rva, MethodSymbol* out) {
+    if (!out || rva == 0) return false;
+    std::lock_guard<std::mutex> lock(g_cache_mutex);
+    if (!g_mapping.header) return false;
+    BuildSymbolIndexLocked();
+
+    // Nearest method entry point at or below the queried RVA
+    const auto& index = g_mapping.rva_index;
+    auto it = std::upper_bound(index.begin(), index.end(),
+                               std::make_pair(rva, UINT32_MAX));
+    if (it == index.begin()) return false;
+    --it;
+
+    uint32_t methodIdx = it->second;
+    const ClassRecord& cls = g_mapping.classes[g_mapping.method_class[methodIdx]];
+    out->name_space = StringAt(cls.ns_off);
+    out->class_name = StringAt(cls.name_off);
+    out->method_name = StringAt(g_mapping.methods[methodIdx].name_off);
+    out->method_rva = it->first;
+    return true;
+}
+
+} // namespace MetaCache
+} // namespace MDB
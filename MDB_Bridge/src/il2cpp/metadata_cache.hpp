@@ -0,0 +1,145 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// ============================================================================
+// Binary Metadata Cache for MDB Bridge
+// ============================================================================
+// Compact, offset-based snapshot of IL2CPP class/method/field metadata,
+// written once at the end of a dump and memory-mapped read-only on later
+// launches. No pointers are stored — records reference a string table at the
+// end of the file by offset — so the image is position-independent and can be
+// consumed straight out of the mapping without any fix-up pass or IL2CPP
+// enumeration calls. The header embeds the size and timestamp of
+// GameAssembly.dll at write time; Open() rejects the cache when either
+// differs, falling back to a live walk.
+//
+// Layout (little-endian):
+//   CacheHeader
+//   ClassRecord  [class_count]   — sorted by (namespace, name) for bsearch
+//   MethodRecord [method_count]  — grouped per class
+//   FieldRecord  [field_count]   — grouped per class
+//   string table                 — NUL-terminated UTF-8, offset 0 = ""
+
+namespace MDB {
+namespace MetaCache {
+
+constexpr uint32_t kCacheVersion = 1;
+
+#pragma pack(push, 1)
+struct CacheHeader {
+    char     magic[4];        // "MDBC"
+    uint32_t version;         // kCacheVersion
+    uint64_t ga_size;         // GameAssembly.dll file size at write time
+    uint64_t ga_mtime;        // GameAssembly.dll last-write FILETIME at write time
+    uint32_t class_count;
+    uint32_t method_count;
+    uint32_t field_count;
+    uint32_t reserved;
+    uint64_t classes_off;     // byte offsets from file start
+    uint64_t methods_off;
+    uint64_t fields_off;
+    uint64_t strings_off;
+    uint64_t strings_size;
+};
+
+struct ClassRecord {
+    uint32_t name_off;        // string table offsets
+    uint32_t ns_off;
+    uint32_t image_off;
+    uint32_t flags;           // TYPE_ATTRIBUTE_* flags
+    uint32_t first_method;    // index into MethodRecord array
+    uint32_t method_count;
+    uint32_t first_field;     // index into FieldRecord array
+    uint32_t field_count;
+    uint32_t instance_size;
+    uint32_t is_valuetype;
+};
+
+struct MethodRecord {
+    uint32_t name_off;
+    uint32_t param_count;
+    uint32_t flags;           // METHOD_ATTRIBUTE_* flags
+    uint32_t reserved;
+    uint64_t rva;             // method pointer minus GameAssembly base (0 if none)
+};
+
+struct FieldRecord {
+    uint32_t name_off;
+    uint32_t offset;          // instance field offset (as reported by il2cpp)
+    uint32_t flags;           // FIELD_ATTRIBUTE_* flags
+    uint32_t reserved;
+};
+#pragma pack(pop)
+
+// Resolved view of a cached class; string pointers point into the mapping
+// and stay valid until Close()
+struct ClassView {
+    const char* name;
+    const char* name_space;
+    const char* image;
+    uint32_t flags;
+    uint32_t method_count;
+    uint32_t field_count;
+    uint32_t instance_size;
+    bool is_valuetype;
+};
+
+// ---- Writer (called at the end of a dump) ----
+
+/// Walk the live IL2CPP metadata and write the binary cache to `path`.
+/// Requires the IL2CPP exports to be resolved. Returns false and fills
+/// `error` (when non-null) on failure; a partial file is removed.
+bool Write(const std::string& path, std::string* error);
+
+// ---- Reader (warm starts) ----
+
+/// Memory-map the cache at `path` and validate its header against the
+/// currently loaded GameAssembly.dll. Returns false (without keeping any
+/// mapping) if the file is missing, malformed, or stale.
+bool Open(const std::string& path);
+
+/// True while a validated cache mapping is active.
+bool IsOpen();
+
+/// Unmap the cache. All ClassView string pointers become invalid.
+void Close();
+
+/// Number of classes in the open cache (0 when closed).
+uint32_t GetClassCount();
+
+/// Binary-search the open cache for a class. Returns its index, or -1.
+int FindClass(const char* name_space, const char* name);
+
+/// Fill `out` for the class at `index`. Returns false on bad index.
+bool GetClass(uint32_t index, ClassView* out);
+
+/// Fill method/field info for a class by per-class ordinal. Strings point
+/// into the mapping. Return false on bad indices.
+bool GetMethod(uint32_t class_index, uint32_t method_ordinal,
+               const char** out_name, uint32_t* out_param_count,
+               uint32_t* out_flags, uint64_t* out_rva);
+bool GetField(uint32_t class_index, uint32_t field_ordinal,
+              const char** out_name, uint32_t* out_offset, uint32_t* out_flags);
+
+// ---- Reverse symbolization ----
+
+/// Resolved symbol for an RVA inside GameAssembly.dll. String pointers point
+/// into the mapping and stay valid until Close().
+struct MethodSymbol {
+    const char* name_space;
+    const char* class_name;
+    const char* method_name;
+    uint64_t method_rva;      // entry-point RVA of the matched method
+};
+
+/// Map an RVA to the method whose entry point is nearest at or below it —
+/// binary search over a sorted (RVA, method) index built lazily from the
+/// mapped records on first use. The RVA may point into a method body, not
+/// just at its start; `out->method_rva` tells the caller how far in.
+/// Returns false when the cache is closed or the RVA precedes every known
+/// method pointer.
+bool ResolveRva(uint64_t rva, MethodSymbol* out);
+
+} // namespace MetaCache
+} // namespace MDB
@@ -1,4 +1,5 @@
 #include "obfuscation_detector.hpp"
+#include "core/thread_pool.hpp"
 #include <Il2CppTableDefine.hpp>
 #include <Il2CppTypes.hpp>
 
@@ -7,11 +8,21 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <iomanip>
 #include <ctime>
 #include <filesystem>
 #include <map>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <emmintrin.h>   // SSE2 — baseline on x64
 
 namespace api = il2cpp::_internal;
 using namespace il2cpp::_internal::unity_structs;
@@ -33,10 +44,69 @@ static bool SafeMemRead(uintptr_t address, void* dest, size_t size) {
     }
 }
 
+// ============================================================================
+// Analysis Worker Pool
+// ============================================================================
+// The per-assembly work in every analysis phase is independent, so each phase
+// runs as a fork-join on the shared bridge pool with per-assembly partial
+// results merged back in assembly order. Mirrors the worker idiom in
+// il2cpp_dumper.cpp.
+
+static unsigned AnalysisWorkerCount(size_t itemCount) {
+    return MDB::Pool::LaneCount(itemCount);
+}
+
+static void RunAnalysisWorkers(unsigned workers, const std::function<void()>& worker) {
+    MDB::Pool::ForkJoin(workers, [&](unsigned) { worker(); });
+}
+
 // ============================================================================
 // Stub Pattern Detection (x86-64)
 // ============================================================================
 
+// Known stub prologues, matched exactly at the method entry. The SSE2 path
+// below compares all 16 prologue bytes at once and masks down to each
+// pattern's length.
+namespace {
+struct StubPrologue {
+    uint8_t bytes[16];
+    uint8_t length;
+};
+}
+
+static const StubPrologue kStubPrologues[] = {
+    { { 0xC3 }, 1 },                                  // RET — empty void stub
+    { { 0xCC, 0xC3 }, 2 },                            // INT3 + RET — padding + ret
+    { { 0x33, 0xC0, 0xC3 }, 3 },                      // XOR EAX,EAX; RET — returns 0/null/false
+    { { 0x90, 0x33, 0xC0, 0xC3 }, 4 },                // NOP; XOR EAX,EAX; RET
+    { { 0xB8, 0x00, 0x00, 0x00, 0x00, 0xC3 }, 6 },    // MOV EAX,0; RET
+    { { 0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3 }, 6 },    // MOV EAX,1; RET — returns true/1
+    { { 0x55, 0x48, 0x89, 0xE5, 0x5D, 0xC3 }, 6 },    // PUSH RBP; MOV RBP,RSP; POP RBP; RET
+};
+
+// Match an already-read 16-byte method body against the prologue table
+static bool MatchesStubPrologue(const uint8_t* body) {
+    __m128i code = _mm_loadu_si128(reinterpret_cast<const __m128i*>(body));
+    for (const StubPrologue& p : kStubPrologues) {
+        __m128i pattern = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p.bytes));
+        uint32_t eq = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(code, pattern)));
+        uint32_t need = (1u << p.length) - 1;
+        if ((eq & need) == need) return true;
+    }
+
+    // SUB RSP, imm8; ADD RSP, imm8; RET — the frame-size byte varies, so this
+    // one stays a scalar check
+    if (body[0] == 0x48 && body[1] == 0x83 && body[2] == 0xEC) {
+        uint8_t frame_size = body[3];
+        if (body[4] == 0x48 && body[5] == 0x83 && body[6] == 0xC4 && body[7] == frame_size &&
+            body[8] == 0xC3) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool Detector::IsStubPattern(uintptr_t address) const {
     if (!address) return true;
 
@@ -47,44 +117,7 @@ bool Detector::IsStubPattern(uintptr_t address) const {
         return true;
     }
 
-    // Pattern 1: Single RET (0xC3) — empty void stub
-    if (buf[0] == 0xC3) return true;
-
-    // Pattern 2: INT3 + RET (0xCC 0xC3) — padding + ret
-    if (buf[0] == 0xCC && buf[1] == 0xC3) return true;
-
-    // Pattern 3: XOR EAX, EAX; RET (0x33 0xC0 0xC3) — returns 0/null/false
-    if (buf[0] == 0x33 && buf[1] == 0xC0 && buf[2] == 0xC3) return true;
-
-    // Pattern 4: XOR EAX, EAX; RET with NOP prefix
-    // 0x90 0x33 0xC0 0xC3
-    if (buf[0] == 0x90 && buf[1] == 0x33 && buf[2] == 0xC0 && buf[3] == 0xC3) return true;
-
-    // Pattern 5: MOV EAX, 0; RET (0xB8 0x00 0x00 0x00 0x00 0xC3) — returns 0
-    if (buf[0] == 0xB8 && buf[1] == 0x00 && buf[2] == 0x00 && buf[3] == 0x00 &&
-        buf[4] == 0x00 && buf[5] == 0xC3) return true;
-
-    // Pattern 6: MOV EAX, 1; RET (0xB8 0x01 0x00 0x00 0x00 0xC3) — returns true/1
-    if (buf[0] == 0xB8 && buf[1] == 0x01 && buf[2] == 0x00 && buf[3] == 0x00 &&
-        buf[4] == 0x00 && buf[5] == 0xC3) return true;
-
-    // Pattern 7: PUSH RBP; MOV RBP, RSP; POP RBP; RET — empty function with frame
-    // 0x55 0x48 0x89 0xE5 0x5D 0xC3
-    if (buf[0] == 0x55 && buf[1] == 0x48 && buf[2] == 0x89 && buf[3] == 0xE5 &&
-        buf[4] == 0x5D && buf[5] == 0xC3) return true;
-
-    // Pattern 8: SUB RSP, XX; ADD RSP, XX; RET — empty function with stack frame
-    // Check if RET appears within first 8 bytes without any meaningful instructions
-    if (buf[0] == 0x48 && buf[1] == 0x83 && buf[2] == 0xEC) {
-        // SUB RSP, imm8 — check if followed quickly by ADD RSP + RET
-        uint8_t frame_size = buf[3];
-        if (buf[4] == 0x48 && buf[5] == 0x83 && buf[6] == 0xC4 && buf[7] == frame_size) {
-            // ADD RSP, same_size
-            if (buf[8] == 0xC3) return true;
-        }
-    }
-
-    return false;
+    return MatchesStubPrologue(buf);
 }
 
 // ============================================================================
@@ -94,9 +127,8 @@ bool Detector::IsStubPattern(uintptr_t address) const {
 bool Detector::IsWhitelistedImage(const char* imageName) const {
     if (!imageName || !imageName[0]) return false;
 
-    std::string name(imageName);
     for (const auto& prefix : m_config.assembly_prefixes_whitelist) {
-        if (name.compare(0, prefix.size(), prefix) == 0) {
+        if (std::strncmp(imageName, prefix.c_str(), prefix.size()) == 0) {
             return true;
         }
     }
@@ -206,258 +238,294 @@ std::string Detector::BuildMethodSignature(const il2cppMethodInfo* method,
 }
 
 // ============================================================================
-// Phase 1: Collect All Method Pointers
+// Phase 1: Single-Traversal Metadata Collection
 // ============================================================================
-
-void Detector::CollectMethodPointers(il2cppAssembly** assemblies, size_t count) {
-    m_pointer_map.clear();
+// The metadata working set is far larger than the last-level cache, so every
+// extra walk over it pays full memory-bandwidth cost. One traversal fills the
+// pointer map and vtable whitelist AND snapshots the per-class method data
+// (name, pointer, vtable membership) that classification needs, touching each
+// il2cppMethodInfo exactly once.
+
+std::vector<Detector::AssemblyRecord> Detector::CollectMetadata(il2cppAssembly** assemblies, size_t count) {
+    m_pointer_map.Clear();
+    m_stub_pointers.Clear();
+    m_vtable_methods.Clear();
     m_total_methods = 0;
     m_whitelisted_methods = 0;
     m_generic_skipped = 0;
 
-    for (size_t i = 0; i < count; ++i) {
-        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
-        if (!image) continue;
-
-        // Check if this entire image (assembly) is whitelisted
-        const char* imgName = api::il2cpp_image_get_name ? api::il2cpp_image_get_name(image) : nullptr;
-        bool whitelisted = IsWhitelistedImage(imgName);
+    // Per-assembly partial results, merged in assembly order below so the
+    // per-pointer method lists stay deterministic across runs
+    struct CollectSlot {
+        FlatPointerCountMap pointers;
+        std::vector<const void*> vtable;
+        size_t total = 0;
+        size_t whitelisted = 0;
+        size_t generic_skipped = 0;
+    };
+    std::vector<CollectSlot> slots(count);
+    std::vector<AssemblyRecord> records(count);
+
+    std::atomic<size_t> nextAssembly{0};
+    RunAnalysisWorkers(AnalysisWorkerCount(count), [&]() {
+        il2cpp::ensure_thread_attached();
+        for (;;) {
+            size_t i = nextAssembly.fetch_add(1);
+            if (i >= count) break;
+
+            auto image = api::il2cpp_assembly_get_image(assemblies[i]);
+            if (!image) continue;
+            CollectSlot& slot = slots[i];
+
+            const char* imgName = api::il2cpp_image_get_name ? api::il2cpp_image_get_name(image) : nullptr;
+            auto classCount = api::il2cpp_image_get_class_count(image);
+
+            // Whitelisted assemblies only contribute to the method total.
+            // They never enter the pointer map (legitimate ICF, e.g.
+            // Unity.Mathematics bitcasts, would inflate shared-pointer counts)
+            // and are never classified, so their methods are just counted.
+            if (IsWhitelistedImage(imgName)) {
+                for (size_t j = 0; j < classCount; ++j) {
+                    auto klass = api::il2cpp_image_get_class(image, j);
+                    if (!klass) continue;
+                    void* iter = nullptr;
+                    while (api::il2cpp_class_get_methods(klass, &iter)) {
+                        slot.total++;
+                        slot.whitelisted++;
+                    }
+                }
+                continue;
+            }
 
-        auto classCount = api::il2cpp_image_get_class_count(image);
-        for (size_t j = 0; j < classCount; ++j) {
-            auto klass = api::il2cpp_image_get_class(image, j);
-            if (!klass) continue;
+            records[i].classes.reserve(classCount);
 
-            // Check once per class if this is a generic class (name has backtick)
-            const char* klassName = api::il2cpp_class_get_name(klass);
-            bool isGenericClass = IsGenericClassName(klassName);
+            for (size_t j = 0; j < classCount; ++j) {
+                auto klass = api::il2cpp_image_get_class(image, j);
+                if (!klass) continue;
 
-            void* iter = nullptr;
-            while (auto method = api::il2cpp_class_get_methods(klass, &iter)) {
-                m_total_methods++;
-
-                // Whitelisted assemblies don't contribute to shared-pointer counts.
-                // This prevents legitimate ICF (e.g., Unity.Mathematics bitcasts)
-                // from inflating stub pointer detection.
-                if (whitelisted) {
-                    m_whitelisted_methods++;
-                    continue;
-                }
+                const char* klassName = api::il2cpp_class_get_name(klass);
 
                 // Generic classes use IL2CPP's "generic sharing" mechanism which
                 // legitimately compiles many methods to a single entry point.
-                // Exclude them so they don't inflate shared-pointer counts.
-                if (isGenericClass) {
-                    m_generic_skipped++;
+                // They are counted but kept out of the pointer map and never
+                // recorded — classification always treats them as real.
+                if (IsGenericClassName(klassName)) {
+                    void* iter = nullptr;
+                    while (api::il2cpp_class_get_methods(klass, &iter)) {
+                        slot.total++;
+                        slot.generic_skipped++;
+                    }
                     continue;
                 }
 
-                auto ptr = reinterpret_cast<uintptr_t>(method->m_pMethodPointer);
-                m_pointer_map[ptr].push_back(method);
-            }
-        }
-    }
-
-    // Identify stub pointers: any pointer shared by >= threshold methods
-    for (const auto& [ptr, methods] : m_pointer_map) {
-        if (methods.size() >= m_config.pointer_sharing_threshold) {
-            m_stub_pointers.insert(ptr);
-        }
-    }
-}
-
-// ============================================================================
-// Phase 2: Build VTable Whitelist
-// ============================================================================
-
-void Detector::BuildVTableWhitelist(il2cppAssembly** assemblies, size_t count) {
-    m_vtable_methods.clear();
-
-    if (!m_config.whitelist_vtable_methods) return;
-
-    // il2cpp doesn't expose a direct vtable iteration API, but we can check
-    // METHOD_ATTRIBUTE_VIRTUAL flag — virtual methods that are in the vtable
-    // are always real because obfuscators can't inject into vtable slots without
-    // breaking polymorphism.
-    //
-    // Additionally, methods implementing interface slots are real.
-    // We approximate this by whitelisting any method with VIRTUAL flag.
+                // Classes with no name still feed the pointer map but are not
+                // classified (matches the old per-phase behavior)
+                ClassRecord* record = nullptr;
+                if (klassName) {
+                    records[i].classes.push_back(
+                        ClassRecord{ klass, api::il2cpp_class_get_namespace(klass), klassName, {} });
+                    record = &records[i].classes.back();
+                }
 
-    for (size_t i = 0; i < count; ++i) {
-        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
-        if (!image) continue;
+                void* iter = nullptr;
+                while (auto method = api::il2cpp_class_get_methods(klass, &iter)) {
+                    slot.total++;
 
-        auto classCount = api::il2cpp_image_get_class_count(image);
-        for (size_t j = 0; j < classCount; ++j) {
-            auto klass = api::il2cpp_image_get_class(image, j);
-            if (!klass) continue;
+                    const char* methodName = api::il2cpp_method_get_name(method);
+                    auto ptr = reinterpret_cast<uintptr_t>(method->m_pMethodPointer);
+                    slot.pointers.Add(ptr, 1);
 
-            void* iter = nullptr;
-            while (auto method = api::il2cpp_class_get_methods(klass, &iter)) {
-                uint32_t iflags = 0;
-                auto flags = api::il2cpp_method_get_flags(method, &iflags);
+                    uint32_t iflags = 0;
+                    auto flags = api::il2cpp_method_get_flags(method, &iflags);
 
-                // Virtual methods are in the vtable — always real
-                if (flags & METHOD_ATTRIBUTE_VIRTUAL) {
-                    m_vtable_methods.insert(method);
-                }
+                    // Virtual methods are in the vtable — always real.
+                    // Abstract methods have no body but are part of the type
+                    // contract — also real.
+                    bool inVTable = m_config.whitelist_vtable_methods &&
+                                    (flags & (METHOD_ATTRIBUTE_VIRTUAL | METHOD_ATTRIBUTE_ABSTRACT)) != 0;
+                    if (inVTable) slot.vtable.push_back(method);
 
-                // Abstract methods have no body but are part of the type contract — real
-                if (flags & METHOD_ATTRIBUTE_ABSTRACT) {
-                    m_vtable_methods.insert(method);
+                    if (record) record->methods.push_back(MethodRecord{ method, methodName, ptr, inVTable });
                 }
             }
         }
+    });
+
+    for (auto& slot : slots) {
+        m_total_methods += slot.total;
+        m_whitelisted_methods += slot.whitelisted;
+        m_generic_skipped += slot.generic_skipped;
+        slot.pointers.ForEach([&](uintptr_t ptr, uint32_t shared) {
+            m_pointer_map.Add(ptr, shared);
+        });
+        for (const void* method : slot.vtable) m_vtable_methods.Insert(method);
     }
+
+    // Identify stub pointers: any pointer shared by >= threshold methods
+    m_pointer_map.ForEach([&](uintptr_t ptr, uint32_t shared) {
+        if (shared >= m_config.pointer_sharing_threshold) {
+            m_stub_pointers.Insert(ptr);
+        }
+    });
+
+    // Confirm stub candidates against the known prologue patterns. The
+    // candidates are sorted first so the body reads walk .text in address
+    // order instead of chasing pointers in hash order — the code section is
+    // far larger than the LLC and random-order reads miss on every probe.
+    m_stub_patterns_confirmed = 0;
+    if (m_config.check_stub_patterns && m_stub_pointers.Size() > 0) {
+        std::vector<uintptr_t> candidates;
+        candidates.reserve(m_stub_pointers.Size());
+        m_stub_pointers.ForEach([&](uintptr_t ptr) {
+            if (ptr) candidates.push_back(ptr);
+        });
+        std::sort(candidates.begin(), candidates.end());
+        for (uintptr_t address : candidates) {
+            if (IsStubPattern(address)) m_stub_patterns_confirmed++;
+        }
+    }
+
+    return records;
 }
 
 // ============================================================================
-// Phase 3: Classify Methods
+// Phase 2: Classify Methods
 // ============================================================================
 
-void Detector::ClassifyMethods(il2cppAssembly** assemblies, size_t count) {
+void Detector::ClassifyMethods(const std::vector<AssemblyRecord>& records) {
     m_fake_methods.clear();
-    m_fake_method_set.clear();
-    m_fake_class_set.clear();
+    m_fake_method_set.Clear();
+    m_fake_class_set.Clear();
     m_class_analysis.clear();
     m_fake_class_count = 0;
 
-    for (size_t i = 0; i < count; ++i) {
-        auto image = api::il2cpp_assembly_get_image(assemblies[i]);
-        if (!image) continue;
-
-        // Skip whitelisted assemblies entirely — all methods are real
-        const char* imgName = api::il2cpp_image_get_name ? api::il2cpp_image_get_name(image) : nullptr;
-        if (IsWhitelistedImage(imgName)) continue;
-
-        auto classCount = api::il2cpp_image_get_class_count(image);
-        for (size_t j = 0; j < classCount; ++j) {
-            auto klass = api::il2cpp_image_get_class(image, j);
-            if (!klass) continue;
-
-            const char* ns = api::il2cpp_class_get_namespace(klass);
-            const char* name = api::il2cpp_class_get_name(klass);
-            if (!name) continue;
-
-            std::string nsStr(ns ? ns : "");
-            std::string nameStr(name);
-            std::string fullName = nsStr.empty() ? nameStr : (nsStr + "." + nameStr);
-            bool isGenericClass = IsGenericClassName(name);
-
-            ClassAnalysis classResult{};
-            classResult.klass = klass;
-            classResult.full_name = fullName;
-            classResult.total_methods = 0;
-            classResult.fake_methods = 0;
-            classResult.real_methods = 0;
-            classResult.is_entirely_fake = false;
-
-            void* iter = nullptr;
-            while (auto method = api::il2cpp_class_get_methods(klass, &iter)) {
-                classResult.total_methods++;
-
-                const char* methodName = api::il2cpp_method_get_name(method);
-                auto ptr = reinterpret_cast<uintptr_t>(method->m_pMethodPointer);
-
-                // Step 1: VTable whitelist — always real
-                if (m_vtable_methods.count(method)) {
-                    classResult.real_methods++;
-                    continue;
-                }
-
-                // Step 2: Constructors and finalizers are always real
-                if (methodName) {
-                    std::string mName(methodName);
-                    if (mName == ".ctor" || mName == ".cctor" || mName == "Finalize") {
+    // Per-assembly partial results; the snapshot and the lookup structures
+    // built by CollectMetadata are only read here
+    struct ClassifySlot {
+        std::vector<FakeMethodInfo> fakes;
+        std::vector<ClassAnalysis> analyses;
+    };
+    std::vector<ClassifySlot> slots(records.size());
+
+    std::atomic<size_t> nextAssembly{0};
+    RunAnalysisWorkers(AnalysisWorkerCount(records.size()), [&]() {
+        il2cpp::ensure_thread_attached();
+        for (;;) {
+            size_t i = nextAssembly.fetch_add(1);
+            if (i >= records.size()) break;
+            ClassifySlot& slot = slots[i];
+
+            for (const ClassRecord& cls : records[i].classes) {
+                std::string fullName = (cls.name_space && cls.name_space[0])
+                    ? std::string(cls.name_space) + "." + cls.name
+                    : std::string(cls.name);
+
+                ClassAnalysis classResult{};
+                classResult.klass = cls.klass;
+                classResult.full_name = fullName;
+                classResult.total_methods = 0;
+                classResult.fake_methods = 0;
+                classResult.real_methods = 0;
+                classResult.is_entirely_fake = false;
+
+                for (const MethodRecord& m : cls.methods) {
+                    classResult.total_methods++;
+
+                    // Step 1: VTable membership — always real
+                    if (m.in_vtable) {
                         classResult.real_methods++;
                         continue;
                     }
-                }
-
-                // Step 3: Generic classes — always real
-                // Generic definitions have null pointers by design, and generic
-                // shared implementations legitimately reuse code addresses.
-                if (isGenericClass) {
-                    classResult.real_methods++;
-                    continue;
-                }
 
-                // Step 4: Null method pointer — fake if name is obfuscated
-                // Generic method definitions in non-generic classes (e.g.
-                // ByteBuffer::ToArray<T>) legitimately have null pointers.
-                // Only flag as fake if the method name is obfuscated.
-                if (ptr == 0) {
-                    if (IsObfuscatedName(methodName)) {
-                        FakeMethodInfo info{};
-                        info.method = method;
-                        info.class_name = fullName;
-                        info.method_name = methodName ? methodName : "???";
-                        info.full_signature = BuildMethodSignature(method, fullName);
-                        info.method_pointer = 0;
-                        info.reason = FakeReason::NullMethodPointer;
-                        info.shared_count = 0;
-                        m_fake_methods.push_back(info);
-                        m_fake_method_set.insert(method);
-                        classResult.fake_methods++;
-                    } else {
+                    // Step 2: Constructors and finalizers are always real
+                    if (m.name && (strcmp(m.name, ".ctor") == 0 ||
+                                   strcmp(m.name, ".cctor") == 0 ||
+                                   strcmp(m.name, "Finalize") == 0)) {
                         classResult.real_methods++;
+                        continue;
                     }
-                    continue;
-                }
 
-                // Step 5: Shared method pointer — primary detection signal
-                // Only flag if the method name looks obfuscated. Real methods
-                // (e.g. get_Position, Update) can share code via MSVC ICF with
-                // BeeByte stubs but are not themselves fake.
-                if (m_stub_pointers.count(ptr)) {
-                    bool nameIsObfuscated = IsObfuscatedName(methodName);
-
-                    if (nameIsObfuscated) {
-                        FakeMethodInfo info{};
-                        info.method = method;
-                        info.class_name = fullName;
-                        info.method_name = methodName ? methodName : "???";
-                        info.full_signature = BuildMethodSignature(method, fullName);
-                        info.method_pointer = ptr;
-                        info.reason = FakeReason::SharedMethodPointer;
-                        info.shared_count = m_pointer_map[ptr].size();
-                        m_fake_methods.push_back(info);
-                        m_fake_method_set.insert(method);
-                        classResult.fake_methods++;
+                    // Step 3: Null method pointer — fake if name is obfuscated
+                    // Generic method definitions in non-generic classes (e.g.
+                    // ByteBuffer::ToArray<T>) legitimately have null pointers.
+                    // Only flag as fake if the method name is obfuscated.
+                    if (m.pointer == 0) {
+                        if (IsObfuscatedName(m.name)) {
+                            FakeMethodInfo info{};
+                            info.method = m.method;
+                            info.class_name = fullName;
+                            info.method_name = m.name ? m.name : "???";
+                            info.method_pointer = 0;
+                            info.reason = FakeReason::NullMethodPointer;
+                            info.shared_count = 0;
+                            slot.fakes.push_back(std::move(info));
+                            classResult.fake_methods++;
+                        } else {
+                            classResult.real_methods++;
+                        }
+                        continue;
+                    }
+
+                    // Step 4: Shared method pointer — primary detection signal
+                    // Only flag if the method name looks obfuscated. Real methods
+                    // (e.g. get_Position, Update) can share code via MSVC ICF with
+                    // BeeByte stubs but are not themselves fake.
+                    if (m_stub_pointers.Contains(m.pointer)) {
+                        if (IsObfuscatedName(m.name)) {
+                            FakeMethodInfo info{};
+                            info.method = m.method;
+                            info.class_name = fullName;
+                            info.method_name = m.name ? m.name : "???";
+                            info.method_pointer = m.pointer;
+                            info.reason = FakeReason::SharedMethodPointer;
+                            info.shared_count = m_pointer_map.Get(m.pointer);
+                            slot.fakes.push_back(std::move(info));
+                            classResult.fake_methods++;
+                            continue;
+                        }
+                        // Non-obfuscated name on a shared pointer → likely ICF collateral.
+                        // Treat as real.
+                        classResult.real_methods++;
                         continue;
                     }
-                    // Non-obfuscated name on a shared pointer → likely ICF collateral.
-                    // Treat as real.
+
+                    // If it passed all checks, it's real
                     classResult.real_methods++;
-                    continue;
                 }
 
-                // If it passed all checks, it's real
-                classResult.real_methods++;
-            }
+                // Determine if class is entirely fake:
+                // A class where ALL non-special methods (.ctor, .cctor, Finalize) are fake
+                // and it has at least some methods
+                if (classResult.total_methods > 0 && classResult.real_methods == 0) {
+                    classResult.is_entirely_fake = true;
+                }
+                // More nuanced: if >90% of methods are fake with at least 5+ fakes
+                else if (classResult.fake_methods >= 5 &&
+                         classResult.total_methods > 0 &&
+                         (classResult.fake_methods * 100 / classResult.total_methods) >= 90) {
+                    classResult.is_entirely_fake = true;
+                }
 
-            // Determine if class is entirely fake:
-            // A class where ALL non-special methods (.ctor, .cctor, Finalize) are fake
-            // and it has at least some methods
-            if (classResult.total_methods > 0 && classResult.real_methods == 0) {
-                classResult.is_entirely_fake = true;
-            }
-            // More nuanced: if >90% of methods are fake with at least 5+ fakes
-            else if (classResult.fake_methods >= 5 &&
-                     classResult.total_methods > 0 &&
-                     (classResult.fake_methods * 100 / classResult.total_methods) >= 90) {
-                classResult.is_entirely_fake = true;
+                // Only store analysis for classes that have at least one fake method
+                if (classResult.fake_methods > 0) {
+                    slot.analyses.push_back(std::move(classResult));
+                }
             }
+        }
+    });
 
-            if (classResult.is_entirely_fake) {
-                m_fake_class_set.insert(klass);
+    // Merge per-assembly results in assembly order (deterministic output)
+    for (auto& slot : slots) {
+        for (auto& fake : slot.fakes) {
+            m_fake_method_set.Insert(fake.method);
+            m_fake_methods.push_back(std::move(fake));
+        }
+        for (auto& analysis : slot.analyses) {
+            if (analysis.is_entirely_fake) {
+                m_fake_class_set.Insert(analysis.klass);
                 m_fake_class_count++;
             }
-
-            // Only store analysis for classes that have at least one fake method
-            if (classResult.fake_methods > 0) {
-                m_class_analysis.push_back(classResult);
-            }
+            m_class_analysis.push_back(std::move(analysis));
         }
     }
 }
@@ -470,14 +538,12 @@ void Detector::Analyze(il2cppAssembly** assemblies, size_t count) {
     if (!assemblies || count == 0) return;
     if (!api::il2cpp_class_get_methods || !api::il2cpp_method_get_flags) return;
 
-    // Phase 1: Collect all method pointers across entire runtime
-    CollectMethodPointers(assemblies, count);
+    // Phase 1: one traversal fills the pointer map, stub set, and vtable
+    // whitelist, and snapshots the per-class method data
+    auto records = CollectMetadata(assemblies, count);
 
-    // Phase 2: Build vtable whitelist
-    BuildVTableWhitelist(assemblies, count);
-
-    // Phase 3: Classify each method
-    ClassifyMethods(assemblies, count);
+    // Phase 2: classify each method from the snapshot
+    ClassifyMethods(records);
 }
 
 // ============================================================================
@@ -485,11 +551,191 @@ void Detector::Analyze(il2cppAssembly** assemblies, size_t count) {
 // ============================================================================
 
 bool Detector::IsFakeMethod(const il2cppMethodInfo* method) const {
-    return m_fake_method_set.count(method) > 0;
+    if (m_cache_loaded) return IsFakeMethodCached(method);
+    return m_fake_method_set.Contains(method);
 }
 
 bool Detector::IsEntirelyFakeClass(il2cppClass* klass) const {
-    return m_fake_class_set.count(klass) > 0;
+    if (m_cache_loaded) {
+        if (!klass) return false;
+        const char* ns = api::il2cpp_class_get_namespace(klass);
+        const char* name = api::il2cpp_class_get_name(klass);
+        if (!name) return false;
+        std::string fullName = (ns && ns[0]) ? std::string(ns) + "." + name : std::string(name);
+        return m_cached_fake_class_names.count(fullName) > 0;
+    }
+    return m_fake_class_set.Contains(klass);
+}
+
+bool Detector::IsFakeMethodCached(const il2cppMethodInfo* method) const {
+    if (!method) return false;
+
+    // Mirrors ClassifyMethods with the persisted stub RVAs standing in for
+    // m_stub_pointers. Every fake has an obfuscated name, which also rules
+    // out constructors, finalizers, and everything in whitelisted images.
+    const char* name = api::il2cpp_method_get_name ? api::il2cpp_method_get_name(method) : nullptr;
+    if (!IsObfuscatedName(name)) return false;
+
+    if (m_config.whitelist_vtable_methods && api::il2cpp_method_get_flags) {
+        uint32_t iflags = 0;
+        auto flags = api::il2cpp_method_get_flags(method, &iflags);
+        if (flags & (METHOD_ATTRIBUTE_VIRTUAL | METHOD_ATTRIBUTE_ABSTRACT)) return false;
+    }
+
+    if (method->m_pClass &&
+        IsGenericClassName(api::il2cpp_class_get_name(method->m_pClass))) return false;
+
+    auto ptr = reinterpret_cast<uintptr_t>(method->m_pMethodPointer);
+    if (ptr == 0) return true;   // null pointer + obfuscated name
+    return m_cached_stub_rvas.Contains(ptr - m_cached_ga_base);
+}
+
+// ============================================================================
+// Persisted Analysis Cache
+// ============================================================================
+// Detection is fully deterministic for a given GameAssembly binary, so the
+// stub RVA set and entirely-fake-class list are persisted next to
+// fake_methods.txt and reloaded instead of re-analyzed while the binary is
+// unchanged — the same size/mtime stamp the metadata cache uses.
+
+#pragma pack(push, 1)
+struct AnalysisCacheHeader {
+    char magic[4];               // "MDBA"
+    uint32_t version;            // kAnalysisCacheVersion
+    uint64_t ga_size;            // GameAssembly.dll stamp
+    uint64_t ga_mtime;
+    uint64_t total_methods;
+    uint64_t whitelisted_methods;
+    uint64_t generic_skipped;
+    uint64_t fake_method_count;
+    uint64_t stub_rva_count;     // uint64 RVAs following the header
+    uint64_t fake_class_bytes;   // NUL-separated "Namespace.Class" blob
+};
+#pragma pack(pop)
+
+static constexpr uint32_t kAnalysisCacheVersion = 1;
+
+// Size + last-write stamp of GameAssembly.dll (matches metadata_cache.cpp)
+static bool GetGameAssemblyStamp(uint64_t* out_size, uint64_t* out_mtime) {
+    HMODULE hGA = GetModuleHandleW(L"GameAssembly.dll");
+    if (!hGA) return false;
+
+    wchar_t gaPath[MAX_PATH];
+    if (GetModuleFileNameW(hGA, gaPath, MAX_PATH) == 0) return false;
+
+    WIN32_FILE_ATTRIBUTE_DATA attr{};
+    if (!GetFileAttributesExW(gaPath, GetFileExInfoStandard, &attr)) return false;
+
+    *out_size = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+    *out_mtime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                 attr.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
+bool Detector::SaveAnalysisCache(const std::string& cache_path) const {
+    uint64_t gaSize = 0, gaMtime = 0;
+    if (!GetGameAssemblyStamp(&gaSize, &gaMtime)) return false;
+    uintptr_t gaBase = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
+    if (!gaBase) return false;
+
+    // Stub pointers as RVAs, sorted for deterministic file contents. The
+    // null pointer needs no persisting — cached classification handles it
+    // from the method itself.
+    std::vector<uint64_t> rvas;
+    rvas.reserve(m_stub_pointers.Size());
+    m_stub_pointers.ForEach([&](uintptr_t ptr) {
+        if (ptr) rvas.push_back(static_cast<uint64_t>(ptr - gaBase));
+    });
+    std::sort(rvas.begin(), rvas.end());
+
+    std::string classBlob;
+    for (const auto& ca : m_class_analysis) {
+        if (!ca.is_entirely_fake) continue;
+        classBlob.append(ca.full_name);
+        classBlob.push_back('\0');
+    }
+
+    AnalysisCacheHeader header{};
+    memcpy(header.magic, "MDBA", 4);
+    header.version = kAnalysisCacheVersion;
+    header.ga_size = gaSize;
+    header.ga_mtime = gaMtime;
+    header.total_methods = m_total_methods;
+    header.whitelisted_methods = m_whitelisted_methods;
+    header.generic_skipped = m_generic_skipped;
+    header.fake_method_count = m_fake_methods.size();
+    header.stub_rva_count = rvas.size();
+    header.fake_class_bytes = classBlob.size();
+
+    std::ofstream file(cache_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!rvas.empty()) {
+        file.write(reinterpret_cast<const char*>(rvas.data()),
+                   static_cast<std::streamsize>(rvas.size() * sizeof(uint64_t)));
+    }
+    if (!classBlob.empty()) {
+        file.write(classBlob.data(), static_cast<std::streamsize>(classBlob.size()));
+    }
+    return file.good();
+}
+
+bool Detector::LoadAnalysisCache(const std::string& cache_path) {
+    m_cache_loaded = false;
+
+    uint64_t gaSize = 0, gaMtime = 0;
+    if (!GetGameAssemblyStamp(&gaSize, &gaMtime)) return false;
+    m_cached_ga_base = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
+    if (!m_cached_ga_base) return false;
+
+    std::ifstream file(cache_path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    AnalysisCacheHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file.good()) return false;
+    if (memcmp(header.magic, "MDBA", 4) != 0) return false;
+    if (header.version != kAnalysisCacheVersion) return false;
+    if (header.ga_size != gaSize || header.ga_mtime != gaMtime) return false;
+
+    // Sanity bounds against a corrupt header
+    if (header.stub_rva_count > (1ull << 24)) return false;
+    if (header.fake_class_bytes > (1ull << 28)) return false;
+
+    std::vector<uint64_t> rvas(static_cast<size_t>(header.stub_rva_count));
+    if (!rvas.empty()) {
+        file.read(reinterpret_cast<char*>(rvas.data()),
+                  static_cast<std::streamsize>(rvas.size() * sizeof(uint64_t)));
+        if (!file.good()) return false;
+    }
+
+    std::string classBlob(static_cast<size_t>(header.fake_class_bytes), '\0');
+    if (!classBlob.empty()) {
+        file.read(&classBlob[0], static_cast<std::streamsize>(classBlob.size()));
+        if (!file.good()) return false;
+    }
+
+    m_cached_stub_rvas.Clear();
+    m_cached_stub_rvas.Reserve(rvas.size());
+    for (uint64_t rva : rvas) m_cached_stub_rvas.Insert(static_cast<uintptr_t>(rva));
+
+    m_cached_fake_class_names.clear();
+    size_t pos = 0;
+    while (pos < classBlob.size()) {
+        size_t end = classBlob.find('\0', pos);
+        if (end == std::string::npos) break;
+        if (end > pos) m_cached_fake_class_names.insert(classBlob.substr(pos, end - pos));
+        pos = end + 1;
+    }
+
+    m_total_methods = static_cast<size_t>(header.total_methods);
+    m_whitelisted_methods = static_cast<size_t>(header.whitelisted_methods);
+    m_generic_skipped = static_cast<size_t>(header.generic_skipped);
+    m_cached_fake_method_count = static_cast<size_t>(header.fake_method_count);
+    m_fake_class_count = m_cached_fake_class_names.size();
+
+    m_cache_loaded = true;
+    return true;
 }
 
 // ============================================================================
@@ -501,153 +747,263 @@ bool Detector::WriteFakeReport(const std::string& output_path) const {
     std::filesystem::path filePath(output_path);
     std::filesystem::create_directories(filePath.parent_path());
 
-    std::ofstream file(output_path);
+    // Formatting and I/O are pipelined the same way as the dumper's wrapper
+    // writer: lines are formatted into a reused block buffer, completed
+    // blocks go through a queue to a dedicated writer thread, and drained
+    // blocks come back for reuse — on heavily obfuscated games the fake
+    // list exceeds a million entries, so disk latency must overlap with
+    // signature formatting instead of serializing behind it.
+    std::vector<char> ioBuffer(1 << 20);
+    std::ofstream file;
+    file.rdbuf()->pubsetbuf(ioBuffer.data(), static_cast<std::streamsize>(ioBuffer.size()));
+    file.open(output_path);
     if (!file.is_open()) return false;
 
+    std::deque<std::string> pendingBlocks;
+    std::deque<std::string> spareBlocks;   // drained, returned for reuse
+    std::mutex blockMutex;
+    std::condition_variable blockCv;
+    bool formatDone = false;
+
+    std::thread writer([&]() {
+        for (;;) {
+            std::string writeBlock;
+            {
+                std::unique_lock<std::mutex> lock(blockMutex);
+                blockCv.wait(lock, [&]() { return !pendingBlocks.empty() || formatDone; });
+                if (pendingBlocks.empty()) break;  // formatDone && drained
+                writeBlock = std::move(pendingBlocks.front());
+                pendingBlocks.pop_front();
+            }
+            file.write(writeBlock.data(), static_cast<std::streamsize>(writeBlock.size()));
+            writeBlock.clear();
+            {
+                std::lock_guard<std::mutex> lock(blockMutex);
+                spareBlocks.push_back(std::move(writeBlock));
+            }
+        }
+    });
+
+    constexpr size_t kBlockBytes = 256 * 1024;
+    std::string block;
+    block.reserve(kBlockBytes + 1024);
+
+    auto flushBlock = [&]() {
+        if (block.empty()) return;
+        std::string next;
+        {
+            std::lock_guard<std::mutex> lock(blockMutex);
+            pendingBlocks.push_back(std::move(block));
+            if (!spareBlocks.empty()) {
+                next = std::move(spareBlocks.front());
+                spareBlocks.pop_front();
+            }
+        }
+        blockCv.notify_one();
+        block = std::move(next);
+        if (block.capacity() < kBlockBytes + 1024) block.reserve(kBlockBytes + 1024);
+    };
+    auto emit = [&](const char* text) {
+        block.append(text);
+        if (block.size() >= kBlockBytes) flushBlock();
+    };
+    auto emitStr = [&](const std::string& text) {
+        block.append(text);
+        if (block.size() >= kBlockBytes) flushBlock();
+    };
+
+    // Fixed scratch for every formatted line — no per-line allocation
+    char line[768];
+
     // Get current timestamp
     auto now = std::chrono::system_clock::now();
     auto time_t_now = std::chrono::system_clock::to_time_t(now);
     std::tm tm_now{};
     localtime_s(&tm_now, &time_t_now);
+    char stamp[32];
+    strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm_now);
 
     // Get GameAssembly base for RVA calculation
     uintptr_t gaBase = reinterpret_cast<uintptr_t>(GetModuleHandleW(L"GameAssembly.dll"));
 
-    file << "// ============================================================================\n";
-    file << "// Obfuscation Fake Method Detection Report\n";
-    file << "// Generated: " << std::put_time(&tm_now, "%Y-%m-%d %H:%M:%S") << "\n";
-    file << "// ============================================================================\n";
-    file << "//\n";
-    file << "// Detection Configuration:\n";
-    file << "//   Pointer sharing threshold: " << m_config.pointer_sharing_threshold << "\n";
-    file << "//   VTable whitelist enabled:  " << (m_config.whitelist_vtable_methods ? "yes" : "no") << "\n";
-    file << "//   Stub pattern check:        " << (m_config.check_stub_patterns ? "yes" : "no") << "\n";
-    file << "//   Assembly whitelist:         ";
+    emit("// ============================================================================\n");
+    emit("// Obfuscation Fake Method Detection Report\n");
+    snprintf(line, sizeof(line), "// Generated: %s\n", stamp);
+    emit(line);
+    emit("// ============================================================================\n");
+    emit("//\n");
+    emit("// Detection Configuration:\n");
+    snprintf(line, sizeof(line), "//   Pointer sharing threshold: %zu\n", m_config.pointer_sharing_threshold);
+    emit(line);
+    snprintf(line, sizeof(line), "//   VTable whitelist enabled:  %s\n", m_config.whitelist_vtable_methods ? "yes" : "no");
+    emit(line);
+    snprintf(line, sizeof(line), "//   Stub pattern check:        %s\n", m_config.check_stub_patterns ? "yes" : "no");
+    emit(line);
+    emit("//   Assembly whitelist:         ");
     for (size_t i = 0; i < m_config.assembly_prefixes_whitelist.size(); ++i) {
-        if (i > 0) file << ", ";
-        file << m_config.assembly_prefixes_whitelist[i] << "*";
+        if (i > 0) emit(", ");
+        emitStr(m_config.assembly_prefixes_whitelist[i]);
+        emit("*");
     }
-    file << "\n";
-    file << "//\n";
-    file << "// Summary:\n";
-    file << "//   Total methods analyzed:    " << m_total_methods << "\n";
-    file << "//   Whitelisted (skipped):     " << m_whitelisted_methods << "\n";
-    file << "//   Generic shared (skipped):  " << m_generic_skipped << "\n";
-    file << "//   Fake methods detected:     " << m_fake_methods.size() << "\n";
-    file << "//   Fake classes detected:     " << m_fake_class_count << "\n";
-    file << "//   Unique stub pointers:      " << m_stub_pointers.size() << "\n";
-    file << "//   VTable methods (whitelist): " << m_vtable_methods.size() << "\n";
-    file << "// ============================================================================\n\n";
+    emit("\n");
+    emit("//\n");
+    emit("// Summary:\n");
+    snprintf(line, sizeof(line), "//   Total methods analyzed:    %zu\n", m_total_methods);
+    emit(line);
+    snprintf(line, sizeof(line), "//   Whitelisted (skipped):     %zu\n", m_whitelisted_methods);
+    emit(line);
+    snprintf(line, sizeof(line), "//   Generic shared (skipped):  %zu\n", m_generic_skipped);
+    emit(line);
+    snprintf(line, sizeof(line), "//   Fake methods detected:     %zu\n", m_fake_methods.size());
+    emit(line);
+    snprintf(line, sizeof(line), "//   Fake classes detected:     %zu\n", m_fake_class_count);
+    emit(line);
+    snprintf(line, sizeof(line), "//   Unique stub pointers:      %zu\n", m_stub_pointers.Size());
+    emit(line);
+    snprintf(line, sizeof(line), "//   Stub prologues confirmed:  %zu\n", m_stub_patterns_confirmed);
+    emit(line);
+    snprintf(line, sizeof(line), "//   VTable methods (whitelist): %zu\n", m_vtable_methods.Size());
+    emit(line);
+    emit("// ============================================================================\n\n");
 
     // Section 1: Stub pointer summary
-    file << "// ============================================================================\n";
-    file << "// STUB POINTERS (shared by " << m_config.pointer_sharing_threshold << "+ methods)\n";
-    file << "// ============================================================================\n\n";
+    emit("// ============================================================================\n");
+    snprintf(line, sizeof(line), "// STUB POINTERS (shared by %zu+ methods)\n", m_config.pointer_sharing_threshold);
+    emit(line);
+    emit("// ============================================================================\n\n");
 
     // Sort stub pointers by usage count
     std::vector<std::pair<uintptr_t, size_t>> sorted_stubs;
-    for (auto ptr : m_stub_pointers) {
-        sorted_stubs.push_back({ ptr, m_pointer_map.at(ptr).size() });
-    }
+    m_stub_pointers.ForEach([&](uintptr_t ptr) {
+        sorted_stubs.push_back({ ptr, m_pointer_map.Get(ptr) });
+    });
     std::sort(sorted_stubs.begin(), sorted_stubs.end(),
               [](const auto& a, const auto& b) { return a.second > b.second; });
 
     for (const auto& [ptr, count] : sorted_stubs) {
         uintptr_t rva = gaBase ? (ptr - gaBase) : ptr;
-        file << "// Pointer 0x" << std::hex << ptr << " (RVA: 0x" << rva << std::dec
-             << ") — shared by " << count << " methods";
+        snprintf(line, sizeof(line), "// Pointer 0x%llx (RVA: 0x%llx) — shared by %zu methods",
+                 static_cast<unsigned long long>(ptr), static_cast<unsigned long long>(rva), count);
+        emit(line);
 
         // Show stub bytes if available
         uint8_t buf[8] = {};
         if (SafeMemRead(ptr, buf, sizeof(buf))) {
-            file << " — bytes: ";
-            for (int b = 0; b < 8; ++b) {
-                file << std::hex << std::setw(2) << std::setfill('0') << (int)buf[b] << " ";
-            }
-            file << std::dec;
+            snprintf(line, sizeof(line), " — bytes: %02x %02x %02x %02x %02x %02x %02x %02x ",
+                     buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf[6], buf[7]);
+            emit(line);
         } else {
-            file << " — [unreadable]";
+            emit(" — [unreadable]");
         }
 
-        file << "\n";
+        emit("\n");
     }
 
     // Section 2: Entirely fake classes
-    file << "\n// ============================================================================\n";
-    file << "// ENTIRELY FAKE CLASSES (" << m_fake_class_count << " detected)\n";
-    file << "// ============================================================================\n\n";
+    emit("\n// ============================================================================\n");
+    snprintf(line, sizeof(line), "// ENTIRELY FAKE CLASSES (%zu detected)\n", m_fake_class_count);
+    emit(line);
+    emit("// ============================================================================\n\n");
 
     for (const auto& ca : m_class_analysis) {
         if (!ca.is_entirely_fake) continue;
-        file << "// [FAKE CLASS] " << ca.full_name
-             << " — " << ca.fake_methods << "/" << ca.total_methods << " methods are fake\n";
+        emit("// [FAKE CLASS] ");
+        emitStr(ca.full_name);
+        snprintf(line, sizeof(line), " — %zu/%zu methods are fake\n", ca.fake_methods, ca.total_methods);
+        emit(line);
     }
 
     // Section 3: All fake methods grouped by class
-    file << "\n// ============================================================================\n";
-    file << "// ALL FAKE METHODS (" << m_fake_methods.size() << " detected)\n";
-    file << "// ============================================================================\n\n";
-
-    // Group by class
-    std::map<std::string, std::vector<const FakeMethodInfo*>> by_class;
-    for (const auto& fm : m_fake_methods) {
-        by_class[fm.class_name].push_back(&fm);
+    emit("\n// ============================================================================\n");
+    snprintf(line, sizeof(line), "// ALL FAKE METHODS (%zu detected)\n", m_fake_methods.size());
+    emit(line);
+    emit("// ============================================================================\n\n");
+
+    // Group by class without a map of a million string keys: sort pointers
+    // to the entries by class name (stable, so detection order within a
+    // class is kept) and walk the runs
+    std::vector<const FakeMethodInfo*> ordered;
+    ordered.reserve(m_fake_methods.size());
+    for (const auto& fm : m_fake_methods) ordered.push_back(&fm);
+    std::stable_sort(ordered.begin(), ordered.end(),
+                     [](const FakeMethodInfo* a, const FakeMethodInfo* b) {
+                         return a->class_name < b->class_name;
+                     });
+
+    std::unordered_set<std::string_view> fakeClassNames;
+    for (const auto& ca : m_class_analysis) {
+        if (ca.is_entirely_fake) fakeClassNames.insert(ca.full_name);
     }
 
-    for (const auto& [className, methods] : by_class) {
-        // Check if this is an entirely fake class
-        bool isFakeClass = false;
-        for (const auto& ca : m_class_analysis) {
-            if (ca.full_name == className && ca.is_entirely_fake) {
-                isFakeClass = true;
-                break;
-            }
-        }
+    size_t runStart = 0;
+    while (runStart < ordered.size()) {
+        const std::string& className = ordered[runStart]->class_name;
+        size_t runEnd = runStart;
+        while (runEnd < ordered.size() && ordered[runEnd]->class_name == className) runEnd++;
 
-        file << "// --- " << className;
-        if (isFakeClass) file << " [ENTIRE CLASS IS FAKE]";
-        file << " ---\n";
+        emit("// --- ");
+        emitStr(className);
+        if (fakeClassNames.count(className) != 0) emit(" [ENTIRE CLASS IS FAKE]");
+        emit(" ---\n");
 
-        for (const auto* fm : methods) {
+        for (size_t i = runStart; i < runEnd; ++i) {
+            const FakeMethodInfo* fm = ordered[i];
             uintptr_t rva = (gaBase && fm->method_pointer) ? (fm->method_pointer - gaBase) : fm->method_pointer;
-            file << "//   ";
 
             switch (fm->reason) {
             case FakeReason::SharedMethodPointer:
-                file << "[SHARED x" << fm->shared_count << "] ";
+                snprintf(line, sizeof(line), "//   [SHARED x%zu] ", fm->shared_count);
+                emit(line);
                 break;
             case FakeReason::NullMethodPointer:
-                file << "[NULL PTR] ";
+                emit("//   [NULL PTR] ");
                 break;
             case FakeReason::StubPattern:
-                file << "[STUB] ";
+                emit("//   [STUB] ");
                 break;
             default:
+                emit("//   ");
                 break;
             }
 
-            file << fm->full_signature;
+            // Signatures are built only here — a run that never writes the
+            // report (analysis-cache hit) never pays for them
+            emitStr(BuildMethodSignature(fm->method, fm->class_name));
             if (fm->method_pointer) {
-                file << " // RVA: 0x" << std::hex << rva << std::dec;
+                snprintf(line, sizeof(line), " // RVA: 0x%llx", static_cast<unsigned long long>(rva));
+                emit(line);
             }
-            file << "\n";
+            emit("\n");
         }
-        file << "\n";
+        emit("\n");
+        runStart = runEnd;
     }
 
     // Section 4: Classes with partial fakes (mixed real + fake)
-    file << "// ============================================================================\n";
-    file << "// PARTIALLY AFFECTED CLASSES (mix of real + fake methods)\n";
-    file << "// ============================================================================\n\n";
+    emit("// ============================================================================\n");
+    emit("// PARTIALLY AFFECTED CLASSES (mix of real + fake methods)\n");
+    emit("// ============================================================================\n\n");
 
     for (const auto& ca : m_class_analysis) {
         if (ca.is_entirely_fake) continue;
-        file << "// " << ca.full_name
-             << " — " << ca.fake_methods << " fake / " << ca.real_methods << " real / "
-             << ca.total_methods << " total\n";
+        emit("// ");
+        emitStr(ca.full_name);
+        snprintf(line, sizeof(line), " — %zu fake / %zu real / %zu total\n",
+                 ca.fake_methods, ca.real_methods, ca.total_methods);
+        emit(line);
+    }
+
+    emit("\n// === End of Report ===\n");
+
+    // Formatting finished — let the writer drain and close
+    flushBlock();
+    {
+        std::lock_guard<std::mutex> lock(blockMutex);
+        formatDone = true;
     }
+    blockCv.notify_one();
+    writer.join();
 
-    file << "\n// === End of Report ===\n";
     file.close();
     return true;
 }
@@ -17,11 +17,10 @@
 //   detector.WriteFakeReport(outputPath);
 
 #include "il2cpp_resolver.hpp"
+#include "flat_pointer_table.hpp"
 #include <string>
-#include <vector>
 #include <unordered_set>
-#include <unordered_map>
-#include <set>
+#include <vector>
 
 namespace MDB {
 namespace Obfuscation {
@@ -77,10 +76,11 @@ struct FakeMethodInfo {
     const il2cpp::_internal::unity_structs::il2cppMethodInfo* method;
     std::string class_name;         // "Namespace.ClassName"
     std::string method_name;
-    std::string full_signature;     // "ReturnType ClassName::MethodName(Params)"
     uintptr_t method_pointer;
     FakeReason reason;
     size_t shared_count;            // How many methods share this pointer
+    // Note: no stored signature — WriteFakeReport() formats signatures
+    // lazily from `method`, so classification never pays for them
 };
 
 // ============================================================================
@@ -108,6 +108,18 @@ public:
     /// Run analysis across all assemblies. Call once after IL2CPP is initialized.
     void Analyze(il2cpp::_internal::unity_structs::il2cppAssembly** assemblies, size_t count);
 
+    /// Try to load a persisted analysis for the current GameAssembly binary.
+    /// Returns true on a hit — Analyze() and WriteFakeReport() can then be
+    /// skipped and queries answer from the persisted data.
+    bool LoadAnalysisCache(const std::string& cache_path);
+
+    /// Persist the analysis so unchanged binaries skip detection on the next
+    /// dump. Call after Analyze().
+    bool SaveAnalysisCache(const std::string& cache_path) const;
+
+    /// Whether queries are answered from a loaded analysis cache.
+    bool WasLoadedFromCache() const { return m_cache_loaded; }
+
     /// Check if a specific method is fake.
     bool IsFakeMethod(const il2cpp::_internal::unity_structs::il2cppMethodInfo* method) const;
 
@@ -122,30 +134,58 @@ public:
 
     /// Get detection statistics.
     size_t GetTotalMethodsAnalyzed() const { return m_total_methods; }
-    size_t GetTotalFakeMethods() const { return m_fake_methods.size(); }
+    size_t GetTotalFakeMethods() const { return m_cache_loaded ? m_cached_fake_method_count : m_fake_methods.size(); }
     size_t GetTotalFakeClasses() const { return m_fake_class_count; }
-    size_t GetUniqueStubPointers() const { return m_stub_pointers.size(); }
+    size_t GetUniqueStubPointers() const { return m_cache_loaded ? m_cached_stub_rvas.Size() : m_stub_pointers.Size(); }
+    size_t GetConfirmedStubPatterns() const { return m_stub_patterns_confirmed; }
     size_t GetWhitelistedMethods() const { return m_whitelisted_methods; }
     size_t GetGenericSkipped() const { return m_generic_skipped; }
 
     /// Write the fake method report to a file (MDB/Dump/fake_methods.txt).
+    /// Formatting streams through a reused block buffer to an async writer
+    /// thread; method signatures are built here, not during Analyze().
+    /// Call from an il2cpp-attached thread.
     bool WriteFakeReport(const std::string& output_path) const;
 
     /// Get the set of fake method pointers (raw MethodInfo* addresses) for fast lookup.
-    const std::unordered_set<const void*>& GetFakeMethodSet() const { return m_fake_method_set; }
+    const FlatPointerSet& GetFakeMethodSet() const { return m_fake_method_set; }
 
     /// Get the set of entirely-fake class pointers for fast lookup.
-    const std::unordered_set<const void*>& GetFakeClassSet() const { return m_fake_class_set; }
+    const FlatPointerSet& GetFakeClassSet() const { return m_fake_class_set; }
 
 private:
-    // Phase 1: Collect all method pointers and count sharing
-    void CollectMethodPointers(il2cpp::_internal::unity_structs::il2cppAssembly** assemblies, size_t count);
+    // Per-method snapshot taken during the single metadata traversal.
+    // Name pointers are raw metadata strings owned by the il2cpp runtime.
+    struct MethodRecord {
+        const il2cpp::_internal::unity_structs::il2cppMethodInfo* method;
+        const char* name;
+        uintptr_t pointer;
+        bool in_vtable;
+    };
+
+    struct ClassRecord {
+        il2cpp::_internal::unity_structs::il2cppClass* klass;
+        const char* name_space;      // may be null
+        const char* name;
+        std::vector<MethodRecord> methods;
+    };
+
+    struct AssemblyRecord {
+        std::vector<ClassRecord> classes;
+    };
+
+    // Phase 1: single traversal over all assemblies — fills m_pointer_map,
+    // m_stub_pointers, and m_vtable_methods, and returns the per-assembly
+    // class/method snapshot the classification pass runs on, so each
+    // il2cppMethodInfo is touched exactly once.
+    std::vector<AssemblyRecord> CollectMetadata(il2cpp::_internal::unity_structs::il2cppAssembly** assemblies, size_t count);
 
-    // Phase 2: Build vtable whitelist
-    void BuildVTableWhitelist(il2cpp::_internal::unity_structs::il2cppAssembly** assemblies, size_t count);
+    // Phase 2: classify methods as real or fake from the collected snapshot
+    void ClassifyMethods(const std::vector<AssemblyRecord>& records);
 
-    // Phase 3: Classify methods as real or fake
-    void ClassifyMethods(il2cpp::_internal::unity_structs::il2cppAssembly** assemblies, size_t count);
+    // Cached-mode IsFakeMethod: re-derives the verdict for a live MethodInfo*
+    // from the persisted stub RVA set (see LoadAnalysisCache)
+    bool IsFakeMethodCached(const il2cpp::_internal::unity_structs::il2cppMethodInfo* method) const;
 
     // Check if a native function body matches known stub patterns
     bool IsStubPattern(uintptr_t address) const;
@@ -168,25 +208,37 @@ private:
 
     DetectorConfig m_config;
 
-    // methodPointer -> list of MethodInfo* that share it
-    std::unordered_map<uintptr_t, std::vector<const il2cpp::_internal::unity_structs::il2cppMethodInfo*>> m_pointer_map;
+    // methodPointer -> number of methods sharing it. Only the counts matter
+    // (stub identification, shared_count, report) — the individual MethodInfo*
+    // lists are never read, so storing counts keeps the table flat and small.
+    FlatPointerCountMap m_pointer_map;
 
     // Set of methodPointer addresses identified as stubs
-    std::unordered_set<uintptr_t> m_stub_pointers;
+    FlatPointerSet m_stub_pointers;
 
     // Set of MethodInfo* addresses in vtable slots (whitelist)
-    std::unordered_set<const void*> m_vtable_methods;
+    FlatPointerSet m_vtable_methods;
 
     // Results
     std::vector<FakeMethodInfo> m_fake_methods;
     std::vector<ClassAnalysis> m_class_analysis;
-    std::unordered_set<const void*> m_fake_method_set;   // Fast lookup by MethodInfo*
-    std::unordered_set<const void*> m_fake_class_set;    // Fast lookup by il2cppClass*
+    FlatPointerSet m_fake_method_set;   // Fast lookup by MethodInfo*
+    FlatPointerSet m_fake_class_set;    // Fast lookup by il2cppClass*
 
     size_t m_total_methods = 0;
     size_t m_whitelisted_methods = 0;
     size_t m_generic_skipped = 0;
     size_t m_fake_class_count = 0;
+    size_t m_stub_patterns_confirmed = 0;
+
+    // Persisted-analysis state. MethodInfo*/il2cppClass* addresses do not
+    // survive a relaunch, so a cache hit keeps the stub set as RVAs and the
+    // fake classes as names, and queries re-derive the verdict per call.
+    bool m_cache_loaded = false;
+    uintptr_t m_cached_ga_base = 0;
+    FlatPointerSet m_cached_stub_rvas;
+    std::unordered_set<std::string> m_cached_fake_class_names;
+    size_t m_cached_fake_method_count = 0;
 };
 
 } // namespace Obfuscation
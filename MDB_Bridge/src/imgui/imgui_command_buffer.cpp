@@ -0,0 +1,437 @@
+// ==============================
+// ImGui Command Buffer Implementation
+// ==============================
+// Replays serialized widget commands from managed mods into ImGui inside
+// the Present hook. See imgui_command_buffer.h for the wire protocol.
+
+#include "imgui_command_buffer.h"
+#include "imgui.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// 256 KB of commands per frame is thousands of widgets — plenty, while
+// keeping the submit memcpy trivially cheap
+constexpr size_t kCommandBufferCapacity = 256 * 1024;
+constexpr size_t kResultSlots = 1024;
+constexpr uint16_t kNoResult = 0xFFFF;
+
+struct CmdHeader {
+    uint16_t op;
+    uint16_t size;      // total bytes including this header, 4-byte aligned
+};
+
+// Fixed payloads (strings follow inline, NUL-terminated)
+struct BeginPayload       { uint16_t result; uint16_t pad; int32_t flags; };
+struct TextColorPayload   { float r, g, b, a; };
+struct ButtonPayload      { uint16_t result; uint16_t pad; float w, h; };
+struct ResultPayload      { uint16_t result; uint16_t pad; };
+struct CheckboxPayload    { uint16_t result; uint16_t pad; int32_t value; };
+struct SliderFloatPayload { uint16_t result; uint16_t pad; float value, min, max; };
+struct SliderIntPayload   { uint16_t result; uint16_t pad; int32_t value, min, max; };
+struct DragFloatPayload   { uint16_t result; uint16_t pad; float value, speed, min, max; };
+struct DragIntPayload     { uint16_t result; uint16_t pad; int32_t value; float speed; int32_t min, max; };
+struct SameLinePayload    { float offset, spacing; };
+struct FloatPayload       { float value; };
+struct IntPayload         { int32_t value; };
+struct Vec2CondPayload    { float x, y; int32_t cond; };
+struct StyleColorPayload  { int32_t idx; float r, g, b, a; };
+struct HeaderPayload      { uint16_t result; uint16_t pad; int32_t flags; };
+struct SelectablePayload  { uint16_t result; uint16_t pad; int32_t selected; int32_t flags; };
+struct BeginChildPayload  { uint16_t result; uint16_t pad; float w, h; int32_t child_flags; int32_t window_flags; };
+
+// Triple-buffer scheme: managed writes into g_write (stable pointer),
+// submit copies into g_pending under the mutex, the render thread swaps
+// g_pending into g_active and replays g_active lock-free every frame.
+std::mutex g_cmd_mutex;
+std::vector<uint8_t> g_write(kCommandBufferCapacity);
+std::vector<uint8_t> g_pending;
+bool g_pending_fresh = false;
+std::vector<uint8_t> g_active;
+
+// Lock-free "is there anything to draw" flag — read every frame by the
+// Present hook's idle fast path, so it must not take g_cmd_mutex
+std::atomic<bool> g_has_commands{ false };
+
+MdbImGuiCmdResult g_results[kResultSlots] = {};
+
+// Payload accessor with bounds check — returns null on a truncated command
+template <typename T>
+const T* CmdPayload(const uint8_t* cmd, size_t cmd_size) {
+    if (cmd_size < sizeof(CmdHeader) + sizeof(T)) return nullptr;
+    return reinterpret_cast<const T*>(cmd + sizeof(CmdHeader));
+}
+
+// Inline string after a fixed payload of size payload_bytes — must be
+// NUL-terminated inside the command record
+const char* CmdString(const uint8_t* cmd, size_t cmd_size, size_t payload_bytes) {
+    size_t offset = sizeof(CmdHeader) + payload_bytes;
+    if (offset >= cmd_size) return nullptr;
+    const char* str = reinterpret_cast<const char*>(cmd + offset);
+    if (!memchr(str, 0, cmd_size - offset)) return nullptr;
+    return str;
+}
+
+MdbImGuiCmdResult* ResultSlot(uint16_t slot) {
+    if (slot >= kResultSlots) return nullptr;   // covers kNoResult
+    return &g_results[slot];
+}
+
+void StoreResult(uint16_t slot, bool changed, float value_f, int32_t value_i) {
+    if (MdbImGuiCmdResult* result = ResultSlot(slot)) {
+        result->changed = changed ? 1 : 0;
+        result->value_f = value_f;
+        result->value_i = value_i;
+    }
+}
+
+// Skip forward past the TreePop matching an unexpanded TreeNode, honoring
+// nesting. Returns the offset of the first command after it.
+size_t SkipTreeNodeBody(const uint8_t* data, size_t size, size_t offset) {
+    int depth = 1;
+    while (offset + sizeof(CmdHeader) <= size) {
+        const CmdHeader* hdr = reinterpret_cast<const CmdHeader*>(data + offset);
+        if (hdr->size < sizeof(CmdHeader) || (hdr->size & 3) != 0 ||
+            offset + hdr->size > size) {
+            return size;    // malformed — abandon the rest of the buffer
+        }
+        if (hdr->op == MDB_IMCMD_TREE_NODE) {
+            depth++;
+        } else if (hdr->op == MDB_IMCMD_TREE_POP) {
+            if (--depth == 0) return offset + hdr->size;
+        }
+        offset += hdr->size;
+    }
+    return size;
+}
+
+} // anonymous namespace
+
+// ========== Managed-Facing Exports ==========
+
+MDB_IMGUI_API void* mdb_imgui_cmd_get_buffer(int32_t* capacity) {
+    if (capacity) *capacity = static_cast<int32_t>(kCommandBufferCapacity);
+    return g_write.data();
+}
+
+MDB_IMGUI_API void* mdb_imgui_cmd_get_results(int32_t* slot_count) {
+    if (slot_count) *slot_count = static_cast<int32_t>(kResultSlots);
+    return g_results;
+}
+
+MDB_IMGUI_API int32_t mdb_imgui_cmd_submit(int32_t bytes_used) {
+    if (bytes_used < 0 || static_cast<size_t>(bytes_used) > kCommandBufferCapacity) {
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(g_cmd_mutex);
+    g_pending.assign(g_write.data(), g_write.data() + bytes_used);
+    g_pending_fresh = true;
+    g_has_commands.store(bytes_used > 0, std::memory_order_release);
+    return 0;
+}
+
+MDB_IMGUI_API void mdb_imgui_cmd_clear() {
+    std::lock_guard<std::mutex> lock(g_cmd_mutex);
+    g_pending.clear();
+    g_pending_fresh = true;     // swaps an empty buffer in next frame
+    g_has_commands.store(false, std::memory_order_release);
+}
+
+// ========== Render-Thread Replay ==========
+
+namespace MDB {
+namespace ImGuiCmd {
+
+bool HasCommands() {
+    return g_has_commands.load(std::memory_order_relaxed);
+}
+
+void Replay() {
+    {
+        std::lock_guard<std::mutex> lock(g_cmd_mutex);
+        if (g_pending_fresh) {
+            g_active.swap(g_pending);
+            g_pending_fresh = false;
+        }
+    }
+    if (g_active.empty()) {
+        return;
+    }
+
+    const uint8_t* data = g_active.data();
+    const size_t size = g_active.size();
+
+    // Stack-balance bookkeeping: a malformed or truncated buffer must never
+    // leave ImGui's window/ID/style stacks unbalanced
+    int window_depth = 0;
+    int child_depth = 0;
+    int id_depth = 0;
+    int style_depth = 0;
+    int tree_depth = 0;
+    int disabled_depth = 0;
+
+    size_t offset = 0;
+    while (offset + sizeof(CmdHeader) <= size) {
+        const uint8_t* cmd = data + offset;
+        const CmdHeader* hdr = reinterpret_cast<const CmdHeader*>(cmd);
+        if (hdr->size < sizeof(CmdHeader) || (hdr->size & 3) != 0 ||
+            offset + hdr->size > size) {
+            break;      // malformed record — abandon the rest of the buffer
+        }
+        const size_t cmd_size = hdr->size;
+        offset += cmd_size;
+
+        switch (hdr->op) {
+            case MDB_IMCMD_BEGIN: {
+                auto* p = CmdPayload<BeginPayload>(cmd, cmd_size);
+                const char* name = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!name) break;
+                bool open = ImGui::Begin(name, nullptr, p->flags);
+                StoreResult(p->result, false, 0.0f, open ? 1 : 0);
+                window_depth++;     // End is required even when collapsed
+                break;
+            }
+            case MDB_IMCMD_END:
+                if (window_depth > 0) { ImGui::End(); window_depth--; }
+                break;
+
+            case MDB_IMCMD_TEXT: {
+                if (const char* text = CmdString(cmd, cmd_size, 0)) {
+                    ImGui::TextUnformatted(text);
+                }
+                break;
+            }
+            case MDB_IMCMD_TEXT_COLORED: {
+                auto* p = CmdPayload<TextColorPayload>(cmd, cmd_size);
+                const char* text = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (text) ImGui::TextColored(ImVec4(p->r, p->g, p->b, p->a), "%s", text);
+                break;
+            }
+            case MDB_IMCMD_TEXT_WRAPPED: {
+                if (const char* text = CmdString(cmd, cmd_size, 0)) {
+                    ImGui::TextWrapped("%s", text);
+                }
+                break;
+            }
+            case MDB_IMCMD_BULLET_TEXT: {
+                if (const char* text = CmdString(cmd, cmd_size, 0)) {
+                    ImGui::BulletText("%s", text);
+                }
+                break;
+            }
+
+            case MDB_IMCMD_BUTTON: {
+                auto* p = CmdPayload<ButtonPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool pressed = ImGui::Button(label, ImVec2(p->w, p->h));
+                StoreResult(p->result, pressed, 0.0f, pressed ? 1 : 0);
+                break;
+            }
+            case MDB_IMCMD_SMALL_BUTTON: {
+                auto* p = CmdPayload<ResultPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool pressed = ImGui::SmallButton(label);
+                StoreResult(p->result, pressed, 0.0f, pressed ? 1 : 0);
+                break;
+            }
+            case MDB_IMCMD_CHECKBOX: {
+                auto* p = CmdPayload<CheckboxPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool value = p->value != 0;
+                bool changed = ImGui::Checkbox(label, &value);
+                StoreResult(p->result, changed, 0.0f, value ? 1 : 0);
+                break;
+            }
+            case MDB_IMCMD_SLIDER_FLOAT: {
+                auto* p = CmdPayload<SliderFloatPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                float value = p->value;
+                bool changed = ImGui::SliderFloat(label, &value, p->min, p->max);
+                StoreResult(p->result, changed, value, 0);
+                break;
+            }
+            case MDB_IMCMD_SLIDER_INT: {
+                auto* p = CmdPayload<SliderIntPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                int value = p->value;
+                bool changed = ImGui::SliderInt(label, &value, p->min, p->max);
+                StoreResult(p->result, changed, 0.0f, value);
+                break;
+            }
+            case MDB_IMCMD_DRAG_FLOAT: {
+                auto* p = CmdPayload<DragFloatPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                float value = p->value;
+                bool changed = ImGui::DragFloat(label, &value, p->speed, p->min, p->max);
+                StoreResult(p->result, changed, value, 0);
+                break;
+            }
+            case MDB_IMCMD_DRAG_INT: {
+                auto* p = CmdPayload<DragIntPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                int value = p->value;
+                bool changed = ImGui::DragInt(label, &value, p->speed, p->min, p->max);
+                StoreResult(p->result, changed, 0.0f, value);
+                break;
+            }
+
+            case MDB_IMCMD_SEPARATOR:
+                ImGui::Separator();
+                break;
+            case MDB_IMCMD_SAME_LINE: {
+                auto* p = CmdPayload<SameLinePayload>(cmd, cmd_size);
+                if (p) ImGui::SameLine(p->offset, p->spacing);
+                break;
+            }
+            case MDB_IMCMD_SPACING:
+                ImGui::Spacing();
+                break;
+            case MDB_IMCMD_INDENT: {
+                auto* p = CmdPayload<FloatPayload>(cmd, cmd_size);
+                if (p) ImGui::Indent(p->value);
+                break;
+            }
+            case MDB_IMCMD_UNINDENT: {
+                auto* p = CmdPayload<FloatPayload>(cmd, cmd_size);
+                if (p) ImGui::Unindent(p->value);
+                break;
+            }
+            case MDB_IMCMD_SET_ITEM_WIDTH: {
+                auto* p = CmdPayload<FloatPayload>(cmd, cmd_size);
+                if (p) ImGui::SetNextItemWidth(p->value);
+                break;
+            }
+            case MDB_IMCMD_SET_WINDOW_POS: {
+                auto* p = CmdPayload<Vec2CondPayload>(cmd, cmd_size);
+                if (p) ImGui::SetNextWindowPos(ImVec2(p->x, p->y), p->cond);
+                break;
+            }
+            case MDB_IMCMD_SET_WINDOW_SIZE: {
+                auto* p = CmdPayload<Vec2CondPayload>(cmd, cmd_size);
+                if (p) ImGui::SetNextWindowSize(ImVec2(p->x, p->y), p->cond);
+                break;
+            }
+
+            case MDB_IMCMD_PUSH_ID_INT: {
+                auto* p = CmdPayload<IntPayload>(cmd, cmd_size);
+                if (p) { ImGui::PushID(p->value); id_depth++; }
+                break;
+            }
+            case MDB_IMCMD_PUSH_ID_STR: {
+                if (const char* id = CmdString(cmd, cmd_size, 0)) {
+                    ImGui::PushID(id);
+                    id_depth++;
+                }
+                break;
+            }
+            case MDB_IMCMD_POP_ID:
+                if (id_depth > 0) { ImGui::PopID(); id_depth--; }
+                break;
+
+            case MDB_IMCMD_PUSH_STYLE_COLOR: {
+                auto* p = CmdPayload<StyleColorPayload>(cmd, cmd_size);
+                if (p && p->idx >= 0 && p->idx < ImGuiCol_COUNT) {
+                    ImGui::PushStyleColor(p->idx, ImVec4(p->r, p->g, p->b, p->a));
+                    style_depth++;
+                }
+                break;
+            }
+            case MDB_IMCMD_POP_STYLE_COLOR: {
+                auto* p = CmdPayload<IntPayload>(cmd, cmd_size);
+                if (p) {
+                    int count = p->value;
+                    if (count > style_depth) count = style_depth;
+                    if (count > 0) { ImGui::PopStyleColor(count); style_depth -= count; }
+                }
+                break;
+            }
+
+            case MDB_IMCMD_COLLAPSING_HEADER: {
+                auto* p = CmdPayload<HeaderPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool open = ImGui::CollapsingHeader(label, p->flags);
+                StoreResult(p->result, false, 0.0f, open ? 1 : 0);
+                break;
+            }
+            case MDB_IMCMD_TREE_NODE: {
+                auto* p = CmdPayload<ResultPayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool open = ImGui::TreeNode(label);
+                StoreResult(p->result, false, 0.0f, open ? 1 : 0);
+                if (open) {
+                    tree_depth++;
+                } else {
+                    // The open/closed verdict is known here, not when the
+                    // buffer was built — skip the node's body and TreePop
+                    offset = SkipTreeNodeBody(data, size, offset);
+                }
+                break;
+            }
+            case MDB_IMCMD_TREE_POP:
+                if (tree_depth > 0) { ImGui::TreePop(); tree_depth--; }
+                break;
+
+            case MDB_IMCMD_SELECTABLE: {
+                auto* p = CmdPayload<SelectablePayload>(cmd, cmd_size);
+                const char* label = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!label) break;
+                bool pressed = ImGui::Selectable(label, p->selected != 0, p->flags);
+                StoreResult(p->result, pressed, 0.0f, pressed ? 1 : 0);
+                break;
+            }
+
+            case MDB_IMCMD_BEGIN_CHILD: {
+                auto* p = CmdPayload<BeginChildPayload>(cmd, cmd_size);
+                const char* id = p ? CmdString(cmd, cmd_size, sizeof(*p)) : nullptr;
+                if (!id) break;
+                bool open = ImGui::BeginChild(id, ImVec2(p->w, p->h),
+                                              p->child_flags, p->window_flags);
+                StoreResult(p->result, false, 0.0f, open ? 1 : 0);
+                child_depth++;      // EndChild is required even when clipped
+                break;
+            }
+            case MDB_IMCMD_END_CHILD:
+                if (child_depth > 0) { ImGui::EndChild(); child_depth--; }
+                break;
+
+            case MDB_IMCMD_BEGIN_DISABLED: {
+                auto* p = CmdPayload<IntPayload>(cmd, cmd_size);
+                if (p) { ImGui::BeginDisabled(p->value != 0); disabled_depth++; }
+                break;
+            }
+            case MDB_IMCMD_END_DISABLED:
+                if (disabled_depth > 0) { ImGui::EndDisabled(); disabled_depth--; }
+                break;
+
+            default:
+                // Unknown opcode — skip it (forward compatibility)
+                break;
+        }
+    }
+
+    // Repair any unbalanced stacks so a buggy buffer cannot trip ImGui
+    // asserts or corrupt the frame — innermost scopes first
+    while (tree_depth > 0)     { ImGui::TreePop(); tree_depth--; }
+    while (disabled_depth > 0) { ImGui::EndDisabled(); disabled_depth--; }
+    if (style_depth > 0)       { ImGui::PopStyleColor(style_depth); style_depth = 0; }
+    while (id_depth > 0)       { ImGui::PopID(); id_depth--; }
+    while (child_depth > 0)    { ImGui::EndChild(); child_depth--; }
+    while (window_depth > 0)   { ImGui::End(); window_depth--; }
+}
+
+} // namespace ImGuiCmd
+} // namespace MDB
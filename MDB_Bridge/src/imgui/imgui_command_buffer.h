@@ -0,0 +1,125 @@
+// ==============================
+// ImGui Command Buffer for MDB_Bridge
+// ==============================
+// Batched widget submission: instead of one P/Invoke per igButton/igText/
+// igSlider* call (thousands of managed→native transitions per frame for
+// UI-heavy mods), managed code serializes widget commands into a shared
+// native buffer and the Present hook replays the whole buffer into ImGui
+// in one tight native loop.
+//
+// Protocol (managed side):
+//   1. mdb_imgui_cmd_get_buffer/get_results once — both pointers are stable
+//      for the process lifetime, so C# writes commands and reads results
+//      with unsafe code and zero transitions.
+//   2. Serialize commands: { uint16 op; uint16 size; payload } records,
+//      size = total bytes including the 4-byte header, 4-byte aligned.
+//      Strings are inline UTF-8, NUL-terminated, after the fixed payload.
+//   3. One mdb_imgui_cmd_submit(bytes_used) per rebuilt frame.
+//
+// The hook replays the most recent submission every frame until a new one
+// arrives. Interactive results (button pressed, slider value, window open)
+// land in the result slot named by each command and are read by managed
+// code one frame later — the standard latency trade for buffered UI.
+
+#pragma once
+
+#include <cstdint>
+
+// Export macro (matches imgui_integration.h)
+#ifndef MDB_IMGUI_API
+#ifdef MDB_BRIDGE_EXPORTS
+#define MDB_IMGUI_API __declspec(dllexport)
+#else
+#define MDB_IMGUI_API __declspec(dllimport)
+#endif
+#endif
+
+// ========== Command Opcodes ==========
+// Explicit values — this is an ABI contract with the managed writer.
+
+enum MdbImGuiCmdOp : uint16_t {
+    MDB_IMCMD_INVALID          = 0,
+    MDB_IMCMD_BEGIN            = 1,   // BeginPayload + name
+    MDB_IMCMD_END              = 2,
+    MDB_IMCMD_TEXT             = 3,   // text
+    MDB_IMCMD_TEXT_COLORED     = 4,   // TextColorPayload + text
+    MDB_IMCMD_TEXT_WRAPPED     = 5,   // text
+    MDB_IMCMD_BUTTON           = 6,   // ButtonPayload + label
+    MDB_IMCMD_SMALL_BUTTON     = 7,   // ResultPayload + label
+    MDB_IMCMD_CHECKBOX         = 8,   // CheckboxPayload + label
+    MDB_IMCMD_SLIDER_FLOAT     = 9,   // SliderFloatPayload + label
+    MDB_IMCMD_SLIDER_INT       = 10,  // SliderIntPayload + label
+    MDB_IMCMD_DRAG_FLOAT       = 11,  // DragFloatPayload + label
+    MDB_IMCMD_DRAG_INT         = 12,  // DragIntPayload + label
+    MDB_IMCMD_SEPARATOR        = 13,
+    MDB_IMCMD_SAME_LINE        = 14,  // SameLinePayload
+    MDB_IMCMD_SPACING          = 15,
+    MDB_IMCMD_INDENT           = 16,  // FloatPayload
+    MDB_IMCMD_UNINDENT         = 17,  // FloatPayload
+    MDB_IMCMD_SET_ITEM_WIDTH   = 18,  // FloatPayload (SetNextItemWidth)
+    MDB_IMCMD_SET_WINDOW_POS   = 19,  // Vec2CondPayload (SetNextWindowPos)
+    MDB_IMCMD_SET_WINDOW_SIZE  = 20,  // Vec2CondPayload (SetNextWindowSize)
+    MDB_IMCMD_PUSH_ID_INT      = 21,  // IntPayload
+    MDB_IMCMD_PUSH_ID_STR      = 22,  // id string
+    MDB_IMCMD_POP_ID           = 23,
+    MDB_IMCMD_PUSH_STYLE_COLOR = 24,  // StyleColorPayload
+    MDB_IMCMD_POP_STYLE_COLOR  = 25,  // IntPayload (count)
+    MDB_IMCMD_COLLAPSING_HEADER= 26,  // HeaderPayload + label
+    MDB_IMCMD_TREE_NODE        = 27,  // ResultPayload + label
+    MDB_IMCMD_TREE_POP         = 28,
+    MDB_IMCMD_SELECTABLE       = 29,  // SelectablePayload + label
+    MDB_IMCMD_BEGIN_CHILD      = 30,  // BeginChildPayload + id
+    MDB_IMCMD_END_CHILD        = 31,
+    MDB_IMCMD_BEGIN_DISABLED   = 32,  // IntPayload
+    MDB_IMCMD_END_DISABLED     = 33,
+    MDB_IMCMD_BULLET_TEXT      = 34,  // text
+};
+
+// ========== Result Slots ==========
+// One slot per interactive command, indexed by the uint16 result field
+// (0xFFFF = no result wanted). Written during replay on the render thread,
+// read directly by managed code the following frame.
+
+struct MdbImGuiCmdResult {
+    int32_t changed;    // 1 when the widget was pressed/edited this frame
+    float value_f;      // latest float value (sliders, drags)
+    int32_t value_i;    // latest int/bool value (checkbox, int widgets, open)
+    int32_t reserved;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stable pointer to the command write buffer; *capacity receives its size
+// in bytes. Managed code writes commands here between submits.
+MDB_IMGUI_API void* mdb_imgui_cmd_get_buffer(int32_t* capacity);
+
+// Stable pointer to the MdbImGuiCmdResult slot array; *slot_count receives
+// the number of slots.
+MDB_IMGUI_API void* mdb_imgui_cmd_get_results(int32_t* slot_count);
+
+// Publish the first bytes_used bytes of the write buffer as the new frame.
+// Returns 0 on success, -1 when bytes_used is out of range.
+MDB_IMGUI_API int32_t mdb_imgui_cmd_submit(int32_t bytes_used);
+
+// Stop replaying — clears the pending and active buffers.
+MDB_IMGUI_API void mdb_imgui_cmd_clear();
+
+#ifdef __cplusplus
+} // extern "C"
+
+// Render-thread entry points for the Present hook (not exported)
+namespace MDB {
+namespace ImGuiCmd {
+
+// Whether a submitted buffer exists (draws should happen this frame)
+bool HasCommands();
+
+// Replay the most recent submission into ImGui. Call between
+// ImGui::NewFrame() and ImGui::Render().
+void Replay();
+
+} // namespace ImGuiCmd
+} // namespace MDB
+#endif // __cplusplus
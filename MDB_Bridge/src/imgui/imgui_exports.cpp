@@ -7,6 +7,11 @@
 #include "imgui_exports.h"
 #include "imgui.h"
 
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 // ===== Windows =====
 
 IMGUI_EXPORT bool igBegin(const char* name, bool* p_open, ImGuiWindowFlags flags)
@@ -437,6 +442,50 @@ IMGUI_EXPORT void ImDrawList_AddText(ImDrawList* self, ImVec2 pos, ImU32 col, co
     if (self) self->AddText(pos, col, text_begin, text_end);
 }
 
+// ===== DrawList (Bulk Geometry) =====
+// One P/Invoke per primitive is the dominant cost for ESP-style mods
+// drawing thousands of lines/rects per frame. These variants append a
+// whole pinned managed array in a single transition; the loop runs
+// natively against the ImDrawList.
+
+IMGUI_EXPORT void mdb_imgui_drawlist_add_lines(ImDrawList* self, const float* points, int line_count, ImU32 col, float thickness)
+{
+    // points: 4 floats per line (x1, y1, x2, y2)
+    if (!self || !points || line_count <= 0) return;
+    for (int i = 0; i < line_count; i++) {
+        const float* p = points + i * 4;
+        self->AddLine(ImVec2(p[0], p[1]), ImVec2(p[2], p[3]), col, thickness);
+    }
+}
+
+IMGUI_EXPORT void mdb_imgui_drawlist_add_polyline(ImDrawList* self, const float* points, int point_count, ImU32 col, int flags, float thickness)
+{
+    // points: 2 floats per vertex; ImVec2 is two packed floats, so the
+    // managed array aliases directly with no copy
+    if (!self || !points || point_count < 2) return;
+    self->AddPolyline(reinterpret_cast<const ImVec2*>(points), point_count, col, (ImDrawFlags)flags, thickness);
+}
+
+IMGUI_EXPORT void mdb_imgui_drawlist_add_rects(ImDrawList* self, const float* rects, int rect_count, ImU32 col, float rounding, float thickness)
+{
+    // rects: 4 floats per rect (min_x, min_y, max_x, max_y)
+    if (!self || !rects || rect_count <= 0) return;
+    for (int i = 0; i < rect_count; i++) {
+        const float* r = rects + i * 4;
+        self->AddRect(ImVec2(r[0], r[1]), ImVec2(r[2], r[3]), col, rounding, 0, thickness);
+    }
+}
+
+IMGUI_EXPORT void mdb_imgui_drawlist_add_rects_filled(ImDrawList* self, const float* rects, int rect_count, ImU32 col, float rounding)
+{
+    // rects: 4 floats per rect (min_x, min_y, max_x, max_y)
+    if (!self || !rects || rect_count <= 0) return;
+    for (int i = 0; i < rect_count; i++) {
+        const float* r = rects + i * 4;
+        self->AddRectFilled(ImVec2(r[0], r[1]), ImVec2(r[2], r[3]), col, rounding);
+    }
+}
+
 // ===== Layout Utilities =====
 
 IMGUI_EXPORT void igCalcTextSize(ImVec2* out, const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -480,6 +529,51 @@ IMGUI_EXPORT void igGetContentRegionAvail(ImVec2* out)
     if (out) *out = ImGui::GetContentRegionAvail();
 }
 
+// ===== Interned Labels =====
+// UI mods re-encode and re-marshal the same constant labels ("Health",
+// "Teleport", window titles) on every widget call, every frame. Interning
+// registers a label once: the handle maps to a const char* that stays
+// valid for the process lifetime, so managed code resolves it a single
+// time and passes the raw pointer straight to any ig* export from then on
+// — zero per-frame UTF-8 encoding or copying for constant strings.
+
+namespace {
+
+std::mutex g_internMutex;
+std::deque<std::string> g_internedLabels;             // deque: element addresses never move
+std::unordered_map<std::string, int> g_internHandles; // label -> 1-based handle
+
+} // anonymous namespace
+
+IMGUI_EXPORT int mdb_imgui_intern_label(const char* utf8_label)
+{
+    if (!utf8_label) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(g_internMutex);
+
+    auto it = g_internHandles.find(utf8_label);
+    if (it != g_internHandles.end()) {
+        return it->second;
+    }
+
+    g_internedLabels.emplace_back(utf8_label);
+    int handle = static_cast<int>(g_internedLabels.size());
+    g_internHandles.emplace(g_internedLabels.back(), handle);
+    return handle;
+}
+
+IMGUI_EXPORT const char* mdb_imgui_intern_resolve(int handle)
+{
+    std::lock_guard<std::mutex> lock(g_internMutex);
+
+    if (handle < 1 || handle > static_cast<int>(g_internedLabels.size())) {
+        return nullptr;
+    }
+    return g_internedLabels[static_cast<size_t>(handle) - 1].c_str();
+}
+
 // ===== Tab Bar =====
 IMGUI_EXPORT bool igBeginTabBar(const char* str_id, int flags)
 {
@@ -137,6 +137,15 @@ IMGUI_EXPORT void ImDrawList_AddCircle(ImDrawList* self, ImVec2 center, float ra
 IMGUI_EXPORT void ImDrawList_AddCircleFilled(ImDrawList* self, ImVec2 center, float radius, ImU32 col, int num_segments);
 IMGUI_EXPORT void ImDrawList_AddText(ImDrawList* self, ImVec2 pos, ImU32 col, const char* text_begin, const char* text_end);
 
+// ===== DrawList (Bulk Geometry) =====
+// Batched variants: append a whole pinned managed array of primitives in
+// one P/Invoke. Layouts: lines = 4 floats per line (x1,y1,x2,y2),
+// polyline = 2 floats per vertex, rects = 4 floats (min_x,min_y,max_x,max_y).
+IMGUI_EXPORT void mdb_imgui_drawlist_add_lines(ImDrawList* self, const float* points, int line_count, ImU32 col, float thickness);
+IMGUI_EXPORT void mdb_imgui_drawlist_add_polyline(ImDrawList* self, const float* points, int point_count, ImU32 col, int flags, float thickness);
+IMGUI_EXPORT void mdb_imgui_drawlist_add_rects(ImDrawList* self, const float* rects, int rect_count, ImU32 col, float rounding, float thickness);
+IMGUI_EXPORT void mdb_imgui_drawlist_add_rects_filled(ImDrawList* self, const float* rects, int rect_count, ImU32 col, float rounding);
+
 // ===== Layout Utilities =====
 IMGUI_EXPORT void igCalcTextSize(ImVec2* out, const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width);
 IMGUI_EXPORT float igGetCursorPosX();
@@ -150,6 +159,15 @@ IMGUI_EXPORT void igGetContentRegionAvail(ImVec2* out);
 IMGUI_EXPORT void igBeginDisabled(bool disabled);
 IMGUI_EXPORT void igEndDisabled();
 
+// ===== Interned Labels =====
+// Register a constant UTF-8 label once; returns a handle (>0), 0 on
+// failure. Interning the same string twice returns the same handle.
+IMGUI_EXPORT int mdb_imgui_intern_label(const char* utf8_label);
+// Resolve a handle to its cached label. The pointer is stable for the
+// process lifetime — managed code caches it and passes it directly to
+// any ig* export, skipping per-call string marshaling.
+IMGUI_EXPORT const char* mdb_imgui_intern_resolve(int handle);
+
 // ===== Tab Bar =====
 IMGUI_EXPORT bool igBeginTabBar(const char* str_id, int flags);
 IMGUI_EXPORT void igEndTabBar();
@@ -4,20 +4,42 @@
 // Auto-detects DirectX version and provides ImGui rendering hooks.
 
 #include "imgui_integration.h"
+#include "imgui_command_buffer.h"
+#include "core/config.hpp"
+#include "core/etw_provider.hpp"
+#include "core/event_ring.hpp"
 #include "core/mdb_log.h"
+#include "core/startup_trace.hpp"
 #include <MinHook.h>
 
+// Forward-declare from bridge_exports.h (can't include directly due to
+// enum redefinition with imgui_integration.h)
+extern "C" int mdb_command_buffer_flush();
+extern "C" int mdb_frame_tasks_drain();
+
+// Mirrors MdbExportStat in bridge_exports.h
+struct MdbExportStat {
+    const char* name;
+    unsigned long long calls;
+    unsigned long long cycles;
+};
+extern "C" void mdb_export_stats_set_enabled(bool enabled);
+extern "C" void mdb_export_stats_reset();
+extern "C" int mdb_get_export_stats(MdbExportStat* out_stats, int cap);
+
 // ImGui headers
 #include "imgui.h"
 #include "imgui_impl_win32.h"
 #include "imgui_impl_dx11.h"
-// #include "imgui_impl_dx12.h"  // Add DX12 support later
+#include "imgui_impl_dx12.h"
 
 #include <mutex>
 #include <atomic>
+#include <memory>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <cstdio>
 
 // ========== HRESULT Helper ==========
 
@@ -63,6 +85,12 @@ std::atomic<bool> g_shutting_down{ false };
 std::atomic<int> g_toggleKey{ VK_F2 };
 bool g_toggleKeyWasDown = false;
 
+// Export statistics debug panel
+std::atomic<bool> g_showStatsPanel{ false };
+
+// Frame cost debug panel
+std::atomic<bool> g_showFrameStatsPanel{ false };
+
 // ========== Multi-Callback System ==========
 
 struct ImGuiCallbackInfo {
@@ -73,25 +101,97 @@ struct ImGuiCallbackInfo {
     bool enabled;
 };
 
-// Vector of registered callbacks sorted by priority
+// Vector of registered callbacks sorted by priority (registration-side
+// registry; the render path never touches it — see g_callbackSnapshot)
 std::vector<ImGuiCallbackInfo> g_callbacks;
 std::mutex g_callbackMutex;
 std::atomic<int> g_nextCallbackId{ 1 };
 
+// Immutable snapshot of what the render thread should invoke this frame:
+// legacy callback first, then enabled callbacks in priority order. Rebuilt
+// at registration time (rare) and swapped in atomically, so the Present
+// hook walks a stable array without taking g_callbackMutex.
+std::shared_ptr<const std::vector<ImGuiCallbackInfo>> g_callbackSnapshot;
+
 // Legacy single callback for backwards compatibility
 MdbImGuiDrawCallback g_legacyCallback = nullptr;
 
+// Mirror of "any draw callback registered?" readable without the mutex.
+// The Present hook checks this every frame on its idle fast path, so
+// registration sites keep it in sync (always while holding g_callbackMutex).
+std::atomic<bool> g_hasDrawCallbacks{ false };
+
+// Recompute g_hasDrawCallbacks — caller must hold g_callbackMutex
+void RefreshHasDrawCallbacks() {
+    g_hasDrawCallbacks.store(g_legacyCallback != nullptr || !g_callbacks.empty(),
+                             std::memory_order_relaxed);
+}
+
+// Rebuild and publish the render-thread snapshot — caller must hold
+// g_callbackMutex. g_callbacks is already priority-sorted at this point.
+void RebuildCallbackSnapshot() {
+    auto snap = std::make_shared<std::vector<ImGuiCallbackInfo>>();
+    snap->reserve(g_callbacks.size() + 1);
+
+    if (g_legacyCallback) {
+        ImGuiCallbackInfo legacy;
+        legacy.id = 0;
+        legacy.name = "legacy";
+        legacy.callback = g_legacyCallback;
+        legacy.priority = 0;
+        legacy.enabled = true;
+        snap->push_back(legacy);
+    }
+
+    for (const auto& info : g_callbacks) {
+        if (info.enabled && info.callback) {
+            snap->push_back(info);
+        }
+    }
+
+    std::atomic_store(&g_callbackSnapshot,
+        std::shared_ptr<const std::vector<ImGuiCallbackInfo>>(std::move(snap)));
+}
+
 // DX11 state
 ID3D11Device* g_pd3dDevice11 = nullptr;
 ID3D11DeviceContext* g_pd3dDeviceContext = nullptr;
 IDXGISwapChain* g_pSwapChain = nullptr;
 ID3D11RenderTargetView* g_mainRenderTargetView = nullptr;
 
-// DX12 state
+// DX12 state. The overlay keeps one command allocator per swapchain
+// backbuffer and pipelines them with a fence: an allocator is only reset
+// once the GPU has retired the frame that last used it, and with the
+// swapchain's own backpressure ahead of that check the wait is normally
+// zero — no mid-frame synchronization on the steady path.
 ID3D12Device* g_pd3dDevice12 = nullptr;
-ID3D12CommandQueue* g_pCommandQueue = nullptr;
+ID3D12CommandQueue* g_pCommandQueue = nullptr;  // captured from ExecuteCommandLists
 ID3D12DescriptorHeap* g_pd3dSrvDescHeap = nullptr;
-// DX12 requires more complex setup - defer for now
+ID3D12DescriptorHeap* g_pd3dRtvDescHeap12 = nullptr;
+ID3D12GraphicsCommandList* g_pCommandList12 = nullptr;
+ID3D12Fence* g_fence12 = nullptr;
+HANDLE g_fenceEvent12 = nullptr;
+UINT64 g_fenceLastSignaled12 = 0;
+IDXGISwapChain3* g_pSwapChain3 = nullptr;
+
+struct FrameContext12 {
+    ID3D12CommandAllocator* allocator = nullptr;
+    ID3D12Resource* backBuffer = nullptr;
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle{};
+    UINT64 fenceValue = 0;  // fence value signaled after this context's last use
+};
+
+constexpr UINT kMaxBackBuffers12 = 8;
+FrameContext12 g_frameContexts12[kMaxBackBuffers12];
+UINT g_numFrames12 = 0;
+
+// Shader-visible SRV heap shared with the ImGui backend; descriptors are
+// handed out through a small index free-list (the backend allocates one
+// per texture — the font atlas plus any dynamic atlas pages)
+constexpr int kSrvHeapSize12 = 64;
+UINT g_srvDescriptorSize12 = 0;
+int g_srvFreeList12[kSrvHeapSize12];
+int g_srvFreeCount12 = 0;
 
 // Window handle
 HWND g_hWnd = nullptr;
@@ -101,31 +201,207 @@ WNDPROC g_originalWndProc = nullptr;
 typedef HRESULT(WINAPI* PFN_Present)(IDXGISwapChain*, UINT, UINT);
 PFN_Present g_originalPresent = nullptr;
 
+typedef HRESULT(WINAPI* PFN_ResizeBuffers)(IDXGISwapChain*, UINT, UINT, UINT, DXGI_FORMAT, UINT);
+PFN_ResizeBuffers g_originalResizeBuffers = nullptr;
+
+// Cached backbuffer dimensions — lets the Present hook detect a resize
+// that slipped past the ResizeBuffers hook (some engines recreate the
+// swapchain instead of resizing it)
+UINT g_backBufferWidth = 0;
+UINT g_backBufferHeight = 0;
+
 typedef void(WINAPI* PFN_ExecuteCommandLists)(ID3D12CommandQueue*, UINT, ID3D12CommandList* const*);
 PFN_ExecuteCommandLists g_originalExecuteCommandLists = nullptr;
 
-// Helper: Invoke all registered callbacks
+// ========== Frame Cost Profiling ==========
+
+// Rolling window of per-frame costs — a couple of seconds at 144 fps,
+// small enough that percentile queries stay cheap
+constexpr int kFrameCostSamples = 240;
+
+struct FrameCostTracker {
+    float samples_ms[kFrameCostSamples] = {};
+    int count = 0;      // valid samples
+    int next = 0;       // ring cursor
+    float last_ms = 0.0f;
+
+    void Add(float ms) {
+        last_ms = ms;
+        samples_ms[next] = ms;
+        next = (next + 1) % kFrameCostSamples;
+        if (count < kFrameCostSamples) {
+            count++;
+        }
+    }
+
+    float Percentile(float p) const {
+        if (count == 0) {
+            return 0.0f;
+        }
+        float work[kFrameCostSamples];
+        std::copy(samples_ms, samples_ms + count, work);
+        int idx = static_cast<int>(p * (count - 1) + 0.5f);
+        std::nth_element(work, work + idx, work + count);
+        return work[idx];
+    }
+};
+
+struct CallbackCost {
+    int id;
+    std::string name;
+    FrameCostTracker tracker;
+};
+
+// All trackers share one mutex: the render thread records once per
+// callback per frame, mdb_imgui_get_frame_stats reads from managed code
+std::mutex g_frameStatsMutex;
+std::vector<CallbackCost> g_callbackCosts;
+FrameCostTracker g_renderCost;   // ImGui::Render + draw-data submit
+FrameCostTracker g_replayCost;   // command buffer replay
+
+LONGLONG QpcNow() {
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return t.QuadPart;
+}
+
+float QpcToMs(LONGLONG ticks) {
+    static LONGLONG freq = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return f.QuadPart;
+    }();
+    return static_cast<float>(ticks * 1000.0 / freq);
+}
+
+// Record one callback's cost for this frame — creates the tracker row the
+// first time an id is seen
+void RecordCallbackCost(int id, const std::string& name, float ms) {
+    std::lock_guard<std::mutex> lock(g_frameStatsMutex);
+    for (auto& cost : g_callbackCosts) {
+        if (cost.id == id) {
+            cost.tracker.Add(ms);
+            return;
+        }
+    }
+    CallbackCost cost;
+    cost.id = id;
+    cost.name = name;
+    cost.tracker.Add(ms);
+    g_callbackCosts.push_back(std::move(cost));
+}
+
+// Helper: Invoke all registered callbacks.
+// Lock-free: grabs the current immutable snapshot and walks it. A
+// registration racing with this frame simply lands in the next snapshot.
 void InvokeAllCallbacks() {
-    std::lock_guard<std::mutex> lock(g_callbackMutex);
-    
-    // Invoke legacy callback first (if any)
-    if (g_legacyCallback) {
+    auto snap = std::atomic_load(&g_callbackSnapshot);
+    if (!snap) {
+        return;
+    }
+
+    // Snapshot order is legacy first, then priority order
+    for (const auto& info : *snap) {
+        LONGLONG start = QpcNow();
         try {
-            g_legacyCallback();
+            info.callback();
         } catch (...) {
             // Silently ignore callback errors
         }
+        RecordCallbackCost(info.id, info.name, QpcToMs(QpcNow() - start));
     }
-    
-    // Invoke all registered callbacks in priority order
-    for (const auto& info : g_callbacks) {
-        if (info.enabled && info.callback) {
-            try {
-                info.callback();
-            } catch (...) {
-                // Silently ignore callback errors
-            }
+}
+
+// Helper: Draw the export statistics debug panel
+void RenderExportStatsPanel() {
+    static MdbExportStat stats[128];
+    int count = mdb_get_export_stats(stats, 128);
+
+    // Sort by accumulated cycles so the dominant exports are on top
+    std::sort(stats, stats + count,
+        [](const MdbExportStat& a, const MdbExportStat& b) {
+            return a.cycles > b.cycles;
+        });
+
+    ImGui::SetNextWindowSize(ImVec2(480, 320), ImGuiCond_FirstUseEver);
+    bool open = true;
+    ImGui::Begin("MDB Export Stats", &open);
+
+    if (ImGui::Button("Reset")) {
+        mdb_export_stats_reset();
+    }
+    ImGui::SameLine();
+    ImGui::Text("%d instrumented exports", count);
+
+    if (ImGui::BeginTable("export_stats", 4,
+            ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
+        ImGui::TableSetupColumn("Export");
+        ImGui::TableSetupColumn("Calls");
+        ImGui::TableSetupColumn("Mcycles");
+        ImGui::TableSetupColumn("Cycles/call");
+        ImGui::TableHeadersRow();
+
+        for (int i = 0; i < count; i++) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(stats[i].name ? stats[i].name : "?");
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%llu", stats[i].calls);
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.2f", stats[i].cycles / 1000000.0);
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%llu", stats[i].calls ? stats[i].cycles / stats[i].calls : 0ull);
         }
+
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+
+    if (!open) {
+        g_showStatsPanel.store(false);
+        mdb_export_stats_set_enabled(false);
+    }
+}
+
+// Helper: Draw the per-callback frame cost panel
+void RenderFrameStatsPanel() {
+    static MdbImGuiFrameStat stats[64];
+    int count = mdb_imgui_get_frame_stats(stats, 64);
+
+    ImGui::SetNextWindowSize(ImVec2(420, 240), ImGuiCond_FirstUseEver);
+    bool open = true;
+    ImGui::Begin("MDB Frame Stats", &open);
+
+    ImGui::Text("Per-frame overlay cost (rolling %d frames)", kFrameCostSamples);
+
+    if (ImGui::BeginTable("frame_stats", 4,
+            ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
+        ImGui::TableSetupColumn("Callback");
+        ImGui::TableSetupColumn("Last ms");
+        ImGui::TableSetupColumn("p50 ms");
+        ImGui::TableSetupColumn("p99 ms");
+        ImGui::TableHeadersRow();
+
+        for (int i = 0; i < count; i++) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(stats[i].name);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%.3f", stats[i].last_ms);
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.3f", stats[i].p50_ms);
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.3f", stats[i].p99_ms);
+        }
+
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+
+    if (!open) {
+        g_showFrameStatsPanel.store(false);
     }
 }
 
@@ -145,6 +421,14 @@ bool CreateRenderTarget11() {
         return false;
     }
     HRESULT hr = g_pd3dDevice11->CreateRenderTargetView(pBackBuffer, nullptr, &g_mainRenderTargetView);
+
+    // Remember the size this RTV was created for so the Present hook can
+    // spot a stale view without re-querying the backbuffer every frame
+    D3D11_TEXTURE2D_DESC texDesc;
+    pBackBuffer->GetDesc(&texDesc);
+    g_backBufferWidth = texDesc.Width;
+    g_backBufferHeight = texDesc.Height;
+
     pBackBuffer->Release();
     return SUCCEEDED(hr);
 }
@@ -160,6 +444,16 @@ void CleanupRenderTarget11() {
 
 LRESULT WINAPI HookedWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
 
+    // Fast path: overlay input inactive. Only plain key messages can carry
+    // the toggle key (the only thing we still care about), so the high-rate
+    // traffic — WM_MOUSEMOVE, WM_INPUT, WM_NCHITTEST — tail-calls the
+    // game's proc after one relaxed load and two compares. Input latency
+    // is sacred; the overlay must cost nothing while hidden.
+    if (!g_inputEnabled.load(std::memory_order_relaxed)
+        && msg != WM_KEYDOWN && msg != WM_KEYUP) {
+        return CallWindowProcW(g_originalWndProc, hWnd, msg, wParam, lParam);
+    }
+
     // Handle toggle key
     if (msg == WM_KEYDOWN && wParam == static_cast<WPARAM>(g_toggleKey.load())) {
         if (!g_toggleKeyWasDown) {
@@ -193,6 +487,200 @@ LRESULT WINAPI HookedWndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
     return CallWindowProcW(g_originalWndProc, hWnd, msg, wParam, lParam);
 }
 
+// ========== Frame Hitch Detector ==========
+// Measures the Present-to-Present interval and, when a frame blows past the
+// threshold, appends a correlation record to MDB\Logs\hitches.log: the
+// per-kind bridge activity counter deltas for that frame plus the labeled
+// events from the activity ring that fell inside its window. Answers "was
+// MDB doing anything during that stutter?" without attaching a profiler.
+// The file write happens on a frame that already missed its deadline, and
+// records are rate-limited so a sustained stall doesn't firehose the log.
+
+// Threshold in ms; MDB_HITCH_THRESHOLD_MS overrides mdb_config.ini's
+// [overlay] hitch_threshold_ms, <= 0 disables
+static float HitchThresholdMs() {
+    static float threshold = [] {
+        char buf[32];
+        DWORD len = GetEnvironmentVariableA("MDB_HITCH_THRESHOLD_MS", buf, sizeof(buf));
+        if (len > 0 && len < sizeof(buf)) {
+            return static_cast<float>(atof(buf));
+        }
+        return MDB::Config::Get().hitch_threshold_ms;
+    }();
+    return threshold;
+}
+
+// Lazily opened append handle; nullptr after a failed open means disabled
+static FILE* HitchLogFile() {
+    static FILE* file = [] () -> FILE* {
+        wchar_t path[MAX_PATH];
+        if (!GetModuleFileNameW(nullptr, path, MAX_PATH)) {
+            return nullptr;
+        }
+        wchar_t* slash = wcsrchr(path, L'\\');
+        if (!slash) {
+            return nullptr;
+        }
+        *slash = L'\0';
+        wchar_t full[MAX_PATH];
+        _snwprintf_s(full, _TRUNCATE, L"%s\\MDB\\Logs\\hitches.log", path);
+        return _wfopen(full, L"a");
+    }();
+    return file;
+}
+
+static void CheckFrameHitch() {
+    static LONGLONG lastPresentQpc = 0;
+    static LONGLONG lastRecordQpc = 0;
+    static uint64_t lastCounts[static_cast<int>(MDB::Events::Kind::Count_)] = {};
+
+    float threshold = HitchThresholdMs();
+    if (threshold <= 0.0f) {
+        return;
+    }
+
+    LONGLONG now = QpcNow();
+    LONGLONG frameStart = lastPresentQpc;
+    lastPresentQpc = now;
+
+    uint64_t counts[static_cast<int>(MDB::Events::Kind::Count_)];
+    MDB::Events::SnapshotCounts(counts);
+
+    if (frameStart == 0) {
+        std::copy(counts, counts + static_cast<int>(MDB::Events::Kind::Count_), lastCounts);
+        return;
+    }
+
+    float intervalMs = QpcToMs(now - frameStart);
+    bool hitch = intervalMs > threshold
+        && QpcToMs(now - lastRecordQpc) >= 500.0f;  // rate limit
+
+    if (hitch) {
+        FILE* file = HitchLogFile();
+        if (file) {
+            lastRecordQpc = now;
+
+            fprintf(file, "[hitch] frame %.1f ms (threshold %.1f ms)\n",
+                    intervalMs, threshold);
+
+            // Exact per-frame totals from the counter deltas
+            fprintf(file, "  counts:");
+            bool anyCount = false;
+            for (int i = 0; i < static_cast<int>(MDB::Events::Kind::Count_); ++i) {
+                uint64_t delta = counts[i] - lastCounts[i];
+                if (delta == 0) {
+                    continue;
+                }
+                fprintf(file, " %s+%llu",
+                        MDB::Events::KindName(static_cast<MDB::Events::Kind>(i)),
+                        static_cast<unsigned long long>(delta));
+                anyCount = true;
+            }
+            fprintf(file, anyCount ? "\n" : " (no bridge activity)\n");
+
+            // Labeled ring events inside the frame window, offset-stamped
+            // from the frame start
+            MDB::Events::Entry events[16];
+            size_t n = MDB::Events::Collect(frameStart, now, events, 16);
+            for (size_t i = 0; i < n; ++i) {
+                fprintf(file, "  +%7.1f ms  %-12s %s",
+                        QpcToMs(events[i].qpc - frameStart),
+                        MDB::Events::KindName(events[i].kind),
+                        events[i].label ? events[i].label : "");
+                if (events[i].duration_ms > 0.0f) {
+                    fprintf(file, "  (%.2f ms)", events[i].duration_ms);
+                }
+                fprintf(file, "\n");
+            }
+            fflush(file);
+        }
+    }
+
+    std::copy(counts, counts + static_cast<int>(MDB::Events::Kind::Count_), lastCounts);
+}
+
+// ========== Shared Overlay Frame Build ==========
+
+// Everything between the backend NewFrame calls and ImGui::Render() is
+// identical for DX11 and DX12: command-buffer replay, registered draw
+// callbacks (or the default placeholder window), and the debug panels.
+// Returns the replay cost in ms for the ETW frame span.
+float BuildOverlayFrame() {
+    ImGui::NewFrame();
+
+    // Invoke all registered callbacks (including legacy) — the mirror
+    // flag keeps the callback mutex off the render path
+    bool hasCallbacks = g_hasDrawCallbacks.load(std::memory_order_relaxed);
+
+    // Replay the managed command buffer (batched widgets — one managed
+    // submit per frame instead of one P/Invoke per widget)
+    bool hasCommands = MDB::ImGuiCmd::HasCommands();
+    float replayMs = 0.0f;
+    if (hasCommands) {
+        LONGLONG replayStart = QpcNow();
+        MDB::ImGuiCmd::Replay();
+        replayMs = QpcToMs(QpcNow() - replayStart);
+        MDB::Events::Record(MDB::Events::Kind::Callback, "imgui.replay", replayMs);
+        std::lock_guard<std::mutex> lock(g_frameStatsMutex);
+        g_replayCost.Add(replayMs);
+    }
+
+    if (hasCallbacks) {
+        InvokeAllCallbacks();
+    }
+    else if (!hasCommands) {
+        // Default: show a simple overlay if no callback registered
+        if (g_inputEnabled.load()) {
+            ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
+            ImGui::Begin("MDB Explorer", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
+            ImGui::Text("ImGui initialized successfully!");
+            ImGui::Text("Press F2 to toggle input capture");
+            ImGui::Text("Waiting for C# callback...");
+            ImGui::End();
+        }
+    }
+
+    if (g_showStatsPanel.load()) {
+        RenderExportStatsPanel();
+    }
+
+    if (g_showFrameStatsPanel.load()) {
+        RenderFrameStatsPanel();
+    }
+
+    return replayMs;
+}
+
+// Shared first-call setup: ImGui context, style, Win32 backend, WndProc
+// hook. Backend (DX11/DX12) init happens at the call site afterwards.
+void InitImGuiCommon(HWND hWnd) {
+    g_hWnd = hWnd;
+    g_originalWndProc = (WNDPROC)SetWindowLongPtrW(g_hWnd, GWLP_WNDPROC, (LONG_PTR)HookedWndProc);
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    io.IniFilename = nullptr; // Don't save settings
+
+    // Setup style (UnityExplorer-like dark theme)
+    ImGui::StyleColorsDark();
+    ImGuiStyle& style = ImGui::GetStyle();
+    style.WindowRounding = 0.0f;
+    style.FrameRounding = 0.0f;
+    style.ScrollbarRounding = 0.0f;
+    style.Colors[ImGuiCol_WindowBg] = ImVec4(0.065f, 0.065f, 0.065f, 1.0f);
+    style.Colors[ImGuiCol_TitleBg] = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
+    style.Colors[ImGuiCol_TitleBgActive] = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
+    style.Colors[ImGuiCol_FrameBg] = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
+    style.Colors[ImGuiCol_Button] = ImVec4(0.2f, 0.2f, 0.2f, 1.0f);
+    style.Colors[ImGuiCol_ButtonHovered] = ImVec4(0.3f, 0.3f, 0.3f, 1.0f);
+    style.Colors[ImGuiCol_Header] = ImVec4(0.1f, 0.3f, 0.3f, 1.0f);
+    style.Colors[ImGuiCol_HeaderHovered] = ImVec4(0.15f, 0.4f, 0.4f, 1.0f);
+
+    ImGui_ImplWin32_Init(g_hWnd);
+}
+
 // ========== Present Hook (DX11) ==========
 
 HRESULT WINAPI HookedPresent11(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags) {
@@ -209,81 +697,404 @@ HRESULT WINAPI HookedPresent11(IDXGISwapChain* pSwapChain, UINT SyncInterval, UI
             // Get window handle
             DXGI_SWAP_CHAIN_DESC desc;
             pSwapChain->GetDesc(&desc);
-            g_hWnd = desc.OutputWindow;
 
-            // Hook WndProc
-            g_originalWndProc = (WNDPROC)SetWindowLongPtrW(g_hWnd, GWLP_WNDPROC, (LONG_PTR)HookedWndProc);
-
-            // Initialize ImGui
-            IMGUI_CHECKVERSION();
-            ImGui::CreateContext();
+            InitImGuiCommon(desc.OutputWindow);
             ImGuiIO& io = ImGui::GetIO();
-            io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
-            io.IniFilename = nullptr; // Don't save settings
-
-            // Setup style (UnityExplorer-like dark theme)
-            ImGui::StyleColorsDark();
-            ImGuiStyle& style = ImGui::GetStyle();
-            style.WindowRounding = 0.0f;
-            style.FrameRounding = 0.0f;
-            style.ScrollbarRounding = 0.0f;
-            style.Colors[ImGuiCol_WindowBg] = ImVec4(0.065f, 0.065f, 0.065f, 1.0f);
-            style.Colors[ImGuiCol_TitleBg] = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
-            style.Colors[ImGuiCol_TitleBgActive] = ImVec4(0.15f, 0.15f, 0.15f, 1.0f);
-            style.Colors[ImGuiCol_FrameBg] = ImVec4(0.1f, 0.1f, 0.1f, 1.0f);
-            style.Colors[ImGuiCol_Button] = ImVec4(0.2f, 0.2f, 0.2f, 1.0f);
-            style.Colors[ImGuiCol_ButtonHovered] = ImVec4(0.3f, 0.3f, 0.3f, 1.0f);
-            style.Colors[ImGuiCol_Header] = ImVec4(0.1f, 0.3f, 0.3f, 1.0f);
-            style.Colors[ImGuiCol_HeaderHovered] = ImVec4(0.15f, 0.4f, 0.4f, 1.0f);
-
-            // Setup platform/renderer backends
-            ImGui_ImplWin32_Init(g_hWnd);
             ImGui_ImplDX11_Init(g_pd3dDevice11, g_pd3dDeviceContext);
 
+            // Bake the font atlas and upload its texture now, while the
+            // game is still loading. The backend otherwise builds it
+            // lazily on the first NewFrame — which, with the idle fast
+            // path skipping NewFrame while hidden, would land exactly on
+            // the first F2 press as a mid-gameplay hitch.
+            io.Fonts->Build();
+            if (!ImGui_ImplDX11_CreateDeviceObjects()) {
+                LOG_WARN("[ImGui] Eager font atlas upload failed; backend will retry on first frame");
+            }
+
             CreateRenderTarget11();
 
             g_initialized.store(true);
         }
     }
 
+    // Present-to-Present interval check; writes a correlation record only
+    // on frames that already blew the threshold
+    CheckFrameHitch();
+
+    // Apply queued mod mutations at a deterministic point in the frame,
+    // before any draw callbacks read game state
+    if (!g_shutting_down.load()) {
+        mdb_command_buffer_flush();
+
+        // Run budgeted background work after the command buffer so tasks
+        // observe this frame's applied mutations; the drain self-limits to
+        // its microsecond budget and carries leftovers to the next frame
+        mdb_frame_tasks_drain();
+    }
+
+    // Idle fast path: overlay hidden (F2) and nothing registered to draw.
+    // A few relaxed loads and a predicted branch — no NewFrame, no callback
+    // lock, no draw-data build while the user is just playing.
+    if (!g_inputEnabled.load(std::memory_order_relaxed)
+        && !g_hasDrawCallbacks.load(std::memory_order_relaxed)
+        && !g_showStatsPanel.load(std::memory_order_relaxed)
+        && !MDB::ImGuiCmd::HasCommands()) {
+        return g_originalPresent(pSwapChain, SyncInterval, Flags);
+    }
+
+    // Recover the RTV if a resize path we don't hook dropped it (some
+    // engines recreate the swapchain rather than calling ResizeBuffers)
+    if (g_initialized.load() && !g_shutting_down.load()
+        && g_pd3dDevice11 && g_pSwapChain && !g_mainRenderTargetView) {
+        if (!CreateRenderTarget11()) {
+            // This retries every frame on persistent failure — keep the
+            // diagnostic but never let it firehose
+            LOG_RATELIMIT_WARN(1, "[ImGui] RTV recovery failed; overlay skipped");
+        }
+    }
+
     // Render ImGui — skip entirely when shutting down or DX state is gone
     if (g_initialized.load() && !g_shutting_down.load()
         && g_pd3dDevice11 && g_pd3dDeviceContext && g_mainRenderTargetView) {
         ImGui_ImplDX11_NewFrame();
         ImGui_ImplWin32_NewFrame();
-        ImGui::NewFrame();
 
-        // Invoke all registered callbacks (including legacy)
-        bool hasCallbacks = false;
+        float replayMs = BuildOverlayFrame();
+
+        LONGLONG renderStart = QpcNow();
+
+        ImGui::Render();
+
+        g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
+        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+        float renderMs = QpcToMs(QpcNow() - renderStart);
         {
-            std::lock_guard<std::mutex> lock(g_callbackMutex);
-            hasCallbacks = g_legacyCallback != nullptr || !g_callbacks.empty();
-        }
-        
-        if (hasCallbacks) {
-            InvokeAllCallbacks();
-        }
-        else {
-            // Default: show a simple overlay if no callback registered
-            if (g_inputEnabled.load()) {
-                ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
-                ImGui::Begin("MDB Explorer", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
-                ImGui::Text("ImGui initialized successfully!");
-                ImGui::Text("Press F2 to toggle input capture");
-                ImGui::Text("Waiting for C# callback...");
-                ImGui::End();
+            std::lock_guard<std::mutex> lock(g_frameStatsMutex);
+            g_renderCost.Add(renderMs);
+        }
+
+        // Per-frame overlay cost span for WPA correlation — one enable-mask
+        // check when no ETW session is recording
+        MDB::Etw::FrameSpan(replayMs, renderMs);
+    }
+
+    return g_originalPresent(pSwapChain, SyncInterval, Flags);
+}
+
+// ========== ResizeBuffers Hook (DX11) ==========
+
+HRESULT WINAPI HookedResizeBuffers(IDXGISwapChain* pSwapChain, UINT BufferCount,
+                                   UINT Width, UINT Height, DXGI_FORMAT NewFormat,
+                                   UINT SwapChainFlags) {
+    // Our RTV holds a backbuffer reference; releasing it up front is what
+    // lets the game's ResizeBuffers call succeed at all
+    bool ours = (pSwapChain == g_pSwapChain) && g_initialized.load();
+    if (ours) {
+        CleanupRenderTarget11();
+    }
+
+    HRESULT hr = g_originalResizeBuffers(pSwapChain, BufferCount, Width, Height,
+                                         NewFormat, SwapChainFlags);
+
+    // Pre-create the RTV for the new size here, off the Present path, so
+    // the first frame after a resize renders instead of stuttering through
+    // backbuffer queries
+    if (ours && SUCCEEDED(hr) && !g_shutting_down.load()) {
+        if (!CreateRenderTarget11()) {
+            LOG_WARN("[ImGui] Failed to recreate render target after resize (%ux%u)",
+                     Width, Height);
+        }
+    }
+
+    return hr;
+}
+
+// ========== DX12 Helpers ==========
+
+// SRV descriptor alloc/free callbacks handed to the ImGui backend. Pure
+// free-list index math over the shared shader-visible heap — no heap
+// creation or GPU work per texture.
+void SrvDescriptorAlloc12(ImGui_ImplDX12_InitInfo*,
+                          D3D12_CPU_DESCRIPTOR_HANDLE* outCpu,
+                          D3D12_GPU_DESCRIPTOR_HANDLE* outGpu) {
+    IM_ASSERT(g_srvFreeCount12 > 0);
+    int idx = g_srvFreeList12[--g_srvFreeCount12];
+    outCpu->ptr = g_pd3dSrvDescHeap->GetCPUDescriptorHandleForHeapStart().ptr
+                + static_cast<SIZE_T>(idx) * g_srvDescriptorSize12;
+    outGpu->ptr = g_pd3dSrvDescHeap->GetGPUDescriptorHandleForHeapStart().ptr
+                + static_cast<UINT64>(idx) * g_srvDescriptorSize12;
+}
+
+void SrvDescriptorFree12(ImGui_ImplDX12_InitInfo*,
+                         D3D12_CPU_DESCRIPTOR_HANDLE cpu,
+                         D3D12_GPU_DESCRIPTOR_HANDLE) {
+    int idx = static_cast<int>(
+        (cpu.ptr - g_pd3dSrvDescHeap->GetCPUDescriptorHandleForHeapStart().ptr)
+        / g_srvDescriptorSize12);
+    if (idx >= 0 && idx < kSrvHeapSize12 && g_srvFreeCount12 < kSrvHeapSize12) {
+        g_srvFreeList12[g_srvFreeCount12++] = idx;
+    }
+}
+
+bool CreateRenderTargets12() {
+    UINT rtvSize = g_pd3dDevice12->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+    D3D12_CPU_DESCRIPTOR_HANDLE handle = g_pd3dRtvDescHeap12->GetCPUDescriptorHandleForHeapStart();
+
+    for (UINT i = 0; i < g_numFrames12; i++) {
+        ID3D12Resource* buffer = nullptr;
+        if (FAILED(g_pSwapChain3->GetBuffer(i, IID_PPV_ARGS(&buffer)))) {
+            return false;
+        }
+        g_pd3dDevice12->CreateRenderTargetView(buffer, nullptr, handle);
+        g_frameContexts12[i].backBuffer = buffer;
+        g_frameContexts12[i].rtvHandle = handle;
+        handle.ptr += rtvSize;
+    }
+
+    D3D12_RESOURCE_DESC desc = g_frameContexts12[0].backBuffer->GetDesc();
+    g_backBufferWidth = static_cast<UINT>(desc.Width);
+    g_backBufferHeight = desc.Height;
+    return true;
+}
+
+void CleanupRenderTargets12() {
+    for (UINT i = 0; i < g_numFrames12; i++) {
+        if (g_frameContexts12[i].backBuffer) {
+            g_frameContexts12[i].backBuffer->Release();
+            g_frameContexts12[i].backBuffer = nullptr;
+        }
+    }
+}
+
+// Full fence drain — resize and shutdown only, never the frame path
+void WaitForGpu12() {
+    if (!g_pCommandQueue || !g_fence12 || !g_fenceEvent12) {
+        return;
+    }
+    UINT64 value = ++g_fenceLastSignaled12;
+    if (SUCCEEDED(g_pCommandQueue->Signal(g_fence12, value))
+        && g_fence12->GetCompletedValue() < value) {
+        g_fence12->SetEventOnCompletion(value, g_fenceEvent12);
+        WaitForSingleObject(g_fenceEvent12, 2000);
+    }
+}
+
+// ========== ExecuteCommandLists Hook (DX12) ==========
+
+// The swapchain alone doesn't expose the queue that drives it, and the
+// overlay needs that queue both to submit its own command list and for
+// the backend's texture uploads. Capture the first direct queue that
+// executes work — in a DXGI-presented title that's the present queue.
+void WINAPI HookedExecuteCommandLists12(ID3D12CommandQueue* pQueue, UINT count,
+                                        ID3D12CommandList* const* ppLists) {
+    if (!g_pCommandQueue && pQueue->GetDesc().Type == D3D12_COMMAND_LIST_TYPE_DIRECT) {
+        g_pCommandQueue = pQueue;
+        LOG_CHAN_VERBOSE(ImGui, "Captured DX12 direct command queue @ 0x%p", (void*)pQueue);
+    }
+    g_originalExecuteCommandLists(pQueue, count, ppLists);
+}
+
+// ========== Present Hook (DX12) ==========
+
+HRESULT WINAPI HookedPresent12(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags) {
+    static bool firstCall = true;
+
+    // Everything below needs the game's direct queue; until the
+    // ExecuteCommandLists hook has seen one, just pass through
+    if (firstCall && g_pCommandQueue) {
+        firstCall = false;
+
+        if (SUCCEEDED(pSwapChain->GetDevice(IID_PPV_ARGS(&g_pd3dDevice12)))
+            && SUCCEEDED(pSwapChain->QueryInterface(IID_PPV_ARGS(&g_pSwapChain3)))) {
+            g_pSwapChain = pSwapChain;
+
+            DXGI_SWAP_CHAIN_DESC desc;
+            pSwapChain->GetDesc(&desc);
+            g_numFrames12 = desc.BufferCount;
+            if (g_numFrames12 > kMaxBackBuffers12) {
+                g_numFrames12 = kMaxBackBuffers12;
+            }
+
+            // RTV heap: one descriptor per backbuffer, CPU-only
+            D3D12_DESCRIPTOR_HEAP_DESC rtvDesc = {};
+            rtvDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
+            rtvDesc.NumDescriptors = g_numFrames12;
+            g_pd3dDevice12->CreateDescriptorHeap(&rtvDesc, IID_PPV_ARGS(&g_pd3dRtvDescHeap12));
+
+            // Shader-visible SRV heap shared with the backend
+            D3D12_DESCRIPTOR_HEAP_DESC srvDesc = {};
+            srvDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+            srvDesc.NumDescriptors = kSrvHeapSize12;
+            srvDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+            g_pd3dDevice12->CreateDescriptorHeap(&srvDesc, IID_PPV_ARGS(&g_pd3dSrvDescHeap));
+            g_srvDescriptorSize12 = g_pd3dDevice12->GetDescriptorHandleIncrementSize(
+                D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+            g_srvFreeCount12 = 0;
+            for (int i = kSrvHeapSize12 - 1; i >= 0; i--) {
+                g_srvFreeList12[g_srvFreeCount12++] = i;
+            }
+
+            // One allocator per backbuffer, one reusable command list
+            bool resourcesOk = g_pd3dRtvDescHeap12 && g_pd3dSrvDescHeap;
+            for (UINT i = 0; i < g_numFrames12 && resourcesOk; i++) {
+                resourcesOk = SUCCEEDED(g_pd3dDevice12->CreateCommandAllocator(
+                    D3D12_COMMAND_LIST_TYPE_DIRECT,
+                    IID_PPV_ARGS(&g_frameContexts12[i].allocator)));
+            }
+            if (resourcesOk) {
+                resourcesOk = SUCCEEDED(g_pd3dDevice12->CreateCommandList(
+                        0, D3D12_COMMAND_LIST_TYPE_DIRECT,
+                        g_frameContexts12[0].allocator, nullptr,
+                        IID_PPV_ARGS(&g_pCommandList12)))
+                    && SUCCEEDED(g_pCommandList12->Close())
+                    && SUCCEEDED(g_pd3dDevice12->CreateFence(
+                        0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&g_fence12)));
+            }
+            if (resourcesOk) {
+                g_fenceEvent12 = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+                resourcesOk = g_fenceEvent12 != nullptr && CreateRenderTargets12();
+            }
+
+            if (resourcesOk) {
+                InitImGuiCommon(desc.OutputWindow);
+                ImGuiIO& io = ImGui::GetIO();
+
+                ImGui_ImplDX12_InitInfo initInfo;
+                initInfo.Device = g_pd3dDevice12;
+                initInfo.CommandQueue = g_pCommandQueue;
+                initInfo.NumFramesInFlight = static_cast<int>(g_numFrames12);
+                initInfo.RTVFormat = desc.BufferDesc.Format;
+                initInfo.DSVFormat = DXGI_FORMAT_UNKNOWN;
+                initInfo.SrvDescriptorHeap = g_pd3dSrvDescHeap;
+                initInfo.SrvDescriptorAllocFn = &SrvDescriptorAlloc12;
+                initInfo.SrvDescriptorFreeFn = &SrvDescriptorFree12;
+                ImGui_ImplDX12_Init(&initInfo);
+
+                // Same eager font-atlas bake as the DX11 path — keep the
+                // first F2 press from paying the upload mid-gameplay
+                io.Fonts->Build();
+                if (!ImGui_ImplDX12_CreateDeviceObjects()) {
+                    LOG_WARN("[ImGui] Eager font atlas upload failed; backend will retry on first frame");
+                }
+
+                g_initialized.store(true);
+            } else {
+                LOG_ERROR("[ImGui] DX12 resource setup failed; overlay disabled");
             }
         }
+    }
+
+    CheckFrameHitch();
+
+    if (!g_shutting_down.load()) {
+        mdb_command_buffer_flush();
+        mdb_frame_tasks_drain();
+    }
+
+    // Same idle fast path as DX11: overlay hidden and nothing to draw
+    if (!g_inputEnabled.load(std::memory_order_relaxed)
+        && !g_hasDrawCallbacks.load(std::memory_order_relaxed)
+        && !g_showStatsPanel.load(std::memory_order_relaxed)
+        && !MDB::ImGuiCmd::HasCommands()) {
+        return g_originalPresent(pSwapChain, SyncInterval, Flags);
+    }
+
+    if (g_initialized.load() && !g_shutting_down.load()
+        && g_pd3dDevice12 && g_pCommandQueue && g_pCommandList12
+        && g_frameContexts12[0].backBuffer) {
+        ImGui_ImplDX12_NewFrame();
+        ImGui_ImplWin32_NewFrame();
+
+        float replayMs = BuildOverlayFrame();
+
+        LONGLONG renderStart = QpcNow();
 
         ImGui::Render();
 
-        g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, nullptr);
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+        // Pipelined allocator reuse keyed to the swapchain's frame index:
+        // only block if the GPU hasn't retired this allocator's previous
+        // frame. The swapchain won't hand out a backbuffer still being
+        // scanned out, so on the steady path the fence has long passed
+        // and this costs one fence read.
+        UINT frameIdx = g_pSwapChain3->GetCurrentBackBufferIndex();
+        if (frameIdx >= g_numFrames12) {
+            frameIdx = 0;
+        }
+        FrameContext12& ctx = g_frameContexts12[frameIdx];
+        if (ctx.fenceValue != 0 && g_fence12->GetCompletedValue() < ctx.fenceValue) {
+            g_fence12->SetEventOnCompletion(ctx.fenceValue, g_fenceEvent12);
+            WaitForSingleObject(g_fenceEvent12, 1000);
+        }
+
+        ctx.allocator->Reset();
+        g_pCommandList12->Reset(ctx.allocator, nullptr);
+
+        D3D12_RESOURCE_BARRIER barrier = {};
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Transition.pResource = ctx.backBuffer;
+        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
+        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
+        g_pCommandList12->ResourceBarrier(1, &barrier);
+
+        g_pCommandList12->OMSetRenderTargets(1, &ctx.rtvHandle, FALSE, nullptr);
+        g_pCommandList12->SetDescriptorHeaps(1, &g_pd3dSrvDescHeap);
+        ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), g_pCommandList12);
+
+        barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
+        barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
+        g_pCommandList12->ResourceBarrier(1, &barrier);
+        g_pCommandList12->Close();
+
+        // Submit through the trampoline — the capture hook has nothing
+        // left to learn from our own submissions
+        ID3D12CommandList* lists[] = { g_pCommandList12 };
+        g_originalExecuteCommandLists(g_pCommandQueue, 1, lists);
+
+        UINT64 fenceValue = ++g_fenceLastSignaled12;
+        g_pCommandQueue->Signal(g_fence12, fenceValue);
+        ctx.fenceValue = fenceValue;
+
+        float renderMs = QpcToMs(QpcNow() - renderStart);
+        {
+            std::lock_guard<std::mutex> lock(g_frameStatsMutex);
+            g_renderCost.Add(renderMs);
+        }
+
+        MDB::Etw::FrameSpan(replayMs, renderMs);
     }
 
     return g_originalPresent(pSwapChain, SyncInterval, Flags);
 }
 
+// ========== ResizeBuffers Hook (DX12) ==========
+
+HRESULT WINAPI HookedResizeBuffers12(IDXGISwapChain* pSwapChain, UINT BufferCount,
+                                     UINT Width, UINT Height, DXGI_FORMAT NewFormat,
+                                     UINT SwapChainFlags) {
+    // The RTVs hold backbuffer references, and unlike DX11 the GPU may
+    // still be reading them — drain the fence before releasing
+    bool ours = (pSwapChain == g_pSwapChain) && g_initialized.load();
+    if (ours) {
+        WaitForGpu12();
+        CleanupRenderTargets12();
+    }
+
+    HRESULT hr = g_originalResizeBuffers(pSwapChain, BufferCount, Width, Height,
+                                         NewFormat, SwapChainFlags);
+
+    if (ours && SUCCEEDED(hr) && !g_shutting_down.load()) {
+        if (!CreateRenderTargets12()) {
+            LOG_WARN("[ImGui] Failed to recreate DX12 render targets after resize (%ux%u)",
+                     Width, Height);
+        }
+    }
+
+    return hr;
+}
+
 // ========== DirectX Detection ==========
 
 MdbDxVersion DetectDxVersion() {
@@ -305,9 +1116,12 @@ MdbDxVersion DetectDxVersion() {
 // ========== SwapChain vTable Hook ==========
 
 // Attempt to create a dummy D3D11 device+swapchain targeting the given HWND.
-// On success, extracts the Present vTable pointer and cleans up.
-static bool TryCreateDummySwapChain(HWND hWnd, const char* label, void*& outPresent) {
+// On success, extracts the Present and ResizeBuffers vTable pointers and
+// cleans up.
+static bool TryCreateDummySwapChain(HWND hWnd, const char* label,
+                                    void*& outPresent, void*& outResizeBuffers) {
     outPresent = nullptr;
+    outResizeBuffers = nullptr;
 
     // Try with explicit FL 11_0 first, then let the runtime pick if that fails
     D3D_FEATURE_LEVEL requestedLevel = D3D_FEATURE_LEVEL_11_0;
@@ -337,11 +1151,12 @@ static bool TryCreateDummySwapChain(HWND hWnd, const char* label, void*& outPres
         );
 
         if (SUCCEEDED(hr)) {
-            LOG_VERBOSE("[ImGui] [%s] Dummy swapchain created (attempt %d, feature level 0x%x)",
+            LOG_CHAN_VERBOSE(ImGui, "[%s] Dummy swapchain created (attempt %d, feature level 0x%x)",
                       label, attempt + 1, (unsigned)achievedLevel);
 
             void** vTable = *reinterpret_cast<void***>(pSwap);
-            outPresent = vTable[8]; // IDXGISwapChain::Present
+            outPresent = vTable[8];        // IDXGISwapChain::Present
+            outResizeBuffers = vTable[13]; // IDXGISwapChain::ResizeBuffers
 
             pSwap->Release();
             pCtx->Release();
@@ -363,17 +1178,19 @@ static bool TryCreateDummySwapChain(HWND hWnd, const char* label, void*& outPres
 }
 
 bool HookDX11Present() {
-    LOG_VERBOSE("[ImGui] HookDX11Present: starting DX11 Present hook sequence");
+    MDB::Trace::ScopedSpan traceSpan("startup.hook_dx11_present");
+    LOG_CHAN_VERBOSE(ImGui, "HookDX11Present: starting DX11 Present hook sequence");
 
     void* pPresent = nullptr;
+    void* pResizeBuffers = nullptr;
 
     // ---- Attempt 1: Desktop Window (fast, works on most systems) ----
     {
         HWND hDesktop = GetDesktopWindow();
-        LOG_VERBOSE("[ImGui] Attempt 1: Using GetDesktopWindow() -> HWND 0x%p", (void*)hDesktop);
+        LOG_CHAN_VERBOSE(ImGui, "Attempt 1: Using GetDesktopWindow() -> HWND 0x%p", (void*)hDesktop);
 
-        if (TryCreateDummySwapChain(hDesktop, "DesktopWnd", pPresent)) {
-            LOG_VERBOSE("[ImGui] Attempt 1 succeeded, Present @ 0x%p", pPresent);
+        if (TryCreateDummySwapChain(hDesktop, "DesktopWnd", pPresent, pResizeBuffers)) {
+            LOG_CHAN_VERBOSE(ImGui, "Attempt 1 succeeded, Present @ 0x%p", pPresent);
         }
     }
 
@@ -405,10 +1222,10 @@ bool HookDX11Present() {
         if (!hHidden) {
             LOG_ERROR("[ImGui] Attempt 2: CreateWindowExW failed, GetLastError=%lu", GetLastError());
         } else {
-            LOG_VERBOSE("[ImGui] Attempt 2: Using hidden window -> HWND 0x%p", (void*)hHidden);
+            LOG_CHAN_VERBOSE(ImGui, "Attempt 2: Using hidden window -> HWND 0x%p", (void*)hHidden);
 
-            if (TryCreateDummySwapChain(hHidden, "HiddenWnd", pPresent)) {
-                LOG_VERBOSE("[ImGui] Attempt 2 succeeded, Present @ 0x%p", pPresent);
+            if (TryCreateDummySwapChain(hHidden, "HiddenWnd", pPresent, pResizeBuffers)) {
+                LOG_CHAN_VERBOSE(ImGui, "Attempt 2 succeeded, Present @ 0x%p", pPresent);
             } else {
                 LOG_ERROR("[ImGui] Attempt 2 also failed");
             }
@@ -456,7 +1273,7 @@ bool HookDX11Present() {
     }
 
     // ---- Install MinHook ----
-    LOG_VERBOSE("[ImGui] Installing MinHook on Present @ 0x%p", pPresent);
+    LOG_CHAN_VERBOSE(ImGui, "Installing MinHook on Present @ 0x%p", pPresent);
 
     MH_STATUS mhStatus = MH_CreateHook(pPresent, &HookedPresent11, reinterpret_cast<void**>(&g_originalPresent));
     if (mhStatus != MH_OK) {
@@ -474,15 +1291,188 @@ bool HookDX11Present() {
         return false;
     }
 
+    // ResizeBuffers hook keeps the RTV lifecycle off the Present path on
+    // alt-tab/resolution changes. Non-fatal if it fails — the Present hook
+    // lazily recreates a dropped RTV.
+    if (pResizeBuffers) {
+        mhStatus = MH_CreateHook(pResizeBuffers, &HookedResizeBuffers,
+                                 reinterpret_cast<void**>(&g_originalResizeBuffers));
+        if (mhStatus == MH_OK) {
+            mhStatus = MH_EnableHook(pResizeBuffers);
+        }
+        if (mhStatus != MH_OK) {
+            LOG_WARN("[ImGui] ResizeBuffers hook failed: %s (code %d) - "
+                     "falling back to lazy render target recovery",
+                     MH_StatusToString(mhStatus), (int)mhStatus);
+            g_originalResizeBuffers = nullptr;
+        } else {
+            LOG_CHAN_VERBOSE(ImGui, "ResizeBuffers hook installed @ 0x%p", pResizeBuffers);
+        }
+    }
+
     LOG_INFO("[ImGui] HookDX11Present: Present hook installed successfully");
     return true;
 }
 
+// Build a throwaway device + queue + swapchain against a hidden window to
+// read the vTable pointers we need: swapchain Present/ResizeBuffers (the
+// DXGI slots are the same ones the game's swapchain uses) and the queue's
+// ExecuteCommandLists, which is how the overlay later finds the game's
+// present queue.
+static bool TryCreateDummySwapChain12(HWND hWnd, void*& outPresent,
+                                      void*& outResizeBuffers,
+                                      void*& outExecuteCommandLists) {
+    outPresent = nullptr;
+    outResizeBuffers = nullptr;
+    outExecuteCommandLists = nullptr;
+
+    ID3D12Device* pDevice = nullptr;
+    HRESULT hr = D3D12CreateDevice(nullptr, D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&pDevice));
+    if (FAILED(hr)) {
+        LOG_WARN("[ImGui] D3D12CreateDevice failed: HRESULT=0x%08X (%s)",
+                 (unsigned)hr, HResultToStr(hr));
+        return false;
+    }
+
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+    ID3D12CommandQueue* pQueue = nullptr;
+    hr = pDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&pQueue));
+    if (FAILED(hr)) {
+        pDevice->Release();
+        return false;
+    }
+
+    IDXGIFactory4* pFactory = nullptr;
+    hr = CreateDXGIFactory1(IID_PPV_ARGS(&pFactory));
+    if (FAILED(hr)) {
+        pQueue->Release();
+        pDevice->Release();
+        return false;
+    }
+
+    DXGI_SWAP_CHAIN_DESC1 scDesc = {};
+    scDesc.BufferCount = 2;
+    scDesc.Width = 100;
+    scDesc.Height = 100;
+    scDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    scDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+    scDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    scDesc.SampleDesc.Count = 1;
+
+    IDXGISwapChain1* pSwap = nullptr;
+    hr = pFactory->CreateSwapChainForHwnd(pQueue, hWnd, &scDesc, nullptr, nullptr, &pSwap);
+    if (SUCCEEDED(hr)) {
+        void** swapVTable = *reinterpret_cast<void***>(pSwap);
+        outPresent = swapVTable[8];         // IDXGISwapChain::Present
+        outResizeBuffers = swapVTable[13];  // IDXGISwapChain::ResizeBuffers
+
+        void** queueVTable = *reinterpret_cast<void***>(pQueue);
+        outExecuteCommandLists = queueVTable[10];  // ID3D12CommandQueue::ExecuteCommandLists
+
+        pSwap->Release();
+    } else {
+        LOG_WARN("[ImGui] CreateSwapChainForHwnd (DX12) failed: HRESULT=0x%08X (%s)",
+                 (unsigned)hr, HResultToStr(hr));
+    }
+
+    pFactory->Release();
+    pQueue->Release();
+    pDevice->Release();
+    return outPresent != nullptr;
+}
+
 bool HookDX12() {
-    // DX12 hook implementation - more complex, defer for now
-    // Would need to hook ID3D12CommandQueue::ExecuteCommandLists
-    // and manage descriptor heaps for ImGui
-    return false;
+    MDB::Trace::ScopedSpan traceSpan("startup.hook_dx12_present");
+    LOG_CHAN_VERBOSE(ImGui, "HookDX12: starting DX12 hook sequence");
+
+    const wchar_t* className = L"MDB_DummyDX12Wnd";
+    HINSTANCE hInst = GetModuleHandleW(nullptr);
+
+    WNDCLASSEXW wc = {};
+    wc.cbSize = sizeof(wc);
+    wc.lpfnWndProc = DefWindowProcW;
+    wc.hInstance = hInst;
+    wc.lpszClassName = className;
+
+    if (!RegisterClassExW(&wc)) {
+        DWORD err = GetLastError();
+        if (err != ERROR_CLASS_ALREADY_EXISTS) {
+            LOG_ERROR("[ImGui] HookDX12: RegisterClassExW failed, GetLastError=%lu", err);
+        }
+    }
+
+    HWND hHidden = CreateWindowExW(
+        0, className, L"", WS_OVERLAPPEDWINDOW,
+        0, 0, 100, 100, nullptr, nullptr, hInst, nullptr);
+    if (!hHidden) {
+        LOG_ERROR("[ImGui] HookDX12: CreateWindowExW failed, GetLastError=%lu", GetLastError());
+        UnregisterClassW(className, hInst);
+        return false;
+    }
+
+    void* pPresent = nullptr;
+    void* pResizeBuffers = nullptr;
+    void* pExecuteCommandLists = nullptr;
+    bool gotVTables = TryCreateDummySwapChain12(hHidden, pPresent, pResizeBuffers,
+                                                pExecuteCommandLists);
+
+    DestroyWindow(hHidden);
+    UnregisterClassW(className, hInst);
+
+    if (!gotVTables) {
+        LOG_ERROR("[ImGui] HookDX12: could not obtain DX12 vTable pointers");
+        return false;
+    }
+
+    // ---- Install MinHook ----
+    LOG_CHAN_VERBOSE(ImGui, "Installing DX12 hooks: Present @ 0x%p, ExecuteCommandLists @ 0x%p",
+              pPresent, pExecuteCommandLists);
+
+    MH_STATUS mhStatus = MH_CreateHook(pPresent, &HookedPresent12,
+                                       reinterpret_cast<void**>(&g_originalPresent));
+    if (mhStatus != MH_OK) {
+        LOG_ERROR("[ImGui] MH_CreateHook (DX12 Present) failed: %s (code %d). "
+                  "Another overlay (Steam/Discord/RivaTuner/MSI Afterburner) may have already hooked Present.",
+                  MH_StatusToString(mhStatus), (int)mhStatus);
+        return false;
+    }
+
+    // Queue capture must be live before the Present hook can ever render
+    mhStatus = MH_CreateHook(pExecuteCommandLists, &HookedExecuteCommandLists12,
+                             reinterpret_cast<void**>(&g_originalExecuteCommandLists));
+    if (mhStatus != MH_OK) {
+        LOG_ERROR("[ImGui] MH_CreateHook (ExecuteCommandLists) failed: %s (code %d)",
+                  MH_StatusToString(mhStatus), (int)mhStatus);
+        MH_RemoveHook(pPresent);
+        return false;
+    }
+
+    if (MH_EnableHook(pExecuteCommandLists) != MH_OK
+        || MH_EnableHook(pPresent) != MH_OK) {
+        LOG_ERROR("[ImGui] MH_EnableHook (DX12) failed");
+        MH_RemoveHook(pPresent);
+        MH_RemoveHook(pExecuteCommandLists);
+        return false;
+    }
+
+    // ResizeBuffers hook keeps the RTV lifecycle off the Present path on
+    // alt-tab/resolution changes. Non-fatal if it fails.
+    if (pResizeBuffers) {
+        mhStatus = MH_CreateHook(pResizeBuffers, &HookedResizeBuffers12,
+                                 reinterpret_cast<void**>(&g_originalResizeBuffers));
+        if (mhStatus == MH_OK) {
+            mhStatus = MH_EnableHook(pResizeBuffers);
+        }
+        if (mhStatus != MH_OK) {
+            LOG_WARN("[ImGui] DX12 ResizeBuffers hook failed: %s (code %d)",
+                     MH_StatusToString(mhStatus), (int)mhStatus);
+            g_originalResizeBuffers = nullptr;
+        }
+    }
+
+    LOG_INFO("[ImGui] HookDX12: Present + ExecuteCommandLists hooks installed");
+    return true;
 }
 
 } // anonymous namespace
@@ -496,10 +1486,10 @@ MDB_IMGUI_API MdbDxVersion mdb_imgui_get_dx_version() {
 }
 
 MDB_IMGUI_API bool mdb_imgui_init() {
-    LOG_VERBOSE("[ImGui] mdb_imgui_init called");
+    LOG_CHAN_VERBOSE(ImGui, "mdb_imgui_init called");
 
     if (g_initialized.load()) {
-        LOG_VERBOSE("[ImGui] Already initialized, returning true");
+        LOG_CHAN_VERBOSE(ImGui, "Already initialized, returning true");
         return true;
     }
 
@@ -512,7 +1502,7 @@ MDB_IMGUI_API bool mdb_imgui_init() {
                       MH_StatusToString(status), (int)status);
             return false;
         }
-        LOG_VERBOSE("[ImGui] MinHook initialized (status: %s)", MH_StatusToString(status));
+        LOG_CHAN_VERBOSE(ImGui, "MinHook initialized (status: %s)", MH_StatusToString(status));
         s_mhInitialized = true;
     }
 
@@ -520,12 +1510,12 @@ MDB_IMGUI_API bool mdb_imgui_init() {
     HMODULE hD3D11 = GetModuleHandleW(L"d3d11.dll");
     HMODULE hD3D12 = GetModuleHandleW(L"d3d12.dll");
     HMODULE hDXGI  = GetModuleHandleW(L"dxgi.dll");
-    LOG_VERBOSE("[ImGui] Module check: d3d11.dll=0x%p, d3d12.dll=0x%p, dxgi.dll=0x%p",
+    LOG_CHAN_VERBOSE(ImGui, "Module check: d3d11.dll=0x%p, d3d12.dll=0x%p, dxgi.dll=0x%p",
               (void*)hD3D11, (void*)hD3D12, (void*)hDXGI);
 
     // Detect DirectX version
     g_dxVersion.store(DetectDxVersion());
-    LOG_VERBOSE("[ImGui] Initial DX detection: %d", (int)g_dxVersion.load());
+    LOG_CHAN_VERBOSE(ImGui, "Initial DX detection: %d", (int)g_dxVersion.load());
 
     if (g_dxVersion.load() == MDB_DX_UNKNOWN) {
         LOG_WARN("[ImGui] DX version unknown, polling up to 10 times (100ms each)...");
@@ -533,7 +1523,7 @@ MDB_IMGUI_API bool mdb_imgui_init() {
             Sleep(100);
             g_dxVersion.store(DetectDxVersion());
             if (g_dxVersion.load() != MDB_DX_UNKNOWN) {
-                LOG_VERBOSE("[ImGui] DX detected after %d polls: %d", i + 1, (int)g_dxVersion.load());
+                LOG_CHAN_VERBOSE(ImGui, "DX detected after %d polls: %d", i + 1, (int)g_dxVersion.load());
                 break;
             }
         }
@@ -541,16 +1531,21 @@ MDB_IMGUI_API bool mdb_imgui_init() {
 
     switch (g_dxVersion.load()) {
     case MDB_DX_11: {
-        LOG_VERBOSE("[ImGui] Proceeding with DX11 Present hook");
+        LOG_CHAN_VERBOSE(ImGui, "Proceeding with DX11 Present hook");
         bool result = HookDX11Present();
         if (!result) {
             LOG_ERROR("[ImGui] DX11 Present hook FAILED - ImGui will not be available");
         }
         return result;
     }
-    case MDB_DX_12:
-        LOG_ERROR("[ImGui] DX12 detected but not yet supported");
-        return false;
+    case MDB_DX_12: {
+        LOG_CHAN_VERBOSE(ImGui, "Proceeding with DX12 hooks");
+        bool result = HookDX12();
+        if (!result) {
+            LOG_ERROR("[ImGui] DX12 hooks FAILED - ImGui will not be available");
+        }
+        return result;
+    }
     default:
         LOG_ERROR("[ImGui] No DirectX version detected after all retries. "
                   "d3d11.dll loaded: %s, d3d12.dll loaded: %s",
@@ -567,7 +1562,7 @@ MDB_IMGUI_API void mdb_imgui_shutdown() {
         return; // already cleaned up
     }
 
-    LOG_VERBOSE("[Shutdown] mdb_imgui_shutdown() running");
+    LOG_CHAN_VERBOSE(ImGui, "[Shutdown] mdb_imgui_shutdown() running");
 
     // Stop the Present hook from touching ImGui/DX resources.
     g_shutting_down.store(true);
@@ -582,6 +1577,8 @@ MDB_IMGUI_API void mdb_imgui_shutdown() {
         std::lock_guard<std::mutex> lock(g_callbackMutex);
         g_callbacks.clear();
         g_legacyCallback = nullptr;
+        RefreshHasDrawCallbacks();
+        RebuildCallbackSnapshot();
     }
 
     // Restore WndProc
@@ -598,9 +1595,30 @@ MDB_IMGUI_API void mdb_imgui_shutdown() {
         ImGui_ImplWin32_Shutdown();
         ImGui::DestroyContext();
         CleanupRenderTarget11();
+    } else if (g_dxVersion.load() == MDB_DX_12 && g_pd3dDevice12) {
+        // Drain in-flight overlay work before tearing down GPU resources
+        WaitForGpu12();
+        ImGui_ImplDX12_Shutdown();
+        ImGui_ImplWin32_Shutdown();
+        ImGui::DestroyContext();
+        CleanupRenderTargets12();
+        for (UINT i = 0; i < g_numFrames12; i++) {
+            if (g_frameContexts12[i].allocator) {
+                g_frameContexts12[i].allocator->Release();
+                g_frameContexts12[i].allocator = nullptr;
+            }
+        }
+        if (g_pCommandList12) { g_pCommandList12->Release(); g_pCommandList12 = nullptr; }
+        if (g_fence12) { g_fence12->Release(); g_fence12 = nullptr; }
+        if (g_fenceEvent12) { CloseHandle(g_fenceEvent12); g_fenceEvent12 = nullptr; }
+        if (g_pd3dRtvDescHeap12) { g_pd3dRtvDescHeap12->Release(); g_pd3dRtvDescHeap12 = nullptr; }
+        if (g_pd3dSrvDescHeap) { g_pd3dSrvDescHeap->Release(); g_pd3dSrvDescHeap = nullptr; }
+        if (g_pSwapChain3) { g_pSwapChain3->Release(); g_pSwapChain3 = nullptr; }
+        g_pd3dDevice12->Release();
+        g_pd3dDevice12 = nullptr;
     }
 
-    LOG_VERBOSE("[Shutdown] mdb_imgui_shutdown() complete");
+    LOG_CHAN_VERBOSE(ImGui, "[Shutdown] mdb_imgui_shutdown() complete");
 }
 
 MDB_IMGUI_API bool mdb_imgui_is_initialized() {
@@ -611,6 +1629,8 @@ MDB_IMGUI_API bool mdb_imgui_is_initialized() {
 MDB_IMGUI_API void mdb_imgui_register_draw_callback(MdbImGuiDrawCallback callback) {
     std::lock_guard<std::mutex> lock(g_callbackMutex);
     g_legacyCallback = callback;
+    RefreshHasDrawCallbacks();
+    RebuildCallbackSnapshot();
 }
 
 // ========== Multi-Callback API ==========
@@ -633,7 +1653,9 @@ MDB_IMGUI_API int mdb_imgui_add_callback(const char* name, MdbImGuiDrawCallback
     
     g_callbacks.push_back(info);
     SortCallbacks();
-    
+    RefreshHasDrawCallbacks();
+    RebuildCallbackSnapshot();
+
     return id;
 }
 
@@ -645,6 +1667,19 @@ MDB_IMGUI_API bool mdb_imgui_remove_callback(int callbackId) {
     
     if (it != g_callbacks.end()) {
         g_callbacks.erase(it);
+        RefreshHasDrawCallbacks();
+        RebuildCallbackSnapshot();
+
+        // Drop the cost history so a long-gone mod doesn't linger in the
+        // frame stats panel
+        {
+            std::lock_guard<std::mutex> statsLock(g_frameStatsMutex);
+            g_callbackCosts.erase(
+                std::remove_if(g_callbackCosts.begin(), g_callbackCosts.end(),
+                    [callbackId](const CallbackCost& cost) { return cost.id == callbackId; }),
+                g_callbackCosts.end());
+        }
+
         return true;
     }
     
@@ -659,6 +1694,7 @@ MDB_IMGUI_API bool mdb_imgui_set_callback_enabled(int callbackId, bool enabled)
     
     if (it != g_callbacks.end()) {
         it->enabled = enabled;
+        RebuildCallbackSnapshot();
         return true;
     }
     
@@ -682,6 +1718,47 @@ MDB_IMGUI_API void mdb_imgui_set_toggle_key(int vkCode) {
     g_toggleKey.store(vkCode);
 }
 
+MDB_IMGUI_API void mdb_imgui_set_stats_panel_visible(bool visible) {
+    g_showStatsPanel.store(visible);
+    // The panel is only useful with instrumentation running
+    mdb_export_stats_set_enabled(visible);
+}
+
+MDB_IMGUI_API int mdb_imgui_get_frame_stats(MdbImGuiFrameStat* out_stats, int cap) {
+    if (!out_stats || cap <= 0) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(g_frameStatsMutex);
+
+    int written = 0;
+    auto emit = [&](int id, const char* name, const FrameCostTracker& tracker) {
+        if (written >= cap || tracker.count == 0) {
+            return;
+        }
+        MdbImGuiFrameStat& s = out_stats[written++];
+        s.callback_id = id;
+        snprintf(s.name, sizeof(s.name), "%s", name);
+        s.last_ms = tracker.last_ms;
+        s.p50_ms = tracker.Percentile(0.5f);
+        s.p99_ms = tracker.Percentile(0.99f);
+    };
+
+    // Synthetic rows first: the overlay's own cost
+    emit(-1, "(imgui render)", g_renderCost);
+    emit(-2, "(command buffer)", g_replayCost);
+
+    for (const auto& cost : g_callbackCosts) {
+        emit(cost.id, cost.name.c_str(), cost.tracker);
+    }
+
+    return written;
+}
+
+MDB_IMGUI_API void mdb_imgui_set_frame_stats_visible(bool visible) {
+    g_showFrameStatsPanel.store(visible);
+}
+
 } // extern "C"
 
 // ========== Internal C++ API ==========
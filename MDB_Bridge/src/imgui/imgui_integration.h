@@ -81,6 +81,33 @@ MDB_IMGUI_API bool mdb_imgui_is_input_enabled();
 // Set the toggle key (default: VK_F2)
 MDB_IMGUI_API void mdb_imgui_set_toggle_key(int vkCode);
 
+// ========== Debug Panels ==========
+
+// Show or hide the built-in export statistics panel. Enables export
+// instrumentation on show, so call counts start accumulating immediately.
+MDB_IMGUI_API void mdb_imgui_set_stats_panel_visible(bool visible);
+
+// ========== Frame Profiling ==========
+
+// Per-callback frame cost. callback_id matches the id returned by
+// mdb_imgui_add_callback; two synthetic rows carry the overlay's own cost:
+//   -1 = ImGui render + draw-data submit
+//   -2 = command buffer replay
+// Percentiles are computed over a rolling window of recent frames.
+struct MdbImGuiFrameStat {
+    int callback_id;
+    char name[64];
+    float last_ms;
+    float p50_ms;
+    float p99_ms;
+};
+
+// Copy up to 'cap' frame stats into out_stats; returns the count written.
+MDB_IMGUI_API int mdb_imgui_get_frame_stats(MdbImGuiFrameStat* out_stats, int cap);
+
+// Show or hide the built-in frame cost panel (per-mod p50/p99 ms)
+MDB_IMGUI_API void mdb_imgui_set_frame_stats_visible(bool visible);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,26 +4,20 @@
 // Forwards all 17 version.dll API calls to the real system version.dll.
 // The .def file (version.def) maps each public export name to the _impl
 // function defined here, so callers see the original API surface.
+//
+// The forward table is resolved in ONE pass (all 17 addresses) the first
+// time it is needed, then every export body is a bare indirect call with
+// no branch — these forwards sit on the game's own API paths, so the
+// steady-state cost must be a single indirect jump. Before resolution the
+// table points at per-export first-call thunks that trigger the one-pass
+// resolve and retry; after it, at the real addresses (or at null-safe
+// fallbacks if the system DLL could not be loaded).
 
 #include "version_proxy.h"
 #include <windows.h>
 
 static HMODULE g_hRealVersion = nullptr;
-
-static void EnsureRealVersionLoaded()
-{
-    if (g_hRealVersion) return;
-
-    wchar_t sysDir[MAX_PATH];
-    GetSystemDirectoryW(sysDir, MAX_PATH);
-    wcscat_s(sysDir, L"\\version.dll");
-    g_hRealVersion = LoadLibraryW(sysDir);
-}
-
-void VersionProxy_Init()
-{
-    EnsureRealVersionLoaded();
-}
+static INIT_ONCE g_resolveOnce = INIT_ONCE_STATIC_INIT;
 
 // ---------------------------------------------------------------------------
 // Function-pointer typedefs
@@ -47,101 +41,255 @@ typedef BOOL  (WINAPI* fn_VerQueryValueA)(LPCVOID, LPCSTR, LPVOID*, PUINT);
 typedef BOOL  (WINAPI* fn_VerQueryValueW)(LPCVOID, LPCWSTR, LPVOID*, PUINT);
 
 // ---------------------------------------------------------------------------
-// Cached pointers (lazy-resolved on first call)
-// ---------------------------------------------------------------------------
-static fn_GetFileVersionInfoA         p_GetFileVersionInfoA         = nullptr;
-static fn_GetFileVersionInfoW         p_GetFileVersionInfoW         = nullptr;
-static fn_GetFileVersionInfoExA       p_GetFileVersionInfoExA       = nullptr;
-static fn_GetFileVersionInfoExW       p_GetFileVersionInfoExW       = nullptr;
-static fn_GetFileVersionInfoSizeA     p_GetFileVersionInfoSizeA     = nullptr;
-static fn_GetFileVersionInfoSizeW     p_GetFileVersionInfoSizeW     = nullptr;
-static fn_GetFileVersionInfoSizeExA   p_GetFileVersionInfoSizeExA   = nullptr;
-static fn_GetFileVersionInfoSizeExW   p_GetFileVersionInfoSizeExW   = nullptr;
-static fn_GetFileVersionInfoByHandle  p_GetFileVersionInfoByHandle  = nullptr;
-static fn_VerFindFileA                p_VerFindFileA                = nullptr;
-static fn_VerFindFileW                p_VerFindFileW                = nullptr;
-static fn_VerInstallFileA             p_VerInstallFileA             = nullptr;
-static fn_VerInstallFileW             p_VerInstallFileW             = nullptr;
-static fn_VerLanguageNameA            p_VerLanguageNameA            = nullptr;
-static fn_VerLanguageNameW            p_VerLanguageNameW            = nullptr;
-static fn_VerQueryValueA              p_VerQueryValueA              = nullptr;
-static fn_VerQueryValueW              p_VerQueryValueW              = nullptr;
+// Null-safe fallbacks — installed for any export the real DLL doesn't
+// provide (or all of them if it failed to load), so the table entries are
+// always callable and the export bodies never need a null check.
+// ---------------------------------------------------------------------------
+static BOOL  WINAPI Fallback_GetFileVersionInfoA(LPCSTR, DWORD, DWORD, LPVOID)                                          { return FALSE; }
+static BOOL  WINAPI Fallback_GetFileVersionInfoW(LPCWSTR, DWORD, DWORD, LPVOID)                                         { return FALSE; }
+static BOOL  WINAPI Fallback_GetFileVersionInfoExA(DWORD, LPCSTR, DWORD, DWORD, LPVOID)                                 { return FALSE; }
+static BOOL  WINAPI Fallback_GetFileVersionInfoExW(DWORD, LPCWSTR, DWORD, DWORD, LPVOID)                                { return FALSE; }
+static DWORD WINAPI Fallback_GetFileVersionInfoSizeA(LPCSTR, LPDWORD)                                                   { return 0; }
+static DWORD WINAPI Fallback_GetFileVersionInfoSizeW(LPCWSTR, LPDWORD)                                                  { return 0; }
+static DWORD WINAPI Fallback_GetFileVersionInfoSizeExA(DWORD, LPCSTR, LPDWORD)                                          { return 0; }
+static DWORD WINAPI Fallback_GetFileVersionInfoSizeExW(DWORD, LPCWSTR, LPDWORD)                                         { return 0; }
+static int   WINAPI Fallback_GetFileVersionInfoByHandle(DWORD, HANDLE)                                                  { return 0; }
+static DWORD WINAPI Fallback_VerFindFileA(DWORD, LPCSTR, LPCSTR, LPCSTR, LPSTR, PUINT, LPSTR, PUINT)                    { return 0; }
+static DWORD WINAPI Fallback_VerFindFileW(DWORD, LPCWSTR, LPCWSTR, LPCWSTR, LPWSTR, PUINT, LPWSTR, PUINT)               { return 0; }
+static DWORD WINAPI Fallback_VerInstallFileA(DWORD, LPCSTR, LPCSTR, LPCSTR, LPCSTR, LPCSTR, LPSTR, PUINT)               { return 0; }
+static DWORD WINAPI Fallback_VerInstallFileW(DWORD, LPCWSTR, LPCWSTR, LPCWSTR, LPCWSTR, LPCWSTR, LPWSTR, PUINT)         { return 0; }
+static DWORD WINAPI Fallback_VerLanguageNameA(DWORD, LPSTR, DWORD)                                                      { return 0; }
+static DWORD WINAPI Fallback_VerLanguageNameW(DWORD, LPWSTR, DWORD)                                                     { return 0; }
+static BOOL  WINAPI Fallback_VerQueryValueA(LPCVOID, LPCSTR, LPVOID*, PUINT)                                            { return FALSE; }
+static BOOL  WINAPI Fallback_VerQueryValueW(LPCVOID, LPCWSTR, LPVOID*, PUINT)                                           { return FALSE; }
+
+// ---------------------------------------------------------------------------
+// First-call thunks — each triggers the one-pass resolve of the WHOLE
+// table (not just its own entry) and retries through the updated pointer.
+// Only reachable if an export fires before VersionProxy_Init ran.
+// ---------------------------------------------------------------------------
+static void ResolveForwardTable();
+
+static BOOL  WINAPI First_GetFileVersionInfoA(LPCSTR f, DWORD h, DWORD len, LPVOID d);
+static BOOL  WINAPI First_GetFileVersionInfoW(LPCWSTR f, DWORD h, DWORD len, LPVOID d);
+static BOOL  WINAPI First_GetFileVersionInfoExA(DWORD fl, LPCSTR f, DWORD h, DWORD len, LPVOID d);
+static BOOL  WINAPI First_GetFileVersionInfoExW(DWORD fl, LPCWSTR f, DWORD h, DWORD len, LPVOID d);
+static DWORD WINAPI First_GetFileVersionInfoSizeA(LPCSTR f, LPDWORD h);
+static DWORD WINAPI First_GetFileVersionInfoSizeW(LPCWSTR f, LPDWORD h);
+static DWORD WINAPI First_GetFileVersionInfoSizeExA(DWORD fl, LPCSTR f, LPDWORD h);
+static DWORD WINAPI First_GetFileVersionInfoSizeExW(DWORD fl, LPCWSTR f, LPDWORD h);
+static int   WINAPI First_GetFileVersionInfoByHandle(DWORD fl, HANDLE hf);
+static DWORD WINAPI First_VerFindFileA(DWORD fl, LPCSTR fn, LPCSTR wd, LPCSTR ad, LPSTR cd, PUINT cl, LPSTR dd, PUINT dl);
+static DWORD WINAPI First_VerFindFileW(DWORD fl, LPCWSTR fn, LPCWSTR wd, LPCWSTR ad, LPWSTR cd, PUINT cl, LPWSTR dd, PUINT dl);
+static DWORD WINAPI First_VerInstallFileA(DWORD fl, LPCSTR sf, LPCSTR df, LPCSTR sd, LPCSTR dd, LPCSTR cd, LPSTR tf, PUINT tl);
+static DWORD WINAPI First_VerInstallFileW(DWORD fl, LPCWSTR sf, LPCWSTR df, LPCWSTR sd, LPCWSTR dd, LPCWSTR cd, LPWSTR tf, PUINT tl);
+static DWORD WINAPI First_VerLanguageNameA(DWORD lang, LPSTR buf, DWORD sz);
+static DWORD WINAPI First_VerLanguageNameW(DWORD lang, LPWSTR buf, DWORD sz);
+static BOOL  WINAPI First_VerQueryValueA(LPCVOID blk, LPCSTR sub, LPVOID* buf, PUINT len);
+static BOOL  WINAPI First_VerQueryValueW(LPCVOID blk, LPCWSTR sub, LPVOID* buf, PUINT len);
+
+// ---------------------------------------------------------------------------
+// Forward table — starts at the first-call thunks, never null
+// ---------------------------------------------------------------------------
+static fn_GetFileVersionInfoA         p_GetFileVersionInfoA         = First_GetFileVersionInfoA;
+static fn_GetFileVersionInfoW         p_GetFileVersionInfoW         = First_GetFileVersionInfoW;
+static fn_GetFileVersionInfoExA       p_GetFileVersionInfoExA       = First_GetFileVersionInfoExA;
+static fn_GetFileVersionInfoExW       p_GetFileVersionInfoExW       = First_GetFileVersionInfoExW;
+static fn_GetFileVersionInfoSizeA     p_GetFileVersionInfoSizeA     = First_GetFileVersionInfoSizeA;
+static fn_GetFileVersionInfoSizeW     p_GetFileVersionInfoSizeW     = First_GetFileVersionInfoSizeW;
+static fn_GetFileVersionInfoSizeExA   p_GetFileVersionInfoSizeExA   = First_GetFileVersionInfoSizeExA;
+static fn_GetFileVersionInfoSizeExW   p_GetFileVersionInfoSizeExW   = First_GetFileVersionInfoSizeExW;
+static fn_GetFileVersionInfoByHandle  p_GetFileVersionInfoByHandle  = First_GetFileVersionInfoByHandle;
+static fn_VerFindFileA                p_VerFindFileA                = First_VerFindFileA;
+static fn_VerFindFileW                p_VerFindFileW                = First_VerFindFileW;
+static fn_VerInstallFileA             p_VerInstallFileA             = First_VerInstallFileA;
+static fn_VerInstallFileW             p_VerInstallFileW             = First_VerInstallFileW;
+static fn_VerLanguageNameA            p_VerLanguageNameA            = First_VerLanguageNameA;
+static fn_VerLanguageNameW            p_VerLanguageNameW            = First_VerLanguageNameW;
+static fn_VerQueryValueA              p_VerQueryValueA              = First_VerQueryValueA;
+static fn_VerQueryValueW              p_VerQueryValueW              = First_VerQueryValueW;
+
+// ---------------------------------------------------------------------------
+// One-pass resolution
+// ---------------------------------------------------------------------------
+static BOOL CALLBACK ResolveForwardTableOnce(PINIT_ONCE, PVOID, PVOID*)
+{
+    wchar_t sysDir[MAX_PATH];
+    GetSystemDirectoryW(sysDir, MAX_PATH);
+    wcscat_s(sysDir, L"\\version.dll");
+    g_hRealVersion = LoadLibraryW(sysDir);
 
+    // Real address when the export exists, fallback otherwise — the table
+    // holds no nulls either way. Plain stores are fine: InitOnce publishes
+    // the table with the necessary ordering before any waiter proceeds,
+    // and pre-resolution readers see the first-call thunks.
 #define RESOLVE(name) \
-    do { if (!p_##name) { EnsureRealVersionLoaded(); if (g_hRealVersion) p_##name = reinterpret_cast<fn_##name>(GetProcAddress(g_hRealVersion, #name)); } } while(0)
+    do { \
+        fn_##name fp = g_hRealVersion \
+            ? reinterpret_cast<fn_##name>(GetProcAddress(g_hRealVersion, #name)) : nullptr; \
+        p_##name = fp ? fp : Fallback_##name; \
+    } while(0)
+
+    RESOLVE(GetFileVersionInfoA);
+    RESOLVE(GetFileVersionInfoW);
+    RESOLVE(GetFileVersionInfoExA);
+    RESOLVE(GetFileVersionInfoExW);
+    RESOLVE(GetFileVersionInfoSizeA);
+    RESOLVE(GetFileVersionInfoSizeW);
+    RESOLVE(GetFileVersionInfoSizeExA);
+    RESOLVE(GetFileVersionInfoSizeExW);
+    RESOLVE(GetFileVersionInfoByHandle);
+    RESOLVE(VerFindFileA);
+    RESOLVE(VerFindFileW);
+    RESOLVE(VerInstallFileA);
+    RESOLVE(VerInstallFileW);
+    RESOLVE(VerLanguageNameA);
+    RESOLVE(VerLanguageNameW);
+    RESOLVE(VerQueryValueA);
+    RESOLVE(VerQueryValueW);
+
+#undef RESOLVE
+    return TRUE;
+}
+
+static void ResolveForwardTable()
+{
+    InitOnceExecuteOnce(&g_resolveOnce, ResolveForwardTableOnce, nullptr, nullptr);
+}
+
+void VersionProxy_Init()
+{
+    ResolveForwardTable();
+}
+
+// ---------------------------------------------------------------------------
+// First-call thunk bodies — resolve everything, retry through the table
+// ---------------------------------------------------------------------------
+static BOOL WINAPI First_GetFileVersionInfoA(LPCSTR f, DWORD h, DWORD len, LPVOID d) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoA(f, h, len, d);
+}
+static BOOL WINAPI First_GetFileVersionInfoW(LPCWSTR f, DWORD h, DWORD len, LPVOID d) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoW(f, h, len, d);
+}
+static BOOL WINAPI First_GetFileVersionInfoExA(DWORD fl, LPCSTR f, DWORD h, DWORD len, LPVOID d) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoExA(fl, f, h, len, d);
+}
+static BOOL WINAPI First_GetFileVersionInfoExW(DWORD fl, LPCWSTR f, DWORD h, DWORD len, LPVOID d) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoExW(fl, f, h, len, d);
+}
+static DWORD WINAPI First_GetFileVersionInfoSizeA(LPCSTR f, LPDWORD h) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoSizeA(f, h);
+}
+static DWORD WINAPI First_GetFileVersionInfoSizeW(LPCWSTR f, LPDWORD h) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoSizeW(f, h);
+}
+static DWORD WINAPI First_GetFileVersionInfoSizeExA(DWORD fl, LPCSTR f, LPDWORD h) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoSizeExA(fl, f, h);
+}
+static DWORD WINAPI First_GetFileVersionInfoSizeExW(DWORD fl, LPCWSTR f, LPDWORD h) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoSizeExW(fl, f, h);
+}
+static int WINAPI First_GetFileVersionInfoByHandle(DWORD fl, HANDLE hf) {
+    ResolveForwardTable();
+    return p_GetFileVersionInfoByHandle(fl, hf);
+}
+static DWORD WINAPI First_VerFindFileA(DWORD fl, LPCSTR fn, LPCSTR wd, LPCSTR ad, LPSTR cd, PUINT cl, LPSTR dd, PUINT dl) {
+    ResolveForwardTable();
+    return p_VerFindFileA(fl, fn, wd, ad, cd, cl, dd, dl);
+}
+static DWORD WINAPI First_VerFindFileW(DWORD fl, LPCWSTR fn, LPCWSTR wd, LPCWSTR ad, LPWSTR cd, PUINT cl, LPWSTR dd, PUINT dl) {
+    ResolveForwardTable();
+    return p_VerFindFileW(fl, fn, wd, ad, cd, cl, dd, dl);
+}
+static DWORD WINAPI First_VerInstallFileA(DWORD fl, LPCSTR sf, LPCSTR df, LPCSTR sd, LPCSTR dd, LPCSTR cd, LPSTR tf, PUINT tl) {
+    ResolveForwardTable();
+    return p_VerInstallFileA(fl, sf, df, sd, dd, cd, tf, tl);
+}
+static DWORD WINAPI First_VerInstallFileW(DWORD fl, LPCWSTR sf, LPCWSTR df, LPCWSTR sd, LPCWSTR dd, LPCWSTR cd, LPWSTR tf, PUINT tl) {
+    ResolveForwardTable();
+    return p_VerInstallFileW(fl, sf, df, sd, dd, cd, tf, tl);
+}
+static DWORD WINAPI First_VerLanguageNameA(DWORD lang, LPSTR buf, DWORD sz) {
+    ResolveForwardTable();
+    return p_VerLanguageNameA(lang, buf, sz);
+}
+static DWORD WINAPI First_VerLanguageNameW(DWORD lang, LPWSTR buf, DWORD sz) {
+    ResolveForwardTable();
+    return p_VerLanguageNameW(lang, buf, sz);
+}
+static BOOL WINAPI First_VerQueryValueA(LPCVOID blk, LPCSTR sub, LPVOID* buf, PUINT len) {
+    ResolveForwardTable();
+    return p_VerQueryValueA(blk, sub, buf, len);
+}
+static BOOL WINAPI First_VerQueryValueW(LPCVOID blk, LPCWSTR sub, LPVOID* buf, PUINT len) {
+    ResolveForwardTable();
+    return p_VerQueryValueW(blk, sub, buf, len);
+}
 
 // ---------------------------------------------------------------------------
 // Proxy implementations  (exported via version.def as the real API names)
-// NULL-safe: if the real DLL failed to load, return sensible defaults.
+// Bare indirect tail calls — no branch, no null check, the table entry is
+// always callable.
 // ---------------------------------------------------------------------------
 
 extern "C" BOOL WINAPI GetFileVersionInfoA_impl(LPCSTR f, DWORD h, DWORD len, LPVOID d) {
-    RESOLVE(GetFileVersionInfoA);
-    return p_GetFileVersionInfoA ? p_GetFileVersionInfoA(f, h, len, d) : FALSE;
+    return p_GetFileVersionInfoA(f, h, len, d);
 }
 extern "C" BOOL WINAPI GetFileVersionInfoW_impl(LPCWSTR f, DWORD h, DWORD len, LPVOID d) {
-    RESOLVE(GetFileVersionInfoW);
-    return p_GetFileVersionInfoW ? p_GetFileVersionInfoW(f, h, len, d) : FALSE;
+    return p_GetFileVersionInfoW(f, h, len, d);
 }
 extern "C" BOOL WINAPI GetFileVersionInfoExA_impl(DWORD fl, LPCSTR f, DWORD h, DWORD len, LPVOID d) {
-    RESOLVE(GetFileVersionInfoExA);
-    return p_GetFileVersionInfoExA ? p_GetFileVersionInfoExA(fl, f, h, len, d) : FALSE;
+    return p_GetFileVersionInfoExA(fl, f, h, len, d);
 }
 extern "C" BOOL WINAPI GetFileVersionInfoExW_impl(DWORD fl, LPCWSTR f, DWORD h, DWORD len, LPVOID d) {
-    RESOLVE(GetFileVersionInfoExW);
-    return p_GetFileVersionInfoExW ? p_GetFileVersionInfoExW(fl, f, h, len, d) : FALSE;
+    return p_GetFileVersionInfoExW(fl, f, h, len, d);
 }
 extern "C" DWORD WINAPI GetFileVersionInfoSizeA_impl(LPCSTR f, LPDWORD h) {
-    RESOLVE(GetFileVersionInfoSizeA);
-    return p_GetFileVersionInfoSizeA ? p_GetFileVersionInfoSizeA(f, h) : 0;
+    return p_GetFileVersionInfoSizeA(f, h);
 }
 extern "C" DWORD WINAPI GetFileVersionInfoSizeW_impl(LPCWSTR f, LPDWORD h) {
-    RESOLVE(GetFileVersionInfoSizeW);
-    return p_GetFileVersionInfoSizeW ? p_GetFileVersionInfoSizeW(f, h) : 0;
+    return p_GetFileVersionInfoSizeW(f, h);
 }
 extern "C" DWORD WINAPI GetFileVersionInfoSizeExA_impl(DWORD fl, LPCSTR f, LPDWORD h) {
-    RESOLVE(GetFileVersionInfoSizeExA);
-    return p_GetFileVersionInfoSizeExA ? p_GetFileVersionInfoSizeExA(fl, f, h) : 0;
+    return p_GetFileVersionInfoSizeExA(fl, f, h);
 }
 extern "C" DWORD WINAPI GetFileVersionInfoSizeExW_impl(DWORD fl, LPCWSTR f, LPDWORD h) {
-    RESOLVE(GetFileVersionInfoSizeExW);
-    return p_GetFileVersionInfoSizeExW ? p_GetFileVersionInfoSizeExW(fl, f, h) : 0;
+    return p_GetFileVersionInfoSizeExW(fl, f, h);
 }
 extern "C" int WINAPI GetFileVersionInfoByHandle_impl(DWORD fl, HANDLE hf) {
-    RESOLVE(GetFileVersionInfoByHandle);
-    return p_GetFileVersionInfoByHandle ? p_GetFileVersionInfoByHandle(fl, hf) : 0;
+    return p_GetFileVersionInfoByHandle(fl, hf);
 }
 extern "C" DWORD WINAPI VerFindFileA_impl(DWORD fl, LPCSTR fn, LPCSTR wd, LPCSTR ad, LPSTR cd, PUINT cl, LPSTR dd, PUINT dl) {
-    RESOLVE(VerFindFileA);
-    return p_VerFindFileA ? p_VerFindFileA(fl, fn, wd, ad, cd, cl, dd, dl) : 0;
+    return p_VerFindFileA(fl, fn, wd, ad, cd, cl, dd, dl);
 }
 extern "C" DWORD WINAPI VerFindFileW_impl(DWORD fl, LPCWSTR fn, LPCWSTR wd, LPCWSTR ad, LPWSTR cd, PUINT cl, LPWSTR dd, PUINT dl) {
-    RESOLVE(VerFindFileW);
-    return p_VerFindFileW ? p_VerFindFileW(fl, fn, wd, ad, cd, cl, dd, dl) : 0;
+    return p_VerFindFileW(fl, fn, wd, ad, cd, cl, dd, dl);
 }
 extern "C" DWORD WINAPI VerInstallFileA_impl(DWORD fl, LPCSTR sf, LPCSTR df, LPCSTR sd, LPCSTR dd, LPCSTR cd, LPSTR tf, PUINT tl) {
-    RESOLVE(VerInstallFileA);
-    return p_VerInstallFileA ? p_VerInstallFileA(fl, sf, df, sd, dd, cd, tf, tl) : 0;
+    return p_VerInstallFileA(fl, sf, df, sd, dd, cd, tf, tl);
 }
 extern "C" DWORD WINAPI VerInstallFileW_impl(DWORD fl, LPCWSTR sf, LPCWSTR df, LPCWSTR sd, LPCWSTR dd, LPCWSTR cd, LPWSTR tf, PUINT tl) {
-    RESOLVE(VerInstallFileW);
-    return p_VerInstallFileW ? p_VerInstallFileW(fl, sf, df, sd, dd, cd, tf, tl) : 0;
+    return p_VerInstallFileW(fl, sf, df, sd, dd, cd, tf, tl);
 }
 extern "C" DWORD WINAPI VerLanguageNameA_impl(DWORD lang, LPSTR buf, DWORD sz) {
-    RESOLVE(VerLanguageNameA);
-    return p_VerLanguageNameA ? p_VerLanguageNameA(lang, buf, sz) : 0;
+    return p_VerLanguageNameA(lang, buf, sz);
 }
 extern "C" DWORD WINAPI VerLanguageNameW_impl(DWORD lang, LPWSTR buf, DWORD sz) {
-    RESOLVE(VerLanguageNameW);
-    return p_VerLanguageNameW ? p_VerLanguageNameW(lang, buf, sz) : 0;
+    return p_VerLanguageNameW(lang, buf, sz);
 }
 extern "C" BOOL WINAPI VerQueryValueA_impl(LPCVOID blk, LPCSTR sub, LPVOID* buf, PUINT len) {
-    RESOLVE(VerQueryValueA);
-    return p_VerQueryValueA ? p_VerQueryValueA(blk, sub, buf, len) : FALSE;
+    return p_VerQueryValueA(blk, sub, buf, len);
 }
 extern "C" BOOL WINAPI VerQueryValueW_impl(LPCVOID blk, LPCWSTR sub, LPVOID* buf, PUINT len) {
-    RESOLVE(VerQueryValueW);
-    return p_VerQueryValueW ? p_VerQueryValueW(blk, sub, buf, len) : FALSE;
+    return p_VerQueryValueW(blk, sub, buf, len);
 }
 
 // ---------------------------------------------------------------------------
@@ -7,8 +7,10 @@
 
 #pragma once
 
-/// Call as early as possible (DLL_PROCESS_ATTACH) to load the real
-/// system version.dll so that forwarded APIs are ready immediately.
+/// Resolve the complete forward table (real version.dll loaded and all 17
+/// addresses fetched in one pass). Call from the init thread, NOT under
+/// the loader lock — LoadLibrary in DllMain can deadlock. Exports called
+/// before this runs resolve the table themselves via first-call thunks.
 void VersionProxy_Init();
 
 /// Call during DLL_PROCESS_DETACH to free the real version.dll handle.
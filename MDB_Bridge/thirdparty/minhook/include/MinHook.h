@@ -177,6 +177,15 @@ extern "C" {
     // Applies all queued changes in one go.
     MH_STATUS WINAPI MH_ApplyQueued(VOID);
 
+    // Preallocates trampoline memory blocks near pOrigin so that later
+    // MH_CreateHook calls on targets in that region do not have to call
+    // VirtualAlloc. Each block holds roughly 60 trampolines.
+    // Parameters:
+    //   pOrigin     [in] An address near the expected hook targets
+    //                    (e.g. a module base).
+    //   blockCount  [in] Number of blocks to preallocate.
+    MH_STATUS WINAPI MH_PrewarmTrampolinePool(LPVOID pOrigin, UINT blockCount);
+
     // Translates the MH_STATUS to its name as a string.
     const char *WINAPI MH_StatusToString(MH_STATUS status);
 
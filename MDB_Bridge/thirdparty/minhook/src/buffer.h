@@ -40,3 +40,4 @@ VOID   UninitializeBuffer(VOID);
 LPVOID AllocateBuffer(LPVOID pOrigin);
 VOID   FreeBuffer(LPVOID pBuffer);
 BOOL   IsExecutableAddress(LPVOID pAddress);
+UINT   PrewarmBuffer(LPVOID pOrigin, UINT uBlockCount);
@@ -880,6 +880,28 @@ MH_STATUS WINAPI MH_ApplyQueued(VOID)
     return status;
 }
 
+//-------------------------------------------------------------------------
+MH_STATUS WINAPI MH_PrewarmTrampolinePool(LPVOID pOrigin, UINT blockCount)
+{
+    MH_STATUS status = MH_OK;
+
+    EnterSpinLock();
+
+    if (g_hHeap != NULL)
+    {
+        if (PrewarmBuffer(pOrigin, blockCount) == 0)
+            status = MH_ERROR_MEMORY_ALLOC;
+    }
+    else
+    {
+        status = MH_ERROR_NOT_INITIALIZED;
+    }
+
+    LeaveSpinLock();
+
+    return status;
+}
+
 //-------------------------------------------------------------------------
 MH_STATUS WINAPI MH_CreateHookApiEx(
     LPCWSTR pszModule, LPCSTR pszProcName, LPVOID pDetour,
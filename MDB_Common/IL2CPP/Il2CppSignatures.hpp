@@ -1,24 +1,44 @@
 #pragma once
+#include <Windows.h>
 #include <vector>
 #include <string>
 
 // ============================================================================
 // IL2CPP Function Signatures for Pattern Scanning - Shared Implementation
-// 
+//
 // When exports are obfuscated, we fall back to pattern scanning.
 // Each function has:
 // - Original export name
 // - Byte patterns (multiple variants for different Unity versions)
 // - Known obfuscation suffixes
-// 
+//
 // This is used by both the dumper and bridge to resolve IL2CPP functions
 // when standard GetProcAddress fails.
+//
+// Patterns carry a Unity-generation bitmask so scanners skip byte patterns
+// that cannot match the running engine — a failed full-section scan is the
+// most expensive no-op in the startup path. The generation is detected
+// once from UnityPlayer.dll's version resource (see DetectUnityGeneration);
+// when detection fails, every pattern stays eligible (old behavior).
 // ============================================================================
 
+// Bitmask of engine generations a pattern can match. Signature drift is
+// per-generation, not per-point-release, so major version is enough.
+enum UnityGeneration : unsigned {
+    UNITY_UNKNOWN = 0,
+    UNITY_2019    = 1u << 0,
+    UNITY_2020    = 1u << 1,
+    UNITY_2021    = 1u << 2,
+    UNITY_2022    = 1u << 3,
+    UNITY_2023    = 1u << 4,
+    UNITY_ANY     = 0xFFFFFFFFu,
+};
+
 struct SignaturePattern {
     const char* pattern;
     const char* mask;
     const char* description; // Unity version or other identifying info
+    unsigned versions = UNITY_ANY; // UnityGeneration bitmask
 };
 
 struct FunctionSignature {
@@ -34,6 +54,74 @@ struct FunctionSignature {
 
 namespace Il2CppSignatures {
 
+    // ========================================================================
+    // Engine generation detection
+    // ========================================================================
+
+    // Read the major file version (e.g. 2021 from "2021.3.16f1") straight
+    // out of a mapped module's VS_VERSION_INFO resource. Deliberately avoids
+    // the version.dll APIs — the bridge ships AS a version.dll proxy, so
+    // linking against them would resolve back into our own module.
+    inline unsigned ReadModuleMajorVersion(HMODULE hModule) {
+        if (!hModule) return 0;
+
+        HRSRC res = FindResourceW(hModule, MAKEINTRESOURCEW(1),
+                                  MAKEINTRESOURCEW(16) /* RT_VERSION */);
+        if (!res) return 0;
+        HGLOBAL block = LoadResource(hModule, res);
+        if (!block) return 0;
+        auto* data = static_cast<const BYTE*>(LockResource(block));
+        DWORD size = SizeofResource(hModule, res);
+        if (!data || size < sizeof(VS_FIXEDFILEINFO)) return 0;
+
+        // VS_FIXEDFILEINFO sits at a variable offset inside the resource;
+        // locate it by its signature
+        for (DWORD off = 0; off + sizeof(VS_FIXEDFILEINFO) <= size; off += 4) {
+            auto* ffi = reinterpret_cast<const VS_FIXEDFILEINFO*>(data + off);
+            if (ffi->dwSignature == 0xFEEF04BD) {
+                return HIWORD(ffi->dwFileVersionMS);
+            }
+        }
+        return 0;
+    }
+
+    // One-time engine generation detection from UnityPlayer.dll (falls back
+    // to GameAssembly.dll — some titles stamp the Unity version there too).
+    // UNITY_UNKNOWN means "scan everything"; never worse than the old path.
+    inline UnityGeneration DetectUnityGeneration() {
+        static const UnityGeneration s_generation = [] {
+            unsigned major = ReadModuleMajorVersion(GetModuleHandleW(L"UnityPlayer.dll"));
+            if (!major) major = ReadModuleMajorVersion(GetModuleHandleW(L"GameAssembly.dll"));
+            switch (major) {
+            case 2019: return UNITY_2019;
+            case 2020: return UNITY_2020;
+            case 2021: return UNITY_2021;
+            case 2022: return UNITY_2022;
+            case 2023: return UNITY_2023;
+            default:   return UNITY_UNKNOWN;
+            }
+        }();
+        return s_generation;
+    }
+
+    // True when 'p' can match the detected engine generation
+    inline bool PatternApplies(const SignaturePattern& p) {
+        UnityGeneration gen = DetectUnityGeneration();
+        if (gen == UNITY_UNKNOWN) return true;
+        return (p.versions & gen) != 0;
+    }
+
+    // The patterns of 'sig' worth scanning on this engine, in declaration
+    // order — scanners iterate this instead of sig.patterns directly
+    inline std::vector<const SignaturePattern*> ApplicablePatterns(const FunctionSignature& sig) {
+        std::vector<const SignaturePattern*> result;
+        result.reserve(sig.patterns.size());
+        for (const auto& p : sig.patterns) {
+            if (PatternApplies(p)) result.push_back(&p);
+        }
+        return result;
+    }
+
     // il2cpp_domain_get - returns pointer to IL2CPP domain
     // Very simple function: just loads and returns a global pointer
     // mov rax, [rip+offset]; ret
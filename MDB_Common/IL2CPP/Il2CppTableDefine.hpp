@@ -161,3 +161,76 @@
 #define ASSEMBLYREF_RETARGETABLE_FLAG                  0x00000100
 #define ASSEMBLYREF_ENABLEJITCOMPILE_TRACKING_FLAG     0x00008000
 #define ASSEMBLYREF_DISABLEJITCOMPILE_OPTIMIZER_FLAG   0x00004000
+
+// ---------------------------------------------------------------------------
+// IL2CPP Export Binding Table
+// ---------------------------------------------------------------------------
+// Single source of truth for the GameAssembly exports the resolver binds.
+// The slot variable, the export name and (for required exports) the
+// Il2CppStatus reported when it is missing all derive from one entry here,
+// so adding an export is a one-line table edit — the binder in
+// il2cpp_resolver.hpp expands these X-macros and needs no per-export code.
+//
+// Required exports abort ensure_exports() with their status when absent;
+// optional exports bind best-effort (dumper/introspection features degrade
+// gracefully without them). All names go through the unified
+// resolve_export fallback chain (disk RVA cache -> export table snapshot
+// -> obfuscation suffix mapping -> GetProcAddress).
+
+// X(slot_and_export_name, status_when_missing)
+#define MDB_IL2CPP_REQUIRED_EXPORTS(X) \
+    X(il2cpp_domain_get,                 Missing_domain_get) \
+    X(il2cpp_thread_attach,              Missing_thread_attach) \
+    X(il2cpp_domain_get_assemblies,      Missing_domain_get_assemblies) \
+    X(il2cpp_class_from_name,            Missing_class_from_name) \
+    X(il2cpp_class_get_method_from_name, Missing_class_get_method_from_name) \
+    X(il2cpp_class_get_field_from_name,  Missing_class_get_field_from_name) \
+    X(il2cpp_field_get_value,            Missing_field_get_set) \
+    X(il2cpp_field_set_value,            Missing_field_get_set) \
+    X(il2cpp_field_static_get_value,     Missing_field_get_set) \
+    X(il2cpp_field_static_set_value,     Missing_field_get_set) \
+    X(il2cpp_object_new,                 GetProcAddressFailed)
+
+// X(slot_and_export_name)
+#define MDB_IL2CPP_OPTIONAL_EXPORTS(X) \
+    X(il2cpp_string_new) \
+    X(il2cpp_thread_detach) \
+    /* -- Dumper/introspection APIs (used by il2cpp_dumper.cpp) -- */ \
+    X(il2cpp_assembly_get_image) \
+    X(il2cpp_image_get_name) \
+    X(il2cpp_image_get_class_count) \
+    X(il2cpp_image_get_class) \
+    X(il2cpp_class_get_type) \
+    X(il2cpp_class_from_type) \
+    X(il2cpp_class_get_namespace) \
+    X(il2cpp_class_get_flags) \
+    X(il2cpp_class_is_valuetype) \
+    X(il2cpp_class_is_enum) \
+    X(il2cpp_class_get_name) \
+    X(il2cpp_class_get_declaring_type) \
+    X(il2cpp_class_get_parent) \
+    X(il2cpp_class_get_interfaces) \
+    X(il2cpp_class_get_fields) \
+    X(il2cpp_field_get_flags) \
+    X(il2cpp_field_get_type) \
+    X(il2cpp_field_get_name) \
+    X(il2cpp_field_get_offset) \
+    X(il2cpp_class_get_properties) \
+    X(il2cpp_property_get_get_method) \
+    X(il2cpp_property_get_set_method) \
+    X(il2cpp_property_get_name) \
+    X(il2cpp_method_get_flags) \
+    X(il2cpp_method_get_return_type) \
+    X(il2cpp_method_get_param) \
+    X(il2cpp_class_get_methods) \
+    X(il2cpp_type_is_byref) \
+    X(il2cpp_method_get_name) \
+    X(il2cpp_method_get_param_count) \
+    X(il2cpp_method_get_param_name) \
+    /* -- Generic method inflation APIs -- */ \
+    X(il2cpp_method_get_object) \
+    X(il2cpp_method_get_from_reflection) \
+    X(il2cpp_type_get_object) \
+    X(il2cpp_object_get_class) \
+    X(il2cpp_array_new) \
+    X(il2cpp_runtime_invoke)
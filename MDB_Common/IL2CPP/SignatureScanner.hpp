@@ -1,10 +1,18 @@
 #pragma once
 #include <Windows.h>
 #include <Psapi.h>
+#include <intrin.h>
+#include <immintrin.h>
 #include <vector>
 #include <string>
 #include <unordered_map>
 #include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
 
 #pragma comment(lib, "psapi.lib")
 
@@ -72,9 +80,24 @@ public:
             }
         }
         
+        // Warm the freshly mapped section pages in the background while the
+        // export map is built — cold page faults otherwise dominate the first
+        // FindPattern/FindString sweep on large modules.
+        std::thread prefetch([]() { PrefetchSections(); });
+
         // Build export map for suffix matching and thunk analysis
         BuildExportMap(hModule);
-        
+
+        prefetch.join();
+
+        // Reset lazy caches in case we're re-initialized with a new module
+        s_leaIndex.clear();
+        s_leaIndexBuilt = false;
+        s_thunkMemo.clear();
+
+        // Restore previously resolved scan results for this exact module build
+        LoadScanCache();
+
         s_initialized = true;
         return true;
     }
@@ -93,7 +116,14 @@ public:
     /// </summary>
     static uintptr_t FindPattern(const char* pattern, const char* mask) {
         if (!s_initialized || !s_module.textStart) return 0;
-        return FindPatternInternal(s_module.textStart, s_module.textSize, pattern, mask);
+
+        std::string key = "pat:" + HexEncode(pattern, strlen(mask)) + ":" + mask;
+        uintptr_t cached;
+        if (CacheLookup(key, cached)) return cached;
+
+        uintptr_t result = FindPatternInternal(s_module.textStart, s_module.textSize, pattern, mask);
+        CacheStore(key, result);
+        return result;
     }
 
     /// <summary>
@@ -101,7 +131,181 @@ public:
     /// </summary>
     static uintptr_t FindPatternInModule(const char* pattern, const char* mask) {
         if (!s_initialized) return 0;
-        return FindPatternInternal(s_module.base, s_module.size, pattern, mask);
+
+        std::string key = "mod:" + HexEncode(pattern, strlen(mask)) + ":" + mask;
+        uintptr_t cached;
+        if (CacheLookup(key, cached)) return cached;
+
+        uintptr_t result = FindPatternInternal(s_module.base, s_module.size, pattern, mask);
+        CacheStore(key, result);
+        return result;
+    }
+
+    /// <summary>
+    /// Parallel pattern scan in .text section — splits the section into
+    /// per-core chunks (overlapping by pattern length at boundaries so
+    /// matches spanning a boundary aren't missed) and scans them on worker
+    /// threads. Returns the lowest-address hit, matching the semantics of
+    /// the single-threaded FindPattern.
+    /// </summary>
+    static uintptr_t FindPatternParallel(const char* pattern, const char* mask) {
+        if (!s_initialized || !s_module.textStart) return 0;
+        return FindPatternParallelInternal(s_module.textStart, s_module.textSize, pattern, mask);
+    }
+
+    /// <summary>
+    /// Parallel pattern scan over the entire module
+    /// </summary>
+    static uintptr_t FindPatternInModuleParallel(const char* pattern, const char* mask) {
+        if (!s_initialized) return 0;
+        return FindPatternParallelInternal(s_module.base, s_module.size, pattern, mask);
+    }
+
+    /// <summary>
+    /// A signature preprocessed once so the scan loop never re-parses the
+    /// mask: length, anchor byte, wildcard flags, and a Boyer-Moore-Horspool
+    /// skip table for jumping over non-matching regions.
+    /// </summary>
+    struct CompiledPattern {
+        const char* pattern;
+        const char* mask;
+        size_t length;
+        size_t anchorIdx;       // first non-wildcard position (== length if all wildcards)
+        uint8_t skip[256];      // BMH shift per byte value at the window's last position
+    };
+
+    /// <summary>
+    /// Build a CompiledPattern from a pattern/mask pair. Call once per
+    /// signature; the result is safe to reuse across scans.
+    /// Wildcard positions match every byte, so they reset the skip table
+    /// conservatively for all byte values.
+    /// </summary>
+    static CompiledPattern CompilePattern(const char* pattern, const char* mask) {
+        CompiledPattern cp = {};
+        cp.pattern = pattern;
+        cp.mask = mask;
+        cp.length = strlen(mask);
+
+        cp.anchorIdx = 0;
+        while (cp.anchorIdx < cp.length && mask[cp.anchorIdx] != 'x') cp.anchorIdx++;
+
+        // Default shift: full pattern length
+        for (int b = 0; b < 256; b++) {
+            cp.skip[b] = static_cast<uint8_t>(cp.length > 255 ? 255 : cp.length);
+        }
+        // Positions 0..len-2 tighten the shift for bytes they can match
+        for (size_t j = 0; j + 1 < cp.length; j++) {
+            uint8_t shift = static_cast<uint8_t>(
+                (cp.length - 1 - j) > 255 ? 255 : (cp.length - 1 - j));
+            if (mask[j] == 'x') {
+                uint8_t b = static_cast<uint8_t>(pattern[j]);
+                if (shift < cp.skip[b]) cp.skip[b] = shift;
+            } else {
+                // Wildcard matches any byte — cap every entry
+                for (int b = 0; b < 256; b++) {
+                    if (shift < cp.skip[b]) cp.skip[b] = shift;
+                }
+            }
+        }
+        return cp;
+    }
+
+    /// <summary>
+    /// Pattern scan in .text using a precompiled pattern (BMH skip loop)
+    /// </summary>
+    static uintptr_t FindPattern(const CompiledPattern& compiled) {
+        if (!s_initialized || !s_module.textStart) return 0;
+
+        std::string key = "pat:" + HexEncode(compiled.pattern, compiled.length) + ":" + compiled.mask;
+        uintptr_t cached;
+        if (CacheLookup(key, cached)) return cached;
+
+        uintptr_t result = FindCompiledInternal(s_module.textStart, s_module.textSize, compiled);
+        CacheStore(key, result);
+        return result;
+    }
+
+    /// <summary>
+    /// One pattern to resolve in a batch scan. `result` receives the match
+    /// address (0 if not found).
+    /// </summary>
+    struct PatternSpec {
+        const char* pattern;
+        const char* mask;
+        uintptr_t result;
+    };
+
+    /// <summary>
+    /// Resolve multiple patterns in a single sweep of the .text section.
+    /// Patterns are bucketed by their first non-wildcard byte so each scan
+    /// position only tests the signatures whose anchor byte matches; resolving
+    /// N signatures costs one pass instead of N full sweeps.
+    /// Returns the number of patterns found.
+    /// </summary>
+    static size_t FindPatterns(PatternSpec* specs, size_t count) {
+        if (!s_initialized || !s_module.textStart || !specs || count == 0) return 0;
+
+        // Per-spec precomputed data, bucketed by anchor byte value
+        struct SpecState {
+            size_t specIdx;
+            size_t maskLen;
+            size_t anchorIdx;
+        };
+        std::vector<SpecState> states;
+        std::vector<std::vector<size_t>> buckets(256);   // anchor byte -> indices into states
+
+        size_t pending = 0;
+        for (size_t s = 0; s < count; s++) {
+            specs[s].result = 0;
+            if (!specs[s].pattern || !specs[s].mask) continue;
+
+            size_t maskLen = strlen(specs[s].mask);
+            if (maskLen == 0 || maskLen > s_module.textSize) continue;
+
+            size_t anchorIdx = 0;
+            while (anchorIdx < maskLen && specs[s].mask[anchorIdx] != 'x') anchorIdx++;
+            if (anchorIdx == maskLen) {
+                // All-wildcard mask: matches immediately
+                specs[s].result = s_module.textStart;
+                continue;
+            }
+
+            uint8_t anchor = static_cast<uint8_t>(specs[s].pattern[anchorIdx]);
+            buckets[anchor].push_back(states.size());
+            states.push_back({ s, maskLen, anchorIdx });
+            pending++;
+        }
+
+        size_t found = count - pending;   // all-wildcard specs already resolved
+        if (pending == 0) return found;
+
+        const uint8_t* text = reinterpret_cast<const uint8_t*>(s_module.textStart);
+        size_t textSize = s_module.textSize;
+
+        for (size_t i = 0; i < textSize && pending > 0; i++) {
+            auto& bucket = buckets[text[i]];
+            if (bucket.empty()) continue;
+
+            for (size_t b = 0; b < bucket.size(); b++) {
+                const SpecState& st = states[bucket[b]];
+                PatternSpec& spec = specs[st.specIdx];
+                if (spec.result) continue;   // already matched earlier in the sweep
+
+                // Anchor sits at offset anchorIdx within the pattern — the
+                // candidate match starts anchorIdx bytes before this position.
+                if (i < st.anchorIdx) continue;
+                size_t matchStart = i - st.anchorIdx;
+                if (matchStart + st.maskLen > textSize) continue;
+
+                if (MatchesPattern(s_module.textStart + matchStart, spec.pattern, spec.mask, st.maskLen)) {
+                    spec.result = s_module.textStart + matchStart;
+                    found++;
+                    pending--;
+                }
+            }
+        }
+
+        return found;
     }
 
     // ========================================================================
@@ -113,71 +317,108 @@ public:
     /// </summary>
     static uintptr_t FindString(const char* str) {
         if (!s_initialized || !s_module.rdataStart) return 0;
-        
+
+        std::string key = "str:" + HexEncode(str, strlen(str));
+        uintptr_t cached;
+        if (CacheLookup(key, cached)) return cached;
+
+        uintptr_t result = FindStringUncached(str);
+        CacheStore(key, result);
+        return result;
+    }
+
+private:
+    static uintptr_t FindStringUncached(const char* str) {
         size_t len = strlen(str);
-        for (size_t i = 0; i < s_module.rdataSize - len; i++) {
-            if (memcmp(reinterpret_cast<void*>(s_module.rdataStart + i), str, len) == 0) {
-                // Verify null terminator
-                if (reinterpret_cast<uint8_t*>(s_module.rdataStart + i)[len] == 0) {
-                    return s_module.rdataStart + i;
-                }
+        if (len == 0 || len >= s_module.rdataSize) return 0;
+
+        // memchr-anchored scan: jump between occurrences of the first
+        // character (memchr is SIMD-optimized in the CRT) instead of running
+        // memcmp at every offset. Repeat lookups for the same string are
+        // already O(1) via the persistent scan cache in FindString.
+        const char* base = reinterpret_cast<const char*>(s_module.rdataStart);
+        const char* cursor = base;
+        size_t remaining = s_module.rdataSize - len;
+
+        while (remaining > 0) {
+            const char* hit = static_cast<const char*>(memchr(cursor, str[0], remaining));
+            if (!hit) break;
+
+            if (memcmp(hit, str, len) == 0 && hit[len] == '\0') {
+                return reinterpret_cast<uintptr_t>(hit);
             }
+
+            remaining -= (hit - cursor) + 1;
+            cursor = hit + 1;
         }
         return 0;
     }
 
+public:
     /// <summary>
     /// Find code that references a string via LEA instruction
     /// Returns address of the LEA instruction
     /// </summary>
     static uintptr_t FindStringReference(const char* str) {
+        std::string key = "ref:" + HexEncode(str, strlen(str));
+        uintptr_t cached;
+        if (CacheLookup(key, cached)) return cached;
+
+        uintptr_t result = FindStringReferenceUncached(str);
+        CacheStore(key, result);
+        return result;
+    }
+
+private:
+    static uintptr_t FindStringReferenceUncached(const char* str) {
         uintptr_t strAddr = FindString(str);
         if (!strAddr) return 0;
-        
-        // Search for LEA instructions referencing this string
-        // 48 8D 0D xx xx xx xx = LEA RCX, [rip+offset]
-        // 48 8D 15 xx xx xx xx = LEA RDX, [rip+offset]
-        // 48 8D 05 xx xx xx xx = LEA RAX, [rip+offset]
-        // 4C 8D 05 xx xx xx xx = LEA R8, [rip+offset]
-        // 4C 8D 0D xx xx xx xx = LEA R9, [rip+offset]
-        // 4C 8D 15 xx xx xx xx = LEA R10, [rip+offset]
-        
-        for (size_t i = 0; i < s_module.textSize - 7; i++) {
+
+        // Answer from the one-pass LEA target index instead of re-decoding
+        // the whole .text section per lookup
+        EnsureLeaIndex();
+        auto it = s_leaIndex.find(strAddr);
+        return (it != s_leaIndex.end()) ? it->second : 0;
+    }
+
+    /// <summary>
+    /// Build the RIP-relative LEA index in a single .text pass. Records the
+    /// lowest LEA instruction address per target so lookups keep the same
+    /// first-hit semantics the linear scan had. Recognized encodings:
+    ///   48 8D /r = LEA RAX/RCX/RDX/..., [rip+disp32]
+    ///   4C 8D /r = LEA R8-R15, [rip+disp32]
+    /// with ModR/M mod=00, r/m=101 (RIP-relative).
+    /// </summary>
+    static void EnsureLeaIndex() {
+        if (s_leaIndexBuilt) return;
+
+        for (size_t i = 0; i + 7 <= s_module.textSize; i++) {
             uintptr_t addr = s_module.textStart + i;
             uint8_t* bytes = reinterpret_cast<uint8_t*>(addr);
-            
-            bool isLea = false;
-            // REX.W LEA with RIP-relative addressing
-            if (bytes[0] == 0x48 && bytes[1] == 0x8D) {
-                // Check ModR/M byte for RIP-relative (mod=00, r/m=101)
-                uint8_t modrm = bytes[2];
-                if ((modrm & 0xC7) == 0x05) { // mod=00, r/m=101
-                    isLea = true;
-                }
-            }
-            // REX.WR LEA (R8-R15 destination)
-            else if (bytes[0] == 0x4C && bytes[1] == 0x8D) {
-                uint8_t modrm = bytes[2];
-                if ((modrm & 0xC7) == 0x05) {
-                    isLea = true;
-                }
-            }
-            
-            if (isLea) {
-                int32_t offset = *reinterpret_cast<int32_t*>(addr + 3);
-                uintptr_t targetAddr = addr + 7 + offset;
-                if (targetAddr == strAddr) {
-                    return addr;
-                }
-            }
+
+            if ((bytes[0] != 0x48 && bytes[0] != 0x4C) || bytes[1] != 0x8D) continue;
+            if ((bytes[2] & 0xC7) != 0x05) continue;   // mod=00, r/m=101
+
+            int32_t offset = *reinterpret_cast<int32_t*>(addr + 3);
+            uintptr_t targetAddr = addr + 7 + offset;
+
+            // Only index targets inside the module — stray byte sequences
+            // that decode as LEA would otherwise bloat the map
+            if (targetAddr < s_module.base || targetAddr >= s_module.base + s_module.size) continue;
+
+            // Keep the lowest instruction address per target (first match wins)
+            auto [it, inserted] = s_leaIndex.try_emplace(targetAddr, addr);
+            (void)it; (void)inserted;
         }
-        return 0;
+
+        s_leaIndexBuilt = true;
     }
 
+public:
     // ========================================================================
     // Thunk Detection and Resolution
     // ========================================================================
-    
+
     /// <summary>
     /// Check if an address is a thunk (just a JMP to somewhere else)
     /// </summary>
@@ -209,19 +450,38 @@ public:
     }
 
     /// <summary>
-    /// Follow thunk chain to get the real function address
+    /// Follow thunk chain to get the real function address.
+    /// Resolved chains are memoized — identical chains are walked repeatedly
+    /// during export binding, so repeat calls are a single hash probe.
     /// </summary>
     static uintptr_t FollowThunk(uintptr_t address) {
+        auto memo = s_thunkMemo.find(address);
+        if (memo != s_thunkMemo.end()) return memo->second;
+
         uintptr_t current = address;
         uintptr_t target;
         int maxDepth = 10; // Prevent infinite loops
-        
+
         while (maxDepth-- > 0 && IsThunk(current, &target)) {
             current = target;
         }
+
+        s_thunkMemo[address] = current;
         return current;
     }
 
+    /// <summary>
+    /// Resolve every export's thunk chain in one pass, pre-populating the
+    /// memo table so later FollowThunk calls during export binding never
+    /// re-decode a chain. Call after Initialize.
+    /// </summary>
+    static void ResolveAllExportThunks() {
+        if (!s_initialized) return;
+        for (const auto& [name, addr] : s_exports) {
+            FollowThunk(addr);
+        }
+    }
+
     // ========================================================================
     // Export Suffix Matching (for obfuscated exports)
     // ========================================================================
@@ -244,15 +504,22 @@ public:
     /// </summary>
     static uintptr_t FindExportBySuffix(const char* suffix) {
         if (!s_initialized) return 0;
-        
-        for (const auto& [name, addr] : s_exports) {
-            size_t nameLen = name.length();
-            size_t suffixLen = strlen(suffix);
-            
-            if (nameLen > suffixLen) {
-                if (name.compare(nameLen - suffixLen, suffixLen, suffix) == 0) {
-                    return FollowThunk(addr);
-                }
+
+        // Binary search the reversed-name index: a suffix of the export name
+        // is a prefix of its reversal
+        size_t suffixLen = strlen(suffix);
+        std::string reversedSuffix(suffix, suffix + suffixLen);
+        std::reverse(reversedSuffix.begin(), reversedSuffix.end());
+
+        auto it = std::lower_bound(
+            s_exportsBySuffix.begin(), s_exportsBySuffix.end(), reversedSuffix,
+            [](const auto& entry, const std::string& value) { return entry.first < value; });
+
+        for (; it != s_exportsBySuffix.end(); ++it) {
+            if (it->first.compare(0, reversedSuffix.size(), reversedSuffix) != 0) break;
+            // Require a strictly longer name — the suffix alone isn't a match
+            if (it->first.size() > suffixLen) {
+                return FollowThunk(it->second);
             }
         }
         return 0;
@@ -294,27 +561,330 @@ private:
     static inline ModuleInfo s_module = {};
     static inline std::unordered_map<std::string, uintptr_t> s_exports;
 
+    // Export names reversed and sorted, for binary-searchable suffix queries
+    static inline std::vector<std::pair<std::string, uintptr_t>> s_exportsBySuffix;
+
+    // Thunk address -> final resolved address (FollowThunk memoization)
+    static inline std::unordered_map<uintptr_t, uintptr_t> s_thunkMemo;
+
+    // One-pass RIP-relative LEA index: target address -> LEA instruction
+    // address. Built lazily on the first FindStringReference call.
+    static inline std::unordered_map<uintptr_t, uintptr_t> s_leaIndex;
+    static inline bool s_leaIndexBuilt = false;
+
+    // Persistent scan-result cache: key -> RVA (0 = scanned, not found).
+    // Keyed on disk by the module's size/timestamp/header hash so a game
+    // update invalidates it automatically.
+    static inline std::unordered_map<std::string, uintptr_t> s_scanCache;
+    static inline bool s_cacheLoaded = false;
+    static inline std::string s_cachePath;
+    static inline std::string s_moduleIdentity;
+
+    // ========================================================================
+    // Scan Cache (persisted to MDB/scanner_cache.txt)
+    // ========================================================================
+
+    static std::string HexEncode(const char* data, size_t len) {
+        static const char* digits = "0123456789abcdef";
+        std::string out;
+        out.reserve(len * 2);
+        for (size_t i = 0; i < len; i++) {
+            uint8_t b = static_cast<uint8_t>(data[i]);
+            out += digits[b >> 4];
+            out += digits[b & 0xF];
+        }
+        return out;
+    }
+
+    /// <summary>
+    /// Identity string for the scanned module: file size + write time +
+    /// FNV-1a hash of the first 4KB (PE headers). Any rebuild of the game
+    /// changes at least one of these.
+    /// </summary>
+    static std::string ComputeModuleIdentity() {
+        wchar_t modPath[MAX_PATH];
+        if (GetModuleFileNameW(s_hModule, modPath, MAX_PATH) == 0) return "";
+
+        WIN32_FILE_ATTRIBUTE_DATA attr = {};
+        if (!GetFileAttributesExW(modPath, GetFileExInfoStandard, &attr)) return "";
+
+        uint64_t fileSize = (static_cast<uint64_t>(attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+        uint64_t writeTime = (static_cast<uint64_t>(attr.ftLastWriteTime.dwHighDateTime) << 32)
+                           | attr.ftLastWriteTime.dwLowDateTime;
+
+        // FNV-1a over the in-memory PE headers
+        uint64_t hash = 14695981039346656037ULL;
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(s_module.base);
+        for (size_t i = 0; i < 4096; i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+
+        char identity[64];
+        snprintf(identity, sizeof(identity), "%llu-%llu-%llx",
+                 (unsigned long long)fileSize, (unsigned long long)writeTime,
+                 (unsigned long long)hash);
+        return identity;
+    }
+
+    static void LoadScanCache() {
+        s_scanCache.clear();
+        s_cacheLoaded = false;
+
+        s_moduleIdentity = ComputeModuleIdentity();
+        if (s_moduleIdentity.empty()) return;
+
+        // Cache lives next to the game exe under MDB\ like the other artifacts
+        char exePath[MAX_PATH];
+        GetModuleFileNameA(nullptr, exePath, MAX_PATH);
+        std::filesystem::path cacheDir = std::filesystem::path(exePath).parent_path() / "MDB";
+        s_cachePath = (cacheDir / "scanner_cache.txt").string();
+
+        std::ifstream file(s_cachePath);
+        if (!file.is_open()) { s_cacheLoaded = true; return; }
+
+        // First line must match the current module identity
+        std::string identityLine;
+        if (!std::getline(file, identityLine) || identityLine != s_moduleIdentity) {
+            s_cacheLoaded = true;   // stale cache — start fresh, overwrite on save
+            return;
+        }
+
+        std::string key;
+        uintptr_t rva;
+        while (file >> key >> std::hex >> rva) {
+            s_scanCache[key] = rva;
+        }
+        s_cacheLoaded = true;
+    }
+
+    static void SaveScanCache() {
+        if (s_cachePath.empty() || s_moduleIdentity.empty()) return;
+
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(s_cachePath).parent_path(), ec);
+
+        std::ofstream file(s_cachePath, std::ios::trunc);
+        if (!file.is_open()) return;
+
+        file << s_moduleIdentity << "\n";
+        for (const auto& [key, rva] : s_scanCache) {
+            file << key << " " << std::hex << rva << "\n";
+        }
+    }
+
+    /// <summary>
+    /// Look up a cached result. Cached RVAs are rebased against the current
+    /// module load address. Stored 0 means "scanned before, not present".
+    /// </summary>
+    static bool CacheLookup(const std::string& key, uintptr_t& outAddress) {
+        auto it = s_scanCache.find(key);
+        if (it == s_scanCache.end()) return false;
+        outAddress = it->second ? (s_module.base + it->second) : 0;
+        return true;
+    }
+
+    static void CacheStore(const std::string& key, uintptr_t address) {
+        if (!s_cacheLoaded) return;
+        s_scanCache[key] = address ? (address - s_module.base) : 0;
+        SaveScanCache();
+    }
+
+    /// <summary>
+    /// Check AVX2 support once (CPUID leaf 7 + OS XSAVE of YMM state).
+    /// SSE2 is architecturally guaranteed on x64, so no check needed there.
+    /// </summary>
+    static bool HasAvx2() {
+        static int s_hasAvx2 = -1;
+        if (s_hasAvx2 < 0) {
+            int info[4] = {};
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avxUsable = false;
+            if (osxsave) {
+                // OS must preserve YMM registers (XCR0 bits 1 and 2)
+                unsigned long long xcr0 = _xgetbv(0);
+                avxUsable = (xcr0 & 0x6) == 0x6;
+            }
+            __cpuidex(info, 7, 0);
+            s_hasAvx2 = (avxUsable && (info[1] & (1 << 5))) ? 1 : 0;
+        }
+        return s_hasAvx2 == 1;
+    }
+
+    /// <summary>
+    /// Verify the full pattern/mask at a candidate address
+    /// </summary>
+    static bool MatchesPattern(uintptr_t address, const char* pattern, const char* mask, size_t maskLen) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(address);
+        for (size_t j = 0; j < maskLen; j++) {
+            if (mask[j] == 'x' && bytes[j] != static_cast<uint8_t>(pattern[j])) {
+                return false;
+            }
+            // '?' in mask = wildcard, skip comparison
+        }
+        return true;
+    }
+
     static uintptr_t FindPatternInternal(uintptr_t start, size_t size, const char* pattern, const char* mask) {
         size_t maskLen = strlen(mask);
-        
-        for (size_t i = 0; i < size - maskLen; i++) {
-            bool found = true;
-            for (size_t j = 0; j < maskLen; j++) {
-                if (mask[j] == 'x') {
-                    if (reinterpret_cast<uint8_t*>(start + i)[j] != static_cast<uint8_t>(pattern[j])) {
-                        found = false;
-                        break;
+        if (maskLen == 0 || size < maskLen) return 0;
+
+        // Use the first non-wildcard byte as the scan anchor. Candidate
+        // positions are found by broadcasting the anchor byte across a SIMD
+        // register and comparing 32 (AVX2) or 16 (SSE2) bytes per iteration;
+        // only anchor hits pay for the full pattern verification.
+        size_t anchorIdx = 0;
+        while (anchorIdx < maskLen && mask[anchorIdx] != 'x') anchorIdx++;
+
+        size_t scanSize = size - maskLen + 1;
+
+        // All-wildcard mask: any position matches
+        if (anchorIdx == maskLen) return start;
+
+        const uint8_t anchor = static_cast<uint8_t>(pattern[anchorIdx]);
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(start + anchorIdx);
+        size_t i = 0;
+
+        if (HasAvx2()) {
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(anchor));
+            for (; i + 32 <= scanSize; i += 32) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + i));
+                unsigned int hits = static_cast<unsigned int>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+                while (hits) {
+                    unsigned long bit;
+                    _BitScanForward(&bit, hits);
+                    if (MatchesPattern(start + i + bit, pattern, mask, maskLen)) {
+                        return start + i + bit;
                     }
+                    hits &= hits - 1;
                 }
-                // '?' in mask = wildcard, skip comparison
             }
-            if (found) {
+        } else {
+            // SSE2 path — baseline for all x64 CPUs
+            const __m128i needle = _mm_set1_epi8(static_cast<char>(anchor));
+            for (; i + 16 <= scanSize; i += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + i));
+                unsigned int hits = static_cast<unsigned int>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+                while (hits) {
+                    unsigned long bit;
+                    _BitScanForward(&bit, hits);
+                    if (MatchesPattern(start + i + bit, pattern, mask, maskLen)) {
+                        return start + i + bit;
+                    }
+                    hits &= hits - 1;
+                }
+            }
+        }
+
+        // Scalar tail for the remainder that doesn't fill a SIMD register
+        for (; i < scanSize; i++) {
+            if (base[i] == anchor && MatchesPattern(start + i, pattern, mask, maskLen)) {
+                return start + i;
+            }
+        }
+        return 0;
+    }
+
+    /// <summary>
+    /// Ask the memory manager to page in .text and .rdata ahead of the scan
+    /// sweeps. PrefetchVirtualMemory issues large sequential reads instead of
+    /// the one-cache-line-at-a-time demand faults the scan loop would cause.
+    /// Best-effort: failure just means scans run against cold pages.
+    /// </summary>
+    static void PrefetchSections() {
+        WIN32_MEMORY_RANGE_ENTRY ranges[2];
+        ULONG_PTR count = 0;
+
+        if (s_module.textStart && s_module.textSize) {
+            ranges[count].VirtualAddress = reinterpret_cast<PVOID>(s_module.textStart);
+            ranges[count].NumberOfBytes = s_module.textSize;
+            count++;
+        }
+        if (s_module.rdataStart && s_module.rdataSize) {
+            ranges[count].VirtualAddress = reinterpret_cast<PVOID>(s_module.rdataStart);
+            ranges[count].NumberOfBytes = s_module.rdataSize;
+            count++;
+        }
+
+        if (count > 0) {
+            PrefetchVirtualMemory(GetCurrentProcess(), count, ranges, 0);
+        }
+    }
+
+    /// <summary>
+    /// BMH scan loop for precompiled patterns. Shifts by the skip distance
+    /// of the byte under the window's last position, so long signatures jump
+    /// over most of the section without per-byte comparisons.
+    /// </summary>
+    static uintptr_t FindCompiledInternal(uintptr_t start, size_t size, const CompiledPattern& cp) {
+        if (cp.length == 0 || size < cp.length) return 0;
+        if (cp.anchorIdx == cp.length) return start;   // all-wildcard mask
+
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(start);
+        size_t last = cp.length - 1;
+        size_t i = 0;
+
+        while (i + cp.length <= size) {
+            if (MatchesPattern(start + i, cp.pattern, cp.mask, cp.length)) {
                 return start + i;
             }
+            i += cp.skip[base[i + last]];
         }
         return 0;
     }
 
+    static uintptr_t FindPatternParallelInternal(uintptr_t start, size_t size, const char* pattern, const char* mask) {
+        size_t maskLen = strlen(mask);
+        if (maskLen == 0 || size < maskLen) return 0;
+
+        // Small regions aren't worth the thread spin-up cost
+        constexpr size_t MIN_PARALLEL_SIZE = 4 * 1024 * 1024;
+        unsigned int threadCount = std::thread::hardware_concurrency();
+        if (threadCount < 2 || size < MIN_PARALLEL_SIZE) {
+            return FindPatternInternal(start, size, pattern, mask);
+        }
+
+        size_t chunkSize = size / threadCount;
+
+        // Each thread records its chunk index + hit; the lowest chunk index
+        // with a hit wins. Chunks after a known hit stop early.
+        std::atomic<size_t> bestChunk{ SIZE_MAX };
+        std::vector<uintptr_t> chunkResults(threadCount, 0);
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+
+        for (unsigned int t = 0; t < threadCount; t++) {
+            workers.emplace_back([&, t]() {
+                // No point scanning past a chunk that already matched
+                if (t > bestChunk.load(std::memory_order_acquire)) return;
+
+                size_t chunkStart = static_cast<size_t>(t) * chunkSize;
+                size_t chunkEnd = (t + 1 == threadCount) ? size : chunkStart + chunkSize;
+                // Overlap into the next chunk so boundary-spanning matches are found
+                size_t scanEnd = chunkEnd + maskLen - 1;
+                if (scanEnd > size) scanEnd = size;
+
+                uintptr_t hit = FindPatternInternal(start + chunkStart, scanEnd - chunkStart, pattern, mask);
+                if (hit) {
+                    chunkResults[t] = hit;
+                    // Track the lowest chunk index that has a match
+                    size_t expected = bestChunk.load(std::memory_order_acquire);
+                    while (t < expected &&
+                           !bestChunk.compare_exchange_weak(expected, t, std::memory_order_acq_rel)) {
+                    }
+                }
+            });
+        }
+
+        for (auto& w : workers) w.join();
+
+        size_t winner = bestChunk.load(std::memory_order_acquire);
+        return (winner != SIZE_MAX) ? chunkResults[winner] : 0;
+    }
+
     static void BuildExportMap(HMODULE hModule) {
         s_exports.clear();
         
@@ -341,5 +911,16 @@ private:
             uintptr_t funcAddr = reinterpret_cast<uintptr_t>(hModule) + functions[ordinals[i]];
             s_exports[name] = funcAddr;
         }
+
+        // Sorted reversed-name index so suffix queries are a binary search
+        // instead of a full map walk per probed suffix
+        s_exportsBySuffix.clear();
+        s_exportsBySuffix.reserve(s_exports.size());
+        for (const auto& [name, addr] : s_exports) {
+            std::string reversed(name.rbegin(), name.rend());
+            s_exportsBySuffix.emplace_back(std::move(reversed), addr);
+        }
+        std::sort(s_exportsBySuffix.begin(), s_exportsBySuffix.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
     }
 };
@@ -0,0 +1,159 @@
+// ==============================
+// CompileServer - In-Process SDK Compilation
+// ==============================
+// Compiles the generated SDK sources into GameSDK.ModHost.dll from inside
+// the hosted CLR, skipping vswhere discovery, MSBuild process startup and
+// full project evaluation. The native bridge invokes Server.Compile via
+// ExecuteInDefaultAppDomain with the path to a response file listing the
+// output assembly, extra references and every source file.
+//
+// This lives in its own small assembly (GameSDK.CompileServer.dll) rather
+// than in ModHost because ModHost IS the compile output — the CLR pins
+// whatever assembly it executes, and a pinned ModHost could never be
+// overwritten by its own rebuild.
+
+using System;
+using System.CodeDom.Compiler;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+using Microsoft.CSharp;
+
+namespace GameSDK.CompileServer
+{
+    /// <summary>
+    /// In-process compiler entry point for the native bridge.
+    /// </summary>
+    public static class Server
+    {
+        /// <summary>
+        /// Compile the sources listed in the response file.
+        /// Response file format, one entry per line:
+        ///   out=&lt;output assembly path&gt;
+        ///   log=&lt;diagnostics log path&gt;
+        ///   ref=&lt;additional reference path&gt;   (repeatable)
+        ///   src=&lt;source file path&gt;            (repeatable)
+        /// </summary>
+        /// <param name="responseFilePath">Path to the response file.</param>
+        /// <returns>0 on success, the error count on compile failure,
+        /// -1 on any setup/IO failure. Nonzero tells the native side to
+        /// fall back to MSBuild.</returns>
+        public static int Compile(string responseFilePath)
+        {
+            string logPath = null;
+            try
+            {
+                string outputPath = null;
+                var references = new List<string>
+                {
+                    // Framework baseline the SDK sources assume; anything
+                    // game-specific arrives via ref= lines
+                    "System.dll",
+                    "System.Core.dll",
+                    "System.Numerics.dll",
+                    "System.Runtime.Serialization.dll",
+                    "System.Xml.dll",
+                    "Microsoft.CSharp.dll"
+                };
+                var sources = new List<string>();
+
+                foreach (string rawLine in File.ReadAllLines(responseFilePath))
+                {
+                    string line = rawLine.Trim();
+                    if (line.Length == 0)
+                    {
+                        continue;
+                    }
+                    if (line.StartsWith("out=", StringComparison.OrdinalIgnoreCase))
+                    {
+                        outputPath = line.Substring(4);
+                    }
+                    else if (line.StartsWith("log=", StringComparison.OrdinalIgnoreCase))
+                    {
+                        logPath = line.Substring(4);
+                    }
+                    else if (line.StartsWith("ref=", StringComparison.OrdinalIgnoreCase))
+                    {
+                        references.Add(line.Substring(4));
+                    }
+                    else if (line.StartsWith("src=", StringComparison.OrdinalIgnoreCase))
+                    {
+                        sources.Add(line.Substring(4));
+                    }
+                }
+
+                if (outputPath == null || sources.Count == 0)
+                {
+                    WriteLog(logPath, "CompileServer: response file missing out= or src= entries");
+                    return -1;
+                }
+
+                var parameters = new CompilerParameters
+                {
+                    OutputAssembly = outputPath,
+                    GenerateExecutable = false,
+                    GenerateInMemory = false,
+                    IncludeDebugInformation = false,
+                    TreatWarningsAsErrors = false,
+                    CompilerOptions = "/optimize+ /unsafe /nowarn:1701,1702"
+                };
+                foreach (string reference in references)
+                {
+                    parameters.ReferencedAssemblies.Add(reference);
+                }
+
+                CompilerResults results;
+                using (var provider = new CSharpCodeProvider())
+                {
+                    results = provider.CompileAssemblyFromFile(parameters, sources.ToArray());
+                }
+
+                var log = new StringBuilder();
+                log.AppendFormat("CompileServer: {0} sources -> {1}", sources.Count, outputPath);
+                log.AppendLine();
+
+                int errorCount = 0;
+                foreach (CompilerError diagnostic in results.Errors)
+                {
+                    if (!diagnostic.IsWarning)
+                    {
+                        errorCount++;
+                    }
+                    log.AppendFormat("{0}({1},{2}): {3} {4}: {5}",
+                        diagnostic.FileName, diagnostic.Line, diagnostic.Column,
+                        diagnostic.IsWarning ? "warning" : "error",
+                        diagnostic.ErrorNumber, diagnostic.ErrorText);
+                    log.AppendLine();
+                }
+
+                log.AppendFormat("CompileServer: {0} error(s), {1} diagnostic(s) total",
+                    errorCount, results.Errors.Count);
+                log.AppendLine();
+                WriteLog(logPath, log.ToString());
+
+                return errorCount;
+            }
+            catch (Exception ex)
+            {
+                WriteLog(logPath, "CompileServer: exception: " + ex);
+                return -1;
+            }
+        }
+
+        private static void WriteLog(string logPath, string text)
+        {
+            if (string.IsNullOrEmpty(logPath))
+            {
+                return;
+            }
+            try
+            {
+                File.WriteAllText(logPath, text);
+            }
+            catch (IOException)
+            {
+                // Diagnostics only — never fail the compile over the log
+            }
+        }
+    }
+}
@@ -121,6 +121,58 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, EntryPoint = "mdb_invoke_method")]
         public static extern IntPtr mdb_invoke_method_ptr(IntPtr method, IntPtr instance, IntPtr args, out IntPtr exception);
 
+        /// <summary>
+        /// Typed variant of mdb_invoke_method for int-returning methods:
+        /// the bridge unboxes the result natively and returns it by value,
+        /// so no boxed object is allocated per sampled value. Narrower
+        /// integer returns (bool/char/sbyte/byte/short/ushort) are widened
+        /// according to the method's return type. Returns 0 on error or
+        /// thrown exception.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_invoke_method_i4(IntPtr method, IntPtr instance, IntPtr[] args, out IntPtr exception);
+
+        /// <summary>
+        /// 64-bit integer variant of mdb_invoke_method_i4.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long mdb_invoke_method_i8(IntPtr method, IntPtr instance, IntPtr[] args, out IntPtr exception);
+
+        /// <summary>
+        /// float variant of mdb_invoke_method_i4 (double returns are narrowed).
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern float mdb_invoke_method_r4(IntPtr method, IntPtr instance, IntPtr[] args, out IntPtr exception);
+
+        /// <summary>
+        /// double variant of mdb_invoke_method_i4 (float returns are widened).
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern double mdb_invoke_method_r8(IntPtr method, IntPtr instance, IntPtr[] args, out IntPtr exception);
+
+        /// <summary>
+        /// Pointer variant of mdb_invoke_method_i4: pointer-sized primitive
+        /// returns (IntPtr/UIntPtr) are unboxed; reference-type results come
+        /// back as the object pointer unchanged.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, EntryPoint = "mdb_invoke_method_ptr")]
+        public static extern IntPtr mdb_invoke_method_unboxed_ptr(IntPtr method, IntPtr instance, IntPtr[] args, out IntPtr exception);
+
+        /// <summary>
+        /// Extract type name, Message, and StackTrace from a thrown exception
+        /// in one native call instead of separate get_Message/get_StackTrace
+        /// invokes. Pass null for any buffer to skip that field (its getter is
+        /// then never invoked).
+        /// </summary>
+        /// <param name="exception">Exception pointer from a failed invoke</param>
+        /// <returns>True if the exception was inspected</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool mdb_exception_get_info(IntPtr exception,
+            StringBuilder typeBuffer, int typeBufferSize,
+            StringBuilder messageBuffer, int messageBufferSize,
+            StringBuilder stackBuffer, int stackBufferSize);
+
         /// <summary>
         /// Get the parameter type for a method at a specific index.
         /// </summary>
@@ -214,6 +266,22 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern void mdb_field_static_set_value(IntPtr field, IntPtr value);
 
+        /// <summary>
+        /// Serialize an object's fields (recursing into referenced objects up
+        /// to depth levels) into a flat record stream in one native call:
+        /// primitives and small structs inline, string contents inline,
+        /// references as (object, class) pointer pairs. Each record is a
+        /// packed header (kind byte, depth byte, ushort name length, int type
+        /// enum, int value size) followed by the UTF-8 name and the payload.
+        /// </summary>
+        /// <param name="instance">Object to dump</param>
+        /// <param name="depth">Reference levels to recurse into (0-8)</param>
+        /// <param name="outBuffer">Destination buffer for the record stream</param>
+        /// <param name="bufferSize">Size of outBuffer in bytes</param>
+        /// <returns>Bytes written, or -1 on error</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_object_dump(IntPtr instance, int depth, [Out] byte[] outBuffer, int bufferSize);
+
         // ==============================
         // Object Creation
         // ==============================
@@ -234,6 +302,17 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
         public static extern IntPtr mdb_string_new(string str);
 
+        /// <summary>
+        /// Interned variant of mdb_string_new for repeated literals: the
+        /// first call per content allocates and roots the IL2CPP string,
+        /// repeats return the shared instance from a native cache. Do not
+        /// mutate or free the returned string — it is shared.
+        /// </summary>
+        /// <param name="str">UTF-8 string</param>
+        /// <returns>Pointer to the shared Il2CppString, or IntPtr.Zero on failure</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern IntPtr mdb_string_new_interned(string str);
+
         /// <summary>
         /// Convert an IL2CPP string to UTF-8.
         /// </summary>
@@ -362,6 +441,19 @@ namespace GameSDK
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool mdb_gameobject_get_active_self(IntPtr gameObject);
 
+        /// <summary>
+        /// Resolve GameObjects by name through the native name index built
+        /// by the scene snapshot and maintained by the diff facility. Only
+        /// the query string crosses the interop boundary; run a snapshot or
+        /// diff first so the index is populated.
+        /// </summary>
+        /// <param name="name">The GameObject name to look up</param>
+        /// <param name="outObjects">Output: matching GameObject pointers</param>
+        /// <param name="objectCap">Capacity of outObjects</param>
+        /// <returns>Number of objects written, or -1 on error</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern int mdb_find_gameobject_by_name(string name, IntPtr[] outObjects, int objectCap);
+
         // ==============================
         // Transform Helpers
         // ==============================
@@ -471,6 +563,50 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int mdb_get_dontdestroyonload_scene_handle();
 
+        /// <summary>
+        /// Per-scene record filled by mdb_scenemanager_snapshot.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MdbSceneInfo
+        {
+            public int Handle;       // Scene handle, -1 if unavailable
+            public int RootCount;    // Root GameObject count, -1 if unavailable
+            public int NameOffset;   // Offset of the UTF-8 name in the name buffer, -1 if unavailable
+        }
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int mdb_scenemanager_snapshot([Out] MdbSceneInfo[] scenes, int cap,
+            [Out] byte[] nameBuffer, int nameBufferCap, out int ddolHandle);
+
+        /// <summary>
+        /// Enumerate every loaded scene (handle, root count, name) plus the
+        /// DontDestroyOnLoad handle in a single native call instead of one
+        /// P/Invoke per datum per scene. sceneNames[i] matches the returned
+        /// record at the same index (null when the name was unavailable).
+        /// </summary>
+        public static MdbSceneInfo[] GetSceneManagerSnapshot(out string[] sceneNames, out int ddolHandle)
+        {
+            // Native side caps the scene count at 100 (same sanity bound as
+            // the scalar exports), so a fixed buffer always fits
+            var scenes = new MdbSceneInfo[100];
+            var nameBuffer = new byte[4096];
+            int written = mdb_scenemanager_snapshot(scenes, scenes.Length, nameBuffer, nameBuffer.Length, out ddolHandle);
+            if (written < 0) written = 0;
+            if (written < scenes.Length)
+                Array.Resize(ref scenes, written);
+
+            sceneNames = new string[written];
+            for (int i = 0; i < written; i++)
+            {
+                int offset = scenes[i].NameOffset;
+                if (offset < 0 || offset >= nameBuffer.Length) continue;
+                int end = offset;
+                while (end < nameBuffer.Length && nameBuffer[end] != 0) end++;
+                sceneNames[i] = System.Text.Encoding.UTF8.GetString(nameBuffer, offset, end - offset);
+            }
+            return scenes;
+        }
+
         // ==============================
         // Array Helpers
         // ==============================
@@ -512,6 +648,22 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr mdb_array_get_element_class(IntPtr array);
 
+        /// <summary>
+        /// Get a direct pointer to an IL2CPP array's element storage for
+        /// zero-copy access — e.g. wrap it in a Span&lt;T&gt; to read or
+        /// mutate large value-type arrays in place. The pointer is only
+        /// valid while the array stays alive and unmoved; keep a reference
+        /// to it for the duration of the access.
+        /// </summary>
+        /// <param name="array">Pointer to the IL2CPP array</param>
+        /// <param name="data">Receives the element storage pointer</param>
+        /// <param name="length">Receives the element count</param>
+        /// <param name="elemSize">Receives the element stride in bytes</param>
+        /// <returns>True on success</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool mdb_array_get_data(IntPtr array, out IntPtr data, out int length, out int elemSize);
+
         /// <summary>
         /// Check if a class is a value type (struct).
         /// </summary>
@@ -603,6 +755,61 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern long mdb_create_hook_ptr(IntPtr target, IntPtr detour, out IntPtr original);
 
+        /// <summary>
+        /// Create a hook routed through a bridge stub so native argument
+        /// filters (mdb_hook_add_filter) can gate the callback. Rejected
+        /// hits call the original directly without entering managed code.
+        /// </summary>
+        /// <param name="method">Pointer to MethodInfo</param>
+        /// <param name="callback">Function pointer to the detour callback</param>
+        /// <param name="original">Output: pointer to trampoline for calling original</param>
+        /// <returns>Hook handle (>0 on success), or negative error code</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long mdb_create_hook_filtered(IntPtr method, IntPtr callback, out IntPtr original);
+
+        /// <summary>
+        /// Create a filterable hook on a direct function pointer.
+        /// </summary>
+        /// <param name="target">Target function pointer to hook</param>
+        /// <param name="detour">Detour function pointer</param>
+        /// <param name="original">Output: pointer to trampoline for calling original</param>
+        /// <returns>Hook handle (>0 on success), or negative error code</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern long mdb_create_hook_ptr_filtered(IntPtr target, IntPtr detour, out IntPtr original);
+
+        /// <summary>
+        /// Install a native argument filter on a filtered or instrumented
+        /// hook. All installed filters must pass for the callback to run.
+        /// Compare ops: 0 ==, 1 !=, 2 &lt;, 3 &lt;=, 4 &gt;, 5 &gt;=,
+        /// 6 mask (argument &amp; value != 0); comparisons are unsigned
+        /// after truncation to the given width.
+        /// </summary>
+        /// <param name="hookHandle">The hook handle</param>
+        /// <param name="argIndex">Forwarded argument position, 0-11 (0 is the instance pointer for instance methods)</param>
+        /// <param name="width">Bytes compared: 1, 2, 4 or 8</param>
+        /// <param name="compareOp">Compare op (see summary)</param>
+        /// <param name="value">The comparison constant</param>
+        /// <returns>0 on success, non-zero on failure</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_hook_add_filter(long hookHandle, int argIndex, int width, int compareOp, ulong value);
+
+        /// <summary>
+        /// Remove all filters from a hook.
+        /// </summary>
+        /// <param name="hookHandle">The hook handle</param>
+        /// <returns>0 on success, non-zero on failure</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_hook_clear_filters(long hookHandle);
+
+        /// <summary>
+        /// Read the number of hits rejected by a hook's filters.
+        /// </summary>
+        /// <param name="hookHandle">The hook handle</param>
+        /// <param name="count">Output: rejected hit count</param>
+        /// <returns>0 on success, non-zero on failure</returns>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_hook_get_filtered_hits(long hookHandle, out ulong count);
+
         /// <summary>
         /// Remove a hook by handle.
         /// </summary>
@@ -703,6 +910,23 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr mdb_property_get_set_method(IntPtr prop);
 
+        /// <summary>
+        /// Resolve a property by name (walks the parent chain). One table
+        /// walk replaces the name-based get_X/set_X method probes.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+        public static extern IntPtr mdb_class_get_property(IntPtr klass, string name);
+
+        /// <summary>
+        /// Resolve a property's accessors in one call: getter/setter
+        /// MethodInfo plus their native function pointers, cached natively
+        /// keyed by the property pointer. Returns a bitmask (bit 0 = getter,
+        /// bit 1 = setter), or -1 on error.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int mdb_property_get_accessors(IntPtr prop, out IntPtr getter, out IntPtr setter,
+            out IntPtr getterPtr, out IntPtr setterPtr);
+
         /// <summary>Get the number of methods in a class.</summary>
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int mdb_class_get_method_count(IntPtr klass);
@@ -727,6 +951,16 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr mdb_class_get_parent(IntPtr klass);
 
+        /// <summary>
+        /// Check whether an instance of class 'from' is assignable to a
+        /// variable of class 'to' (parent chain and interfaces included).
+        /// Memoized natively per class pair — use this instead of walking
+        /// the hierarchy through mdb_class_get_parent per check.
+        /// </summary>
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool mdb_class_is_assignable(IntPtr from, IntPtr to);
+
         /// <summary>Get field value directly (for primitives).</summary>
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
@@ -775,6 +1009,105 @@ namespace GameSDK
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern IntPtr mdb_image_get_class(IntPtr image, int index);
 
+        /// <summary>
+        /// Per-assembly record filled by mdb_get_assembly_snapshot. Pointers
+        /// are raw metadata pointers, stable for the process lifetime.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MdbAssemblyInfo
+        {
+            public IntPtr Assembly;
+            public IntPtr Image;       // IntPtr.Zero if unavailable
+            public IntPtr ImageName;   // ANSI string pointer (e.g. "Assembly-CSharp.dll")
+            public int ClassCount;
+        }
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int mdb_get_assembly_snapshot([Out] MdbAssemblyInfo[] infos, int cap);
+
+        /// <summary>
+        /// Capture every loaded assembly with its image, name and class count
+        /// in a single native call instead of O(n) count/index/get-image
+        /// transitions per refresh.
+        /// </summary>
+        public static MdbAssemblyInfo[] GetAssemblySnapshot()
+        {
+            int total = mdb_get_assembly_snapshot(null, 0);
+            if (total <= 0) return new MdbAssemblyInfo[0];
+
+            var infos = new MdbAssemblyInfo[total];
+            int written = mdb_get_assembly_snapshot(infos, total);
+            if (written < total)
+                Array.Resize(ref infos, Math.Max(written, 0));
+            return infos;
+        }
+
+        /// <summary>
+        /// Per-field record filled by mdb_class_enum_fields. The name is a
+        /// raw metadata pointer, stable for the process lifetime.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MdbFieldRecord
+        {
+            public IntPtr Field;       // FieldInfo pointer
+            public IntPtr Name;        // ANSI string pointer
+            public IntPtr Type;        // Il2CppType pointer
+            public int Offset;         // Instance offset (-1 for thread statics)
+            public int Flags;          // FieldAttributes flags
+            public int IsStatic;       // 1 if static
+        }
+
+        /// <summary>
+        /// Per-method record filled by mdb_class_enum_methods.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct MdbMethodRecord
+        {
+            public IntPtr Method;      // MethodInfo pointer
+            public IntPtr Name;        // ANSI string pointer
+            public IntPtr ReturnType;  // Il2CppType pointer
+            public ulong Rva;          // Body RVA relative to GameAssembly base (0 if none)
+            public int ParamCount;
+            public int Flags;          // MethodAttributes flags
+        }
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int mdb_class_enum_fields(IntPtr klass, [Out] MdbFieldRecord[] records, int cap);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        private static extern int mdb_class_enum_methods(IntPtr klass, [Out] MdbMethodRecord[] records, int cap);
+
+        /// <summary>
+        /// Enumerate every field of a class in two native calls (count + fill)
+        /// instead of get-by-index/name/offset/type transitions per member.
+        /// </summary>
+        public static MdbFieldRecord[] EnumClassFields(IntPtr klass)
+        {
+            int total = mdb_class_enum_fields(klass, null, 0);
+            if (total <= 0) return new MdbFieldRecord[0];
+
+            var records = new MdbFieldRecord[total];
+            int written = mdb_class_enum_fields(klass, records, total);
+            if (written < total)
+                Array.Resize(ref records, Math.Max(written, 0));
+            return records;
+        }
+
+        /// <summary>
+        /// Enumerate every method of a class in two native calls (count + fill).
+        /// </summary>
+        public static MdbMethodRecord[] EnumClassMethods(IntPtr klass)
+        {
+            int total = mdb_class_enum_methods(klass, null, 0);
+            if (total <= 0) return new MdbMethodRecord[0];
+
+            var records = new MdbMethodRecord[total];
+            int written = mdb_class_enum_methods(klass, records, total);
+            if (written < total)
+                Array.Resize(ref records, Math.Max(written, 0));
+            return records;
+        }
+
         /// <summary>Get class flags (access, sealed, abstract, interface, etc.).</summary>
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int mdb_class_get_flags(IntPtr klass);
@@ -432,20 +432,18 @@ namespace GameSDK.Injection
         /// </summary>
         public static void AddTypeToLookup(IntPtr classPtr, string ns, string name)
         {
-            int assemblyCount = Il2CppBridge.mdb_get_assembly_count();
-            LogVerbose($"[INJECT] Registering {ns}.{name} in {assemblyCount} assembly images");
+            // One native call for the whole assembly list instead of
+            // count + 2 transitions per assembly
+            var assemblies = Il2CppBridge.GetAssemblySnapshot();
+            LogVerbose($"[INJECT] Registering {ns}.{name} in {assemblies.Length} assembly images");
 
             lock (s_ClassNameLookup)
             {
-                for (int i = 0; i < assemblyCount; i++)
+                foreach (var info in assemblies)
                 {
-                    IntPtr assembly = Il2CppBridge.mdb_get_assembly(i);
-                    if (assembly == IntPtr.Zero) continue;
+                    if (info.Image == IntPtr.Zero) continue;
 
-                    IntPtr image = Il2CppBridge.mdb_assembly_get_image(assembly);
-                    if (image == IntPtr.Zero) continue;
-
-                    s_ClassNameLookup[(ns, name, image)] = classPtr;
+                    s_ClassNameLookup[(ns, name, info.Image)] = classPtr;
                 }
 
                 // Also register against our fake image
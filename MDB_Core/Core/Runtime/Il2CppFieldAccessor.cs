@@ -199,6 +199,59 @@ namespace GameSDK
             return value != null;
         }
 
+        // ==============================
+        // Direct-Offset Field Access Support
+        // ==============================
+        // Generated wrappers cache each field's offset and then read/write
+        // through raw pointer arithmetic per access, instead of resolving
+        // class -> field -> offset on every GetField/SetField call. This
+        // helper does the one-time resolution.
+
+        /// <summary>
+        /// Resolve a field's byte offset within its declaring class for a
+        /// cached-offset accessor in a generated wrapper.
+        /// </summary>
+        /// <param name="ns">Namespace of the class ("Global" for none)</param>
+        /// <param name="typeName">Class name</param>
+        /// <param name="fieldName">The IL2CPP field name</param>
+        /// <returns>The field offset in bytes, or -1 if the field cannot be
+        /// resolved — the caller then falls back to GetField/SetField</returns>
+        public static int ResolveFieldOffset(string ns, string typeName, string fieldName)
+        {
+            EnsureInitialized();
+
+            try
+            {
+                IntPtr klass = GetOrCacheClass(DefaultAssembly, ns, typeName);
+                if (klass == IntPtr.Zero)
+                {
+                    LogDebug($"ResolveFieldOffset: class not found: {ns}.{typeName}");
+                    return -1;
+                }
+
+                IntPtr field = Il2CppBridge.mdb_get_field(klass, fieldName);
+                if (field == IntPtr.Zero)
+                {
+                    LogDebug($"ResolveFieldOffset: field not found: {ns}.{typeName}.{fieldName}");
+                    return -1;
+                }
+
+                int offset = Il2CppBridge.mdb_get_field_offset(field);
+                if (offset < 0)
+                {
+                    LogDebug($"ResolveFieldOffset: invalid offset for {ns}.{typeName}.{fieldName}");
+                    return -1;
+                }
+
+                return offset;
+            }
+            catch (Exception ex)
+            {
+                LogDebug($"ResolveFieldOffset({ns}.{typeName}.{fieldName}): {ex.Message}");
+                return -1;
+            }
+        }
+
         // ==============================
         // Field Marshaling Helpers
         // ==============================
@@ -566,6 +566,65 @@ namespace GameSDK
             }
         }
 
+        // ==============================
+        // Direct-Pointer Call Support
+        // ==============================
+        // Generated wrappers call blittable-signature methods through typed
+        // native delegates instead of mdb_invoke_method, skipping boxing and
+        // argument-array construction per call. This helper does the one-time
+        // resolution: class -> method -> m_pMethodPointer.
+
+        /// <summary>
+        /// Resolve the native function pointer of a method for a direct-call
+        /// stub in a generated wrapper. Returns the function pointer and the
+        /// MethodInfo* (passed as the trailing argument of every IL2CPP call),
+        /// or IntPtr.Zero if the method cannot be resolved — the caller then
+        /// falls back to the runtime-invoke path.
+        /// </summary>
+        /// <param name="ns">Namespace of the class ("Global" for none)</param>
+        /// <param name="typeName">Class name</param>
+        /// <param name="methodName">IL2CPP method name</param>
+        /// <param name="paramCount">Number of parameters (overload resolution)</param>
+        /// <param name="methodInfo">Receives the MethodInfo* on success</param>
+        /// <returns>The native function pointer, or IntPtr.Zero on failure</returns>
+        public static IntPtr ResolveDirectCall(string ns, string typeName, string methodName, int paramCount, out IntPtr methodInfo)
+        {
+            methodInfo = IntPtr.Zero;
+            EnsureInitialized();
+
+            try
+            {
+                IntPtr klass = GetOrCacheClass(DefaultAssembly, ns, typeName);
+                if (klass == IntPtr.Zero)
+                {
+                    LogDebug($"ResolveDirectCall: class not found: {ns}.{typeName}");
+                    return IntPtr.Zero;
+                }
+
+                IntPtr method = GetOrCacheMethod(klass, methodName, paramCount);
+                if (method == IntPtr.Zero)
+                {
+                    LogDebug($"ResolveDirectCall: method not found: {ns}.{typeName}.{methodName}");
+                    return IntPtr.Zero;
+                }
+
+                IntPtr methodPtr = Il2CppBridge.mdb_get_method_pointer(method);
+                if (methodPtr == IntPtr.Zero)
+                {
+                    LogDebug($"ResolveDirectCall: no native pointer for {ns}.{typeName}.{methodName}");
+                    return IntPtr.Zero;
+                }
+
+                methodInfo = method;
+                return methodPtr;
+            }
+            catch (Exception ex)
+            {
+                LogDebug($"ResolveDirectCall({ns}.{typeName}.{methodName}): {ex.Message}");
+                return IntPtr.Zero;
+            }
+        }
+
         // ==============================
         // RVA-based Method Invocation
         // ==============================
@@ -4,6 +4,7 @@
 // Base class and exception type for IL2CPP objects
 
 using System;
+using System.Text;
 
 namespace GameSDK
 {
@@ -131,6 +132,48 @@ namespace GameSDK
         /// </summary>
         public string NativeMessage { get; }
 
+        private bool _detailsExtracted;
+        private string _il2cppType = string.Empty;
+        private string _il2cppMessage = string.Empty;
+        private string _il2cppStackTrace = string.Empty;
+
+        /// <summary>
+        /// Namespace-qualified type name of the thrown IL2CPP exception.
+        /// Extracted lazily in a single native call shared with
+        /// Il2CppMessage/Il2CppStackTrace; empty when unavailable.
+        /// </summary>
+        public string Il2CppType { get { ExtractDetails(); return _il2cppType; } }
+
+        /// <summary>
+        /// Message of the thrown IL2CPP exception (lazily extracted).
+        /// </summary>
+        public string Il2CppMessage { get { ExtractDetails(); return _il2cppMessage; } }
+
+        /// <summary>
+        /// Stack trace of the thrown IL2CPP exception (lazily extracted).
+        /// </summary>
+        public string Il2CppStackTrace { get { ExtractDetails(); return _il2cppStackTrace; } }
+
+        private void ExtractDetails()
+        {
+            if (_detailsExtracted) return;
+            _detailsExtracted = true;
+            if (NativeException == IntPtr.Zero) return;
+
+            // One transition extracts all three fields; before this, each
+            // detail was a separate managed invoke against the exception
+            var type = new StringBuilder(256);
+            var message = new StringBuilder(1024);
+            var stack = new StringBuilder(8192);
+            if (Il2CppBridge.mdb_exception_get_info(NativeException,
+                type, type.Capacity, message, message.Capacity, stack, stack.Capacity))
+            {
+                _il2cppType = type.ToString();
+                _il2cppMessage = message.ToString();
+                _il2cppStackTrace = stack.ToString();
+            }
+        }
+
         /// <summary>
         /// Creates an IL2CPP exception with a message.
         /// </summary>
@@ -535,20 +535,18 @@ namespace GameSDK.Deobfuscation
 
         private static string GenerateFieldFingerprint(IntPtr klass)
         {
-            int count = Il2CppBridge.mdb_class_get_field_count(klass);
-            if (count == 0) return "F:0";
+            // Two native calls for the whole member list instead of
+            // get-by-index + offset/type/static transitions per field
+            var records = Il2CppBridge.EnumClassFields(klass);
+            if (records.Length == 0) return "F:0";
 
             var fields = new List<(string type, int offset)>();
-            for (int i = 0; i < count; i++)
+            foreach (var rec in records)
             {
-                IntPtr field = Il2CppBridge.mdb_class_get_field_by_index(klass, i);
-                if (field == IntPtr.Zero) continue;
-                if (Il2CppBridge.mdb_field_is_static(field)) continue;
-
-                int offset = Il2CppBridge.mdb_field_get_offset(field);
-                IntPtr ft = Il2CppBridge.mdb_field_get_type(field);
-                string tn = ft != IntPtr.Zero ? NormalizeName(MarshalString(Il2CppBridge.mdb_type_get_name(ft))) : "?";
-                fields.Add((tn, offset));
+                if (rec.IsStatic != 0) continue;
+
+                string tn = rec.Type != IntPtr.Zero ? NormalizeName(MarshalString(Il2CppBridge.mdb_type_get_name(rec.Type))) : "?";
+                fields.Add((tn, rec.Offset));
             }
 
             fields.Sort((a, b) => a.offset.CompareTo(b.offset));
@@ -558,23 +556,18 @@ namespace GameSDK.Deobfuscation
 
         private static string GenerateMethodFingerprint(IntPtr klass)
         {
-            int count = Il2CppBridge.mdb_class_get_method_count(klass);
-            if (count == 0) return "M:0";
+            var records = Il2CppBridge.EnumClassMethods(klass);
+            if (records.Length == 0) return "M:0";
 
             var patterns = new Dictionary<string, int>();
-            for (int i = 0; i < count; i++)
+            foreach (var rec in records)
             {
-                IntPtr method = Il2CppBridge.mdb_class_get_method_by_index(klass, i);
-                if (method == IntPtr.Zero) continue;
-
-                string name = MarshalString(Il2CppBridge.mdb_method_get_name_str(method));
+                string name = MarshalString(rec.Name);
                 if (name != null && name.StartsWith(".")) continue; // Skip constructors
 
-                IntPtr ret = Il2CppBridge.mdb_method_get_return_type(method);
-                string retName = ret != IntPtr.Zero ? NormalizeName(MarshalString(Il2CppBridge.mdb_type_get_name(ret))) : "void";
-                int pc = Il2CppBridge.mdb_method_get_param_count(method);
+                string retName = rec.ReturnType != IntPtr.Zero ? NormalizeName(MarshalString(Il2CppBridge.mdb_type_get_name(rec.ReturnType))) : "void";
 
-                string key = $"{retName}({pc})";
+                string key = $"{retName}({rec.ParamCount})";
                 patterns.TryGetValue(key, out int c);
                 patterns[key] = c + 1;
             }
@@ -53,6 +53,13 @@ namespace GameSDK.ModHost
         /// Note: This runs on Unity's main thread during the rendering phase.
         /// </summary>
         public virtual void OnGUI() { }
+
+        /// <summary>
+        /// Called once when the mod is being unloaded (hot reload or game shutdown).
+        /// Use to release resources and undo any state OnLoad set up.
+        /// Hooks registered via patch attributes are removed automatically.
+        /// </summary>
+        public virtual void OnUnload() { }
     }
 
     /// <summary>
@@ -19,11 +19,20 @@ namespace GameSDK.ModHost
     /// </summary>
     public static class ModManager
     {
-        private static readonly List<ModBase> _loadedMods = new List<ModBase>();
+        // The dispatch loops iterate this without locking from the main
+        // thread; hot reload publishes a fully built replacement list and
+        // swaps the reference, so readers always see a consistent snapshot
+        private static volatile List<ModBase> _loadedMods = new List<ModBase>();
         private static readonly ModLogger _logger = new ModLogger("ModManager");
         private static bool _initialized = false;
         private static Thread _updateThread;
         private static volatile bool _running = false;
+
+        // Loaded mod assemblies keyed by DLL path, so a reload can tear down
+        // the previous assembly's patches before loading the new bytes
+        private static readonly Dictionary<string, Assembly> _assembliesByPath =
+            new Dictionary<string, Assembly>(StringComparer.OrdinalIgnoreCase);
+        private static readonly object _reloadLock = new object();
         
         // Paths
         private static string _mdbDirectory;
@@ -131,7 +140,8 @@ namespace GameSDK.ModHost
                     byte[] assemblyBytes = File.ReadAllBytes(dllPath);
                     Assembly assembly = Assembly.Load(assemblyBytes);
                     loadedAssemblies.Add((assembly, dllPath));
-                    
+                    _assembliesByPath[dllPath] = assembly;
+
                     // Log discovered mods
                     foreach (var modType in GetModTypesFromAssembly(assembly))
                     {
@@ -160,7 +170,7 @@ namespace GameSDK.ModHost
             {
                 try
                 {
-                    LoadModTypesFromAssembly(assembly, dllPath);
+                    LoadModTypesFromAssembly(assembly, dllPath, _loadedMods);
                 }
                 catch (Exception ex)
                 {
@@ -183,7 +193,7 @@ namespace GameSDK.ModHost
             return allTypes.Where(t => t != null && typeof(ModBase).IsAssignableFrom(t) && !t.IsAbstract);
         }
         
-        private static void LoadModTypesFromAssembly(Assembly assembly, string dllPath)
+        private static void LoadModTypesFromAssembly(Assembly assembly, string dllPath, List<ModBase> target)
         {
             string fileName = Path.GetFileName(dllPath);
 
@@ -212,7 +222,7 @@ namespace GameSDK.ModHost
             {
                 try
                 {
-                    LoadModType(modType, dllPath);
+                    LoadModType(modType, dllPath, target);
                 }
                 catch (Exception ex)
                 {
@@ -224,7 +234,7 @@ namespace GameSDK.ModHost
         /// <summary>
         /// Instantiate and initialize a mod type.
         /// </summary>
-        private static void LoadModType(Type modType, string dllPath)
+        private static void LoadModType(Type modType, string dllPath, List<ModBase> target)
         {
             // Get mod info from attribute
             ModInfo info = GetModInfo(modType, dllPath);
@@ -246,7 +256,7 @@ namespace GameSDK.ModHost
                 return;
             }
 
-            _loadedMods.Add(mod);
+            target.Add(mod);
         }
 
         /// <summary>
@@ -278,6 +288,102 @@ namespace GameSDK.ModHost
             return info;
         }
 
+        // ==============================
+        // Hot reload (called by the native file watcher)
+        // ==============================
+
+        /// <summary>
+        /// Reload a single mod DLL in place: unload its mod instances, remove
+        /// the previous assembly's hooks, load the new bytes, and re-register
+        /// patches and mods. Called by the native bridge via
+        /// ExecuteInDefaultAppDomain when the watcher sees the file change.
+        /// Note: .NET Framework cannot unload an assembly from the AppDomain,
+        /// so the old assembly stays resident but inert — its hooks are gone
+        /// and nothing references its mod instances.
+        /// </summary>
+        /// <param name="args">Full path of the changed mod DLL</param>
+        /// <returns>0 on success, non-zero on failure</returns>
+        public static int ReloadMod(string args)
+        {
+            if (!_initialized || string.IsNullOrEmpty(args))
+            {
+                return 1;
+            }
+
+            lock (_reloadLock)
+            {
+                try
+                {
+                    string dllPath = Path.GetFullPath(args);
+                    string fileName = Path.GetFileName(dllPath);
+                    ModLogger.Section($"Reloading {fileName}", ConsoleColor.Magenta);
+
+                    // Unload the old instances and publish a list without them
+                    // before touching the hooks, so the dispatch loops never
+                    // call into a mod whose hooks are mid-teardown
+                    var survivors = new List<ModBase>();
+                    foreach (ModBase mod in _loadedMods)
+                    {
+                        if (!string.Equals(mod.Info?.FilePath, dllPath, StringComparison.OrdinalIgnoreCase))
+                        {
+                            survivors.Add(mod);
+                            continue;
+                        }
+                        try
+                        {
+                            mod.OnUnload();
+                        }
+                        catch (Exception ex)
+                        {
+                            mod.Logger?.Error($"OnUnload exception: {ex.Message}");
+                        }
+                    }
+                    _loadedMods = survivors;
+
+                    if (_assembliesByPath.TryGetValue(dllPath, out Assembly oldAssembly))
+                    {
+                        PatchProcessor.RemovePatchesFromAssembly(oldAssembly);
+                    }
+
+                    Assembly assembly = Assembly.Load(ReadAllBytesWithRetry(dllPath));
+                    _assembliesByPath[dllPath] = assembly;
+
+                    PatchProcessor.ProcessAssembly(assembly);
+
+                    var updated = new List<ModBase>(_loadedMods);
+                    LoadModTypesFromAssembly(assembly, dllPath, updated);
+                    _loadedMods = updated;
+
+                    _logger.Info($"{fileName} reloaded ({_loadedMods.Count} mod(s) active)");
+                    return 0;
+                }
+                catch (Exception ex)
+                {
+                    _logger.Error($"Reload failed for {args}", ex);
+                    return 1;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Read a file that a build may still be writing: retry briefly on
+        /// sharing violations before giving up.
+        /// </summary>
+        private static byte[] ReadAllBytesWithRetry(string path)
+        {
+            for (int attempt = 0; ; attempt++)
+            {
+                try
+                {
+                    return File.ReadAllBytes(path);
+                }
+                catch (IOException) when (attempt < 5)
+                {
+                    Thread.Sleep(100);
+                }
+            }
+        }
+
         // ==============================
         // Main-thread dispatch (called by MDBRunner trampolines)
         // ==============================
@@ -484,6 +590,17 @@ _logger.Info("Shutting down");
             _running = false;
             _updateThread?.Join(1000);
 
+            foreach (ModBase mod in _loadedMods)
+            {
+                try
+                {
+                    mod.OnUnload();
+                }
+                catch (Exception ex)
+                {
+                    mod.Logger?.Error($"OnUnload exception: {ex.Message}");
+                }
+            }
             _loadedMods.Clear();
             _initialized = false;
 
@@ -0,0 +1,189 @@
+// ==============================
+// ArgFramePool - Pooled Argument Capture Frames for Hook Dispatch
+// ==============================
+// Every detour hit used to allocate a fresh IntPtr[] to carry the captured
+// arguments through ExecutePatch. For hooks on hot methods (thousands of hits
+// per second) that garbage pressure is measurable, and allocating inside a
+// detour is a reentrancy hazard when the hooked function is allocator-adjacent.
+// This pool keeps a small per-thread freelist of fixed-arity frames so steady
+// state dispatch performs zero heap allocations. Per-thread storage makes the
+// freelist lock-free by construction - no other thread ever touches it.
+
+using System;
+using System.Collections.Generic;
+
+namespace GameSDK.ModHost.Patching
+{
+    /// <summary>
+    /// Per-thread pool of fixed-size argument capture frames used by the
+    /// detour dispatch path. Frames are rented via the Capture overloads
+    /// (one per detour arity, mirroring Detour0-Detour14) and returned by
+    /// ExecutePatch once the patch chain has run. A missed release is
+    /// benign - the frame is simply collected and a fresh one allocated.
+    /// </summary>
+    internal static class ArgFramePool
+    {
+        /// <summary>
+        /// Highest argument count a detour can capture (matches Detour14).
+        /// </summary>
+        private const int MaxArity = 14;
+
+        /// <summary>
+        /// Cap on retained frames per arity per thread. Nested hooks on the
+        /// same thread rarely go deeper than a couple of levels, so anything
+        /// beyond this is returned to the GC instead of hoarded.
+        /// </summary>
+        private const int MaxFramesPerArity = 4;
+
+        /// <summary>
+        /// Per-thread freelists indexed by frame length. Lazily created on
+        /// first capture from each thread.
+        /// </summary>
+        [ThreadStatic]
+        private static Stack<IntPtr[]>[] _freelists;
+
+        private static IntPtr[] Rent(int length)
+        {
+            var freelists = _freelists;
+            if (freelists == null)
+            {
+                freelists = new Stack<IntPtr[]>[MaxArity + 1];
+                _freelists = freelists;
+            }
+
+            var freelist = freelists[length];
+            if (freelist != null && freelist.Count > 0)
+                return freelist.Pop();
+
+            return new IntPtr[length];
+        }
+
+        /// <summary>
+        /// Return a frame to the current thread's freelist. Zero-length
+        /// frames (Array.Empty) are ignored so ExecutePatch can release
+        /// unconditionally.
+        /// </summary>
+        public static void Release(IntPtr[] frame)
+        {
+            if (frame == null || frame.Length == 0 || frame.Length > MaxArity)
+                return;
+
+            var freelists = _freelists;
+            if (freelists == null)
+                return;
+
+            var freelist = freelists[frame.Length];
+            if (freelist == null)
+            {
+                freelist = new Stack<IntPtr[]>(MaxFramesPerArity);
+                freelists[frame.Length] = freelist;
+            }
+
+            if (freelist.Count < MaxFramesPerArity)
+                freelist.Push(frame);
+        }
+
+        public static IntPtr[] Capture()
+        {
+            return Array.Empty<IntPtr>();
+        }
+
+        public static IntPtr[] Capture(IntPtr a0)
+        {
+            var f = Rent(1);
+            f[0] = a0;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1)
+        {
+            var f = Rent(2);
+            f[0] = a0; f[1] = a1;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2)
+        {
+            var f = Rent(3);
+            f[0] = a0; f[1] = a1; f[2] = a2;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3)
+        {
+            var f = Rent(4);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4)
+        {
+            var f = Rent(5);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5)
+        {
+            var f = Rent(6);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6)
+        {
+            var f = Rent(7);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7)
+        {
+            var f = Rent(8);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8)
+        {
+            var f = Rent(9);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8, IntPtr a9)
+        {
+            var f = Rent(10);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8; f[9] = a9;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8, IntPtr a9, IntPtr a10)
+        {
+            var f = Rent(11);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8; f[9] = a9; f[10] = a10;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8, IntPtr a9, IntPtr a10, IntPtr a11)
+        {
+            var f = Rent(12);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8; f[9] = a9; f[10] = a10; f[11] = a11;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8, IntPtr a9, IntPtr a10, IntPtr a11, IntPtr a12)
+        {
+            var f = Rent(13);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8; f[9] = a9; f[10] = a10; f[11] = a11; f[12] = a12;
+            return f;
+        }
+
+        public static IntPtr[] Capture(IntPtr a0, IntPtr a1, IntPtr a2, IntPtr a3, IntPtr a4, IntPtr a5, IntPtr a6, IntPtr a7, IntPtr a8, IntPtr a9, IntPtr a10, IntPtr a11, IntPtr a12, IntPtr a13)
+        {
+            var f = Rent(14);
+            f[0] = a0; f[1] = a1; f[2] = a2; f[3] = a3; f[4] = a4; f[5] = a5; f[6] = a6; f[7] = a7; f[8] = a8; f[9] = a9; f[10] = a10; f[11] = a11; f[12] = a12; f[13] = a13;
+            return f;
+        }
+    }
+}
@@ -414,7 +414,7 @@ namespace GameSDK.ModHost.Patching
         {
             return (IntPtr methodInfo) =>
             {
-                return ExecutePatch(patch, IntPtr.Zero, Array.Empty<IntPtr>(), methodInfo,
+                return ExecutePatch(patch, IntPtr.Zero, ArgFramePool.Capture(), methodInfo,
                     (modifiedArgs) => ((Detour0)patch.OriginalDelegate)(methodInfo));
             };
         }
@@ -424,7 +424,7 @@ namespace GameSDK.ModHost.Patching
             return (IntPtr arg0, IntPtr methodInfo) =>
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
-                IntPtr[] args = patch.IsStatic ? new[] { arg0 } : Array.Empty<IntPtr>();
+                IntPtr[] args = patch.IsStatic ? ArgFramePool.Capture(arg0) : ArgFramePool.Capture();
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -440,7 +440,7 @@ namespace GameSDK.ModHost.Patching
             return (IntPtr arg0, IntPtr arg1, IntPtr methodInfo) =>
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
-                IntPtr[] args = patch.IsStatic ? new[] { arg0, arg1 } : new[] { arg1 };
+                IntPtr[] args = patch.IsStatic ? ArgFramePool.Capture(arg0, arg1) : ArgFramePool.Capture(arg1);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -458,7 +458,7 @@ namespace GameSDK.ModHost.Patching
             return (IntPtr arg0, IntPtr arg1, IntPtr arg2, IntPtr methodInfo) =>
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
-                IntPtr[] args = patch.IsStatic ? new[] { arg0, arg1, arg2 } : new[] { arg1, arg2 };
+                IntPtr[] args = patch.IsStatic ? ArgFramePool.Capture(arg0, arg1, arg2) : ArgFramePool.Capture(arg1, arg2);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -476,7 +476,7 @@ namespace GameSDK.ModHost.Patching
             return (IntPtr arg0, IntPtr arg1, IntPtr arg2, IntPtr arg3, IntPtr methodInfo) =>
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
-                IntPtr[] args = patch.IsStatic ? new[] { arg0, arg1, arg2, arg3 } : new[] { arg1, arg2, arg3 };
+                IntPtr[] args = patch.IsStatic ? ArgFramePool.Capture(arg0, arg1, arg2, arg3) : ArgFramePool.Capture(arg1, arg2, arg3);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -494,7 +494,7 @@ namespace GameSDK.ModHost.Patching
             return (IntPtr arg0, IntPtr arg1, IntPtr arg2, IntPtr arg3, IntPtr arg4, IntPtr methodInfo) =>
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
-                IntPtr[] args = patch.IsStatic ? new[] { arg0, arg1, arg2, arg3, arg4 } : new[] { arg1, arg2, arg3, arg4 };
+                IntPtr[] args = patch.IsStatic ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4) : ArgFramePool.Capture(arg1, arg2, arg3, arg4);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -513,8 +513,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -533,8 +533,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -553,8 +553,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -573,8 +573,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -593,8 +593,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -613,8 +613,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -633,8 +633,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -653,8 +653,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -673,8 +673,8 @@ namespace GameSDK.ModHost.Patching
             {
                 IntPtr instance = patch.IsStatic ? IntPtr.Zero : arg0;
                 IntPtr[] args = patch.IsStatic 
-                    ? new[] { arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13 } 
-                    : new[] { arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13 };
+                    ? ArgFramePool.Capture(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13) 
+                    : ArgFramePool.Capture(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
                 
                 return ExecutePatch(patch, instance, args, methodInfo,
                     (modifiedArgs) => {
@@ -905,6 +905,11 @@ namespace GameSDK.ModHost.Patching
                 ModLogger.LogInternal("PatchProcessor", $"[ERROR] Exception in patch {patch.PatchClass.Name}: {caughtException.Message}");
             }
 
+            // The patch chain is done with the captured arguments - recycle the
+            // frame for the next hit on this thread. Nothing above escapes the
+            // array: patch methods receive converted copies, not the frame itself.
+            ArgFramePool.Release(args);
+
             return result;
         }
 